@@ -632,9 +632,19 @@ ifeq ($(strip $(VIA_ENABLE)), yes)
     TRI_LAYER_ENABLE := yes
 endif
 
+ifeq ($(strip $(DYNAMIC_KEYMAP_ENABLE)), yes)
+    ifeq ($(strip $(DYNAMIC_KEYMAP_RAM_MIRROR)), yes)
+        DEFERRED_EXEC_ENABLE := yes
+        OPT_DEFS += -DDYNAMIC_KEYMAP_RAM_MIRROR
+    endif
+endif
+
 VALID_CUSTOM_MATRIX_TYPES:= yes lite no
 
 CUSTOM_MATRIX ?= no
+ifneq ($(strip $(CUSTOM_MATRIX)), no)
+    OPT_DEFS += -DCUSTOM_MATRIX
+endif
 ifneq ($(strip $(CUSTOM_MATRIX)), yes)
     ifeq ($(filter $(CUSTOM_MATRIX),$(VALID_CUSTOM_MATRIX_TYPES)),)
         $(call CATASTROPHIC_ERROR,Invalid CUSTOM_MATRIX,CUSTOM_MATRIX="$(CUSTOM_MATRIX)" is not a valid custom matrix type)
@@ -35,12 +35,15 @@ GENERIC_FEATURES = \
     GRAVE_ESC \
     HAPTIC \
     KEY_LOCK \
+    KEY_TRACE \
     KEY_OVERRIDE \
     LEADER \
     MAGIC \
+    MATRIX_WAKE \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
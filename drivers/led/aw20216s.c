@@ -18,8 +18,12 @@
 #include "aw20216s.h"
 #include "wait.h"
 #include "spi_master.h"
+#include "dirty_chunks.h"
 
 #define AW20216S_PWM_REGISTER_COUNT 216
+// One row of 18 current sinks
+#define AW20216S_PWM_CHUNK_SIZE 18
+#define AW20216S_PWM_CHUNK_COUNT (AW20216S_PWM_REGISTER_COUNT / AW20216S_PWM_CHUNK_SIZE)
 
 #ifndef AW20216S_CONFIGURATION
 #    define AW20216S_CONFIGURATION (AW20216S_CONFIGURATION_SWSEL_1_12 | AW20216S_CONFIGURATION_CHIPEN)
@@ -47,12 +51,12 @@
 
 typedef struct aw20216s_driver_t {
     uint8_t pwm_buffer[AW20216S_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[DIRTY_CHUNKS_SIZE(AW20216S_PWM_REGISTER_COUNT, AW20216S_PWM_CHUNK_SIZE)];
 } PACKED aw20216s_driver_t;
 
 aw20216s_driver_t driver_buffers[AW20216S_DRIVER_COUNT] = {{
     .pwm_buffer       = {0},
-    .pwm_buffer_dirty = false,
+    .pwm_buffer_dirty = {0},
 }};
 
 bool aw20216s_write(pin_t cs_pin, uint8_t page, uint8_t reg, uint8_t* data, uint8_t len) {
@@ -147,7 +151,9 @@ void aw20216s_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
     driver_buffers[led.driver].pwm_buffer[led.r] = red;
     driver_buffers[led.driver].pwm_buffer[led.g] = green;
     driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-    driver_buffers[led.driver].pwm_buffer_dirty  = true;
+    dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.r / AW20216S_PWM_CHUNK_SIZE);
+    dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.g / AW20216S_PWM_CHUNK_SIZE);
+    dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.b / AW20216S_PWM_CHUNK_SIZE);
 }
 
 void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
@@ -157,9 +163,19 @@ void aw20216s_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void aw20216s_update_pwm_buffers(pin_t cs_pin, uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, 0, driver_buffers[index].pwm_buffer, AW20216S_PWM_REGISTER_COUNT);
-        driver_buffers[index].pwm_buffer_dirty = false;
+    // Send each run of changed rows in a single transfer
+    for (uint8_t start = 0; start < AW20216S_PWM_CHUNK_COUNT; start++) {
+        if (!dirty_chunks_take(driver_buffers[index].pwm_buffer_dirty, start)) {
+            continue;
+        }
+
+        uint8_t end = start + 1;
+        while (end < AW20216S_PWM_CHUNK_COUNT && dirty_chunks_take(driver_buffers[index].pwm_buffer_dirty, end)) {
+            end++;
+        }
+
+        aw20216s_write(cs_pin, AW20216S_PAGE_PWM, start * AW20216S_PWM_CHUNK_SIZE, driver_buffers[index].pwm_buffer + start * AW20216S_PWM_CHUNK_SIZE, (end - start) * AW20216S_PWM_CHUNK_SIZE);
+        start = end;
     }
 }
 
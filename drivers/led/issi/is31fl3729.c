@@ -18,10 +18,12 @@
 
 #include "is31fl3729.h"
 #include "i2c_master.h"
+#include "dirty_chunks.h"
 #include "gpio.h"
 #include "wait.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
+#define IS31FL3729_PWM_CHUNK_SIZE 13
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
 
 #ifndef IS31FL3729_I2C_TIMEOUT
@@ -81,14 +83,14 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[DIRTY_CHUNKS_SIZE(IS31FL3729_PWM_REGISTER_COUNT, IS31FL3729_PWM_CHUNK_SIZE)];
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = {0},
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -99,21 +101,25 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
     }
 #else
-    i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3729_I2C_TIMEOUT);
+    i2c_write_register_async(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3729_I2C_TIMEOUT);
 #endif
 }
 
 void is31fl3729_write_pwm_buffer(uint8_t index) {
-    // Transmit PWM registers in 11 transfers of 13 bytes.
+    // Transmit the changed PWM registers, in transfers of 13 bytes.
 
     // Iterate over the pwm_buffer contents at 13 byte intervals.
-    for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
+    for (uint8_t i = 0; i < IS31FL3729_PWM_REGISTER_COUNT; i += IS31FL3729_PWM_CHUNK_SIZE) {
+        if (!dirty_chunks_take(driver_buffers[index].pwm_buffer_dirty, i / IS31FL3729_PWM_CHUNK_SIZE)) {
+            continue;
+        }
+
 #if IS31FL3729_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3729_PWM_CHUNK_SIZE, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
+        i2c_write_register_async(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, IS31FL3729_PWM_CHUNK_SIZE, IS31FL3729_I2C_TIMEOUT);
 #endif
     }
 }
@@ -167,7 +173,9 @@ void is31fl3729_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.r / IS31FL3729_PWM_CHUNK_SIZE);
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.g / IS31FL3729_PWM_CHUNK_SIZE);
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.b / IS31FL3729_PWM_CHUNK_SIZE);
     }
 }
 
@@ -195,10 +203,8 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t red, uint8_t green,
 }
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (dirty_chunks_any(driver_buffers[index].pwm_buffer_dirty, sizeof(driver_buffers[index].pwm_buffer_dirty))) {
         is31fl3729_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -19,10 +19,12 @@
 
 #include "is31fl3733.h"
 #include "i2c_master.h"
+#include "dirty_chunks.h"
 #include "gpio.h"
 #include "wait.h"
 
 #define IS31FL3733_PWM_REGISTER_COUNT 192
+#define IS31FL3733_PWM_CHUNK_SIZE 16
 #define IS31FL3733_LED_CONTROL_REGISTER_COUNT 24
 
 #ifndef IS31FL3733_I2C_TIMEOUT
@@ -96,14 +98,14 @@ const uint8_t driver_sync[IS31FL3733_DRIVER_COUNT] = {
 // probably not worth the extra complexity.
 typedef struct is31fl3733_driver_t {
     uint8_t pwm_buffer[IS31FL3733_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[DIRTY_CHUNKS_SIZE(IS31FL3733_PWM_REGISTER_COUNT, IS31FL3733_PWM_CHUNK_SIZE)];
     uint8_t led_control_buffer[IS31FL3733_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3733_driver_t;
 
 is31fl3733_driver_t driver_buffers[IS31FL3733_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
@@ -114,7 +116,7 @@ void is31fl3733_write_register(uint8_t index, uint8_t reg, uint8_t data) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3733_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
     }
 #else
-    i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3733_I2C_TIMEOUT);
+    i2c_write_register_async(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3733_I2C_TIMEOUT);
 #endif
 }
 
@@ -125,16 +127,20 @@ void is31fl3733_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3733_write_pwm_buffer(uint8_t index) {
     // Assumes page 1 is already selected.
-    // Transmit PWM registers in 12 transfers of 16 bytes.
+    // Transmit the changed PWM registers, in transfers of 16 bytes.
 
     // Iterate over the pwm_buffer contents at 16 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3733_PWM_REGISTER_COUNT; i += 16) {
+    for (uint8_t i = 0; i < IS31FL3733_PWM_REGISTER_COUNT; i += IS31FL3733_PWM_CHUNK_SIZE) {
+        if (!dirty_chunks_take(driver_buffers[index].pwm_buffer_dirty, i / IS31FL3733_PWM_CHUNK_SIZE)) {
+            continue;
+        }
+
 #if IS31FL3733_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3733_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3733_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, IS31FL3733_PWM_CHUNK_SIZE, IS31FL3733_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, 16, IS31FL3733_I2C_TIMEOUT);
+        i2c_write_register_async(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer + i, IS31FL3733_PWM_CHUNK_SIZE, IS31FL3733_I2C_TIMEOUT);
 #endif
     }
 }
@@ -211,7 +217,9 @@ void is31fl3733_set_color(int index, uint8_t red, uint8_t green, uint8_t blue) {
         driver_buffers[led.driver].pwm_buffer[led.r] = red;
         driver_buffers[led.driver].pwm_buffer[led.g] = green;
         driver_buffers[led.driver].pwm_buffer[led.b] = blue;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.r / IS31FL3733_PWM_CHUNK_SIZE);
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.g / IS31FL3733_PWM_CHUNK_SIZE);
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.b / IS31FL3733_PWM_CHUNK_SIZE);
     }
 }
 
@@ -252,12 +260,10 @@ void is31fl3733_set_led_control_register(uint8_t index, bool red, bool green, bo
 }
 
 void is31fl3733_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (dirty_chunks_any(driver_buffers[index].pwm_buffer_dirty, sizeof(driver_buffers[index].pwm_buffer_dirty))) {
         is31fl3733_select_page(index, IS31FL3733_COMMAND_PWM);
 
         is31fl3733_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -20,10 +20,12 @@
 
 #include "is31fl3743a-mono.h"
 #include "i2c_master.h"
+#include "dirty_chunks.h"
 #include "gpio.h"
 #include "wait.h"
 
 #define IS31FL3743A_PWM_REGISTER_COUNT 198
+#define IS31FL3743A_PWM_CHUNK_SIZE 18
 #define IS31FL3743A_SCALING_REGISTER_COUNT 198
 
 #ifndef IS31FL3743A_I2C_TIMEOUT
@@ -91,14 +93,14 @@ const uint8_t driver_sync[IS31FL3743A_DRIVER_COUNT] = {
 
 typedef struct is31fl3743a_driver_t {
     uint8_t pwm_buffer[IS31FL3743A_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[DIRTY_CHUNKS_SIZE(IS31FL3743A_PWM_REGISTER_COUNT, IS31FL3743A_PWM_CHUNK_SIZE)];
     uint8_t scaling_buffer[IS31FL3743A_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3743a_driver_t;
 
 is31fl3743a_driver_t driver_buffers[IS31FL3743A_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = {0},
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
@@ -109,7 +111,7 @@ void is31fl3743a_write_register(uint8_t index, uint8_t reg, uint8_t data) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3743A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
     }
 #else
-    i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3743A_I2C_TIMEOUT);
+    i2c_write_register_async(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3743A_I2C_TIMEOUT);
 #endif
 }
 
@@ -120,16 +122,20 @@ void is31fl3743a_select_page(uint8_t index, uint8_t page) {
 
 void is31fl3743a_write_pwm_buffer(uint8_t index) {
     // Assumes page 0 is already selected.
-    // Transmit PWM registers in 11 transfers of 18 bytes.
+    // Transmit the changed PWM registers, in transfers of 18 bytes.
 
     // Iterate over the pwm_buffer contents at 18 byte intervals.
-    for (uint8_t i = 0; i < IS31FL3743A_PWM_REGISTER_COUNT; i += 18) {
+    for (uint8_t i = 0; i < IS31FL3743A_PWM_REGISTER_COUNT; i += IS31FL3743A_PWM_CHUNK_SIZE) {
+        if (!dirty_chunks_take(driver_buffers[index].pwm_buffer_dirty, i / IS31FL3743A_PWM_CHUNK_SIZE)) {
+            continue;
+        }
+
 #if IS31FL3743A_I2C_PERSISTENCE > 0
         for (uint8_t j = 0; j < IS31FL3743A_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, 18, IS31FL3743A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+            if (i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, IS31FL3743A_PWM_CHUNK_SIZE, IS31FL3743A_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
         }
 #else
-        i2c_write_register(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, 18, IS31FL3743A_I2C_TIMEOUT);
+        i2c_write_register_async(i2c_addresses[index] << 1, i + 1, driver_buffers[index].pwm_buffer + i, IS31FL3743A_PWM_CHUNK_SIZE, IS31FL3743A_I2C_TIMEOUT);
 #endif
     }
 }
@@ -198,7 +204,7 @@ void is31fl3743a_set_value(int index, uint8_t value) {
         }
 
         driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        dirty_chunks_mark(driver_buffers[led.driver].pwm_buffer_dirty, led.v / IS31FL3743A_PWM_CHUNK_SIZE);
     }
 }
 
@@ -217,12 +223,10 @@ void is31fl3743a_set_scaling_register(uint8_t index, uint8_t value) {
 }
 
 void is31fl3743a_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
+    if (dirty_chunks_any(driver_buffers[index].pwm_buffer_dirty, sizeof(driver_buffers[index].pwm_buffer_dirty))) {
         is31fl3743a_select_page(index, IS31FL3743A_COMMAND_PWM);
 
         is31fl3743a_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -0,0 +1,136 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "is31fl3731.h"
+#include "i2c_master.h"
+}
+
+#define PWM_REGISTER_BASE 0x24
+#define PWM_REGISTER_COUNT 144
+#define PWM_CHUNK_SIZE 16
+
+// clang-format off
+extern "C" const is31fl3731_led_t PROGMEM g_is31fl3731_leds[IS31FL3731_LED_COUNT] = {
+    {0, C1_1, C1_2, C1_3},   // All in the first chunk
+    {0, C5_1, C5_2, C5_3},   // All in the fifth chunk
+    {0, C2_1, C3_1, C9_16},  // Spread over three chunks, the last one ending the buffer
+};
+// clang-format on
+
+class IS31FL3731 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3731_init_drivers();
+        is31fl3731_set_color_all(0, 0, 0);
+        flush();
+        i2c_mock_reset();
+    }
+
+    // Flushes the buffers and lets the queued writes through
+    void flush() {
+        is31fl3731_flush();
+        EXPECT_EQ(i2c_async_wait(), I2C_STATUS_SUCCESS);
+    }
+
+    void expect_pwm_writes(std::vector<uint8_t> chunks) {
+        ASSERT_EQ(i2c_mock_write_count(), chunks.size());
+        for (size_t i = 0; i < chunks.size(); i++) {
+            EXPECT_EQ(i2c_mock_write(i)->address, IS31FL3731_I2C_ADDRESS_GND << 1);
+            EXPECT_EQ(i2c_mock_write(i)->reg, PWM_REGISTER_BASE + chunks[i] * PWM_CHUNK_SIZE);
+            EXPECT_EQ(i2c_mock_write(i)->length, PWM_CHUNK_SIZE);
+            EXPECT_TRUE(i2c_mock_write(i)->async);
+        }
+    }
+};
+
+TEST_F(IS31FL3731, FlushWithoutChangesWritesNothing) {
+    flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+}
+
+TEST_F(IS31FL3731, SingleLedWritesOnlyItsChunk) {
+    is31fl3731_set_color(1, 10, 20, 30);
+    flush();
+    expect_pwm_writes({4});
+}
+
+TEST_F(IS31FL3731, SameColorWritesNothing) {
+    is31fl3731_set_color(0, 10, 20, 30);
+    flush();
+    i2c_mock_reset();
+
+    is31fl3731_set_color(0, 10, 20, 30);
+    flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+}
+
+TEST_F(IS31FL3731, ChunksAreOnlyWrittenOnce) {
+    is31fl3731_set_color(0, 10, 20, 30);
+    flush();
+    expect_pwm_writes({0});
+
+    i2c_mock_reset();
+    flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+}
+
+TEST_F(IS31FL3731, LedAcrossChunksWritesEachOfThem) {
+    is31fl3731_set_color(2, 10, 20, 30);
+    flush();
+    expect_pwm_writes({1, 2, 8});
+}
+
+TEST_F(IS31FL3731, AllLedsWriteLessThanAFullFrame) {
+    is31fl3731_set_color_all(10, 20, 30);
+    flush();
+    expect_pwm_writes({0, 1, 2, 4, 8});
+    EXPECT_LT(i2c_mock_bytes_written(), 1 + PWM_REGISTER_COUNT);
+}
+
+TEST_F(IS31FL3731, FlushReturnsBeforeTheBusIsDone) {
+    is31fl3731_set_color(0, 10, 20, 30);
+    is31fl3731_set_color(1, 10, 20, 30);
+    is31fl3731_flush();
+    EXPECT_TRUE(i2c_async_is_busy());
+    EXPECT_EQ(i2c_mock_queued(), 2);
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+
+    i2c_mock_complete(1);
+    EXPECT_TRUE(i2c_async_is_busy());
+    i2c_mock_complete(1);
+    EXPECT_FALSE(i2c_async_is_busy());
+    expect_pwm_writes({0, 4});
+}
+
+TEST_F(IS31FL3731, QueuedWritesHoldTheValuesAtFlush) {
+    is31fl3731_set_color(0, 10, 20, 30);
+    is31fl3731_flush();
+
+    // Changing the buffer while the write is queued does not affect it
+    is31fl3731_set_color(0, 40, 50, 60);
+    i2c_mock_complete(1);
+    ASSERT_EQ(i2c_mock_write_count(), 1);
+    EXPECT_EQ(i2c_mock_write(0)->data[C1_1], 10);
+    EXPECT_EQ(i2c_mock_write(0)->data[C1_2], 20);
+    EXPECT_EQ(i2c_mock_write(0)->data[C1_3], 30);
+
+    // ...and is sent by the next flush
+    flush();
+    ASSERT_EQ(i2c_mock_write_count(), 2);
+    EXPECT_EQ(i2c_mock_write(1)->data[C1_1], 40);
+}
+
+TEST_F(IS31FL3731, FailuresAreReportedByWait) {
+    i2c_mock_set_status(I2C_STATUS_TIMEOUT);
+    is31fl3731_set_color(0, 10, 20, 30);
+    is31fl3731_flush();
+    EXPECT_EQ(i2c_async_wait(), I2C_STATUS_TIMEOUT);
+
+    // Only once
+    i2c_mock_set_status(I2C_STATUS_SUCCESS);
+    EXPECT_EQ(i2c_async_wait(), I2C_STATUS_SUCCESS);
+}
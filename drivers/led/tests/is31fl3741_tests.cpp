@@ -0,0 +1,99 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "is31fl3741.h"
+#include "i2c_master.h"
+}
+
+#define PWM_0_CHUNK_SIZE 30
+#define PWM_1_CHUNK_SIZE 19
+
+// clang-format off
+extern "C" const is31fl3741_led_t PROGMEM g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+    {0, SW1_CS1, SW1_CS2, SW1_CS3},     // All in the first chunk of PWM page 0
+    {0, SW7_CS1, SW7_CS2, SW7_CS3},     // All in the first chunk of PWM page 1
+    {0, SW6_CS30, SW9_CS1, SW9_CS39},   // The end of page 0, and two chunks of page 1
+};
+// clang-format on
+
+class IS31FL3741 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        is31fl3741_init_drivers();
+        is31fl3741_set_color_all(0, 0, 0);
+        flush();
+        i2c_mock_reset();
+    }
+
+    // Flushes the buffers and lets the queued writes through
+    void flush() {
+        is31fl3741_flush();
+        EXPECT_EQ(i2c_async_wait(), I2C_STATUS_SUCCESS);
+    }
+};
+
+TEST_F(IS31FL3741, FlushWithoutChangesWritesNothing) {
+    flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+}
+
+TEST_F(IS31FL3741, FirstPageOnly) {
+    is31fl3741_set_color(0, 10, 20, 30);
+    flush();
+
+    // Unlock, select PWM page 0, one transfer
+    ASSERT_EQ(i2c_mock_write_count(), 3);
+    EXPECT_EQ(i2c_mock_write(1)->reg, IS31FL3741_REG_COMMAND);
+    EXPECT_EQ(i2c_mock_write(2)->reg, 0);
+    EXPECT_EQ(i2c_mock_write(2)->length, PWM_0_CHUNK_SIZE);
+}
+
+TEST_F(IS31FL3741, SecondPageOnly) {
+    is31fl3741_set_color(1, 10, 20, 30);
+    flush();
+
+    // Unlock, select PWM page 1, one transfer
+    ASSERT_EQ(i2c_mock_write_count(), 3);
+    EXPECT_EQ(i2c_mock_write(1)->reg, IS31FL3741_REG_COMMAND);
+    EXPECT_EQ(i2c_mock_write(2)->reg, 0);
+    EXPECT_EQ(i2c_mock_write(2)->length, PWM_1_CHUNK_SIZE);
+}
+
+TEST_F(IS31FL3741, LedAcrossPages) {
+    is31fl3741_set_color(2, 10, 20, 30);
+    flush();
+
+    ASSERT_EQ(i2c_mock_write_count(), 7);
+    // Page 0: the last chunk, holding SW6_CS30
+    EXPECT_EQ(i2c_mock_write(2)->reg, 5 * PWM_0_CHUNK_SIZE);
+    EXPECT_EQ(i2c_mock_write(2)->length, PWM_0_CHUNK_SIZE);
+    // Page 1: the chunks holding SW9_CS1 and SW9_CS39
+    EXPECT_EQ(i2c_mock_write(5)->reg, (SW9_CS1 & 0xFF) / PWM_1_CHUNK_SIZE * PWM_1_CHUNK_SIZE);
+    EXPECT_EQ(i2c_mock_write(5)->length, PWM_1_CHUNK_SIZE);
+    EXPECT_EQ(i2c_mock_write(6)->reg, (SW9_CS39 & 0xFF) / PWM_1_CHUNK_SIZE * PWM_1_CHUNK_SIZE);
+    EXPECT_EQ(i2c_mock_write(6)->length, PWM_1_CHUNK_SIZE);
+
+    i2c_mock_reset();
+    flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+}
+
+TEST_F(IS31FL3741, PageSelectionIsQueuedWithTheWrites) {
+    is31fl3741_set_color(2, 10, 20, 30);
+    is31fl3741_flush();
+    EXPECT_EQ(i2c_mock_write_count(), 0);
+    EXPECT_EQ(i2c_mock_queued(), 7);
+
+    i2c_mock_complete(7);
+    ASSERT_EQ(i2c_mock_write_count(), 7);
+    for (uint16_t i = 0; i < 7; i++) {
+        EXPECT_TRUE(i2c_mock_write(i)->async);
+    }
+    EXPECT_EQ(i2c_mock_write(1)->reg, IS31FL3741_REG_COMMAND);
+    EXPECT_EQ(i2c_mock_write(1)->data[0], IS31FL3741_COMMAND_PWM_0);
+    EXPECT_EQ(i2c_mock_write(4)->reg, IS31FL3741_REG_COMMAND);
+    EXPECT_EQ(i2c_mock_write(4)->data[0], IS31FL3741_COMMAND_PWM_1);
+}
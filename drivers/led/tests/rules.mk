@@ -0,0 +1,17 @@
+led_is31fl3731_INC := $(PLATFORM_PATH)/test/drivers $(DRIVER_PATH)/led/issi
+led_is31fl3731_CONFIG := $(DRIVER_PATH)/led/tests/config_is31fl3731.h
+
+led_is31fl3731_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/led/issi/is31fl3731.c \
+	$(PLATFORM_PATH)/test/drivers/i2c_master.c \
+	$(DRIVER_PATH)/led/tests/is31fl3731_tests.cpp
+
+led_is31fl3741_INC := $(PLATFORM_PATH)/test/drivers $(DRIVER_PATH)/led/issi
+led_is31fl3741_CONFIG := $(DRIVER_PATH)/led/tests/config_is31fl3741.h
+
+led_is31fl3741_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c \
+	$(PLATFORM_PATH)/test/drivers/i2c_master.c \
+	$(DRIVER_PATH)/led/tests/is31fl3741_tests.cpp
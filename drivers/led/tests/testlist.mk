@@ -0,0 +1,3 @@
+TEST_LIST += \
+	led_is31fl3731 \
+	led_is31fl3741
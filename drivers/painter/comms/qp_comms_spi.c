@@ -45,6 +45,21 @@ uint32_t qp_comms_spi_send_data(painter_device_t device, const void *data, uint3
     return byte_count - bytes_remaining;
 }
 
+#    ifdef SPI_TRANSMIT_ASYNC_SUPPORTED
+bool qp_comms_spi_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    // Too long for a single transfer, fall back to sending it in pieces
+    if (byte_count > UINT16_MAX) {
+        return qp_comms_spi_send_data(device, data, byte_count) == byte_count;
+    }
+
+    return spi_transmit_async((const uint8_t *)data, byte_count) == SPI_STATUS_SUCCESS;
+}
+
+bool qp_comms_spi_busy(painter_device_t device) {
+    return spi_transmit_busy();
+}
+#    endif // SPI_TRANSMIT_ASYNC_SUPPORTED
+
 void qp_comms_spi_stop(painter_device_t device) {
     painter_driver_t *     driver       = (painter_driver_t *)device;
     qp_comms_spi_config_t *comms_config = (qp_comms_spi_config_t *)driver->comms_config;
@@ -53,10 +68,14 @@ void qp_comms_spi_stop(painter_device_t device) {
 }
 
 const painter_comms_vtable_t spi_comms_vtable = {
-    .comms_init  = qp_comms_spi_init,
-    .comms_start = qp_comms_spi_start,
-    .comms_send  = qp_comms_spi_send_data,
-    .comms_stop  = qp_comms_spi_stop,
+    .comms_init       = qp_comms_spi_init,
+    .comms_start      = qp_comms_spi_start,
+    .comms_send       = qp_comms_spi_send_data,
+    .comms_stop       = qp_comms_spi_stop,
+#    ifdef SPI_TRANSMIT_ASYNC_SUPPORTED
+    .comms_send_async = qp_comms_spi_send_data_async,
+    .comms_busy       = qp_comms_spi_busy,
+#    endif // SPI_TRANSMIT_ASYNC_SUPPORTED
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -97,6 +116,15 @@ uint32_t qp_comms_spi_dc_reset_send_data(painter_device_t device, const void *da
     return qp_comms_spi_send_data(device, data, byte_count);
 }
 
+#        ifdef SPI_TRANSMIT_ASYNC_SUPPORTED
+bool qp_comms_spi_dc_reset_send_data_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *              driver       = (painter_driver_t *)device;
+    qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
+    gpio_write_pin_high(comms_config->dc_pin);
+    return qp_comms_spi_send_data_async(device, data, byte_count);
+}
+#        endif // SPI_TRANSMIT_ASYNC_SUPPORTED
+
 void qp_comms_spi_dc_reset_send_command(painter_device_t device, uint8_t cmd) {
     painter_driver_t *              driver       = (painter_driver_t *)device;
     qp_comms_spi_dc_reset_config_t *comms_config = (qp_comms_spi_dc_reset_config_t *)driver->comms_config;
@@ -131,10 +159,14 @@ void qp_comms_spi_dc_reset_bulk_command_sequence(painter_device_t device, const
 const painter_comms_with_command_vtable_t spi_comms_with_dc_vtable = {
     .base =
         {
-            .comms_init  = qp_comms_spi_dc_reset_init,
-            .comms_start = qp_comms_spi_start,
-            .comms_send  = qp_comms_spi_dc_reset_send_data,
-            .comms_stop  = qp_comms_spi_stop,
+            .comms_init       = qp_comms_spi_dc_reset_init,
+            .comms_start      = qp_comms_spi_start,
+            .comms_send       = qp_comms_spi_dc_reset_send_data,
+            .comms_stop       = qp_comms_spi_stop,
+#        ifdef SPI_TRANSMIT_ASYNC_SUPPORTED
+            .comms_send_async = qp_comms_spi_dc_reset_send_data_async,
+            .comms_busy       = qp_comms_spi_busy,
+#        endif // SPI_TRANSMIT_ASYNC_SUPPORTED
         },
     .send_command          = qp_comms_spi_dc_reset_send_command,
     .bulk_command_sequence = qp_comms_spi_dc_reset_bulk_command_sequence,
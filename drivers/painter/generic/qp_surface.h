@@ -21,6 +21,15 @@
 #    define SURFACE_NUM_DEVICES 1
 #endif
 
+#ifndef SURFACE_MAX_DIRTY_RECTS
+/**
+ * @def This controls the maximum number of separate dirty rectangles tracked by each surface. Changes in different
+ *      areas of the surface are transferred to the display independently, instead of as a single bounding box.
+ *      Setting this to 1 restores the single bounding box behaviour.
+ */
+#    define SURFACE_MAX_DIRTY_RECTS 4
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Forward declarations
 
@@ -29,8 +29,49 @@ void qp_surface_increment_pixdata_location(surface_viewport_data_t *viewport) {
     }
 }
 
+static inline uint32_t qp_surface_dirty_rect_area(const surface_dirty_rect_t *rect) {
+    return (uint32_t)(rect->r - rect->l + 1) * (uint32_t)(rect->b - rect->t + 1);
+}
+
+static inline void qp_surface_dirty_rect_union(surface_dirty_rect_t *dest, const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    dest->l = QP_MIN(a->l, b->l);
+    dest->t = QP_MIN(a->t, b->t);
+    dest->r = QP_MAX(a->r, b->r);
+    dest->b = QP_MAX(a->b, b->b);
+}
+
+static inline bool qp_surface_dirty_rect_overlaps(const surface_dirty_rect_t *a, const surface_dirty_rect_t *b) {
+    return a->l <= b->r && b->l <= a->r && a->t <= b->b && b->t <= a->b;
+}
+
+static void qp_surface_dirty_remove_rect(surface_dirty_data_t *dirty, uint8_t index) {
+    dirty->rects[index] = dirty->rects[--dirty->num_rects];
+}
+
+// Merges every other rect overlapping the rect at `index` into it, so that no pixel gets transferred twice. Returns the
+// final location of the merged rect.
+static uint8_t qp_surface_dirty_merge_overlapping(surface_dirty_data_t *dirty, uint8_t index) {
+    bool merged;
+    do {
+        merged = false;
+        for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+            if (i != index && qp_surface_dirty_rect_overlaps(&dirty->rects[i], &dirty->rects[index])) {
+                qp_surface_dirty_rect_union(&dirty->rects[index], &dirty->rects[index], &dirty->rects[i]);
+                qp_surface_dirty_remove_rect(dirty, i);
+                // The last rect was moved into the removed slot, follow it if it was the one being grown
+                if (index == dirty->num_rects) {
+                    index = i;
+                }
+                merged = true;
+                break;
+            }
+        }
+    } while (merged);
+    return index;
+}
+
 void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y) {
-    // Maintain dirty region
+    // Maintain the bounding box of the dirty region
     if (dirty->l > x) {
         dirty->l        = x;
         dirty->is_dirty = true;
@@ -47,6 +88,68 @@ void qp_surface_update_dirty(surface_dirty_data_t *dirty, uint16_t x, uint16_t y
         dirty->b        = y;
         dirty->is_dirty = true;
     }
+
+    surface_dirty_rect_t pixel = {.l = x, .t = y, .r = x, .b = y};
+
+    // Nothing to do if the pixel is already covered, grow any rect it's touching
+    for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+        surface_dirty_rect_t *rect = &dirty->rects[i];
+        if (x + 1 >= rect->l && x <= rect->r + 1 && y + 1 >= rect->t && y <= rect->b + 1) {
+            if (x < rect->l || x > rect->r || y < rect->t || y > rect->b) {
+                qp_surface_dirty_rect_union(rect, rect, &pixel);
+                qp_surface_dirty_merge_overlapping(dirty, i);
+            }
+            return;
+        }
+    }
+
+    // If all the rects are in use, free one up by growing whichever rect or merging whichever pair of rects adds the
+    // least amount of clean area to the transfer
+    if (dirty->num_rects == SURFACE_MAX_DIRTY_RECTS) {
+        surface_dirty_rect_t merged;
+        uint32_t             best_cost  = UINT32_MAX;
+        uint8_t              best_first = 0;
+        uint8_t              best_other = 0;
+        for (uint8_t i = 0; i < dirty->num_rects; ++i) {
+            qp_surface_dirty_rect_union(&merged, &dirty->rects[i], &pixel);
+            uint32_t cost = qp_surface_dirty_rect_area(&merged) - qp_surface_dirty_rect_area(&dirty->rects[i]);
+            if (cost < best_cost) {
+                best_cost  = cost;
+                best_first = best_other = i;
+            }
+            for (uint8_t j = i + 1; j < dirty->num_rects; ++j) {
+                qp_surface_dirty_rect_union(&merged, &dirty->rects[i], &dirty->rects[j]);
+                // Rects never overlap, so this doesn't underflow
+                cost = qp_surface_dirty_rect_area(&merged) - qp_surface_dirty_rect_area(&dirty->rects[i]) - qp_surface_dirty_rect_area(&dirty->rects[j]);
+                if (cost < best_cost) {
+                    best_cost  = cost;
+                    best_first = i;
+                    best_other = j;
+                }
+            }
+        }
+
+        if (best_first == best_other) {
+            qp_surface_dirty_rect_union(&dirty->rects[best_first], &dirty->rects[best_first], &pixel);
+            qp_surface_dirty_merge_overlapping(dirty, best_first);
+            return;
+        }
+
+        qp_surface_dirty_rect_union(&dirty->rects[best_first], &dirty->rects[best_first], &dirty->rects[best_other]);
+        qp_surface_dirty_remove_rect(dirty, best_other);
+        if (best_first == dirty->num_rects) {
+            best_first = best_other;
+        }
+        best_first = qp_surface_dirty_merge_overlapping(dirty, best_first);
+
+        // The merged rect may have swallowed the pixel
+        if (qp_surface_dirty_rect_overlaps(&dirty->rects[best_first], &pixel)) {
+            return;
+        }
+    }
+
+    // Start a new rect for the pixel
+    dirty->rects[dirty->num_rects++] = pixel;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -63,6 +166,9 @@ bool qp_surface_init(painter_device_t device, painter_rotation_t rotation) {
     surface->dirty.b        = surface->base.panel_height - 1;
     surface->dirty.is_dirty = true;
 
+    surface->dirty.num_rects = 1;
+    surface->dirty.rects[0]  = (surface_dirty_rect_t){.l = surface->dirty.l, .t = surface->dirty.t, .r = surface->dirty.r, .b = surface->dirty.b};
+
     return true;
 }
 
@@ -83,6 +189,7 @@ bool qp_surface_flush(painter_device_t device) {
     surface->dirty.l = surface->dirty.t = UINT16_MAX;
     surface->dirty.r = surface->dirty.b = 0;
     surface->dirty.is_dirty             = false;
+    surface->dirty.num_rects            = 0;
     return true;
 }
 
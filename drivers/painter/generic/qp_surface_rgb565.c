@@ -68,13 +68,11 @@ static bool qp_surface_append_pixels_rgb565(painter_device_t device, uint8_t *ta
     return true;
 }
 
-static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
-    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
-
-    uint16_t l = entire_surface ? 0 : surface_handle->dirty.l;
-    uint16_t t = entire_surface ? 0 : surface_handle->dirty.t;
-    uint16_t r = entire_surface ? (surface_handle->base.panel_width - 1) : surface_handle->dirty.r;
-    uint16_t b = entire_surface ? (surface_handle->base.panel_height - 1) : surface_handle->dirty.b;
+static bool rgb565_target_pixdata_transfer_rect(surface_painter_device_t *surface_handle, painter_driver_t *target_driver, uint16_t x, uint16_t y, const surface_dirty_rect_t *rect) {
+    uint16_t l = rect->l;
+    uint16_t t = rect->t;
+    uint16_t r = rect->r;
+    uint16_t b = rect->b;
 
     // Set the target drawing area
     bool ok = qp_viewport((painter_device_t)target_driver, x + l, y + t, x + r, y + b);
@@ -84,7 +82,7 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     }
 
     // Housekeeping of the amount of pixels to transfer
-    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_driver->native_bits_per_pixel;
+    uint32_t  total_pixel_count = (8 * QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE) / surface_handle->base.native_bits_per_pixel;
     uint32_t  pixel_counter     = 0;
     uint16_t *target_buffer     = (uint16_t *)qp_internal_global_pixdata_buffer;
 
@@ -119,6 +117,24 @@ static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, pai
     return true;
 }
 
+static bool rgb565_target_pixdata_transfer(painter_driver_t *surface_driver, painter_driver_t *target_driver, uint16_t x, uint16_t y, bool entire_surface) {
+    surface_painter_device_t *surface_handle = (surface_painter_device_t *)surface_driver;
+
+    if (entire_surface) {
+        surface_dirty_rect_t rect = {.l = 0, .t = 0, .r = surface_handle->base.panel_width - 1, .b = surface_handle->base.panel_height - 1};
+        return rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &rect);
+    }
+
+    // Each dirty rect gets its own viewport, so unchanged areas in between are skipped
+    for (uint8_t i = 0; i < surface_handle->dirty.num_rects; ++i) {
+        if (!rgb565_target_pixdata_transfer_rect(surface_handle, target_driver, x, y, &surface_handle->dirty.rects[i])) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 static bool qp_surface_append_pixdata_rgb565(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
     target_buffer[pixdata_offset] = pixdata_byte;
     return true;
@@ -73,6 +73,7 @@ const tft_panel_dc_reset_painter_driver_vtable_t ili9341_driver_vtable = {
             .clear           = qp_tft_panel_clear,
             .flush           = qp_tft_panel_flush,
             .pixdata         = qp_tft_panel_pixdata,
+            .pixdata_async   = qp_tft_panel_pixdata_async,
             .viewport        = qp_tft_panel_viewport,
             .palette_convert = qp_tft_panel_palette_convert_rgb565_swapped,
             .append_pixels   = qp_tft_panel_append_pixels_rgb565,
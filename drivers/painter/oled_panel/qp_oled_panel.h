@@ -61,8 +61,8 @@ bool qp_oled_panel_passthru_palette_convert(painter_device_t device, int16_t pal
 bool qp_oled_panel_passthru_append_pixels(painter_device_t device, uint8_t *target_buffer, qp_pixel_t *palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t *palette_indices);
 bool qp_oled_panel_passthru_append_pixdata(painter_device_t device, uint8_t *target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte);
 
-// Helpers for flushing data from the dirty region to the correct location on the OLED
-void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer);
-void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer);
-void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer);
-void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_data_t *dirty, const uint8_t *framebuffer);
+// Helpers for flushing data from a dirty rect to the correct location on the OLED
+void qp_oled_panel_page_column_flush_rot0(painter_device_t device, surface_dirty_rect_t *dirty, const uint8_t *framebuffer);
+void qp_oled_panel_page_column_flush_rot90(painter_device_t device, surface_dirty_rect_t *dirty, const uint8_t *framebuffer);
+void qp_oled_panel_page_column_flush_rot180(painter_device_t device, surface_dirty_rect_t *dirty, const uint8_t *framebuffer);
+void qp_oled_panel_page_column_flush_rot270(painter_device_t device, surface_dirty_rect_t *dirty, const uint8_t *framebuffer);
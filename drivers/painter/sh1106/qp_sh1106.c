@@ -83,20 +83,24 @@ bool qp_sh1106_flush(painter_device_t device) {
         return true;
     }
 
-    switch (driver->oled.base.rotation) {
-        default:
-        case QP_ROTATION_0:
-            qp_oled_panel_page_column_flush_rot0(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_90:
-            qp_oled_panel_page_column_flush_rot90(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_180:
-            qp_oled_panel_page_column_flush_rot180(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
-        case QP_ROTATION_270:
-            qp_oled_panel_page_column_flush_rot270(device, &driver->oled.surface.dirty, driver->framebuffer);
-            break;
+    // Each dirty rect is sent separately, so unchanged areas in between are skipped
+    for (uint8_t i = 0; i < driver->oled.surface.dirty.num_rects; ++i) {
+        surface_dirty_rect_t *dirty = &driver->oled.surface.dirty.rects[i];
+        switch (driver->oled.base.rotation) {
+            default:
+            case QP_ROTATION_0:
+                qp_oled_panel_page_column_flush_rot0(device, dirty, driver->framebuffer);
+                break;
+            case QP_ROTATION_90:
+                qp_oled_panel_page_column_flush_rot90(device, dirty, driver->framebuffer);
+                break;
+            case QP_ROTATION_180:
+                qp_oled_panel_page_column_flush_rot180(device, dirty, driver->framebuffer);
+                break;
+            case QP_ROTATION_270:
+                qp_oled_panel_page_column_flush_rot270(device, dirty, driver->framebuffer);
+                break;
+        }
     }
 
     // Clear the dirty area
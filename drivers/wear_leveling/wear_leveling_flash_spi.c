@@ -41,6 +41,29 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+#ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#endif
+
+    // Only entire blocks can be erased
+    if (address % (EXTERNAL_FLASH_BLOCK_SIZE) != 0 || length % (EXTERNAL_FLASH_BLOCK_SIZE) != 0) {
+        return false;
+    }
+
+    bool ret = true;
+    for (uint32_t offset = address; offset < address + length; offset += (EXTERNAL_FLASH_BLOCK_SIZE)) {
+        flash_status_t status = flash_erase_block((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) * (EXTERNAL_FLASH_BLOCK_SIZE) + offset);
+        if (status != FLASH_STATUS_SUCCESS) {
+            ret = false;
+            break;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
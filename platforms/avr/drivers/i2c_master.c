@@ -315,4 +315,25 @@ __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t ti
     i2c_status_t status = i2c_start(address, timeout);
     i2c_stop();
     return status;
-}
\ No newline at end of file
+}
+
+// The TWI peripheral has no DMA to hand transfers off to, so asynchronous writes are sent right away
+static i2c_status_t i2c_async_status = I2C_STATUS_SUCCESS;
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_status_t status = i2c_write_register(devaddr, regaddr, data, length, timeout);
+    if (status != I2C_STATUS_SUCCESS) {
+        i2c_async_status = status;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_is_busy(void) {
+    return false;
+}
+
+i2c_status_t i2c_async_wait(void) {
+    i2c_status_t status = i2c_async_status;
+    i2c_async_status    = I2C_STATUS_SUCCESS;
+    return status;
+}
@@ -134,6 +134,14 @@ inline uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(t, last);
 }
 
+/** \brief timer read microseconds
+ *
+ * Only counts whole milliseconds, as timer 0 is not read for the time in between.
+ */
+uint32_t timer_read_us(void) {
+    return timer_read32() * 1000;
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
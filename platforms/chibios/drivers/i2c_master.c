@@ -74,6 +74,15 @@
 #    define I2C_DRIVER I2CD1
 #endif
 
+#ifdef I2C_ASYNC_ENABLE
+#    ifndef I2C_ASYNC_QUEUE_SIZE
+#        define I2C_ASYNC_QUEUE_SIZE 16
+#    endif
+#    ifndef I2C_ASYNC_MAX_LENGTH
+#        define I2C_ASYNC_MAX_LENGTH 36
+#    endif
+#endif
+
 #ifdef USE_GPIOV1
 #    ifndef I2C1_SCL_PAL_MODE
 #        define I2C1_SCL_PAL_MODE PAL_MODE_ALTERNATE_OPENDRAIN
@@ -129,6 +138,12 @@ static i2c_status_t i2c_epilogue(const msg_t status) {
     return status == MSG_TIMEOUT ? I2C_STATUS_TIMEOUT : I2C_STATUS_ERROR;
 }
 
+#ifdef I2C_ASYNC_ENABLE
+static void i2c_async_drain(void);
+#else
+#    define i2c_async_drain()
+#endif
+
 __attribute__((weak)) void i2c_init(void) {
     static bool is_initialised = false;
     if (!is_initialised) {
@@ -150,18 +165,21 @@ __attribute__((weak)) void i2c_init(void) {
 }
 
 i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (address >> 1), data, length, 0, 0, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_receive(uint8_t address, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterReceiveTimeout(&I2C_DRIVER, (address >> 1), data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 1];
@@ -175,6 +193,7 @@ i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t*
 }
 
 i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
 
     uint8_t complete_packet[length + 2];
@@ -189,12 +208,14 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 }
 
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     msg_t status = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), &regaddr, 1, data, length, TIME_MS2I(timeout));
     return i2c_epilogue(status);
 }
 
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_async_drain();
     i2cStart(&I2C_DRIVER, &i2cconfig);
     uint8_t register_packet[2] = {regaddr >> 8, regaddr & 0xFF};
     msg_t   status             = i2cMasterTransmitTimeout(&I2C_DRIVER, (devaddr >> 1), register_packet, 2, data, length, TIME_MS2I(timeout));
@@ -207,4 +228,131 @@ __attribute__((weak)) i2c_status_t i2c_ping_address(uint8_t address, uint16_t ti
     // This approach may produce false negative results for I2C devices that do not respond to a register 0 read request.
     uint8_t data = 0;
     return i2c_read_register(address, 0, &data, sizeof(data), timeout);
-}
\ No newline at end of file
+}
+
+#ifdef I2C_ASYNC_ENABLE
+// Register writes are copied into a ring of transfers, which a separate thread sends one after another. While
+// it waits on the bus the main thread carries on, so callers only block when the queue is full.
+typedef struct i2c_async_transfer_t {
+    uint8_t  address;
+    uint16_t length;
+    uint16_t timeout;
+    uint8_t  packet[I2C_ASYNC_MAX_LENGTH + 1];
+} i2c_async_transfer_t;
+
+static i2c_async_transfer_t  i2c_async_queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t               i2c_async_head = 0; // Only touched by the submitting thread
+static uint8_t               i2c_async_tail = 0; // Only touched by the worker thread
+static semaphore_t           i2c_async_free;
+static semaphore_t           i2c_async_queued;
+static volatile uint8_t      i2c_async_pending = 0;
+static volatile i2c_status_t i2c_async_status  = I2C_STATUS_SUCCESS;
+static thread_reference_t    i2c_async_waiter  = NULL;
+
+static THD_WORKING_AREA(waI2CAsyncThread, 256);
+static THD_FUNCTION(I2CAsyncThread, arg) {
+    (void)arg;
+    chRegSetThreadName("i2c_async");
+
+    while (true) {
+        chSemWait(&i2c_async_queued);
+
+        i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_tail];
+        i2cStart(&I2C_DRIVER, &i2cconfig);
+        msg_t        msg    = i2cMasterTransmitTimeout(&I2C_DRIVER, (transfer->address >> 1), transfer->packet, transfer->length, 0, 0, TIME_MS2I(transfer->timeout));
+        i2c_status_t status = i2c_epilogue(msg);
+        i2c_async_tail      = (i2c_async_tail + 1) % I2C_ASYNC_QUEUE_SIZE;
+
+        chSysLock();
+        if (status != I2C_STATUS_SUCCESS) {
+            i2c_async_status = status;
+        }
+        if (--i2c_async_pending == 0) {
+            chThdResumeI(&i2c_async_waiter, MSG_OK);
+        }
+        chSemSignalI(&i2c_async_free);
+        chSchRescheduleS();
+        chSysUnlock();
+    }
+}
+
+static void i2c_async_start(void) {
+    static bool is_started = false;
+    if (!is_started) {
+        is_started = true;
+
+        chSemObjectInit(&i2c_async_free, I2C_ASYNC_QUEUE_SIZE);
+        chSemObjectInit(&i2c_async_queued, 0);
+        chThdCreateStatic(waI2CAsyncThread, sizeof(waI2CAsyncThread), HIGHPRIO, I2CAsyncThread, NULL);
+    }
+}
+
+static void i2c_async_drain(void) {
+    chSysLock();
+    if (i2c_async_pending > 0) {
+        chThdSuspendS(&i2c_async_waiter);
+    }
+    chSysUnlock();
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    if (length > I2C_ASYNC_MAX_LENGTH) {
+        // Too long to copy -- send it right away, after everything already queued
+        return i2c_write_register(devaddr, regaddr, data, length, timeout);
+    }
+
+    i2c_async_start();
+    chSemWait(&i2c_async_free);
+
+    i2c_async_transfer_t* transfer = &i2c_async_queue[i2c_async_head];
+    transfer->address              = devaddr;
+    transfer->length               = length + 1;
+    transfer->timeout              = timeout;
+    transfer->packet[0]            = regaddr;
+    memcpy(&transfer->packet[1], data, length);
+    i2c_async_head = (i2c_async_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+
+    chSysLock();
+    i2c_async_pending++;
+    chSemSignalI(&i2c_async_queued);
+    chSchRescheduleS();
+    chSysUnlock();
+
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_is_busy(void) {
+    return i2c_async_pending > 0;
+}
+
+i2c_status_t i2c_async_wait(void) {
+    i2c_async_drain();
+
+    chSysLock();
+    i2c_status_t status = i2c_async_status;
+    i2c_async_status    = I2C_STATUS_SUCCESS;
+    chSysUnlock();
+
+    return status;
+}
+#else
+static i2c_status_t i2c_async_status = I2C_STATUS_SUCCESS;
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    i2c_status_t status = i2c_write_register(devaddr, regaddr, data, length, timeout);
+    if (status != I2C_STATUS_SUCCESS) {
+        i2c_async_status = status;
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_is_busy(void) {
+    return false;
+}
+
+i2c_status_t i2c_async_wait(void) {
+    i2c_status_t status = i2c_async_status;
+    i2c_async_status    = I2C_STATUS_SUCCESS;
+    return status;
+}
+#endif
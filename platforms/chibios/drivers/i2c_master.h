@@ -25,6 +25,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <stdbool.h>
 
 // ### DEPRECATED - DO NOT USE ###
 #define i2c_writeReg(devaddr, regaddr, data, length, timeout) i2c_write_register(devaddr, regaddr, data, length, timeout)
@@ -47,3 +48,7 @@ i2c_status_t i2c_write_register16(uint8_t devaddr, uint16_t regaddr, const uint8
 i2c_status_t i2c_read_register(uint8_t devaddr, uint8_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_read_register16(uint8_t devaddr, uint16_t regaddr, uint8_t* data, uint16_t length, uint16_t timeout);
 i2c_status_t i2c_ping_address(uint8_t address, uint16_t timeout);
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+bool         i2c_async_is_busy(void);
+i2c_status_t i2c_async_wait(void);
@@ -19,6 +19,8 @@
 #include "timer.h"
 
 static bool spiStarted = false;
+// Set while the session started by spi_transmit_async() has not been stopped yet
+static bool spiAsyncSession = false;
 
 #if SPI_SELECT_MODE == SPI_SELECT_MODE_NONE
 static pin_t currentSlavePin;
@@ -65,7 +67,13 @@ __attribute__((weak)) void spi_init(void) {
 
 bool spi_start(pin_t slavePin, bool lsbFirst, uint8_t mode, uint16_t divisor) {
     if (spiStarted) {
-        return false;
+        if (!spiAsyncSession) {
+            return false;
+        }
+        // Another device left an asynchronous transfer running, end its session once the transfer is done
+        while (spi_transmit_busy()) {
+        }
+        spi_stop();
     }
 #if SPI_SELECT_MODE != SPI_SELECT_MODE_NONE
     if (slavePin == NO_PIN) {
@@ -310,6 +318,17 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length) {
     return SPI_STATUS_SUCCESS;
 }
 
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length) {
+    spiAsyncSession = true;
+    spiStartSend(&SPI_DRIVER, length, data);
+    return SPI_STATUS_SUCCESS;
+}
+
+bool spi_transmit_busy(void) {
+    // Updated from the transfer complete interrupt
+    return *(volatile spistate_t *)&SPI_DRIVER.state == SPI_ACTIVE;
+}
+
 spi_status_t spi_receive(uint8_t *data, uint16_t length) {
     spiReceive(&SPI_DRIVER, length, data);
     return SPI_STATUS_SUCCESS;
@@ -324,6 +343,7 @@ void spi_stop(void) {
 #endif
         spiUnselect(&SPI_DRIVER);
         spiStop(&SPI_DRIVER);
-        spiStarted = false;
+        spiStarted      = false;
+        spiAsyncSession = false;
     }
 }
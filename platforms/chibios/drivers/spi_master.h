@@ -87,6 +87,14 @@ spi_status_t spi_transmit(const uint8_t *data, uint16_t length);
 
 spi_status_t spi_receive(uint8_t *data, uint16_t length);
 
+// Starts transmitting without waiting for completion. The data must remain valid until spi_transmit_busy() returns
+// false. Until the session is stopped, spi_start() for another device waits for the transfer to finish and stops the
+// session itself, so the spi_stop() from the device that started the transfer may come after that device's session.
+#define SPI_TRANSMIT_ASYNC_SUPPORTED
+spi_status_t spi_transmit_async(const uint8_t *data, uint16_t length);
+
+bool spi_transmit_busy(void);
+
 void spi_stop(void);
 #ifdef __cplusplus
 }
@@ -120,6 +120,42 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+bool backing_store_erase_range(uint32_t address, size_t length) {
+#ifdef WEAR_LEVELING_DEBUG_OUTPUT
+    uint32_t start = timer_read32();
+#endif
+
+    bool          ret = true;
+    flash_error_t status;
+    for (int i = 0; i < sector_count; ++i) {
+        uint32_t sector_offset = flashGetSectorOffset(flash, first_sector + i) - base_offset;
+        uint32_t sector_size   = flashGetSectorSize(flash, first_sector + i);
+        if (sector_offset + sector_size <= address || sector_offset >= address + length) {
+            continue;
+        }
+
+        // Only entire sectors can be erased
+        if (sector_offset < address || sector_offset + sector_size > address + length) {
+            return false;
+        }
+
+        // Kick off the sector erase
+        status = flashStartEraseSector(flash, first_sector + i);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+
+        // Wait for the erase to complete
+        status = flashWaitErase(flash);
+        if (status != FLASH_NO_ERROR && status != FLASH_BUSY_ERASING) {
+            ret = false;
+        }
+    }
+
+    bs_dprintf("Backing store range erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+    return ret;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     uint32_t offset = (base_offset + address);
     bs_dprintf("Write ");
@@ -77,7 +77,8 @@ uint16_t timer_read(void) {
     return (uint16_t)timer_read32();
 }
 
-uint32_t timer_read32(void) {
+// Reads the ticks since timer_clear(), together with the milliseconds already taken out of them on overflow.
+static uint32_t read_ticks(uint32_t *ms_offset_out) {
     chSysLock();
     uint32_t ticks = get_system_time_ticks() - ticks_offset;
     if (ticks < last_ticks) {
@@ -91,13 +92,28 @@ uint32_t timer_read32(void) {
         ticks_offset += OVERFLOW_ADJUST_TICKS;
         ms_offset += OVERFLOW_ADJUST_MS;
     }
-    last_ticks              = ticks;
-    uint32_t ms_offset_copy = ms_offset; // read while still holding the lock to ensure a consistent value
+    last_ticks     = ticks;
+    *ms_offset_out = ms_offset; // read while still holding the lock to ensure a consistent value
     chSysUnlock();
 
+    return ticks;
+}
+
+uint32_t timer_read32(void) {
+    uint32_t ms_offset_copy;
+    uint32_t ticks = read_ticks(&ms_offset_copy);
+
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
 
+uint32_t timer_read_us(void) {
+    uint32_t ms_offset_copy;
+    uint32_t ticks = read_ticks(&ms_offset_copy);
+
+    // Both terms wrap at 32 bits, so differences between readings stay exact
+    return (uint32_t)TIME_I2US(ticks) + ms_offset_copy * 1000;
+}
+
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
 }
@@ -0,0 +1,105 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include <string.h>
+#include "i2c_master.h"
+
+static i2c_mock_write_t writes[I2C_MOCK_MAX_WRITES];
+static uint16_t         write_count   = 0;
+static uint32_t         bytes_written = 0;
+static i2c_status_t     bus_status    = I2C_STATUS_SUCCESS;
+
+static i2c_mock_write_t queue[I2C_ASYNC_QUEUE_SIZE];
+static uint8_t          queue_head   = 0;
+static uint8_t          queue_length = 0;
+static i2c_status_t     async_status = I2C_STATUS_SUCCESS;
+
+static i2c_status_t send(const i2c_mock_write_t* write) {
+    if (write_count < I2C_MOCK_MAX_WRITES) {
+        writes[write_count] = *write;
+    }
+    write_count++;
+    bytes_written += 1 + write->length;
+    return bus_status;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    // Like the real driver, wait for everything queued before to go out first
+    i2c_mock_complete(queue_length);
+
+    i2c_mock_write_t write = {.address = devaddr, .reg = regaddr, .length = length, .async = false};
+    memcpy(write.data, data, length < I2C_MOCK_MAX_LENGTH ? length : I2C_MOCK_MAX_LENGTH);
+    return send(&write);
+}
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    if (length > I2C_MOCK_MAX_LENGTH) {
+        return i2c_write_register(devaddr, regaddr, data, length, timeout);
+    }
+
+    // A full queue blocks until the oldest write has been sent
+    if (queue_length == I2C_ASYNC_QUEUE_SIZE) {
+        i2c_mock_complete(1);
+    }
+
+    i2c_mock_write_t* write = &queue[(queue_head + queue_length) % I2C_ASYNC_QUEUE_SIZE];
+    *write                  = (i2c_mock_write_t){.address = devaddr, .reg = regaddr, .length = length, .async = true};
+    memcpy(write->data, data, length);
+    queue_length++;
+    return I2C_STATUS_SUCCESS;
+}
+
+bool i2c_async_is_busy(void) {
+    return queue_length > 0;
+}
+
+i2c_status_t i2c_async_wait(void) {
+    i2c_mock_complete(queue_length);
+
+    i2c_status_t status = async_status;
+    async_status        = I2C_STATUS_SUCCESS;
+    return status;
+}
+
+void i2c_mock_reset(void) {
+    write_count   = 0;
+    bytes_written = 0;
+    bus_status    = I2C_STATUS_SUCCESS;
+    queue_head    = 0;
+    queue_length  = 0;
+    async_status  = I2C_STATUS_SUCCESS;
+}
+
+void i2c_mock_set_status(i2c_status_t status) {
+    bus_status = status;
+}
+
+void i2c_mock_complete(uint16_t count) {
+    while (count-- > 0 && queue_length > 0) {
+        i2c_status_t status = send(&queue[queue_head]);
+        if (status != I2C_STATUS_SUCCESS) {
+            async_status = status;
+        }
+        queue_head = (queue_head + 1) % I2C_ASYNC_QUEUE_SIZE;
+        queue_length--;
+    }
+}
+
+uint16_t i2c_mock_queued(void) {
+    return queue_length;
+}
+
+uint16_t i2c_mock_write_count(void) {
+    return write_count;
+}
+
+const i2c_mock_write_t* i2c_mock_write(uint16_t index) {
+    return index < write_count && index < I2C_MOCK_MAX_WRITES ? &writes[index] : NULL;
+}
+
+uint32_t i2c_mock_bytes_written(void) {
+    return bytes_written;
+}
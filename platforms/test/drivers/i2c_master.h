@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Stands in for the platform I2C driver. Writes are recorded instead of sent, and asynchronous ones wait in a
+// queue until the test lets them through, so that both ordering and completion can be checked.
+
+typedef int16_t i2c_status_t;
+
+#define I2C_STATUS_SUCCESS (0)
+#define I2C_STATUS_ERROR (-1)
+#define I2C_STATUS_TIMEOUT (-2)
+
+#ifndef I2C_ASYNC_QUEUE_SIZE
+#    define I2C_ASYNC_QUEUE_SIZE 16
+#endif
+
+#define I2C_MOCK_MAX_WRITES 64
+#define I2C_MOCK_MAX_LENGTH 36
+
+typedef struct i2c_mock_write_t {
+    uint8_t  address;
+    uint8_t  reg;
+    uint16_t length;
+    uint8_t  data[I2C_MOCK_MAX_LENGTH];
+    bool     async;
+} i2c_mock_write_t;
+
+void         i2c_init(void);
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+
+i2c_status_t i2c_write_register_async(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout);
+bool         i2c_async_is_busy(void);
+i2c_status_t i2c_async_wait(void);
+
+/**
+ * \brief Forgets all recorded and queued writes, and any pending failure.
+ */
+void i2c_mock_reset(void);
+
+/**
+ * \brief Makes every write from now on fail with the given status, or succeed again with `I2C_STATUS_SUCCESS`.
+ */
+void i2c_mock_set_status(i2c_status_t status);
+
+/**
+ * \brief Sends up to `count` of the queued asynchronous writes, oldest first.
+ */
+void i2c_mock_complete(uint16_t count);
+
+/**
+ * \brief The number of asynchronous writes still in the queue.
+ */
+uint16_t i2c_mock_queued(void);
+
+/**
+ * \brief The number of writes which have reached the bus.
+ */
+uint16_t i2c_mock_write_count(void);
+
+/**
+ * \brief A write which has reached the bus, in the order they were sent.
+ */
+const i2c_mock_write_t* i2c_mock_write(uint16_t index);
+
+/**
+ * \brief The number of bytes sent on the bus, including register addresses.
+ */
+uint32_t i2c_mock_bytes_written(void);
@@ -43,6 +43,10 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// A free-running microsecond count that wraps at 32 bits, for platforms with a finer clock than 1ms
+// (elsewhere it only advances in whole milliseconds)
+uint32_t timer_read_us(void);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
@@ -44,6 +44,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "encoder.h"
 #endif
 
+#ifdef KEY_TRACE_ENABLE
+#    include "key_trace.h"
+#endif
+
 int tp_buttons;
 
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
@@ -66,6 +70,10 @@ __attribute__((weak)) bool get_retro_tapping(uint16_t keycode, keyrecord_t *reco
 }
 #endif
 
+#ifdef HIGH_RES_EVENT_TIME
+static uint32_t last_tick_us = 0;
+#endif
+
 /** \brief Called to execute an action.
  *
  * FIXME: Needs documentation.
@@ -76,11 +84,20 @@ void action_exec(keyevent_t event) {
         ac_dprintf("EVENT: ");
         debug_event(event);
         ac_dprintf("\n");
+#ifdef KEY_TRACE_ENABLE
+        key_trace_record(event);
+#endif
 #if defined(RETRO_TAPPING) || defined(RETRO_TAPPING_PER_KEY) || (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
         retro_tapping_counter++;
 #endif
     }
 
+#ifdef HIGH_RES_EVENT_TIME
+    if (IS_NOEVENT(event)) {
+        last_tick_us = event.time_us;
+    }
+#endif
+
     if (event.pressed) {
         // clear the potential weak mods left by previously pressed keys
         clear_weak_mods();
@@ -134,6 +151,47 @@ void action_exec(keyevent_t event) {
 #endif
 }
 
+#ifdef HIGH_RES_EVENT_TIME
+/** \brief A millisecond after the last tick event, or now if that has already passed.
+ */
+uint32_t action_tick_next_ms(void) {
+    uint32_t now = timer_read_us();
+    if (TIMER_DIFF_32(now, last_tick_us) >= 1000) {
+        return now;
+    }
+    return last_tick_us + 1000;
+}
+
+/** \brief Reports when action_exec() next needs a tick event to act on a timeout.
+ *
+ * \return false when nothing is waiting on a timeout, so no tick is needed until the next event.
+ */
+bool action_tick_deadline(uint32_t *deadline) {
+    bool pending = false;
+
+#    ifndef NO_ACTION_TAPPING
+    pending = action_tapping_tick_deadline(deadline);
+#    endif
+
+#    if !defined(NO_ACTION_ONESHOT) && (defined(ONESHOT_TIMEOUT) && (ONESHOT_TIMEOUT > 0))
+    // One shot timeouts are kept in milliseconds, so these are ticked once per millisecond as before
+    bool oneshot_pending = get_oneshot_mods() || is_oneshot_layer_active();
+#        ifdef SWAP_HANDS_ENABLE
+    oneshot_pending |= is_swap_hands_on();
+#        endif
+    if (keymap_config.oneshot_enable && oneshot_pending) {
+        uint32_t next_ms = action_tick_next_ms();
+        if (!pending || timer_expired32(*deadline, next_ms)) {
+            *deadline = next_ms;
+        }
+        pending = true;
+    }
+#    endif
+
+    return pending;
+}
+#endif
+
 #ifdef SWAP_HANDS_ENABLE
 extern const keypos_t PROGMEM hand_swap_config[MATRIX_ROWS][MATRIX_COLS];
 #    ifdef ENCODER_MAP_ENABLE
@@ -58,6 +58,14 @@ typedef struct {
 /* Execute action per keyevent */
 void action_exec(keyevent_t event);
 
+#ifdef HIGH_RES_EVENT_TIME
+/* Earliest timer_read_us() at which a tick event is due, if any is */
+bool action_tick_deadline(uint32_t *deadline);
+
+/* Deadline for timeouts that are still checked every millisecond */
+uint32_t action_tick_next_ms(void);
+#endif
+
 /* action for key */
 action_t action_for_key(uint8_t layer, keypos_t key);
 action_t action_for_keycode(uint16_t keycode);
@@ -1,5 +1,6 @@
 #include <limits.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "keyboard.h"
 #include "action.h"
@@ -39,6 +40,7 @@ static void default_layer_state_set(layer_state_t state) {
     default_layer_state = state;
     default_layer_debug();
     ac_dprintf("\n");
+    layer_switch_cache_invalidate();
 #if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -119,6 +121,7 @@ void layer_state_set(layer_state_t state) {
     layer_state = state;
     layer_debug();
     ac_dprintf("\n");
+    layer_switch_cache_invalidate();
 #    if defined(STRICT_LAYER_RELEASE)
     clear_keyboard_but_mods(); // To avoid stuck keys
 #    elif defined(SEMI_STRICT_LAYER_RELEASE)
@@ -316,6 +319,43 @@ action_t store_or_get_action(bool pressed, keypos_t key) {
 #endif
 }
 
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+/** \brief layer switch cache
+ *
+ * Resolved layer of each matrix position for the active layers, LAYER_SWITCH_CACHE_EMPTY if not looked up yet.
+ */
+#    define LAYER_SWITCH_CACHE_EMPTY 0xFF
+
+static uint8_t       layer_switch_cache[MATRIX_ROWS][MATRIX_COLS];
+static layer_state_t layer_switch_cache_layers = 0;
+static bool          layer_switch_cache_valid  = false;
+
+/** \brief Layer switch cache invalidate
+ *
+ * Drops all resolved layers, must be called whenever the keymap contents change
+ */
+void layer_switch_cache_invalidate(void) {
+    layer_switch_cache_valid = false;
+}
+
+/** \brief Layer switch cache lookup
+ *
+ * Returns the slot caching the layer of a key, or NULL if the key is not part of the matrix
+ */
+static uint8_t *layer_switch_cache_lookup(keypos_t key, layer_state_t layers) {
+    if (key.row >= MATRIX_ROWS || key.col >= MATRIX_COLS) {
+        return NULL;
+    }
+    // Also catches layer_state being written directly instead of through layer_state_set().
+    if (!layer_switch_cache_valid || layer_switch_cache_layers != layers) {
+        memset(layer_switch_cache, LAYER_SWITCH_CACHE_EMPTY, sizeof(layer_switch_cache));
+        layer_switch_cache_layers = layers;
+        layer_switch_cache_valid  = true;
+    }
+    return &layer_switch_cache[key.row][key.col];
+}
+#endif
+
 /** \brief Layer switch get layer
  *
  * Gets the layer based on key info
@@ -326,17 +366,33 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+    /* fall back to layer 0 */
+    uint8_t layer = 0;
+
+#    ifdef LAYER_SWITCH_CACHE
+    uint8_t *cached = layer_switch_cache_lookup(key, layers);
+    if (cached && *cached != LAYER_SWITCH_CACHE_EMPTY) {
+        return *cached;
+    }
+#    endif
+
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
             action = action_for_key(i, key);
             if (action.code != ACTION_TRANSPARENT) {
-                return i;
+                layer = i;
+                break;
             }
         }
     }
-    /* fall back to layer 0 */
-    return 0;
+
+#    ifdef LAYER_SWITCH_CACHE
+    if (cached) {
+        *cached = layer;
+    }
+#    endif
+    return layer;
 #else
     return get_highest_layer(default_layer_state);
 #endif
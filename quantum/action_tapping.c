@@ -20,8 +20,13 @@
 #    else
 #        define IS_TAPPING_RECORD(r) (KEYEQ(tapping_key.event.key, (r->event.key)) && tapping_key.keycode == r->keycode)
 #    endif
-#    define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
-#    define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    ifdef HIGH_RES_EVENT_TIME
+#        define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_32(e.time_us, tapping_key.event.time_us) < (uint32_t)GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key) * 1000)
+#        define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_32(e.time_us, tapping_key.event.time_us) < (uint32_t)GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key) * 1000)
+#    else
+#        define WITHIN_TAPPING_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#        define WITHIN_QUICK_TAP_TERM(e) (TIMER_DIFF_16(e.time, tapping_key.event.time) < GET_QUICK_TAP_TERM(get_record_keycode(&tapping_key, false), &tapping_key))
+#    endif
 
 #    ifdef DYNAMIC_TAPPING_TERM_ENABLE
 uint16_t g_tapping_term = TAPPING_TERM;
@@ -157,6 +162,33 @@ void action_tapping_process(keyrecord_t record) {
 #        define TAP_GET_HOLD_ON_OTHER_KEY_PRESS false
 #    endif
 
+#    ifdef HIGH_RES_EVENT_TIME
+/** \brief Reports when the tapping state machine next needs a tick event.
+ *
+ * \return false when no tick is needed until the next key event.
+ */
+bool action_tapping_tick_deadline(uint32_t *deadline) {
+    if (IS_NOEVENT(tapping_key.event)) {
+        return false;
+    }
+    // A tap that is still held only settles on its release
+    if (tapping_key.event.pressed && tapping_key.tap.count > 0) {
+        return false;
+    }
+#        if defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT)
+    TAP_DEFINE_KEYCODE;
+    // Retro Shift can extend the term, so these keys are checked every millisecond as before
+    if (MAYBE_RETRO_SHIFTING(tapping_key.event, &tapping_key)) {
+        *deadline = action_tick_next_ms();
+        return true;
+    }
+#        endif
+    // Either the hold or the end of the tap sequence, once the tapping term has passed
+    *deadline = tapping_key.event.time_us + (uint32_t)GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key) * 1000;
+    return true;
+}
+#    endif
+
 /** \brief Tapping
  *
  * Rule: Tap key is typed(pressed and released) within TAPPING_TERM.
@@ -307,6 +339,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .tap           = tapping_key.tap,
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
+#    ifdef HIGH_RES_EVENT_TIME
+                            .event.time_us = event.time_us,
+#    endif
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
 #    ifdef COMBO_ENABLE
@@ -358,6 +393,9 @@ bool process_tapping(keyrecord_t *keyp) {
                             .tap           = tapping_key.tap,
                             .event.key     = tapping_key.event.key,
                             .event.time    = event.time,
+#    ifdef HIGH_RES_EVENT_TIME
+                            .event.time_us = event.time_us,
+#    endif
                             .event.pressed = false,
                             .event.type    = tapping_key.event.type,
 #    ifdef COMBO_ENABLE
@@ -46,6 +46,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    include "audio.h"
 #endif /* AUDIO_ENABLE */
 
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+
 static bool command_common(uint8_t code);
 static void command_common_help(void);
 static void print_version(void);
@@ -536,6 +540,10 @@ static void command_console_help(void) {
           "ESC/q:	quit\n"
 #ifdef MOUSEKEY_ENABLE
           "m:	mousekey\n"
+#endif
+#ifdef PROFILING_ENABLE
+          "p:	print profiling probes\n"
+          "r:	reset profiling probes\n"
 #endif
     );
 }
@@ -556,6 +564,16 @@ static bool command_console(uint8_t code) {
             command_state = MOUSEKEY;
             mousekey_console(KC_SLASH /* ? */);
             return true;
+#endif
+#ifdef PROFILING_ENABLE
+        case KC_P:
+            profiling_print();
+            print("C> ");
+            return true;
+        case KC_R:
+            profiling_reset();
+            print("Profiling probes reset\nC> ");
+            return true;
 #endif
         default:
             print("?");
@@ -21,11 +21,13 @@
 Asymetric per-key algorithm. After pressing a key, it immediately changes state,
 with no further inputs accepted until DEBOUNCE milliseconds have occurred. After
 releasing a key, that state is pushed after no changes occur for DEBOUNCE milliseconds.
+Only the keys with a running counter are visited on each scan.
 */
 
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -57,6 +59,16 @@ static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, one bit per key
+static matrix_row_t active_keys[MATRIX_ROWS];
+
+#    ifdef DEBOUNCE_FULL_SCAN
+// Visit every key rather than only the active ones, to check the active key tracking in tests
+#        define VISITED_KEYS(keys) ((matrix_row_t)~(matrix_row_t)0 >> (sizeof(matrix_row_t) * 8 - MATRIX_COLS))
+#    else
+#        define VISITED_KEYS(keys) (keys)
+#    endif
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
@@ -71,6 +83,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++].time = DEBOUNCE_ELAPSED;
         }
     }
+    memset(active_keys, 0, sizeof(active_keys));
 }
 
 void debounce_free(void) {
@@ -109,18 +122,19 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     counters_need_update = false;
     matrix_need_update   = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
+        for (matrix_row_t keys = VISITED_KEYS(active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
+            matrix_row_t        col_mask         = (ROW_SHIFTER << col);
 
             if (debounce_pointer->time != DEBOUNCE_ELAPSED) {
                 if (debounce_pointer->time <= elapsed_time) {
                     debounce_pointer->time = DEBOUNCE_ELAPSED;
+                    active_keys[row] &= ~col_mask;
 
                     if (debounce_pointer->pressed) {
                         // key-down: eager
@@ -136,26 +150,27 @@ static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[],
                     counters_need_update = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
 
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
-
     matrix_need_update = false;
 
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
+        // Only keys which just changed, or which are back at their debounced state, need a visit
+        for (matrix_row_t keys = VISITED_KEYS(delta ^ active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
+            matrix_row_t        col_mask         = (ROW_SHIFTER << col);
 
             if (delta & col_mask) {
                 if (debounce_pointer->time == DEBOUNCE_ELAPSED) {
                     debounce_pointer->pressed = (raw[row] & col_mask);
                     debounce_pointer->time    = DEBOUNCE;
-                    counters_need_update      = true;
+                    active_keys[row] |= col_mask;
+                    counters_need_update = true;
 
                     if (debounce_pointer->pressed) {
                         // key-down: eager
@@ -167,9 +182,9 @@ static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], ui
                 if (!debounce_pointer->pressed) {
                     // key-up: defer
                     debounce_pointer->time = DEBOUNCE_ELAPSED;
+                    active_keys[row] &= ~col_mask;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
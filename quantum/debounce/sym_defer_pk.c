@@ -17,11 +17,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 /*
 Basic symmetric per-key algorithm. Uses an 8-bit counter per key.
 When no state changes have occured for DEBOUNCE milliseconds, we push the state.
+Only the keys with a running counter are visited on each scan.
 */
 
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -49,6 +51,16 @@ static fast_timer_t        last_time;
 static bool                counters_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, one bit per key
+static matrix_row_t active_keys[MATRIX_ROWS];
+
+#    ifdef DEBOUNCE_FULL_SCAN
+// Visit every key rather than only the active ones, to check the active key tracking in tests
+#        define VISITED_KEYS(keys) ((matrix_row_t)~(matrix_row_t)0 >> (sizeof(matrix_row_t) * 8 - MATRIX_COLS))
+#    else
+#        define VISITED_KEYS(keys) (keys)
+#    endif
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
@@ -63,6 +75,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
     }
+    memset(active_keys, 0, sizeof(active_keys));
 }
 
 void debounce_free(void) {
@@ -101,13 +114,15 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 }
 
 static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        for (matrix_row_t keys = VISITED_KEYS(active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
             if (*debounce_pointer != DEBOUNCE_ELAPSED) {
                 if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer        = DEBOUNCE_ELAPSED;
+                    *debounce_pointer = DEBOUNCE_ELAPSED;
+                    active_keys[row] &= ~(ROW_SHIFTER << col);
                     matrix_row_t cooked_next = (cooked[row] & ~(ROW_SHIFTER << col)) | (raw[row] & (ROW_SHIFTER << col));
                     cooked_changed |= cooked[row] ^ cooked_next;
                     cooked[row] = cooked_next;
@@ -116,16 +131,17 @@ static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[],
                     counters_need_update = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
 
 static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    debounce_counter_t *debounce_pointer = debounce_counters;
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta = raw[row] ^ cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        // Only keys which just changed, or which are back at their debounced state, need a visit
+        for (matrix_row_t keys = VISITED_KEYS(delta ^ active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
             if (delta & (ROW_SHIFTER << col)) {
                 if (*debounce_pointer == DEBOUNCE_ELAPSED) {
                     *debounce_pointer    = DEBOUNCE;
@@ -134,8 +150,8 @@ static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], u
             } else {
                 *debounce_pointer = DEBOUNCE_ELAPSED;
             }
-            debounce_pointer++;
         }
+        active_keys[row] = delta;
     }
 }
 
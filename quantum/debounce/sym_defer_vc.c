@@ -0,0 +1,168 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters, with the same behaviour as sym_defer_pk.
+When no state changes have occured on a key for DEBOUNCE milliseconds, we push its state.
+
+Rather than a byte per key, the counters are bit-sliced: counters[row][b] holds bit b of the counter of every key in
+that row. A whole row is counted down and compared with a few bitwise operations per counter bit, so the cost of a
+scan depends on the number of rows only, however many keys are bouncing. The counters live in a static array, sized
+for MATRIX_ROWS.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Enough bits to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+// All keys of a row where `bit` of `value` is set, none otherwise
+#    define BROADCAST(value, bit) ((matrix_row_t)0 - (matrix_row_t)(((value) >> (bit)) & 1))
+
+// A counter of 0 means the key is not debouncing
+static matrix_row_t counters[MATRIX_ROWS][COUNTER_BITS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(counters, 0, sizeof(counters));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        if (elapsed_time > UINT8_MAX) {
+            elapsed_time = UINT8_MAX;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static matrix_row_t active_counters(const matrix_row_t counter[]) {
+    matrix_row_t active = 0;
+    for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+        active |= counter[bit];
+    }
+    return active;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = counters[row];
+        matrix_row_t  active  = active_counters(counter);
+        if (!active) {
+            continue;
+        }
+
+        // Compare every counter with elapsed_time from the top bit down, counters wider than COUNTER_BITS are all below
+        matrix_row_t expired = active;
+        if (elapsed_time < (1 << COUNTER_BITS)) {
+            matrix_row_t below = 0;
+            matrix_row_t equal = ~(matrix_row_t)0;
+            for (int8_t bit = COUNTER_BITS - 1; bit >= 0; bit--) {
+                matrix_row_t elapsed_bit = BROADCAST(elapsed_time, bit);
+                below |= equal & ~counter[bit] & elapsed_bit;
+                equal &= ~(counter[bit] ^ elapsed_bit);
+            }
+            expired &= below | equal;
+        }
+
+        // Subtract elapsed_time from the counters still running, which are all larger than it
+        matrix_row_t running = active & ~expired;
+        matrix_row_t borrow  = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            matrix_row_t value       = counter[bit] & ~expired;
+            matrix_row_t elapsed_bit = BROADCAST(elapsed_time, bit) & running;
+            counter[bit]             = value ^ elapsed_bit ^ borrow;
+            borrow                   = (~value & (elapsed_bit | borrow)) | (value & elapsed_bit & borrow);
+        }
+
+        if (expired) {
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (running) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t *counter = counters[row];
+        matrix_row_t  delta   = raw[row] ^ cooked[row];
+        matrix_row_t  start   = delta & ~active_counters(counter);
+
+        // Keys back at their debounced state stop counting, keys which just changed count from DEBOUNCE
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            counter[bit] = (counter[bit] & delta) | (BROADCAST(DEBOUNCE, bit) & start);
+        }
+        if (start) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
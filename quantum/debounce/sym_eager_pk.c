@@ -17,11 +17,13 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 Basic per-key algorithm. Uses an 8-bit counter per key.
 After pressing a key, it immediately changes state, and sets a counter.
 No further inputs are accepted until DEBOUNCE milliseconds have occurred.
+Only the keys with a running counter are visited on each scan.
 */
 
 #include "debounce.h"
 #include "timer.h"
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef PROTOCOL_CHIBIOS
 #    if CH_CFG_USE_MEMCORE == FALSE
@@ -50,6 +52,16 @@ static bool                counters_need_update;
 static bool                matrix_need_update;
 static bool                cooked_changed;
 
+// Keys with a running counter, one bit per key
+static matrix_row_t active_keys[MATRIX_ROWS];
+
+#    ifdef DEBOUNCE_FULL_SCAN
+// Visit every key rather than only the active ones, to check the active key tracking in tests
+#        define VISITED_KEYS(keys) ((matrix_row_t)~(matrix_row_t)0 >> (sizeof(matrix_row_t) * 8 - MATRIX_COLS))
+#    else
+#        define VISITED_KEYS(keys) (keys)
+#    endif
+
 #    define DEBOUNCE_ELAPSED 0
 
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time);
@@ -64,6 +76,7 @@ void debounce_init(uint8_t num_rows) {
             debounce_counters[i++] = DEBOUNCE_ELAPSED;
         }
     }
+    memset(active_keys, 0, sizeof(active_keys));
 }
 
 void debounce_free(void) {
@@ -103,43 +116,46 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 // If the current time is > debounce counter, set the counter to enable input.
 static void update_debounce_counters(uint8_t num_rows, uint8_t elapsed_time) {
-    counters_need_update                 = false;
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    counters_need_update = false;
+    matrix_need_update   = false;
     for (uint8_t row = 0; row < num_rows; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+        for (matrix_row_t keys = VISITED_KEYS(active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
             if (*debounce_pointer != DEBOUNCE_ELAPSED) {
                 if (*debounce_pointer <= elapsed_time) {
-                    *debounce_pointer  = DEBOUNCE_ELAPSED;
+                    *debounce_pointer = DEBOUNCE_ELAPSED;
+                    active_keys[row] &= ~(ROW_SHIFTER << col);
                     matrix_need_update = true;
                 } else {
                     *debounce_pointer -= elapsed_time;
                     counters_need_update = true;
                 }
             }
-            debounce_pointer++;
         }
     }
 }
 
 // upload from raw_matrix to final matrix;
 static void transfer_matrix_values(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
-    matrix_need_update                   = false;
-    debounce_counter_t *debounce_pointer = debounce_counters;
+    matrix_need_update = false;
     for (uint8_t row = 0; row < num_rows; row++) {
         matrix_row_t delta        = raw[row] ^ cooked[row];
         matrix_row_t existing_row = cooked[row];
-        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
-            matrix_row_t col_mask = (ROW_SHIFTER << col);
+        // Keys with a running counter ignore their changes
+        for (matrix_row_t keys = VISITED_KEYS(delta & ~active_keys[row]); keys; keys &= keys - 1) {
+            uint8_t             col              = __builtin_ctzl(keys);
+            debounce_counter_t *debounce_pointer = &debounce_counters[row * MATRIX_COLS + col];
+            matrix_row_t        col_mask         = (ROW_SHIFTER << col);
             if (delta & col_mask) {
                 if (*debounce_pointer == DEBOUNCE_ELAPSED) {
-                    *debounce_pointer    = DEBOUNCE;
+                    *debounce_pointer = DEBOUNCE;
+                    active_keys[row] |= col_mask;
                     counters_need_update = true;
                     existing_row ^= col_mask; // flip the bit.
                     cooked_changed = true;
                 }
             }
-            debounce_pointer++;
         }
         cooked[row] = existing_row;
     }
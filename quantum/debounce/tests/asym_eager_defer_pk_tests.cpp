@@ -267,6 +267,26 @@ TEST_F(DebounceTest, TwoKeysShort) {
     runEvents();
 }
 
+TEST_F(DebounceTest, TwoKeysInOtherRowsAndColumns) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 9, DOWN}}, {{0, 9, DOWN}}},
+        {1, {{3, 0, DOWN}}, {{3, 0, DOWN}}},
+        /* Release key after 2ms delay */
+        {2, {{0, 9, UP}}, {}},
+        {3, {{3, 0, UP}}, {}},
+
+        {5, {}, {}}, /* See OneKeyShort1 */
+        {6, {}, {}}, /* See OneKeyShort1 */
+
+        {10, {}, {{0, 9, UP}}}, /* 5ms+5ms after DOWN at time 0 */
+        /* Press key again after 1ms delay */
+        {11, {{0, 9, DOWN}}, {{0, 9, DOWN}, {3, 0, UP}}}, /* 5ms+5ms after DOWN at time 0 */
+        {12, {{3, 0, DOWN}}, {{3, 0, DOWN}}},             /* 5ms+5ms after DOWN at time 0 */
+    });
+    runEvents();
+}
+
 TEST_F(DebounceTest, OneKeyDelayedScan1) {
     addEvents({
         /* Time, Inputs, Outputs */
@@ -0,0 +1,77 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+extern "C" {
+#include "debounce.h"
+#include "matrix.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+#define DEBOUNCE_BENCHMARK_STRINGIFY(x) #x
+#define DEBOUNCE_BENCHMARK_NAME(x) DEBOUNCE_BENCHMARK_STRINGIFY(x)
+
+#define BENCHMARK_SCANS 20000
+#define BENCHMARK_ATTEMPTS 5
+
+double debounce_benchmark_ns_per_scan(uint8_t keys_per_row) {
+    using clock = std::chrono::steady_clock;
+
+    // The chatter repeats every 4 scans, each key a scan behind the previous one so they do not all change together
+    matrix_row_t raw[4][MATRIX_ROWS] = {};
+    bool         changed[4]          = {};
+    for (uint8_t scan = 0; scan < 4; scan++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < keys_per_row; col++) {
+                if ((scan + row + col) % 4 != 3) {
+                    raw[scan][row] |= (matrix_row_t)1 << col;
+                }
+            }
+        }
+    }
+    for (uint8_t scan = 0; scan < 4; scan++) {
+        changed[scan] = std::memcmp(raw[scan], raw[(scan + 3) % 4], sizeof(raw[scan])) != 0;
+    }
+
+    matrix_row_t cooked[MATRIX_ROWS];
+    auto         best = clock::duration::max();
+
+    for (int attempt = 0; attempt < BENCHMARK_ATTEMPTS; attempt++) {
+        std::memset(cooked, 0, sizeof(cooked));
+        debounce_init(MATRIX_ROWS);
+        set_time(1000);
+
+        auto start = clock::now();
+        for (uint32_t scan = 0; scan < BENCHMARK_SCANS; scan++) {
+            advance_time(1);
+            debounce(raw[scan % 4], cooked, MATRIX_ROWS, changed[scan % 4]);
+        }
+        best = std::min(best, clock::now() - start);
+
+        debounce_free();
+    }
+
+    return std::chrono::duration<double, std::nano>(best).count() / BENCHMARK_SCANS;
+}
+
+TEST(DebounceBenchmark, CostPerScan) {
+    double idle = debounce_benchmark_ns_per_scan(0);
+    double one  = debounce_benchmark_ns_per_scan(1);
+    double all  = debounce_benchmark_ns_per_scan(MATRIX_COLS);
+
+    std::ios_base::fmtflags flags(std::cout.flags());
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "[ BENCH    ] " << DEBOUNCE_BENCHMARK_NAME(DEBOUNCE_ALGORITHM) << ": " << idle << " ns/scan idle, " << one << " ns/scan with 1 key per row bouncing, " << all << " ns/scan with all " << MATRIX_ROWS * MATRIX_COLS << " keys bouncing" << std::endl;
+    std::cout.flags(flags);
+}
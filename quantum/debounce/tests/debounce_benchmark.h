@@ -0,0 +1,14 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+
+/**
+ * @brief The host time spent in debounce() per scan, with the first `keys_per_row` keys of every row chattering.
+ *
+ * Scans are 1ms apart on the simulated timer. The chattering keys are pressed for 3ms and released for 1ms, which
+ * keeps them debouncing without ever settling. Results are only comparable between runs on the same machine.
+ */
+double debounce_benchmark_ns_per_scan(uint8_t keys_per_row);
@@ -28,27 +28,55 @@ debounce_sym_defer_g_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_g.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_g_tests.cpp
 
-debounce_sym_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=sym_defer_pk
 debounce_sym_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
-	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_sym_defer_pk_full_scan_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=sym_defer_pk_full_scan -DDEBOUNCE_FULL_SCAN
+debounce_sym_defer_pk_full_scan_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
 
 debounce_sym_defer_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_defer_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_defer_pr.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_defer_pr_tests.cpp
 
-debounce_sym_eager_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_sym_eager_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=sym_eager_pk
 debounce_sym_eager_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
-	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_sym_eager_pk_full_scan_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=sym_eager_pk_full_scan -DDEBOUNCE_FULL_SCAN
+debounce_sym_eager_pk_full_scan_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_eager_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_eager_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
 
 debounce_sym_eager_pr_DEFS := $(DEBOUNCE_COMMON_DEFS)
 debounce_sym_eager_pr_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/sym_eager_pr.c \
 	$(QUANTUM_PATH)/debounce/tests/sym_eager_pr_tests.cpp
 
-debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS)
+debounce_asym_eager_defer_pk_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=asym_eager_defer_pk
 debounce_asym_eager_defer_pk_SRC := $(DEBOUNCE_COMMON_SRC) \
 	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
-	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp
+	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_asym_eager_defer_pk_full_scan_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=asym_eager_defer_pk_full_scan -DDEBOUNCE_FULL_SCAN
+debounce_asym_eager_defer_pk_full_scan_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/asym_eager_defer_pk.c \
+	$(QUANTUM_PATH)/debounce/tests/asym_eager_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
+
+debounce_sym_defer_vc_DEFS := $(DEBOUNCE_COMMON_DEFS) -DDEBOUNCE_ALGORITHM=sym_defer_vc
+debounce_sym_defer_vc_SRC := $(DEBOUNCE_COMMON_SRC) \
+	$(QUANTUM_PATH)/debounce/sym_defer_vc.c \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_pk_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/sym_defer_vc_tests.cpp \
+	$(QUANTUM_PATH)/debounce/tests/debounce_benchmark.cpp
@@ -150,6 +150,24 @@ TEST_F(DebounceTest, TwoKeysShort) {
     runEvents();
 }
 
+TEST_F(DebounceTest, TwoKeysInOtherRowsAndColumns) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 9, DOWN}}, {}},
+        {1, {{3, 0, DOWN}}, {}},
+
+        {5, {}, {{0, 9, DOWN}}},
+        {6, {}, {{3, 0, DOWN}}},
+
+        {7, {{0, 9, UP}}, {}},
+        {8, {{3, 0, UP}}, {}},
+
+        {12, {}, {{0, 9, UP}}},
+        {13, {}, {{3, 0, UP}}},
+    });
+    runEvents();
+}
+
 TEST_F(DebounceTest, TwoKeysSimultaneous1) {
     addEvents({
         /* Time, Inputs, Outputs */
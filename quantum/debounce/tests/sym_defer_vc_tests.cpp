@@ -0,0 +1,56 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include "debounce_test_common.h"
+
+/* sym_defer_pk_tests.cpp is built into this test as well, these cover what is specific to the vertical counters.
+ * The scan cost is reported by the benchmark in debounce_benchmark.cpp. */
+
+TEST_F(DebounceTest, VerticalCountersKeysInOneRowAreIndependent) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 0, DOWN}}, {}},
+        {1, {{0, 1, DOWN}}, {}},
+        {2, {{0, 2, DOWN}}, {}},
+        {3, {{0, 3, DOWN}}, {}},
+        {4, {{0, 4, DOWN}}, {}},
+        {5, {{0, 5, DOWN}}, {{0, 0, DOWN}}},
+        {6, {{0, 6, DOWN}}, {{0, 1, DOWN}}},
+        {7, {{0, 7, DOWN}}, {{0, 2, DOWN}}},
+        {8, {{0, 8, DOWN}}, {{0, 3, DOWN}}},
+        {9, {{0, 9, DOWN}}, {{0, 4, DOWN}}},
+        {10, {}, {{0, 5, DOWN}}},
+        {11, {}, {{0, 6, DOWN}}},
+        {12, {}, {{0, 7, DOWN}}},
+        {13, {}, {{0, 8, DOWN}}},
+        {14, {}, {{0, 9, DOWN}}},
+
+        /* Release the whole row at once */
+        {20, {{0, 0, UP}, {0, 1, UP}, {0, 2, UP}, {0, 3, UP}, {0, 4, UP}, {0, 5, UP}, {0, 6, UP}, {0, 7, UP}, {0, 8, UP}, {0, 9, UP}}, {}},
+        {25, {}, {{0, 0, UP}, {0, 1, UP}, {0, 2, UP}, {0, 3, UP}, {0, 4, UP}, {0, 5, UP}, {0, 6, UP}, {0, 7, UP}, {0, 8, UP}, {0, 9, UP}}},
+    });
+    runEvents();
+}
+
+TEST_F(DebounceTest, VerticalCountersBouncingAcrossRows) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 1, DOWN}, {3, 9, DOWN}}, {}},
+        /* Bounces back, without affecting the other row */
+        {2, {{0, 1, UP}}, {}},
+        {3, {{1, 4, DOWN}}, {}},
+        {4, {{0, 1, DOWN}}, {}},
+
+        {5, {}, {{3, 9, DOWN}}},
+        {8, {}, {{1, 4, DOWN}}},
+        {9, {}, {{0, 1, DOWN}}},
+
+        /* Releases while another key in the same row is still bouncing */
+        {10, {{1, 4, UP}, {1, 5, DOWN}}, {}},
+        {12, {{1, 5, UP}}, {}},
+        {15, {}, {{1, 4, UP}}},
+    });
+    runEvents();
+}
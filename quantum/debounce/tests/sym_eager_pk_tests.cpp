@@ -176,6 +176,28 @@ TEST_F(DebounceTest, TwoKeysShort) {
     runEvents();
 }
 
+TEST_F(DebounceTest, TwoKeysInOtherRowsAndColumns) {
+    addEvents({
+        /* Time, Inputs, Outputs */
+        {0, {{0, 9, DOWN}}, {{0, 9, DOWN}}},
+        {1, {{0, 9, UP}}, {}},
+        {2, {{3, 0, DOWN}}, {{3, 0, DOWN}}},
+        {3, {{3, 0, UP}}, {}},
+
+        {5, {}, {{0, 9, UP}}},
+        /* Press key again after 1ms delay (debounce has not yet finished) */
+        {6, {{0, 9, DOWN}}, {}},
+        {7, {}, {{3, 0, UP}}},
+
+        /* Press key again after 1ms delay (debounce has not yet finished) */
+        {9, {{3, 0, DOWN}}, {}},
+        {10, {}, {{0, 9, DOWN}}}, /* 5ms after UP at time 5 */
+
+        {12, {}, {{3, 0, DOWN}}}, /* 5ms after UP at time 7 */
+    });
+    runEvents();
+}
+
 TEST_F(DebounceTest, OneKeyDelayedScan1) {
     addEvents({
         /* Time, Inputs, Outputs */
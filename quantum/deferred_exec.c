@@ -12,24 +12,110 @@
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time, packed at the start of the table. The next executor
+// due is always the first entry, so checking whether anything needs to run is O(1), and the number of entries in use
+// can be found with a binary search rather than walking the whole table.
+//
 
 static deferred_token current_token = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline bool is_due(const deferred_executor_t *entry, uint32_t now) {
+    return ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0;
+}
+
+static inline bool triggers_before(const deferred_executor_t *a, const deferred_executor_t *b) {
+    return ((int32_t)TIMER_DIFF_32(a->trigger_time, b->trigger_time)) < 0;
+}
+
+static inline void swap_entries(deferred_executor_t *a, deferred_executor_t *b) {
+    deferred_executor_t tmp = *a;
+    *a                      = *b;
+    *b                      = tmp;
+}
+
+static size_t active_count(deferred_executor_t *table, size_t table_count) {
+    size_t lo = 0;
+    size_t hi = table_count;
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (table[mid].token != INVALID_DEFERRED_TOKEN) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
     }
-    for (int i = 0; i < table_count; ++i) {
+    return lo;
+}
+
+static size_t find_entry(deferred_executor_t *table, size_t count, deferred_token token) {
+    for (size_t i = 0; i < count; ++i) {
         if (table[i].token == token) {
-            return false;
+            return i;
         }
     }
-    return true;
+    return count;
+}
+
+static size_t sift_up(deferred_executor_t *table, size_t index) {
+    while (index > 0) {
+        size_t parent = (index - 1) / 2;
+        if (!triggers_before(&table[index], &table[parent])) {
+            break;
+        }
+        swap_entries(&table[index], &table[parent]);
+        index = parent;
+    }
+    return index;
+}
+
+static void sift_down(deferred_executor_t *table, size_t count, size_t index) {
+    while (true) {
+        size_t earliest = index;
+        size_t left     = 2 * index + 1;
+        size_t right    = left + 1;
+        if (left < count && triggers_before(&table[left], &table[earliest])) {
+            earliest = left;
+        }
+        if (right < count && triggers_before(&table[right], &table[earliest])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            return;
+        }
+        swap_entries(&table[index], &table[earliest]);
+        index = earliest;
+    }
+}
+
+// Restores the heap after the trigger time of an entry has changed in either direction
+static inline void reschedule(deferred_executor_t *table, size_t count, size_t index) {
+    sift_down(table, count, sift_up(table, index));
+}
+
+static void remove_entry(deferred_executor_t *table, size_t count, size_t index) {
+    size_t last = count - 1;
+    if (index != last) {
+        table[index] = table[last];
+    }
+    table[last].token        = INVALID_DEFERRED_TOKEN;
+    table[last].trigger_time = 0;
+    table[last].callback     = NULL;
+    table[last].cb_arg       = NULL;
+    if (index != last) {
+        reschedule(table, last, index);
+    }
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
+static inline bool token_can_be_used(deferred_executor_t *table, size_t count, deferred_token token) {
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return false;
+    }
+    return find_entry(table, count, token) == count;
+}
+
+static inline deferred_token allocate_token(deferred_executor_t *table, size_t count) {
     deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
+    while (!token_can_be_used(table, count, current_token)) {
         ++current_token;
         if (current_token == first) {
             // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
@@ -49,27 +135,26 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
         return INVALID_DEFERRED_TOKEN;
     }
 
-    // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
-
-            // Set up the executor table entry
-            entry->token        = current_token;
-            entry->trigger_time = timer_read32() + delay_ms;
-            entry->callback     = callback;
-            entry->cb_arg       = cb_arg;
-            return current_token;
-        }
+    // Claim the slot after the last one in use, if there is one
+    size_t count = active_count(table, table_count);
+    if (count == table_count) {
+        return INVALID_DEFERRED_TOKEN;
     }
 
-    // None available
-    return INVALID_DEFERRED_TOKEN;
+    // Work out the new token value, dropping out if none were available
+    deferred_token token = allocate_token(table, count);
+    if (token == INVALID_DEFERRED_TOKEN) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    // Set up the executor table entry, and move it up to its place in the schedule
+    deferred_executor_t *entry = &table[count];
+    entry->token               = token;
+    entry->trigger_time        = timer_read32() + delay_ms;
+    entry->callback            = callback;
+    entry->cb_arg              = cb_arg;
+    sift_up(table, count);
+    return token;
 }
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
@@ -79,17 +164,17 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    size_t count = active_count(table, table_count);
+    size_t index = find_entry(table, count, token);
+    if (index == count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    table[index].trigger_time = timer_read32() + delay_ms;
+    reschedule(table, count, index);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
@@ -99,59 +184,66 @@ bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
     }
 
     // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    size_t count = active_count(table, table_count);
+    size_t index = find_entry(table, count, token);
+    if (index == count) {
+        // Not found
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, cancel and clear the table entry
+    remove_entry(table, count, index);
+    return true;
+}
+
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count) {
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN) {
+        return UINT32_MAX;
+    }
+    int32_t remaining = (int32_t)TIMER_DIFF_32(table[0].trigger_time, timer_read32());
+    return remaining > 0 ? remaining : 0;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
     uint32_t now = timer_read32();
 
     // Throttle only once per millisecond
-    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
-        *last_execution_time = now;
-
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
-            deferred_token       curr_token = entry->token;
-
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
-
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
-
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
-                }
-            }
+    if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) <= 0) {
+        return;
+    }
+    *last_execution_time = now;
+
+    // Nothing to do until the earliest executor is due
+    if (!table || table_count == 0 || table[0].token == INVALID_DEFERRED_TOKEN || !is_due(&table[0], now)) {
+        return;
+    }
+
+    // Bounded by the number of executors, so one that is re-queued with too short a delay can't stall the task
+    for (size_t runs = active_count(table, table_count); runs > 0 && table[0].token != INVALID_DEFERRED_TOKEN && is_due(&table[0], now); --runs) {
+        // Take a copy, as the callback may reorder the table by queueing, extending or cancelling executors
+        deferred_executor_t entry = table[0];
+
+        // Invoke the callback and work work out if we should be requeued
+        uint32_t delay_ms = entry.callback(entry.trigger_time, entry.cb_arg);
+
+        // If the token is gone, then the callback has canceled it. Skip further processing.
+        size_t count = active_count(table, table_count);
+        size_t index = find_entry(table, count, entry.token);
+        if (index == count) {
+            continue;
+        }
+
+        // Update the trigger time if we have to repeat, otherwise clear it out
+        if (delay_ms > 0) {
+            // Intentionally add just the delay to the existing trigger time -- this ensures the next
+            // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+            // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+            // considerable length of time, then this ensures best-effort timing between invocations.
+            table[index].trigger_time += delay_ms;
+            reschedule(table, count, index);
+        } else {
+            // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+            remove_entry(table, count, index);
         }
     }
 }
@@ -172,6 +264,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_time_until_next(void) {
+    return deferred_exec_advanced_time_until_next(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
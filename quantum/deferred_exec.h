@@ -14,7 +14,7 @@
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
@@ -60,6 +60,13 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Works out how long until the next deferred execution is due, so that the main loop can sleep until then.
+ *
+ * @return the number of milliseconds until the next execution, 0 if one is already due, or UINT32_MAX if none are queued
+ */
+uint32_t deferred_exec_time_until_next(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -73,6 +80,7 @@ void deferred_exec_task(void);
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
  *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        Entries are kept sorted by trigger time, so the array must be zero-initialised and only ever modified through the functions below.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
@@ -110,6 +118,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Works out how long until the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return the number of milliseconds until the next execution, 0 if one is already due, or UINT32_MAX if none are queued
+ */
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -0,0 +1,51 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Tracks which fixed-size chunks of a buffer have changed since they were last written out, one bit per chunk.
+
+    The LED drivers keep one of these next to each PWM buffer, so that a flush only transfers the register
+    blocks that hold LEDs which actually changed, rather than the whole frame.
+*/
+
+/**
+ * \brief The number of bytes needed to track a buffer of `length` bytes in chunks of `chunk_size`.
+ */
+#define DIRTY_CHUNKS_SIZE(length, chunk_size) (((((length) + (chunk_size)-1) / (chunk_size)) + 7) / 8)
+
+/**
+ * \brief Flags a chunk as changed.
+ */
+static inline void dirty_chunks_mark(uint8_t *chunks, uint8_t chunk) {
+    chunks[chunk / 8] |= 1 << (chunk % 8);
+}
+
+/**
+ * \brief Clears the flag of a chunk, returning whether it was set.
+ */
+static inline bool dirty_chunks_take(uint8_t *chunks, uint8_t chunk) {
+    uint8_t mask = 1 << (chunk % 8);
+    if (!(chunks[chunk / 8] & mask)) {
+        return false;
+    }
+    chunks[chunk / 8] &= ~mask;
+    return true;
+}
+
+/**
+ * \brief Whether any chunk is flagged as changed.
+ *
+ * \param size the size of the bitmap in bytes, as given by DIRTY_CHUNKS_SIZE()
+ */
+static inline bool dirty_chunks_any(const uint8_t *chunks, uint8_t size) {
+    for (uint8_t i = 0; i < size; i++) {
+        if (chunks[i]) {
+            return true;
+        }
+    }
+    return false;
+}
@@ -17,11 +17,17 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+#    include <string.h>
+#    include "deferred_exec.h"
+#endif
+
 #ifdef VIA_ENABLE
 #    include "via.h"
 #    define DYNAMIC_KEYMAP_EEPROM_START (VIA_EEPROM_CONFIG_END)
@@ -101,6 +107,106 @@ _Static_assert((DYNAMIC_KEYMAP_EEPROM_MAX_ADDR) - (DYNAMIC_KEYMAP_MACRO_EEPROM_A
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// The mirror covers keymaps, encoders and macros in one contiguous block, laid out exactly as in EEPROM.
+_Static_assert(DYNAMIC_KEYMAP_EEPROM_ADDR <= DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR && DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR <= DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR, "DYNAMIC_KEYMAP_RAM_MIRROR requires keymaps, encoders and macros to be stored in that order.");
+
+#    define DYNAMIC_KEYMAP_MIRROR_SIZE (DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - DYNAMIC_KEYMAP_EEPROM_ADDR)
+
+#    ifndef DYNAMIC_KEYMAP_WRITE_BACK_DELAY
+#        define DYNAMIC_KEYMAP_WRITE_BACK_DELAY 1000
+#    endif
+
+// Dirty tracking granularity, each dirty block is committed with a single eeprom_update_block().
+#    ifndef DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE
+#        define DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE 32
+#    endif
+
+#    define DYNAMIC_KEYMAP_MIRROR_BLOCK_COUNT ((DYNAMIC_KEYMAP_MIRROR_SIZE + DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE - 1) / DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE)
+
+static uint8_t             dynamic_keymap_mirror[DYNAMIC_KEYMAP_MIRROR_SIZE];
+static uint8_t             dynamic_keymap_mirror_dirty[(DYNAMIC_KEYMAP_MIRROR_BLOCK_COUNT + 7) / 8];
+static bool                dynamic_keymap_mirror_loaded    = false;
+static deferred_executor_t dynamic_keymap_executors[1]     = {0};
+static deferred_token      dynamic_keymap_write_back_token = INVALID_DEFERRED_TOKEN;
+static uint32_t            dynamic_keymap_last_exec        = 0;
+
+static void dynamic_keymap_mirror_load(void) {
+    if (!dynamic_keymap_mirror_loaded) {
+        eeprom_read_block(dynamic_keymap_mirror, (const void *)DYNAMIC_KEYMAP_EEPROM_ADDR, DYNAMIC_KEYMAP_MIRROR_SIZE);
+        dynamic_keymap_mirror_loaded = true;
+    }
+}
+
+static uint32_t dynamic_keymap_write_back_callback(uint32_t trigger_time, void *cb_arg) {
+    dynamic_keymap_write_back_token = INVALID_DEFERRED_TOKEN;
+    dynamic_keymap_flush();
+    return 0;
+}
+
+static uint8_t dynamic_keymap_read_byte(const void *address) {
+    dynamic_keymap_mirror_load();
+    return dynamic_keymap_mirror[(uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR];
+}
+
+// Only the RAM copy is updated here, the EEPROM write is batched with every other change made before the
+// write back fires.
+static void dynamic_keymap_update_byte(void *address, uint8_t value) {
+    dynamic_keymap_mirror_load();
+    uint16_t offset = (uintptr_t)address - DYNAMIC_KEYMAP_EEPROM_ADDR;
+    if (dynamic_keymap_mirror[offset] == value) {
+        return;
+    }
+    dynamic_keymap_mirror[offset] = value;
+
+    uint16_t block = offset / DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE;
+    dynamic_keymap_mirror_dirty[block / 8] |= 1 << (block % 8);
+    if (dynamic_keymap_write_back_token == INVALID_DEFERRED_TOKEN) {
+        dynamic_keymap_write_back_token = defer_exec_advanced(dynamic_keymap_executors, 1, DYNAMIC_KEYMAP_WRITE_BACK_DELAY, dynamic_keymap_write_back_callback, NULL);
+        // No executor available, fall back to writing through.
+        if (dynamic_keymap_write_back_token == INVALID_DEFERRED_TOKEN) {
+            dynamic_keymap_flush();
+        }
+    }
+}
+
+void dynamic_keymap_flush(void) {
+    for (uint16_t block = 0; block < DYNAMIC_KEYMAP_MIRROR_BLOCK_COUNT; block++) {
+        if (dynamic_keymap_mirror_dirty[block / 8] & (1 << (block % 8))) {
+            uint16_t offset = block * DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE;
+            uint16_t size   = DYNAMIC_KEYMAP_MIRROR_SIZE - offset;
+            if (size > DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE) {
+                size = DYNAMIC_KEYMAP_WRITE_BACK_BLOCK_SIZE;
+            }
+            eeprom_update_block(&dynamic_keymap_mirror[offset], (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), size);
+        }
+    }
+    memset(dynamic_keymap_mirror_dirty, 0, sizeof(dynamic_keymap_mirror_dirty));
+
+    if (dynamic_keymap_write_back_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec_advanced(dynamic_keymap_executors, 1, dynamic_keymap_write_back_token);
+        dynamic_keymap_write_back_token = INVALID_DEFERRED_TOKEN;
+    }
+}
+
+void dynamic_keymap_task(void) {
+    deferred_exec_advanced_task(dynamic_keymap_executors, 1, &dynamic_keymap_last_exec);
+}
+
+void dynamic_keymap_invalidate(void) {
+    memset(dynamic_keymap_mirror_dirty, 0, sizeof(dynamic_keymap_mirror_dirty));
+    dynamic_keymap_mirror_loaded = false;
+
+    if (dynamic_keymap_write_back_token != INVALID_DEFERRED_TOKEN) {
+        cancel_deferred_exec_advanced(dynamic_keymap_executors, 1, dynamic_keymap_write_back_token);
+        dynamic_keymap_write_back_token = INVALID_DEFERRED_TOKEN;
+    }
+}
+#else
+#    define dynamic_keymap_read_byte(address) eeprom_read_byte(address)
+#    define dynamic_keymap_update_byte(address, value) eeprom_update_byte(address, value)
+#endif // DYNAMIC_KEYMAP_RAM_MIRROR
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -114,8 +220,8 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = eeprom_read_byte(address) << 8;
-    keycode |= eeprom_read_byte(address + 1);
+    uint16_t keycode = dynamic_keymap_read_byte(address) << 8;
+    keycode |= dynamic_keymap_read_byte(address + 1);
     return keycode;
 }
 
@@ -123,8 +229,9 @@ void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_update_byte(address, (uint8_t)(keycode >> 8));
+    dynamic_keymap_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    layer_switch_cache_invalidate();
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -136,8 +243,8 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
-    keycode |= eeprom_read_byte(address + (clockwise ? 0 : 2) + 1);
+    uint16_t keycode = ((uint16_t)dynamic_keymap_read_byte(address + (clockwise ? 0 : 2))) << 8;
+    keycode |= dynamic_keymap_read_byte(address + (clockwise ? 0 : 2) + 1);
     return keycode;
 }
 
@@ -145,8 +252,8 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
-    eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
-    eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+    dynamic_keymap_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
+    dynamic_keymap_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
 }
 #endif // ENCODER_MAP_ENABLE
 
@@ -169,11 +276,11 @@ void dynamic_keymap_reset(void) {
 
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
+            *target = dynamic_keymap_read_byte(source);
         } else {
             *target = 0x00;
         }
@@ -184,15 +291,16 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
+            dynamic_keymap_update_byte(target, *source);
         }
         source++;
         target++;
     }
+    layer_switch_cache_invalidate();
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -220,11 +328,11 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
+            *target = dynamic_keymap_read_byte(source);
         } else {
             *target = 0x00;
         }
@@ -234,11 +342,11 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
+            dynamic_keymap_update_byte(target, *source);
         }
         source++;
         target++;
@@ -249,7 +357,7 @@ void dynamic_keymap_macro_reset(void) {
     void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
     void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
     while (p != end) {
-        eeprom_update_byte(p, 0);
+        dynamic_keymap_update_byte(p, 0);
         ++p;
     }
 }
@@ -264,7 +372,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // of buffer writing, possibly an aborted buffer
     // write. So do nothing.
     void *p = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE - 1);
-    if (eeprom_read_byte(p) != 0) {
+    if (dynamic_keymap_read_byte(p) != 0) {
         return;
     }
 
@@ -278,7 +386,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
         if (p == end) {
             return;
         }
-        if (eeprom_read_byte(p) == 0) {
+        if (dynamic_keymap_read_byte(p) == 0) {
             --id;
         }
         ++p;
@@ -289,7 +397,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
     // We already checked there was a null at the end of
     // the buffer, so this cannot go past the end
     while (1) {
-        data[0] = eeprom_read_byte(p++);
+        data[0] = dynamic_keymap_read_byte(p++);
         data[1] = 0;
         // Stop at the null terminator of this macro string
         if (data[0] == 0) {
@@ -297,14 +405,14 @@ void dynamic_keymap_macro_send(uint8_t id) {
         }
         if (data[0] == SS_QMK_PREFIX) {
             // Get the code
-            data[1] = eeprom_read_byte(p++);
+            data[1] = dynamic_keymap_read_byte(p++);
             // Unexpected null, abort.
             if (data[1] == 0) {
                 return;
             }
             if (data[1] == SS_TAP_CODE || data[1] == SS_DOWN_CODE || data[1] == SS_UP_CODE) {
                 // Get the keycode
-                data[2] = eeprom_read_byte(p++);
+                data[2] = dynamic_keymap_read_byte(p++);
                 // Unexpected null, abort.
                 if (data[2] == 0) {
                     return;
@@ -316,7 +424,7 @@ void dynamic_keymap_macro_send(uint8_t id) {
                 // At most this is 4 digits plus '|'
                 uint8_t i = 2;
                 while (1) {
-                    data[i] = eeprom_read_byte(p++);
+                    data[i] = dynamic_keymap_read_byte(p++);
                     // Unexpected null, abort
                     if (data[i] == 0) {
                         return;
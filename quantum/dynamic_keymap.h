@@ -68,3 +68,18 @@ void     dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t
 void     dynamic_keymap_macro_reset(void);
 
 void dynamic_keymap_macro_send(uint8_t id);
+
+#ifdef DYNAMIC_KEYMAP_RAM_MIRROR
+// With the RAM mirror enabled, changes are written back to EEPROM
+// DYNAMIC_KEYMAP_WRITE_BACK_DELAY milliseconds after the first unsaved change.
+// dynamic_keymap_flush() commits any pending changes immediately.
+// dynamic_keymap_invalidate() drops the RAM copy and any pending changes,
+// it must be called whenever the EEPROM is erased underneath it.
+void dynamic_keymap_flush(void);
+void dynamic_keymap_task(void);
+void dynamic_keymap_invalidate(void);
+#else
+#    define dynamic_keymap_flush()
+#    define dynamic_keymap_task()
+#    define dynamic_keymap_invalidate()
+#endif
@@ -13,6 +13,10 @@
 #    include "haptic.h"
 #endif
 
+#if defined(DYNAMIC_KEYMAP_ENABLE)
+#    include "dynamic_keymap.h"
+#endif
+
 #if defined(VIA_ENABLE)
 bool via_eeprom_is_valid(void);
 void via_eeprom_set_valid(bool valid);
@@ -47,6 +51,9 @@ __attribute__((weak)) void eeconfig_init_kb(void) {
 void eeconfig_init_quantum(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+#    if defined(DYNAMIC_KEYMAP_ENABLE)
+    dynamic_keymap_invalidate();
+#    endif
 #endif
 
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER);
@@ -109,6 +116,9 @@ void eeconfig_enable(void) {
 void eeconfig_disable(void) {
 #if defined(EEPROM_DRIVER)
     eeprom_driver_erase();
+#    if defined(DYNAMIC_KEYMAP_ENABLE)
+    dynamic_keymap_invalidate();
+#    endif
 #endif
     eeprom_update_word(EECONFIG_MAGIC, EECONFIG_MAGIC_NUMBER_OFF);
 }
@@ -0,0 +1,148 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "key_trace.h"
+#include "action_layer.h"
+#include "timer.h"
+
+static key_trace_record_t records[KEY_TRACE_BUFFER_SIZE];
+static uint16_t           records_head    = 0; // where the next record goes
+static uint16_t           records_count   = 0;
+static uint32_t           records_dropped = 0;
+static bool               recording       = true;
+
+void key_trace_record(keyevent_t event) {
+    if (!recording) {
+        return;
+    }
+
+    key_trace_record_t *record = &records[records_head];
+#ifdef HIGH_RES_EVENT_TIME
+    record->time = event.time_us;
+#else
+    // Widen the 16-bit event time, which may be a little in the past for events from the other half
+    record->time = timer_read32() - TIMER_DIFF_16(timer_read(), event.time);
+#endif
+    record->layer_state   = layer_state;
+    record->default_layer = get_highest_layer(default_layer_state);
+    record->row           = event.key.row;
+    record->col           = event.key.col;
+    record->event         = (event.type & KEY_TRACE_TYPE_MASK) | (event.pressed ? KEY_TRACE_PRESSED : 0);
+
+    records_head = (records_head + 1) % KEY_TRACE_BUFFER_SIZE;
+    if (records_count < KEY_TRACE_BUFFER_SIZE) {
+        records_count++;
+    } else {
+        records_dropped++;
+    }
+}
+
+void key_trace_clear(void) {
+    records_head    = 0;
+    records_count   = 0;
+    records_dropped = 0;
+}
+
+void key_trace_set_enabled(bool enabled) {
+    recording = enabled;
+}
+
+bool key_trace_is_enabled(void) {
+    return recording;
+}
+
+uint16_t key_trace_count(void) {
+    return records_count;
+}
+
+bool key_trace_get(uint16_t index, key_trace_record_t *record) {
+    if (index >= records_count) {
+        return false;
+    }
+
+    uint16_t oldest = (records_head + KEY_TRACE_BUFFER_SIZE - records_count) % KEY_TRACE_BUFFER_SIZE;
+    *record         = records[(oldest + index) % KEY_TRACE_BUFFER_SIZE];
+    return true;
+}
+
+uint16_t key_trace_size(void) {
+    return sizeof(key_trace_header_t) + records_count * sizeof(key_trace_record_t);
+}
+
+static void key_trace_get_header(key_trace_header_t *header) {
+    memcpy(header->magic, KEY_TRACE_MAGIC, sizeof(header->magic));
+    header->version     = KEY_TRACE_VERSION;
+    header->record_size = sizeof(key_trace_record_t);
+#ifdef HIGH_RES_EVENT_TIME
+    header->flags = KEY_TRACE_FLAG_TIME_US;
+#else
+    header->flags = 0;
+#endif
+    header->reserved = 0;
+    header->count    = records_count;
+    header->capacity = KEY_TRACE_BUFFER_SIZE;
+    header->dropped  = records_dropped;
+}
+
+uint16_t key_trace_read(uint16_t offset, void *buffer, uint16_t length) {
+    uint8_t *out    = buffer;
+    uint16_t copied = 0;
+
+    if (offset < sizeof(key_trace_header_t)) {
+        key_trace_header_t header;
+        key_trace_get_header(&header);
+
+        uint16_t chunk = MIN(length, sizeof(header) - offset);
+        memcpy(out, (const uint8_t *)&header + offset, chunk);
+        copied += chunk;
+        offset += chunk;
+    }
+
+    // Records are copied a whole or partial record at a time, as they may wrap around the end of the ring
+    while (copied < length && offset < key_trace_size()) {
+        uint16_t           index = (offset - sizeof(key_trace_header_t)) / sizeof(key_trace_record_t);
+        uint8_t            start = (offset - sizeof(key_trace_header_t)) % sizeof(key_trace_record_t);
+        key_trace_record_t record;
+        key_trace_get(index, &record);
+
+        uint16_t chunk = MIN(length - copied, sizeof(record) - start);
+        memcpy(out + copied, (const uint8_t *)&record + start, chunk);
+        copied += chunk;
+        offset += chunk;
+    }
+
+    return copied;
+}
+
+bool key_trace_process_raw_hid(uint8_t *data, uint8_t length) {
+    if (length < 5 || data[0] != KEY_TRACE_RAW_HID_ID) {
+        return false;
+    }
+
+    switch (data[1]) {
+        case key_trace_raw_hid_pause: {
+            // Keeps the trace from moving while the host reads it out
+            uint16_t size = key_trace_size();
+            recording     = false;
+            data[2]       = size & 0xFF;
+            data[3]       = size >> 8;
+            break;
+        }
+        case key_trace_raw_hid_read: {
+            uint16_t offset = data[2] | (data[3] << 8);
+            data[4]         = key_trace_read(offset, &data[5], length - 5);
+            break;
+        }
+        case key_trace_raw_hid_resume:
+            recording = true;
+            break;
+        case key_trace_raw_hid_clear:
+            key_trace_clear();
+            break;
+        default:
+            data[1] = key_trace_raw_hid_unhandled;
+            break;
+    }
+    return true;
+}
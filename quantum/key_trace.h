@@ -0,0 +1,119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+#include "util.h"
+
+/*
+    Records every event passed to action_exec() into a RAM ring buffer, together with the layer state it was
+    processed in, so that misfiring mod-taps and combos can be replayed on the host.
+
+    The trace is read out as a single byte stream: a key_trace_header_t followed by the recorded events, oldest
+    first. All fields are little endian. The stream can be dumped over raw HID with key_trace_process_raw_hid(),
+    and replayed against a keymap with the helpers in tests/key_trace.
+*/
+
+#ifndef KEY_TRACE_BUFFER_SIZE
+#    define KEY_TRACE_BUFFER_SIZE 128
+#endif
+
+#ifndef KEY_TRACE_RAW_HID_ID
+#    define KEY_TRACE_RAW_HID_ID 0xE7
+#endif
+
+#define KEY_TRACE_MAGIC "QKTR"
+#define KEY_TRACE_VERSION 1
+
+// Times are in microseconds rather than milliseconds, set when built with HIGH_RES_EVENT_TIME
+#define KEY_TRACE_FLAG_TIME_US (1 << 0)
+
+#define KEY_TRACE_PRESSED 0x80
+#define KEY_TRACE_TYPE_MASK 0x7F
+
+typedef struct PACKED {
+    char     magic[4];    // KEY_TRACE_MAGIC
+    uint8_t  version;     // KEY_TRACE_VERSION
+    uint8_t  record_size; // sizeof(key_trace_record_t)
+    uint8_t  flags;       // KEY_TRACE_FLAG_*
+    uint8_t  reserved;
+    uint16_t count;    // records following the header
+    uint16_t capacity; // KEY_TRACE_BUFFER_SIZE
+    uint32_t dropped;  // older records overwritten since the trace was last cleared
+} key_trace_header_t;
+
+typedef struct PACKED {
+    uint32_t time;          // when the event happened, in milliseconds or microseconds
+    uint32_t layer_state;   // layer_state before the event was processed
+    uint8_t  default_layer; // highest layer of default_layer_state
+    uint8_t  row;
+    uint8_t  col;
+    uint8_t  event; // keyevent_type_t, ORed with KEY_TRACE_PRESSED
+} key_trace_record_t;
+
+_Static_assert(sizeof(key_trace_header_t) == 16, "key_trace_header_t out of spec.");
+_Static_assert(sizeof(key_trace_record_t) == 12, "key_trace_record_t out of spec.");
+_Static_assert(KEY_TRACE_BUFFER_SIZE <= 4096, "KEY_TRACE_BUFFER_SIZE must fit a 16-bit trace size.");
+
+enum key_trace_raw_hid_command {
+    key_trace_raw_hid_pause     = 0x01, // stops recording, replies with the trace size in bytes at data[2]
+    key_trace_raw_hid_read      = 0x02, // reads from the offset at data[2], replies with the length at data[4]
+    key_trace_raw_hid_resume    = 0x03,
+    key_trace_raw_hid_clear     = 0x04,
+    key_trace_raw_hid_unhandled = 0xFF,
+};
+
+/**
+ * \brief Adds an event to the trace, overwriting the oldest one once the buffer is full.
+ *
+ * Called by action_exec() for every event other than ticks.
+ */
+void key_trace_record(keyevent_t event);
+
+/**
+ * \brief Drops all recorded events.
+ */
+void key_trace_clear(void);
+
+/**
+ * \brief Starts or stops recording. Recording is enabled from startup.
+ */
+void key_trace_set_enabled(bool enabled);
+
+bool key_trace_is_enabled(void);
+
+/**
+ * \brief The number of events in the trace.
+ */
+uint16_t key_trace_count(void);
+
+/**
+ * \brief Copies out a recorded event, 0 being the oldest.
+ *
+ * \return false if `index` is past the end of the trace
+ */
+bool key_trace_get(uint16_t index, key_trace_record_t *record);
+
+/**
+ * \brief The size of the trace stream in bytes, header included.
+ */
+uint16_t key_trace_size(void);
+
+/**
+ * \brief Copies `length` bytes of the trace stream, starting at `offset`.
+ *
+ * \return the number of bytes copied, which is less than `length` at the end of the stream
+ */
+uint16_t key_trace_read(uint16_t offset, void *buffer, uint16_t length);
+
+/**
+ * \brief Handles a raw HID packet addressed to the trace recorder, writing the reply into `data`.
+ *
+ * Call this from raw_hid_receive() and send `data` back when it returns true. With VIA, call it from
+ * via_command_kb() instead, which has to send the reply with raw_hid_send() itself and return true.
+ *
+ * \return false if the packet is not a KEY_TRACE_RAW_HID_ID command
+ */
+bool key_trace_process_raw_hid(uint8_t *data, uint8_t length);
@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiling.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -83,6 +84,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SECURE_ENABLE
 #    include "secure.h"
 #endif
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+#    include "send_string.h"
+#endif
 #ifdef POINTING_DEVICE_ENABLE
 #    include "pointing_device.h"
 #endif
@@ -104,12 +108,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
 #ifdef EEPROM_DRIVER
 #    include "eeprom_driver.h"
 #endif
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_BANK_COUNT)
+#    include "wear_leveling.h"
+#endif
 #if defined(CRC_ENABLE)
 #    include "crc.h"
 #endif
@@ -122,6 +132,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef SPLIT_KEYBOARD
 #    include "split_util.h"
 #endif
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_MATRIX_EVENTS)
+#    include "transactions.h"
+#endif
 #ifdef BLUETOOTH_ENABLE
 #    include "bluetooth.h"
 #endif
@@ -140,6 +153,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#ifdef MATRIX_WAKE_ENABLE
+#    include "matrix_wake.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -418,6 +434,9 @@ void keyboard_init(void) {
     encoder_init();
 #endif
     matrix_init();
+#ifdef MATRIX_WAKE_ENABLE
+    matrix_wake_init();
+#endif
     quantum_init();
     led_init_ports();
 #ifdef BACKLIGHT_ENABLE
@@ -507,6 +526,18 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
 #endif
 }
 
+#ifdef HIGH_RES_EVENT_TIME
+/**
+ * @brief Generates a tick event once the next timeout of the internal QMK
+ * state machine is due, rather than every millisecond.
+ */
+static inline void generate_tick_event(void) {
+    uint32_t deadline;
+    if (action_tick_deadline(&deadline) && timer_expired32(timer_read_us(), deadline)) {
+        action_exec(MAKE_TICK_EVENT);
+    }
+}
+#else
 /**
  * @brief Generates a tick event at a maximum rate of 1KHz that drives the
  * internal QMK state machine.
@@ -519,6 +550,7 @@ static inline void generate_tick_event(void) {
         last_tick = now;
     }
 }
+#endif
 
 /**
  * @brief This task scans the keyboards matrix and processes any key presses
@@ -533,6 +565,13 @@ static bool matrix_task(void) {
         return false;
     }
 
+#ifdef MATRIX_WAKE_ENABLE
+    // Nothing is held and nothing has changed since going idle, so there is nothing to scan or tick for
+    if (!matrix_wake_task()) {
+        return false;
+    }
+#endif
+
     static matrix_row_t matrix_previous[MATRIX_ROWS];
 
     matrix_scan();
@@ -541,6 +580,14 @@ static bool matrix_task(void) {
         matrix_changed |= matrix_previous[row] ^ matrix_get_row(row);
     }
 
+#ifdef MATRIX_WAKE_ENABLE
+    bool keys_held = false;
+    for (uint8_t row = 0; row < MATRIX_ROWS && !keys_held; row++) {
+        keys_held = matrix_get_row(row) != 0;
+    }
+    matrix_wake_scan_result(keys_held, matrix_changed);
+#endif
+
     matrix_scan_perf_task();
 
     // Short-circuit the complete matrix processing if it is not necessary
@@ -569,7 +616,18 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
-                    action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+                    keyevent_t event = MAKE_KEYEVENT(row, col, key_pressed);
+#if defined(SPLIT_COMMON_TRANSACTIONS) && defined(SPLIT_TRANSPORT_MATRIX_EVENTS)
+                    // Changes on the other half keep the time they were scanned there, rather than when they arrived
+#    ifdef HIGH_RES_EVENT_TIME
+                    const uint16_t arrival = event.time;
+                    transactions_slave_matrix_event_time(row, col, &event.time);
+                    event.time_us -= (uint32_t)TIMER_DIFF_16(arrival, event.time) * 1000;
+#    else
+                    transactions_slave_matrix_event_time(row, col, &event.time);
+#    endif
+#endif
+                    action_exec(event);
                 }
 
                 switch_events(row, col, key_pressed);
@@ -655,17 +713,24 @@ void quantum_task(void) {
 #ifdef SECURE_ENABLE
     secure_task();
 #endif
+
+#if defined(SEND_STRING_ENABLE) && defined(SEND_STRING_ASYNC_ENABLE)
+    send_string_task();
+#endif
 }
 
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
+    PROFILING_BEGIN(keyboard_task);
     __attribute__((unused)) bool activity_has_occurred = false;
-    if (matrix_task()) {
+    bool                         matrix_changed;
+    PROFILING_CALL_NAMED("matrix_task", matrix_changed = matrix_task());
+    if (matrix_changed) {
         last_matrix_activity_trigger();
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILING_CALL_NAMED("quantum_task", quantum_task());
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -679,7 +744,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILING_CALL_NAMED("rgb_matrix_task", rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -748,4 +813,14 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_task();
+#endif
+
+#if defined(WEAR_LEVELING_ENABLE) && defined(WEAR_LEVELING_BANK_COUNT)
+    wear_leveling_task();
+#endif
+
+    PROFILING_END(keyboard_task);
 }
@@ -38,6 +38,9 @@ typedef enum keyevent_type_t { TICK_EVENT = 0, KEY_EVENT = 1, ENCODER_CW_EVENT =
 typedef struct {
     keypos_t        key;
     uint16_t        time;
+#ifdef HIGH_RES_EVENT_TIME
+    uint32_t        time_us; // timer_read_us() when the event happened
+#endif
     keyevent_type_t type;
     bool            pressed;
 } keyevent_t;
@@ -74,7 +77,11 @@ static inline bool IS_DIPSWITCHEVENT(const keyevent_t event) {
 #define MAKE_KEYPOS(row_num, col_num) ((keypos_t){.row = (row_num), .col = (col_num)})
 
 /* Common keyevent_t object factory */
-#define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#ifdef HIGH_RES_EVENT_TIME
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .time_us = timer_read_us(), .type = (event_type)})
+#else
+#    define MAKE_EVENT(row_num, col_num, press, event_type) ((keyevent_t){.key = MAKE_KEYPOS((row_num), (col_num)), .pressed = (press), .time = timer_read(), .type = (event_type)})
+#endif
 
 /**
  * @brief Constructs a key event for a pressed or released key.
@@ -16,13 +16,10 @@
 
 #pragma once
 
-#ifdef __cplusplus
-#    define _Static_assert static_assert
-#endif
-
 #include "eeconfig.h"
 #include "keycode.h"
 #include "action_code.h"
+#include "util.h"
 
 uint16_t keycode_config(uint16_t keycode);
 uint8_t  mod_config(uint8_t mod);
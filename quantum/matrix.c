@@ -21,6 +21,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "matrix.h"
 #include "debounce.h"
 #include "atomic_util.h"
+#ifdef MATRIX_WAKE_ENABLE
+#    include "matrix_wake.h"
+#endif
 
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
@@ -270,6 +273,155 @@ __attribute__((weak)) void matrix_read_rows_on_col(matrix_row_t current_matrix[]
 #    error DIODE_DIRECTION is not defined!
 #endif
 
+#ifdef MATRIX_WAKE_ENABLE
+#    if defined(PROTOCOL_CHIBIOS) && defined(PAL_USE_CALLBACKS) && (PAL_USE_CALLBACKS == TRUE)
+static void matrix_wake_pal_callback(void *arg) {
+    (void)arg;
+    matrix_wake_signal();
+}
+
+// The same pad on every port shares one interrupt line (EXTI on STM32), only one of those pins can be armed
+static bool matrix_wake_pin_claim_line(uint32_t *claimed, pin_t pin) {
+    return matrix_wake_claim_line(claimed, PAL_PAD(pin));
+}
+
+static bool matrix_wake_pin_interrupt_enable(pin_t pin) {
+    // Same order as the PS/2 driver, the event is configured before the callback is attached to it
+    palEnableLineEvent(pin, PAL_EVENT_MODE_BOTH_EDGES);
+    palSetLineCallback(pin, matrix_wake_pal_callback, NULL);
+    return true;
+}
+
+static void matrix_wake_pin_interrupt_disable(pin_t pin) {
+    palDisableLineEvent(pin);
+}
+#    else
+static bool matrix_wake_pin_claim_line(uint32_t *claimed, pin_t pin) {
+    return true;
+}
+
+// Needs PAL_USE_CALLBACKS on ChibiOS, elsewhere the keyboard has to provide its own matrix_wake_arm()
+static bool matrix_wake_pin_interrupt_enable(pin_t pin) {
+    return false;
+}
+
+static void matrix_wake_pin_interrupt_disable(pin_t pin) {}
+#    endif
+
+#    ifdef DIRECT_PINS
+
+__attribute__((weak)) bool matrix_wake_arm(void) {
+    uint32_t claimed_lines = 0;
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin != NO_PIN && !matrix_wake_pin_claim_line(&claimed_lines, pin)) {
+                return false;
+            }
+        }
+    }
+
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin != NO_PIN && !matrix_wake_pin_interrupt_enable(pin)) {
+                matrix_wake_disarm();
+                return false;
+            }
+        }
+    }
+
+    // Anything pressed while arming would not raise an interrupt
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (!readMatrixPin(direct_pins[row][col])) {
+                matrix_wake_disarm();
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+__attribute__((weak)) void matrix_wake_disarm(void) {
+    for (uint8_t row = 0; row < ROWS_PER_HAND; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            pin_t pin = direct_pins[row][col];
+            if (pin != NO_PIN) {
+                matrix_wake_pin_interrupt_disable(pin);
+            }
+        }
+    }
+}
+
+#    elif defined(MATRIX_ROW_PINS) && defined(MATRIX_COL_PINS)
+#        if (DIODE_DIRECTION == COL2ROW)
+#            define WAKE_OUTPUT_PINS row_pins
+#            define WAKE_OUTPUT_COUNT ROWS_PER_HAND
+#            define WAKE_INPUT_PINS col_pins
+#            define WAKE_INPUT_COUNT MATRIX_COLS
+#            define wake_unselect_outputs unselect_rows
+#        else
+#            define WAKE_OUTPUT_PINS col_pins
+#            define WAKE_OUTPUT_COUNT MATRIX_COLS
+#            define WAKE_INPUT_PINS row_pins
+#            define WAKE_INPUT_COUNT ROWS_PER_HAND
+#            define wake_unselect_outputs unselect_cols
+#        endif
+
+__attribute__((weak)) bool matrix_wake_arm(void) {
+    uint32_t claimed_lines = 0;
+    for (uint8_t x = 0; x < WAKE_INPUT_COUNT; x++) {
+        if (WAKE_INPUT_PINS[x] != NO_PIN && !matrix_wake_pin_claim_line(&claimed_lines, WAKE_INPUT_PINS[x])) {
+            return false;
+        }
+    }
+
+    // Select every output at once, so that any key press pulls its input low
+    for (uint8_t x = 0; x < WAKE_OUTPUT_COUNT; x++) {
+        if (WAKE_OUTPUT_PINS[x] != NO_PIN) {
+            setPinOutput_writeLow(WAKE_OUTPUT_PINS[x]);
+        }
+    }
+
+    for (uint8_t x = 0; x < WAKE_INPUT_COUNT; x++) {
+        if (WAKE_INPUT_PINS[x] != NO_PIN && !matrix_wake_pin_interrupt_enable(WAKE_INPUT_PINS[x])) {
+            matrix_wake_disarm();
+            return false;
+        }
+    }
+    matrix_output_select_delay();
+
+    // Anything pressed while arming would not raise an interrupt
+    for (uint8_t x = 0; x < WAKE_INPUT_COUNT; x++) {
+        if (!readMatrixPin(WAKE_INPUT_PINS[x])) {
+            matrix_wake_disarm();
+            return false;
+        }
+    }
+    return true;
+}
+
+__attribute__((weak)) void matrix_wake_disarm(void) {
+    for (uint8_t x = 0; x < WAKE_INPUT_COUNT; x++) {
+        if (WAKE_INPUT_PINS[x] != NO_PIN) {
+            matrix_wake_pin_interrupt_disable(WAKE_INPUT_PINS[x]);
+        }
+    }
+    wake_unselect_outputs();
+    matrix_output_unselect_delay(0, false);
+}
+
+#    else
+// No pins to arm, so never leave the active state
+__attribute__((weak)) bool matrix_wake_arm(void) {
+    return false;
+}
+
+__attribute__((weak)) void matrix_wake_disarm(void) {}
+#    endif
+#endif // MATRIX_WAKE_ENABLE
+
 void matrix_init(void) {
 #ifdef SPLIT_KEYBOARD
     // Set pinout for right half if pinout for that half is defined
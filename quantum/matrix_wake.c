@@ -0,0 +1,93 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "matrix_wake.h"
+#include "action.h"
+#include "action_tapping.h"
+#include "timer.h"
+
+#ifdef SPLIT_KEYBOARD
+// The master has to keep polling the other half, which has no way to wake it
+#    error "MATRIX_WAKE_ENABLE is not supported on split keyboards"
+#endif
+
+#if MATRIX_WAKE_IDLE_TIMEOUT <= TAPPING_TERM
+// Tick events stop while idle, so any pending tap has to be resolved before getting there
+#    error "MATRIX_WAKE_IDLE_TIMEOUT must be longer than TAPPING_TERM"
+#endif
+
+static matrix_wake_state_t matrix_wake_state = MATRIX_WAKE_ACTIVE;
+static uint32_t            last_activity     = 0;
+static volatile bool       wake_pending      = false;
+
+void matrix_wake_init(void) {
+    if (matrix_wake_state == MATRIX_WAKE_IDLE) {
+        matrix_wake_disarm();
+    }
+    matrix_wake_state = MATRIX_WAKE_ACTIVE;
+    wake_pending      = false;
+    last_activity     = timer_read32();
+}
+
+bool matrix_wake_task(void) {
+    if (matrix_wake_state == MATRIX_WAKE_ACTIVE) {
+        return true;
+    }
+
+    if (!wake_pending) {
+        return false;
+    }
+
+    // A signal landing after this is for a change the scans below pick up anyway
+    wake_pending = false;
+    matrix_wake_disarm();
+    matrix_wake_state = MATRIX_WAKE_ACTIVE;
+    last_activity     = timer_read32();
+    return true;
+}
+
+void matrix_wake_scan_result(bool keys_held, bool changed) {
+    if (keys_held || changed) {
+        last_activity = timer_read32();
+        return;
+    }
+
+    if (timer_elapsed32(last_activity) < MATRIX_WAKE_IDLE_TIMEOUT) {
+        return;
+    }
+
+    // Clear any stale signal before the interrupts are armed, so only changes from here on wake us up
+    wake_pending = false;
+    if (matrix_wake_arm()) {
+        matrix_wake_state = MATRIX_WAKE_IDLE;
+    } else {
+        // Something is pressed after all, or interrupts are unavailable -- try again after another timeout
+        last_activity = timer_read32();
+    }
+}
+
+void matrix_wake_signal(void) {
+    wake_pending = true;
+}
+
+matrix_wake_state_t matrix_wake_get_state(void) {
+    return matrix_wake_state;
+}
+
+bool matrix_wake_claim_line(uint32_t *claimed, uint8_t line) {
+    uint32_t mask = (uint32_t)1 << line;
+    if (*claimed & mask) {
+        return false;
+    }
+    *claimed |= mask;
+    return true;
+}
+
+#ifdef CUSTOM_MATRIX
+// The default matrix provides its own, custom matrices without support never leave the active state
+__attribute__((weak)) bool matrix_wake_arm(void) {
+    return false;
+}
+
+__attribute__((weak)) void matrix_wake_disarm(void) {}
+#endif
@@ -0,0 +1,85 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Interrupt driven matrix scanning.
+
+    While keys are in use the matrix is scanned continuously as usual. Once nothing has been held for
+    MATRIX_WAKE_IDLE_TIMEOUT milliseconds, the matrix driver is asked to drive all of its outputs active and arm
+    edge interrupts on its inputs, and keyboard_task() stops scanning -- and generating tick events -- until one
+    of those interrupts fires.
+*/
+
+#ifndef MATRIX_WAKE_IDLE_TIMEOUT
+#    define MATRIX_WAKE_IDLE_TIMEOUT 1000
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum matrix_wake_state_t {
+    MATRIX_WAKE_ACTIVE,
+    MATRIX_WAKE_IDLE,
+} matrix_wake_state_t;
+
+/**
+ * \brief Resets to the active state and restarts the idle timer.
+ */
+void matrix_wake_init(void);
+
+/**
+ * \brief Whether the matrix should be scanned this time round.
+ *
+ * Leaves the idle state, disarming the interrupts, if a pin change has been signalled since.
+ */
+bool matrix_wake_task(void);
+
+/**
+ * \brief Reports the outcome of a matrix scan.
+ *
+ * \param keys_held whether any key is still held after the scan
+ * \param changed whether the scan saw any change
+ */
+void matrix_wake_scan_result(bool keys_held, bool changed);
+
+/**
+ * \brief Records a pin change, safe to call from an interrupt handler.
+ */
+void matrix_wake_signal(void);
+
+matrix_wake_state_t matrix_wake_get_state(void);
+
+/**
+ * \brief Drives all matrix outputs active and arms interrupts on its inputs.
+ *
+ * Implemented by the matrix driver. Must check the inputs after arming, so that a key pressed in the meantime
+ * is not missed.
+ *
+ * \return false if a key is already pressed or interrupts are unavailable, with the matrix left ready to scan
+ */
+bool matrix_wake_arm(void);
+
+/**
+ * \brief Disarms the interrupts and restores the matrix pins for scanning.
+ */
+void matrix_wake_disarm(void);
+
+/**
+ * \brief Claims an interrupt line for one of the pins to arm.
+ *
+ * For matrix drivers whose inputs may share interrupt lines, which have to be checked before arming any of them.
+ *
+ * \param claimed[in,out] bitmask of the lines claimed so far, starting at 0
+ * \param line the interrupt line of the pin, below 32
+ * \return false if the line was already claimed
+ */
+bool matrix_wake_claim_line(uint32_t *claimed, uint8_t line);
+
+#ifdef __cplusplus
+}
+#endif
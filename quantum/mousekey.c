@@ -17,13 +17,15 @@
 
 #include <stdint.h>
 #include <string.h>
-#include <math.h>
 #include "keycode.h"
 #include "host.h"
 #include "timer.h"
 #include "print.h"
 #include "debug.h"
 #include "mousekey.h"
+#ifdef MOUSEKEY_INERTIA
+#    include "mousekey_inertia.h"
+#endif
 
 static inline int8_t times_inv_sqrt2(int8_t x) {
     // 181/256 (0.70703125) is used as an approximation for 1/sqrt(2)
@@ -44,11 +46,11 @@ static uint8_t        mousekey_accel        = 0;
 static uint8_t        mousekey_repeat       = 0;
 static uint8_t        mousekey_wheel_repeat = 0;
 #ifdef MOUSEKEY_INERTIA
-static uint8_t mousekey_frame     = 0; // track whether gesture is inactive, first frame, or repeating
-static int8_t  mousekey_x_dir     = 0; // -1 / 0 / 1 = left / neutral / right
-static int8_t  mousekey_y_dir     = 0; // -1 / 0 / 0 = up / neutral / down
-static float  mousekey_x_inertia = 0; // current velocity, limit +/- MOUSEKEY_TIME_TO_MAX
-static float  mousekey_y_inertia = 0; // ...
+static uint8_t             mousekey_frame     = 0; // track whether gesture is inactive, first frame, or repeating
+static int8_t              mousekey_x_dir     = 0; // -1 / 0 / 1 = left / neutral / right
+static int8_t              mousekey_y_dir     = 0; // -1 / 0 / 0 = up / neutral / down
+static mousekey_velocity_t mousekey_x_inertia = 0; // current velocity, limit +/- MOUSEKEY_TIME_TO_MAX
+static mousekey_velocity_t mousekey_y_inertia = 0; // ...
 #endif
 #ifdef MK_KINETIC_SPEED
 static uint16_t mouse_timer = 0;
@@ -117,8 +119,8 @@ static int8_t move_unit(uint8_t axis) {
     int16_t unit;
 
     // handle X or Y axis
-    int8_t dir;
-    float inertia;
+    int8_t              dir;
+    mousekey_velocity_t inertia;
     if (axis) {
         inertia = mousekey_y_inertia;
         dir     = mousekey_y_dir;
@@ -133,8 +135,7 @@ static int8_t move_unit(uint8_t axis) {
         mousekey_frame = 1;
         unit           = base_move;
     } else { // acceleration
-        // linear acceleration (is here for reference, but doesn't feel as good during use)
-        unit = base_move + (MOUSEKEY_MOVE_DELTA * mk_max_speed * inertia / 2) / mk_time_to_max;
+        unit = mousekey_inertia_move(base_move, inertia, mk_max_speed, mk_time_to_max);
     }
 
     if (unit > MOUSEKEY_MOVE_MAX)
@@ -271,47 +272,6 @@ static uint8_t wheel_unit(void) {
 
 #    endif /* #ifndef MK_COMBINED */
 
-#    ifdef MOUSEKEY_INERTIA
-
-static int8_t calc_inertia(int8_t direction, float velocity) {
-    // simulate acceleration and deceleration
-
-    if (direction == 0 && velocity != 0)
-        // deceleration when no input on one of two axes.
-        velocity = velocity * (256 - 0.05) / 256;
-    else if ((direction < 0 && velocity > 0) || (direction > 0 && velocity < 0))
-        // changing direction
-        velocity = velocity * (256 - 16) / 256;
-
-    // acceleration
-    if ((direction > 0) && (velocity < mk_time_to_max))
-        velocity++;
-    else if ((direction < 0) && (velocity > -mk_time_to_max))
-        velocity--;
-
-    return velocity;
-}
-
-static void apply_combined_inertia(float *vx, float *vy) {
-    // Calculate the combined velocity vector
-    float velocity_magnitude = sqrt((*vx) * (*vx) + (*vy) * (*vy));
-    float angle = atan2(*vy, *vx);
-
-    float friction = 28;
-
-    // Apply deceleration to the magnitude of the velocity vector
-    if (velocity_magnitude > 0) {
-        // PPY: increased friction when not pressing either key
-        velocity_magnitude = (velocity_magnitude * (256 - friction)) / 256;
-    }
-
-    // Update the velocities based on the new magnitude and original angle
-    *vx = (float)(velocity_magnitude * cos(angle));
-    *vy = (float)(velocity_magnitude * sin(angle));
-}
-
-#    endif
-
 void mousekey_task(void) {
     // report cursor and scroll movement independently
     report_mouse_t tmpmr = mouse_report;
@@ -327,11 +287,11 @@ void mousekey_task(void) {
     if ((mousekey_frame) && timer_elapsed(last_timer_c) > ((mousekey_frame > 1) ? mk_interval : mk_delay * 10)) {
         if (mousekey_x_dir == 0 && mousekey_y_dir == 0) {
             // Apply combined inertia when no direction is pressed
-            apply_combined_inertia(&mousekey_x_inertia, &mousekey_y_inertia);
+            mousekey_inertia_coast(&mousekey_x_inertia, &mousekey_y_inertia);
         } else {
             // Apply inertia separately if any direction key is pressed
-            mousekey_x_inertia = calc_inertia(mousekey_x_dir, mousekey_x_inertia);
-            mousekey_y_inertia = calc_inertia(mousekey_y_dir, mousekey_y_inertia);
+            mousekey_x_inertia = mousekey_inertia_accelerate(mousekey_x_dir, mousekey_x_inertia, mk_time_to_max);
+            mousekey_y_inertia = mousekey_inertia_accelerate(mousekey_y_dir, mousekey_y_inertia, mk_time_to_max);
         }
 
         mouse_report.x = move_unit(0);
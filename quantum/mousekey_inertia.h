@@ -0,0 +1,117 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <math.h>
+#include "mousekey.h"
+
+/*
+    The MOUSEKEY_INERTIA velocity model, as used by mousekey_task() on every frame.
+
+    The velocity of each axis is counted in frames of acceleration, up to +/- mk_time_to_max. By default it is
+    kept as Q8.8 fixed point, which avoids software floating point on AVR and Cortex-M0 parts. Defining
+    MOUSEKEY_INERTIA_FLOAT brings back the original floating point model, which follows the same curves.
+*/
+
+/**
+ * \brief Updates the velocity of an axis for a frame in which a direction key is held on either axis.
+ *
+ * \param direction -1, 0 or 1, for the keys held on this axis
+ */
+static inline int8_t mousekey_inertia_accelerate_float(int8_t direction, float velocity, uint8_t time_to_max) {
+    // simulate acceleration and deceleration
+
+    if (direction == 0 && velocity != 0)
+        // deceleration when no input on one of two axes.
+        velocity = velocity * (256 - 0.05) / 256;
+    else if ((direction < 0 && velocity > 0) || (direction > 0 && velocity < 0))
+        // changing direction
+        velocity = velocity * (256 - 16) / 256;
+
+    // acceleration
+    if ((direction > 0) && (velocity < time_to_max))
+        velocity++;
+    else if ((direction < 0) && (velocity > -time_to_max))
+        velocity--;
+
+    return velocity;
+}
+
+/**
+ * \brief Slows both axes down together, for a frame in which no direction key is held.
+ */
+static inline void mousekey_inertia_coast_float(float *vx, float *vy) {
+    // Calculate the combined velocity vector
+    float velocity_magnitude = sqrt((*vx) * (*vx) + (*vy) * (*vy));
+    float angle              = atan2(*vy, *vx);
+
+    float friction = 28;
+
+    // Apply deceleration to the magnitude of the velocity vector
+    if (velocity_magnitude > 0) {
+        // PPY: increased friction when not pressing either key
+        velocity_magnitude = (velocity_magnitude * (256 - friction)) / 256;
+    }
+
+    // Update the velocities based on the new magnitude and original angle
+    *vx = (float)(velocity_magnitude * cos(angle));
+    *vy = (float)(velocity_magnitude * sin(angle));
+}
+
+/**
+ * \brief The distance an axis moves in a frame, before clamping to MOUSEKEY_MOVE_MAX.
+ *
+ * \param base_move the movement from the direction key alone
+ */
+static inline int16_t mousekey_inertia_move_float(int16_t base_move, float velocity, uint8_t max_speed, uint8_t time_to_max) {
+    // linear acceleration (is here for reference, but doesn't feel as good during use)
+    return base_move + (MOUSEKEY_MOVE_DELTA * max_speed * velocity / 2) / time_to_max;
+}
+
+#define MOUSEKEY_INERTIA_ONE 256
+
+static inline int16_t mousekey_inertia_accelerate_fixed(int8_t direction, int16_t velocity, uint8_t time_to_max) {
+    // The float model returns an int8_t, which bounds the speed just the same
+    int16_t limit = (time_to_max > INT8_MAX ? INT8_MAX : time_to_max) * MOUSEKEY_INERTIA_ONE;
+
+    if (direction == 0 && velocity != 0) {
+        // Deceleration by 0.05/256, which drops a whole step once truncated below
+        int16_t step = velocity / 5120;
+        velocity -= step ? step : (velocity > 0 ? 1 : -1);
+    } else if ((direction < 0 && velocity > 0) || (direction > 0 && velocity < 0)) {
+        velocity = (int32_t)velocity * (256 - 16) / 256;
+    }
+
+    if ((direction > 0) && (velocity < limit))
+        velocity += MOUSEKEY_INERTIA_ONE;
+    else if ((direction < 0) && (velocity > -limit))
+        velocity -= MOUSEKEY_INERTIA_ONE;
+
+    // Only whole steps are kept while a key is held, rounding towards zero
+    return velocity / MOUSEKEY_INERTIA_ONE * MOUSEKEY_INERTIA_ONE;
+}
+
+static inline void mousekey_inertia_coast_fixed(int16_t *vx, int16_t *vy) {
+    // Scaling the magnitude of the vector while keeping its angle is the same as scaling each axis
+    *vx = (int32_t)*vx * (256 - 28) / 256;
+    *vy = (int32_t)*vy * (256 - 28) / 256;
+}
+
+static inline int16_t mousekey_inertia_move_fixed(int16_t base_move, int16_t velocity, uint8_t max_speed, uint8_t time_to_max) {
+    // A single division, so the result truncates exactly like the float model
+    int32_t divisor = (int32_t)2 * time_to_max * MOUSEKEY_INERTIA_ONE;
+    return ((int32_t)base_move * divisor + (int32_t)MOUSEKEY_MOVE_DELTA * max_speed * velocity) / divisor;
+}
+
+#ifdef MOUSEKEY_INERTIA_FLOAT
+typedef float mousekey_velocity_t;
+#    define mousekey_inertia_accelerate mousekey_inertia_accelerate_float
+#    define mousekey_inertia_coast mousekey_inertia_coast_float
+#    define mousekey_inertia_move mousekey_inertia_move_float
+#else
+typedef int16_t mousekey_velocity_t;
+#    define mousekey_inertia_accelerate mousekey_inertia_accelerate_fixed
+#    define mousekey_inertia_coast mousekey_inertia_coast_fixed
+#    define mousekey_inertia_move mousekey_inertia_move_fixed
+#endif
@@ -16,9 +16,41 @@ typedef struct lvgl_state_t {
 static deferred_executor_t lvgl_executors[2] = {0}; // For lv_tick_inc and lv_task_handler
 static lvgl_state_t        lvgl_states[2]    = {0}; // For lv_tick_inc and lv_task_handler
 
+#if QP_LVGL_BUFFER_FRACTION < 1
+#    error QP_LVGL_BUFFER_FRACTION must be at least 1
+#endif
+
+#ifdef QP_LVGL_DOUBLE_BUFFER
+#    define QP_LVGL_BUFFER_COUNT 2
+#else
+#    define QP_LVGL_BUFFER_COUNT 1
+#endif
+
 painter_device_t selected_display = NULL;
 void *           color_buffer     = NULL;
 
+#ifdef QP_LVGL_DOUBLE_BUFFER
+static lv_disp_drv_t *flushing_disp = NULL; // Waiting for its transfer to the display to complete
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter LVGL Integration Internal: qp_lvgl_flush_complete
+
+// Tells LVGL it can reuse the buffer, once the transfer started by qp_lvgl_flush has completed
+static void qp_lvgl_flush_complete(void) {
+    if (flushing_disp && qp_pixdata_complete(selected_display)) {
+        lv_disp_drv_t *disp = flushing_disp;
+        flushing_disp       = NULL;
+        qp_flush(selected_display);
+        lv_disp_flush_ready(disp);
+    }
+}
+
+// LVGL calls this while it waits for a buffer to be released
+static void qp_lvgl_wait(lv_disp_drv_t *disp) {
+    qp_lvgl_flush_complete();
+}
+#endif // QP_LVGL_DOUBLE_BUFFER
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter LVGL Integration Internal: qp_lvgl_flush
 
@@ -26,9 +58,16 @@ void qp_lvgl_flush(lv_disp_drv_t *disp, const lv_area_t *area, lv_color_t *color
     if (selected_display) {
         uint32_t number_pixels = (area->x2 - area->x1 + 1) * (area->y2 - area->y1 + 1);
         qp_viewport(selected_display, area->x1, area->y1, area->x2, area->y2);
+#ifdef QP_LVGL_DOUBLE_BUFFER
+        // LVGL carries on rendering into the other buffer while this one is sent
+        qp_pixdata_async(selected_display, (void *)color_p, number_pixels);
+        flushing_disp = disp;
+        qp_lvgl_flush_complete();
+#else
         qp_pixdata(selected_display, (void *)color_p, number_pixels);
         qp_flush(selected_display);
         lv_disp_flush_ready(disp);
+#endif // QP_LVGL_DOUBLE_BUFFER
     }
 }
 
@@ -95,18 +134,22 @@ bool qp_lvgl_attach(painter_device_t device) {
 
     // Set up lvgl display buffer
     static lv_disp_draw_buf_t draw_buf;
-    // Allocate a buffer for 1/10 screen size
-    const size_t count_required   = driver->panel_width * driver->panel_height / 10;
-    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required);
+    // Allocate buffers for 1/QP_LVGL_BUFFER_FRACTION screen size
+    const size_t count_required   = driver->panel_width * driver->panel_height / QP_LVGL_BUFFER_FRACTION;
+    void *       new_color_buffer = realloc(color_buffer, sizeof(lv_color_t) * count_required * QP_LVGL_BUFFER_COUNT);
     if (!new_color_buffer) {
         qp_dprintf("qp_lvgl_attach: fail (could not set up memory buffer)\n");
         qp_lvgl_detach();
         return false;
     }
     color_buffer = new_color_buffer;
-    memset(color_buffer, 0, sizeof(lv_color_t) * count_required);
+    memset(color_buffer, 0, sizeof(lv_color_t) * count_required * QP_LVGL_BUFFER_COUNT);
     // Initialize the display buffer.
+#ifdef QP_LVGL_DOUBLE_BUFFER
+    lv_disp_draw_buf_init(&draw_buf, color_buffer, (lv_color_t *)color_buffer + count_required, count_required);
+#else
     lv_disp_draw_buf_init(&draw_buf, color_buffer, NULL, count_required);
+#endif // QP_LVGL_DOUBLE_BUFFER
 
     selected_display = device;
 
@@ -120,6 +163,9 @@ bool qp_lvgl_attach(painter_device_t device) {
     disp_drv.draw_buf = &draw_buf;     /*Assign the buffer to the display*/
     disp_drv.hor_res  = panel_width;   /*Set the horizontal resolution of the display*/
     disp_drv.ver_res  = panel_height;  /*Set the vertical resolution of the display*/
+#ifdef QP_LVGL_DOUBLE_BUFFER
+    disp_drv.wait_cb = qp_lvgl_wait; /*Release buffers as their transfers complete*/
+#endif
     lv_disp_drv_register(&disp_drv);   /*Finally register the driver*/
 
     return true;
@@ -132,6 +178,14 @@ void qp_lvgl_detach(void) {
     for (int i = 0; i < 2; ++i) {
         cancel_deferred_exec_advanced(lvgl_executors, 2, lvgl_states[i].defer_token);
     }
+#ifdef QP_LVGL_DOUBLE_BUFFER
+    // The buffer can't be freed while it's still being sent
+    if (selected_display) {
+        while (!qp_pixdata_complete(selected_display)) {
+        }
+    }
+    flushing_disp = NULL;
+#endif // QP_LVGL_DOUBLE_BUFFER
     if (color_buffer) {
         free(color_buffer);
         color_buffer = NULL;
@@ -144,5 +198,8 @@ void qp_lvgl_detach(void) {
 
 void qp_lvgl_internal_tick(void) {
     static uint32_t last_lvgl_exec = 0;
+#ifdef QP_LVGL_DOUBLE_BUFFER
+    qp_lvgl_flush_complete();
+#endif
     deferred_exec_advanced_task(lvgl_executors, 2, &last_lvgl_exec);
 }
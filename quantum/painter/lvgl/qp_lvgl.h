@@ -11,6 +11,13 @@
 #    define QP_LVGL_TASK_PERIOD 5
 #endif
 
+// LVGL renders into buffers of 1/QP_LVGL_BUFFER_FRACTION of the screen
+#ifndef QP_LVGL_BUFFER_FRACTION
+#    define QP_LVGL_BUFFER_FRACTION 10
+#endif
+
+// Define QP_LVGL_DOUBLE_BUFFER to render into a second buffer while the first is transferred to the display
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter - LVGL External API
 
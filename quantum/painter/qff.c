@@ -10,7 +10,7 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF API
 
-bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, uint8_t *bpp, bool *has_palette, bool *is_panel_native, painter_compression_t *compression_scheme, uint32_t *total_bytes) {
+bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *has_ascii_table, uint16_t *num_unicode_glyphs, bool *has_sorted_unicode_table, uint8_t *bpp, bool *has_palette, bool *is_panel_native, painter_compression_t *compression_scheme, uint32_t *total_bytes) {
     // Seek to the start
     qp_stream_setpos(stream, 0);
 
@@ -27,8 +27,8 @@ bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *h
     }
 
     // Make sure the magic and version are correct
-    if (font_descriptor.magic != QFF_MAGIC || font_descriptor.qff_version != 0x01) {
-        qp_dprintf("Failed to validate font_descriptor, expected magic 0x%06X was 0x%06X, expected version = 0x%02X was 0x%02X\n", (int)QFF_MAGIC, (int)font_descriptor.magic, (int)0x01, (int)font_descriptor.qff_version);
+    if (font_descriptor.magic != QFF_MAGIC || (font_descriptor.qff_version != QFF_VERSION_1 && font_descriptor.qff_version != QFF_VERSION_2)) {
+        qp_dprintf("Failed to validate font_descriptor, expected magic 0x%06X was 0x%06X, expected version <= 0x%02X was 0x%02X\n", (int)QFF_MAGIC, (int)font_descriptor.magic, (int)QFF_VERSION_2, (int)font_descriptor.qff_version);
         return false;
     }
 
@@ -48,6 +48,9 @@ bool qff_read_font_descriptor(qp_stream_t *stream, uint8_t *line_height, bool *h
     if (num_unicode_glyphs) {
         *num_unicode_glyphs = font_descriptor.num_unicode_glyphs;
     }
+    if (has_sorted_unicode_table) {
+        *has_sorted_unicode_table = font_descriptor.qff_version >= QFF_VERSION_2;
+    }
     if (bpp || has_palette) {
         if (!qgf_parse_format(font_descriptor.format, bpp, has_palette, is_panel_native)) {
             return false;
@@ -102,7 +105,7 @@ bool qff_validate_stream(qp_stream_t *stream) {
     bool     has_ascii_table;
     uint16_t num_unicode_glyphs;
 
-    if (!qff_read_font_descriptor(stream, NULL, &has_ascii_table, &num_unicode_glyphs, NULL, NULL, NULL, NULL, NULL)) {
+    if (!qff_read_font_descriptor(stream, NULL, &has_ascii_table, &num_unicode_glyphs, NULL, NULL, NULL, NULL, NULL, NULL)) {
         return false;
     }
 
@@ -127,7 +130,7 @@ uint32_t qff_get_total_size(qp_stream_t *stream) {
 
     // Read the font descriptor, grabbing the size
     uint32_t total_size;
-    if (!qff_read_font_descriptor(stream, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &total_size)) {
+    if (!qff_read_font_descriptor(stream, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, &total_size)) {
         return false;
     }
 
@@ -318,3 +318,47 @@ bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native
     qp_comms_stop(device);
     return ret;
 }
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_pixdata_async
+
+bool qp_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count) {
+    qp_dprintf("qp_pixdata_async: entry\n");
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_pixdata_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    // Fall back to a synchronous transfer if either the driver or the comms can't do any better
+    if (!driver->driver_vtable->pixdata_async || !qp_comms_async_capable(device)) {
+        return qp_pixdata(device, pixel_data, native_pixel_count);
+    }
+
+    if (!qp_comms_start(device)) {
+        qp_dprintf("qp_pixdata_async: fail (could not start comms)\n");
+        return false;
+    }
+
+    // Comms stay started until the transfer completes, see qp_pixdata_complete
+    bool ret = driver->driver_vtable->pixdata_async(device, pixel_data, native_pixel_count);
+    qp_dprintf("qp_pixdata_async: %s\n", ret ? "ok" : "fail");
+    if (!driver->comms_async_pending) {
+        qp_comms_stop(device);
+    }
+    return ret;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_pixdata_complete
+
+bool qp_pixdata_complete(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        // Nothing can have been started on an invalid device, so there's nothing to wait for
+        qp_dprintf("qp_pixdata_complete: fail (validation_ok == false)\n");
+        return true;
+    }
+
+    return qp_comms_async_complete(device);
+}
@@ -56,6 +56,15 @@
 #    define QUANTUM_PAINTER_LOAD_FONTS_TO_RAM FALSE
 #endif
 
+#ifndef QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+/**
+ * @def This controls the number of recently drawn unicode glyphs each loaded font remembers the location of, so that
+ *      repeated characters skip the unicode glyph table lookup. Each entry costs 8 bytes of RAM per font slot, as
+ *      configured by \ref QUANTUM_PAINTER_NUM_FONTS. Defaults to 0, which disables the cache.
+ */
+#    define QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE
+
 #ifndef QUANTUM_PAINTER_CONCURRENT_ANIMATIONS
 /**
  * @def This controls the maximum number of animations that Quantum Painter can play simultaneously. Increasing this
@@ -72,6 +81,33 @@
 #    define QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE 1024
 #endif
 
+#ifndef QUANTUM_PAINTER_DECODE_BLOCK_SIZE
+/**
+ * @def This controls the number of pixels decoded at a time when drawing images and fonts. Whole RLE runs are read
+ *      into a stack buffer of twice this size in bytes, and converted to native pixels with one driver call per block.
+ *      Must be a multiple of 8. Set to 0 to decode one pixel at a time instead.
+ */
+#    define QUANTUM_PAINTER_DECODE_BLOCK_SIZE 64
+#endif
+
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+/**
+ * @def This controls the number of bytes of RAM set aside for images already converted to the display's native pixel
+ *      format. Images opted in with \ref qp_cache_image are decoded once, then sent straight to the display on later
+ *      draws. The least recently drawn images are evicted when the cache is full. Defaults to 0, which disables the
+ *      cache.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_SIZE 0
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE
+
+#ifndef QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES
+/**
+ * @def This controls the maximum number of image frames held by the native image cache at any one time, each costing
+ *      a few tens of bytes of RAM. Only relevant when \ref QUANTUM_PAINTER_IMAGE_CACHE_SIZE is non-zero.
+ */
+#    define QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES 8
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES
+
 #ifndef QUANTUM_PAINTER_SUPPORTS_256_PALETTE
 /**
  * @def This controls whether 256-color palettes are supported. This has relatively hefty requirements on RAM -- at
@@ -341,6 +377,32 @@ bool qp_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t
  */
 bool qp_pixdata(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
 
+/**
+ * Starts transferring raw pixel data to the display, without waiting for the transfer to complete.
+ *
+ * @note This is for advanced uses only, and should not be required for normal Quantum Painter functionality.
+ *
+ * @note The pixel data must not be modified until \ref qp_pixdata_complete returns true. Any other drawing to the
+ *       display waits for the transfer to complete first. Displays or comms drivers without asynchronous transfers
+ *       fall back to \ref qp_pixdata.
+ *
+ * @param device[in] the handle of the device to control
+ * @param pixel_data[in] pointer to buffer data
+ * @param native_pixel_count[in] the number of pixels to transmit
+ * @return true if the transfer was started
+ * @return false if the transfer could not be started
+ */
+bool qp_pixdata_async(painter_device_t device, const void *pixel_data, uint32_t native_pixel_count);
+
+/**
+ * Checks whether a transfer started by \ref qp_pixdata_async has completed.
+ *
+ * @param device[in] the handle of the device to control
+ * @return true if no transfer is in progress, including on an invalid device
+ * @return false if the transfer is still in progress
+ */
+bool qp_pixdata_complete(painter_device_t device);
+
 /**
  * Loads an image into memory.
  *
@@ -362,6 +424,19 @@ painter_image_handle_t qp_load_image_mem(const void *buffer);
  */
 bool qp_close_image(painter_image_handle_t image);
 
+/**
+ * Opts an image in or out of the native image cache.
+ *
+ * @note Only has an effect if \ref QUANTUM_PAINTER_IMAGE_CACHE_SIZE is non-zero. Cached frames are dropped when the
+ *       image is opted out, or closed with \ref qp_close_image.
+ *
+ * @param image[in] the handle of the image to cache
+ * @param enable[in] whether later draws of the image should be cached
+ * @return true if the image is valid and the cache is enabled
+ * @return false otherwise
+ */
+bool qp_cache_image(painter_image_handle_t image, bool enable);
+
 /**
  * Draws an image to the display.
  *
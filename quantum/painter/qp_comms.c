@@ -23,6 +23,10 @@ bool qp_comms_start(painter_device_t device) {
         return false;
     }
 
+    // Anything else sent to the display has to wait for an asynchronous transfer to finish first
+    while (!qp_comms_async_complete(device)) {
+    }
+
     return driver->comms_vtable->comms_start(device);
 }
 
@@ -46,6 +50,46 @@ uint32_t qp_comms_send(painter_device_t device, const void *data, uint32_t byte_
     return driver->comms_vtable->comms_send(device, data, byte_count);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous comms APIs
+
+bool qp_comms_async_capable(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    return driver->comms_vtable->comms_send_async != NULL && driver->comms_vtable->comms_busy != NULL;
+}
+
+// Expects comms to have been started, they're stopped by qp_comms_async_complete() once the transfer has finished
+bool qp_comms_send_async(painter_device_t device, const void *data, uint32_t byte_count) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver || !driver->validate_ok) {
+        qp_dprintf("qp_comms_send_async: fail (validation_ok == false)\n");
+        return false;
+    }
+
+    if (!qp_comms_async_capable(device)) {
+        qp_dprintf("qp_comms_send_async: fail (comms driver is synchronous only)\n");
+        return false;
+    }
+
+    driver->comms_async_pending = driver->comms_vtable->comms_send_async(device, data, byte_count);
+    return driver->comms_async_pending;
+}
+
+bool qp_comms_async_complete(painter_device_t device) {
+    painter_driver_t *driver = (painter_driver_t *)device;
+    if (!driver->comms_async_pending) {
+        return true;
+    }
+
+    if (driver->comms_vtable->comms_busy(device)) {
+        return false;
+    }
+
+    driver->comms_async_pending = false;
+    driver->comms_vtable->comms_stop(device);
+    return true;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
@@ -16,6 +16,13 @@ bool     qp_comms_start(painter_device_t device);
 void     qp_comms_stop(painter_device_t device);
 uint32_t qp_comms_send(painter_device_t device, const void* data, uint32_t byte_count);
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Asynchronous comms APIs, for comms drivers which provide comms_send_async
+
+bool qp_comms_async_capable(painter_device_t device);
+bool qp_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count);
+bool qp_comms_async_complete(painter_device_t device);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Comms APIs that use a D/C pin
 
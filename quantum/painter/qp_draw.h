@@ -12,6 +12,14 @@
 // Global variable used for native pixel data streaming.
 extern uint8_t qp_internal_global_pixdata_buffer[QUANTUM_PAINTER_PIXDATA_BUFFER_SIZE];
 
+// Sends the first native_pixel_count pixels of the global pixdata buffer to the display.
+bool qp_internal_flush_pixdata(painter_device_t device, uint32_t native_pixel_count);
+
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+// Copies native pixel data about to be sent to the display into the image cache entry being filled, if any.
+void qp_internal_image_cache_capture(const uint8_t* pixdata, uint32_t byte_count);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
 // Check if the supplied bpp is capable of being rendered
 bool qp_internal_bpp_capable(uint8_t bits_per_pixel);
 
@@ -2,10 +2,15 @@
 // Copyright 2023 Pablo Martinez (@elpekenin) <elpekenin@elpekenin.dev>
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
 
+#if (QUANTUM_PAINTER_DECODE_BLOCK_SIZE % 8) != 0
+#    error QUANTUM_PAINTER_DECODE_BLOCK_SIZE must be a multiple of 8, so that a block never splits the pixels of a byte
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Palette / Monochrome-format decoder
 
@@ -126,6 +131,14 @@ static inline int16_t qp_drawimage_byte_rle_decoder(void* cb_arg) {
     return c;
 }
 
+bool qp_internal_flush_pixdata(painter_device_t device, uint32_t native_pixel_count) {
+    painter_driver_t* driver = (painter_driver_t*)device;
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    qp_internal_image_cache_capture(qp_internal_global_pixdata_buffer, native_pixel_count * driver->native_bits_per_pixel / 8);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    return driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, native_pixel_count);
+}
+
 bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg) {
     qp_internal_pixel_output_state_t* state  = (qp_internal_pixel_output_state_t*)cb_arg;
     painter_driver_t*                 driver = (painter_driver_t*)state->device;
@@ -136,7 +149,7 @@ bool qp_internal_pixel_appender(qp_pixel_t* palette, uint8_t index, void* cb_arg
 
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->pixel_write_pos == state->max_pixels) {
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->pixel_write_pos)) {
+        if (!qp_internal_flush_pixdata(state->device, state->pixel_write_pos)) {
             return false;
         }
         state->pixel_write_pos = 0;
@@ -156,7 +169,7 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     // If we've hit the transmit limit, send out the entire buffer and reset the write position
     if (state->byte_write_pos == state->max_bytes) {
         painter_driver_t* driver = (painter_driver_t*)state->device;
-        if (!driver->driver_vtable->pixdata(state->device, qp_internal_global_pixdata_buffer, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
+        if (!qp_internal_flush_pixdata(state->device, state->byte_write_pos * 8 / driver->native_bits_per_pixel)) {
             return false;
         }
         state->byte_write_pos = 0;
@@ -165,6 +178,153 @@ bool qp_internal_byte_appender(uint8_t byteval, void* cb_arg) {
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Block decode, whole runs at a time
+
+#if QUANTUM_PAINTER_DECODE_BLOCK_SIZE > 0
+
+// Reads the next `length` decoded bytes. Runs from the built-in decoders are copied whole, anything else goes through the callback a byte at a time.
+static bool qp_internal_read_bytes(qp_internal_byte_input_callback input_callback, void* input_arg, uint8_t* buffer, uint32_t length) {
+    qp_internal_byte_input_state_t* state = (qp_internal_byte_input_state_t*)input_arg;
+
+    if (input_callback == qp_drawimage_byte_uncompressed_decoder) {
+        return qp_stream_read(buffer, 1, length, state->src_stream) == length;
+    }
+
+    if (input_callback == qp_drawimage_byte_rle_decoder) {
+        // Leaves the state as the byte-wise decoder would, so that fonts can mix both across glyphs
+        while (length > 0) {
+            if (state->rle.mode == MARKER_BYTE) {
+                int16_t marker = qp_stream_get(state->src_stream);
+                if (marker < 0) {
+                    return false;
+                }
+                if (marker >= 128) {
+                    state->rle.mode   = NON_REPEATING_RUN;
+                    state->rle.remain = marker - 127;
+                } else {
+                    state->rle.mode   = REPEATING_RUN;
+                    state->rle.remain = marker;
+                }
+
+                state->curr = qp_stream_get(state->src_stream);
+                if (state->curr < 0) {
+                    return false;
+                }
+            }
+
+            uint8_t count = QP_MIN(state->rle.remain, length);
+            if (state->rle.mode == REPEATING_RUN) {
+                memset(buffer, state->curr, count);
+            } else if (count > 0) {
+                buffer[0] = state->curr;
+                if (qp_stream_read(buffer + 1, 1, count - 1, state->src_stream) != count - 1u) {
+                    return false;
+                }
+            }
+            buffer += count;
+            length -= count;
+            state->rle.remain -= count;
+
+            if (state->rle.remain > 0) {
+                // If we're in a non-repeating run, queue up the next byte
+                if (state->rle.mode == NON_REPEATING_RUN) {
+                    state->curr = qp_stream_get(state->src_stream);
+                    if (state->curr < 0) {
+                        return false;
+                    }
+                }
+            } else {
+                state->rle.mode = MARKER_BYTE;
+            }
+        }
+        return true;
+    }
+
+    for (uint32_t i = 0; i < length; ++i) {
+        int16_t byteval = input_callback(input_arg);
+        if (byteval < 0) {
+            return false;
+        }
+        buffer[i] = byteval;
+    }
+    return true;
+}
+
+// Block equivalent of qp_internal_decode_palette + qp_internal_pixel_appender, with one append_pixels() call per block rather than per pixel
+static bool qp_internal_decode_palette_blocks(painter_device_t device, uint32_t pixel_count, uint8_t bits_per_pixel, qp_internal_byte_input_callback input_callback, void* input_arg, qp_pixel_t* palette, qp_internal_pixel_output_state_t* output_state) {
+    painter_driver_t* driver           = (painter_driver_t*)device;
+    const uint8_t     pixel_bitmask    = (1 << bits_per_pixel) - 1;
+    const uint8_t     pixels_per_byte  = 8 / bits_per_pixel;
+    uint32_t          remaining_pixels = pixel_count;
+    uint8_t           bytes[QUANTUM_PAINTER_DECODE_BLOCK_SIZE];
+    uint8_t           indices[QUANTUM_PAINTER_DECODE_BLOCK_SIZE];
+
+    while (remaining_pixels > 0) {
+        uint32_t block_pixels = QP_MIN(remaining_pixels, QUANTUM_PAINTER_DECODE_BLOCK_SIZE);
+        uint32_t byte_count   = (block_pixels + pixels_per_byte - 1) / pixels_per_byte;
+        if (!qp_internal_read_bytes(input_callback, input_arg, bytes, byte_count)) {
+            return false;
+        }
+
+        // 8bpp bytes are already palette indices, otherwise unpack them -- the last byte may not be used in its entirety
+        uint8_t* pending = bytes;
+        if (pixels_per_byte > 1) {
+            uint8_t* index = indices;
+            for (uint32_t b = 0; b < byte_count; ++b) {
+                uint8_t byteval = bytes[b];
+                for (uint8_t q = 0; q < pixels_per_byte; ++q) {
+                    *index++ = byteval & pixel_bitmask;
+                    byteval >>= bits_per_pixel;
+                }
+            }
+            pending = indices;
+        }
+
+        remaining_pixels -= block_pixels;
+        while (block_pixels > 0) {
+            uint32_t count = QP_MIN(block_pixels, output_state->max_pixels - output_state->pixel_write_pos);
+            if (!driver->driver_vtable->append_pixels(device, qp_internal_global_pixdata_buffer, palette, output_state->pixel_write_pos, count, pending)) {
+                return false;
+            }
+            output_state->pixel_write_pos += count;
+            pending += count;
+            block_pixels -= count;
+
+            // If we've hit the transmit limit, send out the entire buffer and reset the write position
+            if (output_state->pixel_write_pos == output_state->max_pixels) {
+                if (!qp_internal_flush_pixdata(device, output_state->pixel_write_pos)) {
+                    return false;
+                }
+                output_state->pixel_write_pos = 0;
+            }
+        }
+    }
+    return true;
+}
+
+// Block equivalent of qp_internal_send_bytes, for native pixel formats
+static bool qp_internal_send_byte_blocks(uint32_t byte_count, qp_internal_byte_input_callback input_callback, void* input_arg, qp_internal_byte_output_state_t* output_state) {
+    uint32_t remaining_bytes = byte_count;
+    uint8_t  bytes[QUANTUM_PAINTER_DECODE_BLOCK_SIZE];
+
+    while (remaining_bytes > 0) {
+        uint32_t block_bytes = QP_MIN(remaining_bytes, QUANTUM_PAINTER_DECODE_BLOCK_SIZE);
+        if (!qp_internal_read_bytes(input_callback, input_arg, bytes, block_bytes)) {
+            return false;
+        }
+        for (uint32_t i = 0; i < block_bytes; ++i) {
+            if (!qp_internal_byte_appender(bytes[i], output_state)) {
+                return false;
+            }
+        }
+        remaining_bytes -= block_bytes;
+    }
+    return true;
+}
+
+#endif // QUANTUM_PAINTER_DECODE_BLOCK_SIZE > 0
+
 // Helper shared between image and font rendering -- uses either (qp_internal_decode_palette + qp_internal_pixel_appender) or (qp_internal_send_bytes) to send data data to the display based on the asset's native-ness
 bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_count, qp_internal_byte_input_callback input_callback, void* input_state) {
     painter_driver_t* driver = (painter_driver_t*)device;
@@ -177,10 +337,14 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
         qp_internal_pixel_output_state_t output_state = {.device = device, .pixel_write_pos = 0, .max_pixels = qp_internal_num_pixels_in_buffer(device)};
 
         // Decode the pixel data and stream to the display
+#if QUANTUM_PAINTER_DECODE_BLOCK_SIZE > 0
+        ret = qp_internal_decode_palette_blocks(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, &output_state);
+#else
         ret = qp_internal_decode_palette(device, pixel_count, bpp, input_callback, input_state, qp_internal_global_pixel_lookup_table, qp_internal_pixel_appender, &output_state);
+#endif
         // Any leftovers need transmission as well.
         if (ret && output_state.pixel_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.pixel_write_pos);
+            ret &= qp_internal_flush_pixdata(device, output_state.pixel_write_pos);
         }
     }
 
@@ -194,10 +358,14 @@ bool qp_internal_appender(painter_device_t device, uint8_t bpp, uint32_t pixel_c
 
         // Stream the raw pixel data to the display
         uint32_t byte_count = pixel_count * bpp / 8;
-        ret                 = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+#if QUANTUM_PAINTER_DECODE_BLOCK_SIZE > 0
+        ret = qp_internal_send_byte_blocks(byte_count, input_callback, input_state, &output_state);
+#else
+        ret = qp_internal_send_bytes(device, byte_count, input_callback, input_state, qp_internal_byte_appender, &output_state);
+#endif
         // Any leftovers need transmission as well.
         if (ret && output_state.byte_write_pos > 0) {
-            ret &= driver->driver_vtable->pixdata(device, qp_internal_global_pixdata_buffer, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
+            ret &= qp_internal_flush_pixdata(device, output_state.byte_write_pos * 8 / driver->native_bits_per_pixel);
         }
     }
 
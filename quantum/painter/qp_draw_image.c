@@ -1,6 +1,7 @@
 // Copyright 2021-2023 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_internal.h"
 #include "qp_draw.h"
 #include "qp_comms.h"
@@ -13,6 +14,7 @@
 typedef struct qgf_image_handle_t {
     painter_image_desc_t base;
     bool                 validate_ok;
+    bool                 cacheable;
     union {
         qp_stream_t        stream;
         qp_memory_stream_t mem_stream;
@@ -24,6 +26,140 @@ typedef struct qgf_image_handle_t {
 
 static qgf_image_handle_t image_descriptors[QUANTUM_PAINTER_NUM_IMAGES] = {0};
 
+typedef struct qgf_frame_info_t {
+    painter_compression_t compression_scheme;
+    uint8_t               bpp;
+    bool                  has_palette;
+    bool                  is_panel_native;
+    bool                  is_delta;
+    uint16_t              left;
+    uint16_t              top;
+    uint16_t              right;
+    uint16_t              bottom;
+    uint16_t              delay;
+} qgf_frame_info_t;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Native image cache
+
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
+typedef struct image_cache_entry_t {
+    painter_device_t    device;
+    qgf_image_handle_t *image; // NULL if the entry is unused
+    uint16_t            frame_number;
+    qp_pixel_t          fg_hsv888;
+    qp_pixel_t          bg_hsv888;
+    qgf_frame_info_t    frame_info;
+    uint32_t            offset; // into image_cache_data
+    uint32_t            length; // including padding
+    uint32_t            filled; // number of bytes captured so far
+    uint32_t            last_used;
+} image_cache_entry_t;
+
+// Entries are packed at the start of the data buffer, in no particular order, so that free space is always at the end.
+// Each entry is padded to a multiple of 4 bytes, so that drivers can read pixels from it as they would from the global
+// pixdata buffer.
+__attribute__((__aligned__(4))) static uint8_t image_cache_data[QUANTUM_PAINTER_IMAGE_CACHE_SIZE];
+static uint32_t             image_cache_used          = 0;
+static uint32_t             image_cache_tick          = 0;
+static image_cache_entry_t  image_cache_entries[QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES];
+static image_cache_entry_t *image_cache_capture_entry = NULL;
+
+static inline bool qp_pixel_equal(qp_pixel_t a, qp_pixel_t b) {
+    return a.hsv888.h == b.hsv888.h && a.hsv888.s == b.hsv888.s && a.hsv888.v == b.hsv888.v;
+}
+
+static void image_cache_evict(image_cache_entry_t *entry) {
+    uint32_t end = entry->offset + entry->length;
+    memmove(&image_cache_data[entry->offset], &image_cache_data[end], image_cache_used - end);
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES; ++i) {
+        if (image_cache_entries[i].image && image_cache_entries[i].offset > entry->offset) {
+            image_cache_entries[i].offset -= entry->length;
+        }
+    }
+    image_cache_used -= entry->length;
+    entry->image = NULL;
+}
+
+static void image_cache_evict_image(qgf_image_handle_t *image) {
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES; ++i) {
+        if (image_cache_entries[i].image == image) {
+            image_cache_evict(&image_cache_entries[i]);
+        }
+    }
+}
+
+static image_cache_entry_t *image_cache_least_recently_used(void) {
+    image_cache_entry_t *lru = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES; ++i) {
+        image_cache_entry_t *entry = &image_cache_entries[i];
+        if (entry->image && (!lru || entry->last_used < lru->last_used)) {
+            lru = entry;
+        }
+    }
+    return lru;
+}
+
+static image_cache_entry_t *image_cache_find(painter_device_t device, qgf_image_handle_t *image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888) {
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES; ++i) {
+        image_cache_entry_t *entry = &image_cache_entries[i];
+        if (entry->image == image && entry->device == device && entry->frame_number == frame_number && qp_pixel_equal(entry->fg_hsv888, fg_hsv888) && qp_pixel_equal(entry->bg_hsv888, bg_hsv888)) {
+            entry->last_used = ++image_cache_tick;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+// Makes room for a new entry, evicting the least recently drawn frames as needed
+static image_cache_entry_t *image_cache_reserve(uint32_t byte_count) {
+    uint32_t length = (byte_count + 3) & ~(uint32_t)3;
+    if (byte_count == 0 || length > QUANTUM_PAINTER_IMAGE_CACHE_SIZE) {
+        return NULL;
+    }
+
+    image_cache_entry_t *entry = NULL;
+    for (int i = 0; i < QUANTUM_PAINTER_IMAGE_CACHE_ENTRIES; ++i) {
+        if (!image_cache_entries[i].image) {
+            entry = &image_cache_entries[i];
+            break;
+        }
+    }
+    if (!entry) {
+        entry = image_cache_least_recently_used();
+        image_cache_evict(entry);
+    }
+    while (QUANTUM_PAINTER_IMAGE_CACHE_SIZE - image_cache_used < length) {
+        image_cache_evict(image_cache_least_recently_used());
+    }
+
+    entry->offset = image_cache_used;
+    entry->length = length;
+    entry->filled = 0;
+    image_cache_used += length;
+    return entry;
+}
+
+void qp_internal_image_cache_capture(const uint8_t *pixdata, uint32_t byte_count) {
+    image_cache_entry_t *entry = image_cache_capture_entry;
+    if (!entry) {
+        return;
+    }
+
+    // More data than expected means the frame can't be replayed as-is, so it's dropped once the draw completes
+    if (byte_count > entry->length - entry->filled) {
+        entry->filled = UINT32_MAX;
+        image_cache_capture_entry = NULL;
+        return;
+    }
+
+    memcpy(&image_cache_data[entry->offset + entry->filled], pixdata, byte_count);
+    entry->filled += byte_count;
+}
+
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Helper: load image from stream
 
@@ -61,6 +197,7 @@ static painter_image_handle_t qp_load_image_internal(bool (*stream_factory)(qgf_
 
     // Validation success, we can return the handle
     image->validate_ok = true;
+    image->cacheable   = false;
     qp_dprintf("qp_load_image: ok\n");
     return (painter_image_handle_t)image;
 }
@@ -95,12 +232,38 @@ bool qp_close_image(painter_image_handle_t image) {
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    image_cache_evict_image(qgf_image);
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Free up this image for use elsewhere.
     qgf_image->validate_ok = false;
     qp_stream_close(&qgf_image->stream);
     return true;
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Quantum Painter External API: qp_cache_image
+
+bool qp_cache_image(painter_image_handle_t image, bool enable) {
+    qgf_image_handle_t *qgf_image = (qgf_image_handle_t *)image;
+    if (!qgf_image || !qgf_image->validate_ok) {
+        qp_dprintf("qp_cache_image: fail (invalid image)\n");
+        return false;
+    }
+
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    qgf_image->cacheable = enable;
+    if (!enable) {
+        image_cache_evict_image(qgf_image);
+    }
+    return true;
+#else
+    qp_dprintf("qp_cache_image: fail (QUANTUM_PAINTER_IMAGE_CACHE_SIZE is 0)\n");
+    return false;
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_drawimage
 
@@ -111,19 +274,6 @@ bool qp_drawimage(painter_device_t device, uint16_t x, uint16_t y, painter_image
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Quantum Painter External API: qp_drawimage_recolor
 
-typedef struct qgf_frame_info_t {
-    painter_compression_t compression_scheme;
-    uint8_t               bpp;
-    bool                  has_palette;
-    bool                  is_panel_native;
-    bool                  is_delta;
-    uint16_t              left;
-    uint16_t              top;
-    uint16_t              right;
-    uint16_t              bottom;
-    uint16_t              delay;
-} qgf_frame_info_t;
-
 static bool qp_drawimage_prepare_frame_for_stream_read(painter_device_t device, qgf_image_handle_t *qgf_image, uint16_t frame_number, qp_pixel_t fg_hsv888, qp_pixel_t bg_hsv888, qgf_frame_info_t *info) {
     painter_driver_t *driver = (painter_driver_t *)device;
 
@@ -222,8 +372,20 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+    bool cached = false;
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    image_cache_entry_t *cache_entry = NULL;
+    if (qgf_image->cacheable) {
+        cache_entry = image_cache_find(device, qgf_image, frame_number, fg_hsv888, bg_hsv888);
+        if (cache_entry) {
+            *frame_info = cache_entry->frame_info;
+            cached      = true;
+        }
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Read the frame info
-    if (!qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
+    if (!cached && !qp_drawimage_prepare_frame_for_stream_read(device, qgf_image, frame_number, fg_hsv888, bg_hsv888, frame_info)) {
         qp_dprintf("qp_drawimage_recolor: fail (could not read frame %d)\n", frame_number);
         return false;
     }
@@ -254,6 +416,16 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    if (cached) {
+        // Send the already-converted pixels as-is, skipping decoding and palette conversion
+        bool ret = driver->driver_vtable->pixdata(device, &image_cache_data[cache_entry->offset], pixel_count);
+        qp_dprintf("qp_drawimage_recolor: %s (cached)\n", ret ? "ok" : "fail");
+        qp_comms_stop(device);
+        return ret;
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Set up the input state
     qp_internal_byte_input_state_t  input_state    = {.device = device, .src_stream = &qgf_image->stream};
     qp_internal_byte_input_callback input_callback = qp_internal_prepare_input_state(&input_state, frame_info->compression_scheme);
@@ -263,9 +435,36 @@ static bool qp_drawimage_recolor_impl(painter_device_t device, uint16_t x, uint1
         return false;
     }
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    // Capture the native pixels as they're sent, if the frame fits in the cache
+    uint32_t native_byte_count = pixel_count * driver->native_bits_per_pixel / 8;
+    if (qgf_image->cacheable && (driver->native_bits_per_pixel % 8) == 0) {
+        cache_entry = image_cache_reserve(native_byte_count);
+        if (cache_entry) {
+            cache_entry->device       = device;
+            cache_entry->image        = qgf_image;
+            cache_entry->frame_number = frame_number;
+            cache_entry->fg_hsv888    = fg_hsv888;
+            cache_entry->bg_hsv888    = bg_hsv888;
+            cache_entry->frame_info   = *frame_info;
+            cache_entry->last_used    = ++image_cache_tick;
+            image_cache_capture_entry = cache_entry;
+        }
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     // Decode and stream pixels
     bool ret = qp_internal_appender(device, frame_info->bpp, pixel_count, input_callback, &input_state);
 
+#if QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+    if (cache_entry) {
+        image_cache_capture_entry = NULL;
+        if (!ret || cache_entry->filled != native_byte_count) {
+            image_cache_evict(cache_entry);
+        }
+    }
+#endif // QUANTUM_PAINTER_IMAGE_CACHE_SIZE > 0
+
     qp_dprintf("qp_drawimage_recolor: %s\n", ret ? "ok" : "fail");
     qp_comms_stop(device);
     return ret;
@@ -12,11 +12,21 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // QFF font handles
 
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+// Location of a recently drawn unicode glyph. Code point 0 can't be part of a string, so marks an unused entry.
+typedef struct qff_glyph_cache_entry_t {
+    uint32_t code_point : 24;
+    uint32_t width : 8;
+    uint32_t data_offset;
+} qff_glyph_cache_entry_t;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
 typedef struct qff_font_handle_t {
     painter_font_desc_t   base;
     bool                  validate_ok;
     bool                  has_ascii_table;
     uint16_t              num_unicode_glyphs;
+    bool                  has_sorted_unicode_table;
     uint8_t               bpp;
     bool                  has_palette;
     bool                  is_panel_native;
@@ -32,6 +42,10 @@ typedef struct qff_font_handle_t {
     bool  owns_buffer;
     void *buffer;
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    qff_glyph_cache_entry_t glyph_cache[QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE];
+    uint16_t                glyph_cache_next;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 } qff_font_handle_t;
 
 static qff_font_handle_t font_descriptors[QUANTUM_PAINTER_NUM_FONTS] = {0};
@@ -98,7 +112,13 @@ static painter_font_handle_t qp_load_font_internal(bool (*stream_factory)(qff_fo
 #endif // QUANTUM_PAINTER_LOAD_FONTS_TO_RAM
 
     // Read the info (parsing already successful above, no need to check return value)
-    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
+    qff_read_font_descriptor(&font->stream, &font->base.line_height, &font->has_ascii_table, &font->num_unicode_glyphs, &font->has_sorted_unicode_table, &font->bpp, &font->has_palette, &font->is_panel_native, &font->compression_scheme, NULL);
+
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+    // Forget any glyphs remembered from the font previously loaded into this slot
+    memset(font->glyph_cache, 0, sizeof(font->glyph_cache));
+    font->glyph_cache_next = 0;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 
     if (!qp_internal_bpp_capable(font->bpp)) {
         qp_dprintf("qp_load_font: fail (image bpp too high (%d), check QUANTUM_PAINTER_SUPPORTS_256_PALETTE or QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS)\n", (int)font->bpp);
@@ -214,6 +234,58 @@ static inline bool qp_drawtext_prepare_font_for_render(painter_device_t device,
     return true;
 }
 
+// Helper that finds the unicode table entry for the code point
+static bool qp_drawtext_find_unicode_glyph(qff_font_handle_t *qff_font, uint32_t code_point, qff_unicode_glyph_v1_t *glyph_info) {
+    uint32_t table_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
+                            + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
+                            + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+
+    if (qff_font->has_sorted_unicode_table) {
+        // Binary search, each probe is a single seek and read
+        uint16_t lower = 0;
+        uint16_t upper = qff_font->num_unicode_glyphs;
+        while (lower < upper) {
+            uint16_t middle = lower + (upper - lower) / 2;
+            if (qp_stream_setpos(&qff_font->stream, table_offset + middle * sizeof(qff_unicode_glyph_v1_t)) < 0) {
+                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+                return false;
+            }
+
+            if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+                qp_dprintf("Failed to read unicode glyph info\n");
+                return false;
+            }
+
+            if (glyph_info->code_point == code_point) {
+                return true;
+            } else if (glyph_info->code_point < code_point) {
+                lower = middle + 1;
+            } else {
+                upper = middle;
+            }
+        }
+        return false;
+    }
+
+    // v1 fonts make no guarantees about the ordering of the table, so scan all of it
+    if (qp_stream_setpos(&qff_font->stream, table_offset) < 0) {
+        qp_dprintf("Failed to set stream position while preparing glyph data\n");
+        return false;
+    }
+
+    for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
+        if (qp_stream_read(glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
+            qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
+            return false;
+        }
+
+        if (glyph_info->code_point == code_point) {
+            return true;
+        }
+    }
+    return false;
+}
+
 static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_font, uint32_t code_point, uint8_t *width) {
     if (code_point >= 0x20 && code_point < 0x7F && qff_font->has_ascii_table) {
         // Do ascii table
@@ -249,45 +321,50 @@ static inline bool qp_drawtext_prepare_glyph_for_render(qff_font_handle_t *qff_f
         return true;
     } else {
         // Do unicode table, which may include singular ascii glyphs if full ascii table isn't specified
-        uint32_t glyph_info_offset = sizeof(qff_font_descriptor_v1_t)                                       // Skip the font descriptor
-                                     + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0) // Skip the ascii table
-                                     + sizeof(qgf_block_header_v1_t);                                       // Skip the unicode block header
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        for (uint16_t i = 0; i < QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE; ++i) {
+            qff_glyph_cache_entry_t *entry = &qff_font->glyph_cache[i];
+            if (entry->code_point == code_point) {
+                if (qp_stream_setpos(&qff_font->stream, entry->data_offset) < 0) {
+                    qp_dprintf("Failed to set stream position while preparing cached unicode glyph data\n");
+                    return false;
+                }
 
-        if (qp_stream_setpos(&qff_font->stream, glyph_info_offset) < 0) {
-            qp_dprintf("Failed to set stream position while preparing glyph data\n");
-            return false;
+                *width = entry->width;
+                return true;
+            }
         }
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
 
         qff_unicode_glyph_v1_t glyph_info;
-        for (uint16_t i = 0; i < qff_font->num_unicode_glyphs; ++i) {
-            if (qp_stream_read(&glyph_info, sizeof(qff_unicode_glyph_v1_t), 1, &qff_font->stream) != 1) {
-                qp_dprintf("Failed to set stream position while reading unicode glyph info\n");
-                return false;
-            }
+        if (!qp_drawtext_find_unicode_glyph(qff_font, code_point, &glyph_info)) {
+            // Not found
+            qp_dprintf("Failed to find unicode glyph info\n");
+            return false;
+        }
 
-            if (glyph_info.code_point == code_point) {
-                uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
-                uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
-                uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
-                                       + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
-                                       + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
-                                       + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
-                                       + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
-                                       + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
-
-                if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
-                    qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
-                    return false;
-                }
+        uint8_t  glyph_width  = (uint8_t)(glyph_info.value & QFF_GLYPH_WIDTH_MASK);
+        uint32_t glyph_offset = ((glyph_info.value & QFF_GLYPH_OFFSET_MASK) >> QFF_GLYPH_WIDTH_BITS);
+        uint32_t data_offset  = sizeof(qff_font_descriptor_v1_t)                                                                                                                   // Skip the font descriptor
+                               + (qff_font->has_ascii_table ? sizeof(qff_ascii_glyph_table_v1_t) : 0)                                                                              // Skip the ascii table
+                               + (qff_font->num_unicode_glyphs > 0 ? (sizeof(qff_unicode_glyph_table_v1_t) + (qff_font->num_unicode_glyphs * sizeof(qff_unicode_glyph_v1_t))) : 0) // Skip the unicode table
+                               + (qff_font->has_palette ? (sizeof(qgf_palette_v1_t) + ((1 << qff_font->bpp) * sizeof(qgf_palette_entry_v1_t))) : 0)                                // Skip the palette
+                               + sizeof(qgf_block_header_v1_t)                                                                                                                     // Skip the data block header
+                               + glyph_offset;                                                                                                                                     // Jump to the specified glyph offset
 
-                *width = glyph_width;
-                return true;
-            }
+        if (qp_stream_setpos(&qff_font->stream, data_offset) < 0) {
+            qp_dprintf("Failed to set stream position while preparing unicode glyph data\n");
+            return false;
         }
 
-        // Not found
-        qp_dprintf("Failed to find unicode glyph info\n");
-        return false;
+#if QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+        // Replace the oldest remembered glyph
+        qff_font->glyph_cache[qff_font->glyph_cache_next] = (qff_glyph_cache_entry_t){.code_point = code_point, .width = glyph_width, .data_offset = data_offset};
+        qff_font->glyph_cache_next                        = (qff_font->glyph_cache_next + 1) % QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE;
+#endif // QUANTUM_PAINTER_FONT_GLYPH_CACHE_SIZE > 0
+
+        *width = glyph_width;
+        return true;
     }
     return false;
 }
@@ -29,6 +29,9 @@ typedef struct painter_driver_vtable_t {
     painter_driver_convert_palette_func palette_convert;
     painter_driver_append_pixels        append_pixels;
     painter_driver_append_pixdata       append_pixdata;
+
+    // Optional -- starts streaming native pixels without waiting for the transfer to complete, using qp_comms_send_async
+    painter_driver_pixdata_func pixdata_async;
 } painter_driver_vtable_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -38,12 +41,18 @@ typedef bool (*painter_driver_comms_init_func)(painter_device_t device);
 typedef bool (*painter_driver_comms_start_func)(painter_device_t device);
 typedef void (*painter_driver_comms_stop_func)(painter_device_t device);
 typedef uint32_t (*painter_driver_comms_send_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_send_async_func)(painter_device_t device, const void *data, uint32_t byte_count);
+typedef bool (*painter_driver_comms_busy_func)(painter_device_t device);
 
 typedef struct painter_comms_vtable_t {
     painter_driver_comms_init_func  comms_init;
     painter_driver_comms_start_func comms_start;
     painter_driver_comms_stop_func  comms_stop;
     painter_driver_comms_send_func  comms_send;
+
+    // Optional -- starts sending without waiting for the transfer to complete, comms_busy returns true until it has.
+    painter_driver_comms_send_async_func comms_send_async;
+    painter_driver_comms_busy_func       comms_busy;
 } painter_comms_vtable_t;
 
 typedef void (*painter_driver_comms_send_command_func)(painter_device_t device, uint8_t cmd);
@@ -81,6 +90,9 @@ typedef struct painter_driver_t {
 
     // Comms config pointer -- needs to point to an appropriate comms config if the comms driver requires it.
     void *comms_config;
+
+    // Set while an asynchronous transfer holds the comms open, until qp_comms_async_complete() sees it finish
+    bool comms_async_pending;
 } painter_driver_t;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1,14 +1,31 @@
 // Copyright 2021 Nick Brassel (@tzarc)
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <string.h>
 #include "qp_stream.h"
 
+static inline int16_t mem_get(qp_stream_t *stream);
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Stream API
 
 uint32_t qp_stream_read_impl(void *output_buf, uint32_t member_size, uint32_t num_members, qp_stream_t *stream) {
     uint8_t *output_ptr = (uint8_t *)output_buf;
 
+    // Memory streams can be copied in one go, stopping at the end of the buffer as mem_get() would
+    if (stream->get == mem_get) {
+        qp_memory_stream_t *s      = (qp_memory_stream_t *)stream;
+        uint32_t            length = num_members * member_size;
+        uint32_t            avail  = s->position < s->length ? s->length - s->position : 0;
+        if (length > avail) {
+            length    = avail;
+            s->is_eof = true;
+        }
+        memcpy(output_ptr, &s->buffer[s->position], length);
+        s->position += length;
+        return length / member_size;
+    }
+
     uint32_t i;
     for (i = 0; i < (num_members * member_size); ++i) {
         int16_t c = qp_stream_get(stream);
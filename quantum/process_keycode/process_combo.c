@@ -16,6 +16,9 @@
 
 #include "process_combo.h"
 #include <stddef.h>
+#ifdef COMBO_KEY_INDEX
+#    include <stdlib.h>
+#endif
 #include "process_auto_shift.h"
 #include "caps_word.h"
 #include "timer.h"
@@ -72,7 +75,16 @@ __attribute__((weak)) bool combo_should_trigger(uint16_t combo_index, combo_t *c
 #endif
 
 #ifndef COMBO_NO_TIMER
+#    ifdef HIGH_RES_EVENT_TIME
+// Timed in microseconds from when the key was pressed
+static uint32_t timer = 0;
+#        define COMBO_TIMER_START(record) ((record)->event.time_us)
+#        define COMBO_TIMER_ELAPSED(term) (TIMER_DIFF_32(timer_read_us(), timer) > (uint32_t)(term) * 1000)
+#    else
 static uint16_t timer = 0;
+#        define COMBO_TIMER_START(record) timer_read()
+#        define COMBO_TIMER_ELAPSED(term) (timer_elapsed(timer) > (term))
+#    endif
 #endif
 static bool     b_combo_enable = true; // defaults to enabled
 static uint16_t longest_term   = 0;
@@ -414,6 +426,90 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
+#ifdef COMBO_KEY_INDEX
+/* Inverted index from keycode to the combos containing it, sorted by keycode
+ * and then by combo index so candidates are visited in key_combos order. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+} combo_key_index_entry_t;
+
+static combo_key_index_entry_t *key_index             = NULL;
+static uint16_t                 key_index_size        = 0;
+static uint16_t                 key_index_combo_count = 0;
+static bool                     key_index_valid       = false;
+
+void combo_key_index_invalidate(void) {
+    key_index_valid = false;
+}
+
+static int combo_key_index_compare(const void *a, const void *b) {
+    const combo_key_index_entry_t *entry_a = a;
+    const combo_key_index_entry_t *entry_b = b;
+
+    if (entry_a->keycode != entry_b->keycode) {
+        return entry_a->keycode < entry_b->keycode ? -1 : 1;
+    }
+    return entry_a->combo_index < entry_b->combo_index ? -1 : (entry_a->combo_index > entry_b->combo_index);
+}
+
+static void combo_key_index_build(void) {
+    uint16_t size = 0;
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        for (uint8_t i = 0; pgm_read_word(&keys[i]) != COMBO_END; ++i) {
+            size++;
+        }
+    }
+
+    free(key_index);
+    key_index             = size ? malloc(size * sizeof(combo_key_index_entry_t)) : NULL;
+    key_index_size        = 0;
+    key_index_combo_count = combo_count();
+    key_index_valid       = true;
+    if (!key_index) {
+        // Nothing to index or out of memory, process_combo falls back to scanning every combo.
+        return;
+    }
+
+    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+        const uint16_t *keys = combo_get(idx)->keys;
+        uint16_t        key;
+        for (uint8_t i = 0; (key = pgm_read_word(&keys[i])) != COMBO_END; ++i) {
+            key_index[key_index_size++] = (combo_key_index_entry_t){
+                .keycode     = key,
+                .combo_index = idx,
+            };
+        }
+    }
+
+    qsort(key_index, key_index_size, sizeof(combo_key_index_entry_t), combo_key_index_compare);
+
+    // A combo listing the same key twice must still only be processed once per event.
+    uint16_t unique = 1;
+    for (uint16_t i = 1; i < key_index_size; ++i) {
+        if (key_index[i].keycode != key_index[unique - 1].keycode || key_index[i].combo_index != key_index[unique - 1].combo_index) {
+            key_index[unique++] = key_index[i];
+        }
+    }
+    key_index_size = unique;
+}
+
+/* Returns the position of the first entry for keycode, or key_index_size if no combo contains it. */
+static uint16_t combo_key_index_find(uint16_t keycode) {
+    uint16_t low = 0, high = key_index_size;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (key_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
     uint8_t  key_count = 0;
     uint16_t key_index = -1;
@@ -447,7 +543,7 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
 
 #ifndef COMBO_NO_TIMER
             /* Don't buffer this combo if its combo term has passed. */
-            if (timer && timer_elapsed(timer) > time) {
+            if (timer && COMBO_TIMER_ELAPSED(time)) {
                 DISABLE_COMBO(combo);
                 return true;
             } else
@@ -564,10 +660,25 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    if (!key_index_valid || key_index_combo_count != combo_count()) {
+        combo_key_index_build();
+    }
+
+    /* KC_NO matches the COMBO_END terminator of every combo, keep the full scan for it. */
+    if (key_index && keycode != COMBO_END) {
+        for (uint16_t i = combo_key_index_find(keycode); i < key_index_size && key_index[i].keycode == keycode; ++i) {
+            uint16_t idx = key_index[i].combo_index;
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            combo_t *combo = combo_get(idx);
+            is_combo_key |= process_single_combo(combo, keycode, record, idx);
+            no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -575,10 +686,10 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
 #    ifdef COMBO_STRICT_TIMER
         if (!timer) {
             // timer is set only on the first key
-            timer = timer_read();
+            timer = COMBO_TIMER_START(record);
         }
 #    else
-        timer = timer_read();
+        timer = COMBO_TIMER_START(record);
 #    endif
 #endif
 
@@ -611,7 +722,7 @@ void combo_task(void) {
     }
 
 #ifndef COMBO_NO_TIMER
-    if (timer && timer_elapsed(timer) > longest_term) {
+    if (timer && COMBO_TIMER_ELAPSED(longest_term)) {
         if (combo_buffer_read != combo_buffer_write) {
             apply_combos();
             longest_term = 0;
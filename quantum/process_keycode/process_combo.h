@@ -81,3 +81,8 @@ void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEY_INDEX
+/* Must be called after changing the keys of any combo at runtime, the index is rebuilt on the next key event. */
+void combo_key_index_invalidate(void);
+#endif
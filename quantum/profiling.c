@@ -0,0 +1,136 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "print.h"
+#include "timer.h"
+
+#if defined(PROTOCOL_CHIBIOS)
+#    include <ch.h>
+#elif defined(__AVR__)
+#    include "timer_avr.h"
+#endif
+
+static profiling_probe_t *probes_head = NULL;
+static profiling_probe_t *probes_tail = NULL;
+
+#if defined(PROTOCOL_CHIBIOS)
+__attribute__((weak)) uint32_t profiling_get_cycles(void) {
+#    if defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+    return chSysGetRealtimeCounterX();
+#    else
+    // No cycle counter on this core, fall back to system ticks
+    return chVTGetSystemTimeX();
+#    endif
+}
+#elif defined(__AVR__)
+__attribute__((weak)) uint32_t profiling_get_cycles(void) {
+    // Ticks of the timer driving timer_read32(), which wraps at TIMER_RAW_TOP every millisecond
+    return timer_read32() * (uint32_t)(TIMER_RAW_TOP) + TIMER_RAW;
+}
+#else
+// Platforms without a finer counter, such as ARM_ATSAM, fall back to milliseconds. The test platform overrides this
+// with its own mock counter.
+__attribute__((weak)) uint32_t profiling_get_cycles(void) {
+    return timer_read32();
+}
+#endif
+
+static void profiling_probe_clear(profiling_probe_t *probe) {
+    probe->ring_index = 0;
+    probe->count      = 0;
+    probe->min        = UINT32_MAX;
+    probe->max        = 0;
+    probe->total      = 0;
+    memset(probe->ring, 0, sizeof(probe->ring));
+    memset(probe->histogram, 0, sizeof(probe->histogram));
+}
+
+static uint8_t profiling_histogram_bucket(uint32_t cycles) {
+    uint8_t bucket = 0;
+    while (cycles && bucket < PROFILING_HISTOGRAM_BUCKETS - 1) {
+        cycles >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+void profiling_probe_record(profiling_probe_t *probe, uint32_t cycles) {
+    if (!probe->registered) {
+        profiling_probe_clear(probe);
+        probe->registered = true;
+        probe->next       = NULL;
+        if (probes_tail) {
+            probes_tail->next = probe;
+        } else {
+            probes_head = probe;
+        }
+        probes_tail = probe;
+    }
+
+    probe->count++;
+    probe->total += cycles;
+    if (cycles < probe->min) {
+        probe->min = cycles;
+    }
+    if (cycles > probe->max) {
+        probe->max = cycles;
+    }
+
+    probe->ring[probe->ring_index] = cycles;
+    probe->ring_index              = (probe->ring_index + 1) % PROFILING_RING_SIZE;
+
+    uint8_t bucket = profiling_histogram_bucket(cycles);
+    if (probe->histogram[bucket] < UINT16_MAX) {
+        probe->histogram[bucket]++;
+    }
+}
+
+uint32_t profiling_probe_recent_average(const profiling_probe_t *probe) {
+    uint8_t samples = probe->count < PROFILING_RING_SIZE ? probe->count : PROFILING_RING_SIZE;
+    if (!samples) {
+        return 0;
+    }
+
+    uint64_t sum = 0;
+    for (uint8_t i = 0; i < samples; i++) {
+        // The most recent sample is just before ring_index
+        sum += probe->ring[(probe->ring_index + PROFILING_RING_SIZE - 1 - i) % PROFILING_RING_SIZE];
+    }
+    return sum / samples;
+}
+
+const profiling_probe_t *profiling_get_probes(void) {
+    return probes_head;
+}
+
+const profiling_probe_t *profiling_find_probe(const char *name) {
+    for (const profiling_probe_t *probe = probes_head; probe; probe = probe->next) {
+        if (strcmp(probe->name, name) == 0) {
+            return probe;
+        }
+    }
+    return NULL;
+}
+
+void profiling_reset(void) {
+    for (profiling_probe_t *probe = probes_head; probe; probe = probe->next) {
+        profiling_probe_clear(probe);
+    }
+}
+
+void profiling_print(void) {
+    xprintf("%-24s %10s %10s %10s %10s %10s\n", "probe", "count", "min", "avg", "max", "recent");
+    for (const profiling_probe_t *probe = probes_head; probe; probe = probe->next) {
+        __attribute__((unused)) uint32_t avg = probe->count ? probe->total / probe->count : 0;
+        __attribute__((unused)) uint32_t min = probe->count ? probe->min : 0;
+        xprintf("%-24s %10lu %10lu %10lu %10lu %10lu\n", probe->name, (unsigned long)probe->count, (unsigned long)min, (unsigned long)avg, (unsigned long)probe->max, (unsigned long)profiling_probe_recent_average(probe));
+
+        xprintf("  histogram:");
+        for (uint8_t i = 0; i < PROFILING_HISTOGRAM_BUCKETS; i++) {
+            xprintf(" %u", (unsigned)probe->histogram[i]);
+        }
+        xprintf("\n");
+    }
+}
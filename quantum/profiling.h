@@ -0,0 +1,118 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Named probe points measuring the number of cycles spent in a section of code.
+
+    Usage example:
+
+        #include "profiling.h"
+
+        void my_task(void) {
+            PROFILING_BEGIN(my_task);
+            // ...
+            PROFILING_END(my_task);
+        }
+
+        // Or, for a single call:
+        PROFILING_CALL(matrix_scan());
+
+    Probes register themselves the first time they are hit, and can be dumped with profiling_print(), or through
+    the command console. Everything compiles to nothing unless PROFILING_ENABLE is set.
+*/
+
+#ifndef PROFILING_RING_SIZE
+#    define PROFILING_RING_SIZE 16
+#endif
+
+#ifndef PROFILING_HISTOGRAM_BUCKETS
+#    define PROFILING_HISTOGRAM_BUCKETS 20
+#endif
+
+/**
+ * \brief Counters of a single probe point.
+ *
+ * Histogram bucket `n` counts the samples taking at least `2^(n-1)` but less than `2^n` cycles, the last bucket
+ * counts everything longer.
+ */
+typedef struct profiling_probe_t {
+    const char *              name;
+    struct profiling_probe_t *next;
+    bool                      registered;
+    uint8_t                   ring_index;
+    uint32_t                  count;
+    uint32_t                  min;
+    uint32_t                  max;
+    uint64_t                  total;
+    uint32_t                  ring[PROFILING_RING_SIZE];
+    uint16_t                  histogram[PROFILING_HISTOGRAM_BUCKETS];
+} profiling_probe_t;
+
+/**
+ * \brief The current value of the cycle counter.
+ *
+ * On ChibiOS this is the realtime counter, on AVR the ticks of the system timer. The test platform provides a mock
+ * counter which only moves when advanced by the test.
+ */
+uint32_t profiling_get_cycles(void);
+
+/**
+ * \brief Adds a sample of `cycles` to `probe`, registering it on first use.
+ */
+void profiling_probe_record(profiling_probe_t *probe, uint32_t cycles);
+
+/**
+ * \brief The average of the last PROFILING_RING_SIZE samples of `probe`.
+ */
+uint32_t profiling_probe_recent_average(const profiling_probe_t *probe);
+
+/**
+ * \brief The first registered probe, use `next` to walk the others.
+ */
+const profiling_probe_t *profiling_get_probes(void);
+
+/**
+ * \brief Looks up a registered probe by name.
+ *
+ * \return NULL if no probe with that name has been hit yet
+ */
+const profiling_probe_t *profiling_find_probe(const char *name);
+
+/**
+ * \brief Clears the counters of all registered probes.
+ */
+void profiling_reset(void);
+
+/**
+ * \brief Prints the counters of all registered probes over console.
+ */
+void profiling_print(void);
+
+#ifdef PROFILING_ENABLE
+#    define PROFILING_BEGIN(probe)                                           \
+        static profiling_probe_t profiling_probe_##probe = {.name = #probe}; \
+        const uint32_t           profiling_start_##probe = profiling_get_cycles()
+#    define PROFILING_END(probe) profiling_probe_record(&profiling_probe_##probe, profiling_get_cycles() - profiling_start_##probe)
+#    define PROFILING_CALL_NAMED(probe_name, ...)                                               \
+        do {                                                                                    \
+            static profiling_probe_t profiling_probe = {.name = (probe_name)};                  \
+            const uint32_t           profiling_start = profiling_get_cycles();                  \
+            do {                                                                                \
+                __VA_ARGS__;                                                                    \
+            } while (0);                                                                        \
+            profiling_probe_record(&profiling_probe, profiling_get_cycles() - profiling_start); \
+        } while (0)
+#else
+#    define PROFILING_BEGIN(probe)
+#    define PROFILING_END(probe)
+#    define PROFILING_CALL_NAMED(probe_name, ...) \
+        do {                                      \
+            __VA_ARGS__;                          \
+        } while (0)
+#endif // PROFILING_ENABLE
+
+#define PROFILING_CALL(...) PROFILING_CALL_NAMED(#__VA_ARGS__, __VA_ARGS__)
@@ -198,6 +198,9 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_flush();
+#endif
 }
 
 void reset_keyboard(void) {
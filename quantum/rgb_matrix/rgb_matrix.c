@@ -23,12 +23,17 @@
 #include "keyboard.h"
 #include "sync_timer.h"
 #include "debug.h"
+#include "util.h"
 #include <string.h>
 #include <math.h>
 #include <stdlib.h>
 
 #include <lib/lib8tion/lib8tion.h>
 
+#if defined(RGB_MATRIX_RENDER_BUDGET_US) && defined(__AVR__)
+#    include "timer_avr.h"
+#endif
+
 #ifndef RGB_MATRIX_CENTER
 const led_point_t k_rgb_matrix_center = {112, 32};
 #else
@@ -88,6 +93,22 @@ static last_hit_t last_hit_buffer;
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// Instead of a fixed RGB_MATRIX_LED_PROCESS_LIMIT, each render step gets as many LEDs as fit in the budget, based on
+// the measured cost of the previous steps
+static struct {
+    uint8_t  chunk_min;
+    uint8_t  chunk_max;
+    uint8_t  chunk_size;
+    uint32_t led_cost; // measured cost per LED in 1/256us, zero until the first measurement
+    uint32_t stats_timer;
+    uint32_t frame_count;
+    uint32_t worst_chunk_us;
+    uint32_t last_frame_rate;
+    uint32_t last_worst_chunk_us;
+} rgb_render_budget = {.chunk_size = 1};
+#endif
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, EECONFIG_RGB_MATRIX, rgb_matrix_config);
 
 void eeconfig_update_rgb_matrix(void) {
@@ -278,6 +299,102 @@ static void rgb_task_start(void) {
     rgb_task_state = RENDERING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+#    if defined(__AVR__)
+__attribute__((weak)) uint32_t rgb_matrix_render_timer_us(void) {
+    // timer_read_us() only counts whole milliseconds here, add the ticks of the current one from the timer driving it
+    uint8_t  raw;
+    uint32_t ms;
+    do {
+        raw = TIMER_RAW;
+        ms  = timer_read32();
+    } while (TIMER_RAW < raw);
+    return ms * 1000 + (uint32_t)raw * 1000 / ((TIMER_RAW_TOP) + 1);
+}
+#    elif defined(PROTOCOL_ARM_ATSAM)
+#        error "RGB_MATRIX_RENDER_BUDGET_US needs a microsecond timer, which this platform does not have"
+#    else
+__attribute__((weak)) uint32_t rgb_matrix_render_timer_us(void) {
+    return timer_read_us();
+}
+#    endif
+
+static void rgb_render_budget_begin_chunk(void) {
+    uint8_t led_end = RGB_MATRIX_LED_COUNT;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) {
+        led_end = k_rgb_matrix_split[0];
+    }
+#    endif
+
+    if (rgb_effect_params.iter == 0) {
+        rgb_render_budget.chunk_min = 0;
+#    if defined(RGB_MATRIX_SPLIT)
+        if (!is_keyboard_left()) {
+            rgb_render_budget.chunk_min = k_rgb_matrix_split[0];
+        }
+#    endif
+    } else {
+        rgb_render_budget.chunk_min = rgb_render_budget.chunk_max;
+    }
+
+    uint8_t remaining           = led_end - rgb_render_budget.chunk_min;
+    rgb_render_budget.chunk_max = rgb_render_budget.chunk_min + MIN(rgb_render_budget.chunk_size, remaining);
+}
+
+static void rgb_render_budget_end_chunk(uint32_t elapsed_us) {
+    if (elapsed_us > rgb_render_budget.worst_chunk_us) {
+        rgb_render_budget.worst_chunk_us = elapsed_us;
+    }
+
+    uint8_t led_count = rgb_render_budget.chunk_max - rgb_render_budget.chunk_min;
+    if (led_count > 0) {
+        // Smooth the per-LED cost, but react to effects getting more expensive immediately
+        uint32_t cost = (elapsed_us << 8) / led_count;
+        if (cost > rgb_render_budget.led_cost) {
+            rgb_render_budget.led_cost = cost;
+        } else {
+            rgb_render_budget.led_cost -= (rgb_render_budget.led_cost - cost) / 4;
+        }
+    }
+
+    // Grow the chunk at most twofold per step, the measurement of a small chunk is the least accurate
+    uint32_t chunk_size = rgb_render_budget.led_cost ? ((uint32_t)RGB_MATRIX_RENDER_BUDGET_US << 8) / rgb_render_budget.led_cost : RGB_MATRIX_LED_COUNT;
+    chunk_size          = MIN(chunk_size, 2 * (uint32_t)rgb_render_budget.chunk_size);
+    chunk_size          = MIN(chunk_size, RGB_MATRIX_LED_COUNT);
+
+    rgb_render_budget.chunk_size = MAX(chunk_size, 1);
+}
+
+static void rgb_render_budget_frame_done(void) {
+    rgb_render_budget.frame_count++;
+
+    uint32_t timer_now = timer_read32();
+    if (TIMER_DIFF_32(timer_now, rgb_render_budget.stats_timer) >= 1000) {
+        rgb_render_budget.last_frame_rate     = rgb_render_budget.frame_count;
+        rgb_render_budget.last_worst_chunk_us = rgb_render_budget.worst_chunk_us;
+#    if defined(CONSOLE_ENABLE)
+        dprintf("rgb matrix frame rate: %lu, worst chunk: %luus, chunk size: %u\n", rgb_render_budget.last_frame_rate, rgb_render_budget.last_worst_chunk_us, rgb_render_budget.chunk_size);
+#    endif
+        rgb_render_budget.stats_timer    = timer_now;
+        rgb_render_budget.frame_count    = 0;
+        rgb_render_budget.worst_chunk_us = 0;
+    }
+}
+
+uint32_t rgb_matrix_get_frame_rate(void) {
+    return rgb_render_budget.last_frame_rate;
+}
+
+uint32_t rgb_matrix_get_worst_chunk_us(void) {
+    return rgb_render_budget.last_worst_chunk_us;
+}
+
+uint8_t rgb_matrix_get_render_chunk_size(void) {
+    return rgb_render_budget.chunk_size;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_render(uint8_t effect) {
     bool rendering         = false;
     rgb_effect_params.init = (effect != rgb_last_effect) || (rgb_matrix_config.enable != rgb_last_enable);
@@ -343,6 +460,10 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_budget_frame_done();
+#endif
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -367,7 +488,11 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            uint32_t render_start = rgb_matrix_render_timer_us();
+            rgb_render_budget_begin_chunk();
+#endif
             rgb_task_render(effect);
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
@@ -375,7 +500,10 @@ void rgb_matrix_task(void) {
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
-            break;
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            rgb_render_budget_end_chunk(rgb_matrix_render_timer_us() - render_start);
+#endif
+        } break;
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -399,7 +527,11 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#if defined(RGB_MATRIX_RENDER_BUDGET_US)
+    // The chunk sizes vary, so `iter` can't be used to work out the limits -- they're always those of the current chunk
+    limits.led_min_index = rgb_render_budget.chunk_min;
+    limits.led_max_index = rgb_render_budget.chunk_max;
+#elif defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
 #    if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
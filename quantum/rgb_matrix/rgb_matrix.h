@@ -152,6 +152,13 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
 void rgb_matrix_task(void);
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+uint32_t rgb_matrix_render_timer_us(void);
+uint32_t rgb_matrix_get_frame_rate(void);
+uint32_t rgb_matrix_get_worst_chunk_us(void);
+uint8_t  rgb_matrix_get_render_chunk_size(void);
+#endif
+
 // This runs after another backlight effect and replaces
 // colors already set
 void rgb_matrix_indicators(void);
@@ -24,6 +24,20 @@
 #include "action.h"
 #include "wait.h"
 
+#if defined(NKRO_ENABLE) && defined(SEND_STRING_NKRO_BATCH)
+#    include "host.h"
+#    include "keycode_config.h"
+#    include "action_util.h"
+#endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+#    include "timer.h"
+#    ifdef UNICODE_COMMON_ENABLE
+#        include "unicode.h"
+#        include "utf8.h"
+#    endif
+#endif
+
 #if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
 #    include "audio.h"
 #    ifndef BELL_SOUND
@@ -146,6 +160,103 @@ __attribute__((weak)) const uint8_t ascii_to_keycode_lut[128] PROGMEM = {
 // Note: we bit-pack in "reverse" order to optimize loading
 #define PGM_LOADBIT(mem, pos) ((pgm_read_byte(&((mem)[(pos) / 8])) >> ((pos) % 8)) & 0x01)
 
+static inline char read_char(const char *string, bool progmem) {
+#if defined(__AVR__)
+    if (progmem) {
+        return pgm_read_byte(string);
+    }
+#endif
+    return *string;
+}
+
+#if defined(NKRO_ENABLE) && defined(SEND_STRING_NKRO_BATCH)
+// Whether a character can be typed as part of a batch: a plain keypress, optionally with modifiers
+static bool batch_char_allowed(char ascii_code) {
+    if (!ascii_code || ascii_code == SS_QMK_PREFIX || (uint8_t)ascii_code >= 128) {
+        return false;
+    }
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') {
+        return false;
+    }
+#    endif
+    return pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]) != KC_NO && !PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+}
+
+/* Types out the run of characters at the start of the string in a single NKRO report, if there is more than one.
+ *
+ * The host reads the keys in a report in keycode order, so a run only continues while the keycodes go up -- which
+ * also rules out repeated characters. All characters in a run need the same modifiers.
+ *
+ * Returns the number of characters typed, or 0 if the string should carry on one character at a time.
+ */
+static uint8_t send_string_batch(const char *string, bool progmem, uint8_t interval) {
+    if (!keyboard_protocol || !keymap_config.nkro) {
+        return 0;
+    }
+
+    char ascii_code = read_char(string, progmem);
+    if (!batch_char_allowed(ascii_code)) {
+        return 0;
+    }
+
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    uint8_t last       = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    uint8_t count      = 1;
+    while (count < UINT8_MAX) {
+        ascii_code = read_char(string + count, progmem);
+        if (!batch_char_allowed(ascii_code) || PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code) != is_shifted || PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code) != is_altgred) {
+            break;
+        }
+        uint8_t keycode = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+        if (keycode <= last) {
+            break;
+        }
+        last = keycode;
+        count++;
+    }
+
+    if (count < 2) {
+        return 0;
+    }
+
+    if (is_shifted) {
+        register_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+
+    if (is_altgred) {
+        register_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        add_key(pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)read_char(string + i, progmem)]));
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+
+    for (uint8_t i = 0; i < count; i++) {
+        del_key(pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)read_char(string + i, progmem)]));
+    }
+    send_keyboard_report();
+    wait_ms(interval);
+
+    if (is_altgred) {
+        unregister_code(KC_RIGHT_ALT);
+        wait_ms(interval);
+    }
+
+    if (is_shifted) {
+        unregister_code(KC_LEFT_SHIFT);
+        wait_ms(interval);
+    }
+
+    return count;
+}
+#endif
+
 void send_string(const char *string) {
     send_string_with_delay(string, TAP_CODE_DELAY);
 }
@@ -185,6 +296,13 @@ void send_string_with_delay(const char *string, uint8_t interval) {
 
             wait_ms(interval);
         } else {
+#if defined(NKRO_ENABLE) && defined(SEND_STRING_NKRO_BATCH)
+            uint8_t batched = send_string_batch(string, false, interval);
+            if (batched) {
+                string += batched;
+                continue;
+            }
+#endif
             send_char_with_delay(ascii_code, interval);
         }
 
@@ -329,6 +447,13 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
                 wait_ms(ms);
             }
         } else {
+#if defined(NKRO_ENABLE) && defined(SEND_STRING_NKRO_BATCH)
+            uint8_t batched = send_string_batch(string, true, interval);
+            if (batched) {
+                string += batched;
+                continue;
+            }
+#endif
             send_char_with_delay(ascii_code, interval);
         }
 
@@ -336,3 +461,387 @@ void send_string_with_delay_P(const char *string, uint8_t interval) {
     }
 }
 #endif
+
+#ifdef SEND_STRING_ASYNC_ENABLE
+/* Queued strings are stored back to back in a ring buffer, each as
+ * [record type][interval][string bytes...][0]
+ *
+ * send_string_task() expands one character at a time into the keystrokes
+ * and delays send_string_with_delay() would produce, and steps through them
+ * without waiting in place.
+ */
+
+enum {
+    SEND_STRING_RECORD_ASCII,
+    SEND_STRING_RECORD_UNICODE,
+};
+
+enum {
+    SEND_STRING_OP_REGISTER,
+    SEND_STRING_OP_UNREGISTER,
+    SEND_STRING_OP_WAIT,
+};
+
+typedef struct {
+    uint8_t  type;
+    uint8_t  keycode;
+    uint16_t ms;
+} send_string_op_t;
+
+// Enough for a shifted, AltGr'd dead key with a delay after every step
+#    define SEND_STRING_OPS_MAX 16
+
+static uint8_t  queue[SEND_STRING_ASYNC_BUFFER_SIZE];
+static uint16_t queue_head  = 0;
+static uint16_t queue_count = 0;
+
+static bool    record_open     = false;
+static uint8_t record_type     = SEND_STRING_RECORD_ASCII;
+static uint8_t record_interval = 0;
+
+static send_string_op_t ops[SEND_STRING_OPS_MAX];
+static uint8_t          ops_count  = 0;
+static uint8_t          ops_index  = 0;
+static bool             waiting    = false;
+static uint16_t         wait_timer = 0;
+
+#    ifdef UNICODE_COMMON_ENABLE
+static uint8_t unicode_digits[16];
+static uint8_t unicode_digits_count = 0;
+static uint8_t unicode_digits_index = 0;
+static bool    unicode_active       = false;
+static bool    unicode_cancelled    = false;
+#    endif
+
+static void queue_push(uint8_t byte) {
+    uint16_t index = queue_head + queue_count++;
+    if (index >= SEND_STRING_ASYNC_BUFFER_SIZE) {
+        index -= SEND_STRING_ASYNC_BUFFER_SIZE;
+    }
+    queue[index] = byte;
+}
+
+static uint8_t queue_peek(uint16_t offset) {
+    uint16_t index = queue_head + offset;
+    if (index >= SEND_STRING_ASYNC_BUFFER_SIZE) {
+        index -= SEND_STRING_ASYNC_BUFFER_SIZE;
+    }
+    return queue[index];
+}
+
+static uint8_t queue_pop(void) {
+    uint8_t byte = queue[queue_head];
+    if (++queue_head >= SEND_STRING_ASYNC_BUFFER_SIZE) {
+        queue_head = 0;
+    }
+    queue_count--;
+    return byte;
+}
+
+// Next byte of the current record, or 0 once its end has been reached
+static uint8_t record_pop(void) {
+    if (!record_open) {
+        return 0;
+    }
+    uint8_t byte = queue_pop();
+    if (!byte) {
+        record_open = false;
+    }
+    return byte;
+}
+
+static bool send_string_async_enqueue(uint8_t type, const char *string, uint8_t interval, bool progmem) {
+    if (!string) {
+        return false;
+    }
+
+    uint16_t length = 0;
+    while (read_char(string + length, progmem)) {
+        if (++length > SEND_STRING_ASYNC_BUFFER_SIZE) {
+            return false;
+        }
+    }
+
+    // All or nothing, so a string is never cut short
+    if (length + 3 > SEND_STRING_ASYNC_BUFFER_SIZE - queue_count) {
+        return false;
+    }
+
+    queue_push(type);
+    queue_push(interval);
+    for (uint16_t i = 0; i < length; i++) {
+        queue_push(read_char(string + i, progmem));
+    }
+    queue_push(0);
+    return true;
+}
+
+static void ops_add(uint8_t type, uint8_t keycode, uint16_t ms) {
+    if (type == SEND_STRING_OP_WAIT && !ms) {
+        return;
+    }
+    ops[ops_count++] = (send_string_op_t){.type = type, .keycode = keycode, .ms = ms};
+}
+
+static void ops_add_tap(uint8_t keycode, uint16_t delay) {
+    ops_add(SEND_STRING_OP_REGISTER, keycode, 0);
+    ops_add(SEND_STRING_OP_WAIT, 0, delay);
+    ops_add(SEND_STRING_OP_UNREGISTER, keycode, 0);
+}
+
+// Same keystrokes as send_char_with_delay()
+static void ops_add_char(char ascii_code, uint8_t interval) {
+#    if defined(AUDIO_ENABLE) && defined(SENDSTRING_BELL)
+    if (ascii_code == '\a') { // BEL
+        PLAY_SONG(bell_song);
+        return;
+    }
+#    endif
+
+    uint8_t keycode    = pgm_read_byte(&ascii_to_keycode_lut[(uint8_t)ascii_code]);
+    bool    is_shifted = PGM_LOADBIT(ascii_to_shift_lut, (uint8_t)ascii_code);
+    bool    is_altgred = PGM_LOADBIT(ascii_to_altgr_lut, (uint8_t)ascii_code);
+    bool    is_dead    = PGM_LOADBIT(ascii_to_dead_lut, (uint8_t)ascii_code);
+
+    if (is_shifted) {
+        ops_add(SEND_STRING_OP_REGISTER, KC_LEFT_SHIFT, 0);
+        ops_add(SEND_STRING_OP_WAIT, 0, interval);
+    }
+
+    if (is_altgred) {
+        ops_add(SEND_STRING_OP_REGISTER, KC_RIGHT_ALT, 0);
+        ops_add(SEND_STRING_OP_WAIT, 0, interval);
+    }
+
+    ops_add_tap(keycode, interval);
+    ops_add(SEND_STRING_OP_WAIT, 0, interval);
+
+    if (is_altgred) {
+        ops_add(SEND_STRING_OP_UNREGISTER, KC_RIGHT_ALT, 0);
+        ops_add(SEND_STRING_OP_WAIT, 0, interval);
+    }
+
+    if (is_shifted) {
+        ops_add(SEND_STRING_OP_UNREGISTER, KC_LEFT_SHIFT, 0);
+        ops_add(SEND_STRING_OP_WAIT, 0, interval);
+    }
+
+    if (is_dead) {
+        ops_add_tap(KC_SPACE, TAP_CODE_DELAY);
+        ops_add(SEND_STRING_OP_WAIT, 0, interval);
+    }
+}
+
+// Same keystrokes as send_string_with_delay() for a single character or SS_ code
+static void ops_add_record_ascii(uint8_t ascii_code) {
+    if (ascii_code != SS_QMK_PREFIX) {
+        ops_add_char(ascii_code, record_interval);
+        return;
+    }
+
+    uint8_t code = record_pop();
+    if (code == SS_TAP_CODE) {
+        uint8_t keycode = record_pop();
+        ops_add_tap(keycode, keycode == KC_CAPS_LOCK ? TAP_HOLD_CAPS_DELAY : TAP_CODE_DELAY);
+    } else if (code == SS_DOWN_CODE) {
+        ops_add(SEND_STRING_OP_REGISTER, record_pop(), 0);
+    } else if (code == SS_UP_CODE) {
+        ops_add(SEND_STRING_OP_UNREGISTER, record_pop(), 0);
+    } else if (code == SS_DELAY_CODE) {
+        uint16_t ms      = 0;
+        uint8_t  keycode = record_pop();
+
+        // The first character after the digits is the terminator, and is dropped as well
+        while (isdigit(keycode)) {
+            ms *= 10;
+            ms += keycode - '0';
+            keycode = record_pop();
+        }
+
+        ops_add(SEND_STRING_OP_WAIT, 0, ms);
+    }
+    ops_add(SEND_STRING_OP_WAIT, 0, record_interval);
+}
+
+#    ifdef UNICODE_COMMON_ENABLE
+static void ops_add_record_unicode(uint8_t lead) {
+    // Look ahead at the rest of the sequence, without going past the end of the record
+    char    utf8[4]   = {lead};
+    uint8_t available = 1;
+    while (available < sizeof(utf8) && queue_peek(available - 1)) {
+        utf8[available] = queue_peek(available - 1);
+        available++;
+    }
+
+    int32_t code_point = 0;
+    uint8_t length     = decode_utf8(utf8, &code_point) - utf8;
+    for (uint8_t i = 1; i < length && i < available; i++) {
+        queue_pop();
+    }
+
+    if (code_point < 0) {
+        return;
+    }
+
+    unicode_digits_count = unicode_code_point_digits(code_point, unicode_digits);
+    if (!unicode_digits_count) {
+        return;
+    }
+
+    // The input sequence is sent as a whole, only the digits are spread out
+    unicode_digits_index = 0;
+    unicode_active       = true;
+    unicode_cancelled    = false;
+    unicode_input_start();
+}
+
+static bool ops_add_unicode_digit(void) {
+    if (unicode_digits_index < unicode_digits_count) {
+        uint8_t digit = unicode_digits[unicode_digits_index++];
+        if (get_unicode_input_mode() == UNICODE_MODE_WINDOWS) {
+            ops_add_tap(unicode_windows_digit_keycode(digit), TAP_CODE_DELAY);
+        } else {
+            ops_add_char(digit < 10 ? digit + '0' : digit - 10 + 'a', TAP_CODE_DELAY);
+        }
+        return true;
+    }
+
+    if (unicode_active) {
+        unicode_active = false;
+        if (unicode_cancelled) {
+            unicode_input_cancel();
+        } else {
+            unicode_input_finish();
+        }
+        return true;
+    }
+
+    return false;
+}
+#    endif
+
+// Expands the next step of the queue into ops, returning false once there is nothing left to do
+static bool ops_refill(void) {
+#    ifdef UNICODE_COMMON_ENABLE
+    if (ops_add_unicode_digit()) {
+        return true;
+    }
+#    endif
+
+    if (!record_open) {
+        if (!queue_count) {
+            return false;
+        }
+        record_type     = queue_pop();
+        record_interval = queue_pop();
+        record_open     = true;
+    }
+
+    uint8_t byte = record_pop();
+    if (!byte) {
+        return true;
+    }
+
+    switch (record_type) {
+        case SEND_STRING_RECORD_ASCII:
+            ops_add_record_ascii(byte);
+            break;
+#    ifdef UNICODE_COMMON_ENABLE
+        case SEND_STRING_RECORD_UNICODE:
+            ops_add_record_unicode(byte);
+            break;
+#    endif
+    }
+    return true;
+}
+
+bool send_string_async(const char *string) {
+    return send_string_async_with_delay(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay(const char *string, uint8_t interval) {
+    return send_string_async_enqueue(SEND_STRING_RECORD_ASCII, string, interval, false);
+}
+
+#    if defined(__AVR__)
+bool send_string_async_P(const char *string) {
+    return send_string_async_with_delay_P(string, TAP_CODE_DELAY);
+}
+
+bool send_string_async_with_delay_P(const char *string, uint8_t interval) {
+    return send_string_async_enqueue(SEND_STRING_RECORD_ASCII, string, interval, true);
+}
+#    endif
+
+#    ifdef UNICODE_COMMON_ENABLE
+bool send_unicode_string_async(const char *string) {
+    return send_string_async_enqueue(SEND_STRING_RECORD_UNICODE, string, TAP_CODE_DELAY, false);
+}
+#    endif
+
+bool send_string_async_is_busy(void) {
+#    ifdef UNICODE_COMMON_ENABLE
+    if (unicode_active) {
+        return true;
+    }
+#    endif
+    return ops_index < ops_count || record_open || queue_count;
+}
+
+uint16_t send_string_async_free(void) {
+    return SEND_STRING_ASYNC_BUFFER_SIZE - queue_count;
+}
+
+void send_string_async_clear(void) {
+    queue_head  = 0;
+    queue_count = 0;
+    record_open = false;
+#    ifdef UNICODE_COMMON_ENABLE
+    if (unicode_active) {
+        unicode_digits_index = unicode_digits_count;
+        unicode_cancelled    = true;
+    }
+#    endif
+}
+
+void send_string_task(void) {
+    bool refilled = false;
+    while (true) {
+        while (ops_index < ops_count) {
+            send_string_op_t *op = &ops[ops_index];
+            switch (op->type) {
+                case SEND_STRING_OP_REGISTER:
+                    register_code(op->keycode);
+                    break;
+                case SEND_STRING_OP_UNREGISTER:
+                    unregister_code(op->keycode);
+                    break;
+                case SEND_STRING_OP_WAIT:
+                    if (!waiting) {
+                        waiting    = true;
+                        wait_timer = timer_read();
+                    }
+                    if (timer_elapsed(wait_timer) < op->ms) {
+                        return;
+                    }
+                    waiting = false;
+                    break;
+            }
+            ops_index++;
+        }
+        ops_count = 0;
+        ops_index = 0;
+
+        // At most one character per call, so the rest of the firmware keeps running while a long string is typed
+        if (refilled) {
+            return;
+        }
+        do {
+            if (!ops_refill()) {
+                return;
+            }
+        } while (!ops_count);
+        refilled = true;
+    }
+}
+#endif
@@ -24,6 +24,7 @@
  */
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "progmem.h"
 #include "send_string_keycodes.h"
@@ -161,4 +162,101 @@ void send_string_with_delay_P(const char *string, uint8_t interval);
  */
 #define SEND_STRING_DELAY(string, interval) send_string_with_delay_P(PSTR(string), interval)
 
+#if defined(SEND_STRING_ASYNC_ENABLE) || defined(__DOXYGEN__)
+#    ifndef SEND_STRING_ASYNC_BUFFER_SIZE
+#        define SEND_STRING_ASYNC_BUFFER_SIZE 128
+#    endif
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background.
+ *
+ * This function simply calls `send_string_async_with_delay(string, TAP_CODE_DELAY)`.
+ *
+ * \param string The string to type out.
+ *
+ * \return `false` if there is not enough room left in the queue, in which case nothing is queued.
+ */
+bool send_string_async(const char *string);
+
+/**
+ * \brief Queue a string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * The string is copied, and typed out by `send_string_task()` with the same keystrokes and timing as `send_string_with_delay()`, without blocking the rest of the firmware while it waits.
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ *
+ * \return `false` if there is not enough room left in the queue, in which case nothing is queued.
+ */
+bool send_string_async_with_delay(const char *string, uint8_t interval);
+
+#    if defined(UNICODE_COMMON_ENABLE) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a string containing Unicode characters to be typed out in the background.
+ *
+ * Each character is typed like `register_unicode()` does. The input sequence around each character is sent as a whole, only the digits in between are spread out.
+ *
+ * \param string The UTF-8 encoded string to type out.
+ *
+ * \return `false` if there is not enough room left in the queue, in which case nothing is queued.
+ */
+bool send_unicode_string_async(const char *string);
+#    endif
+
+/**
+ * \brief Whether there is anything left to type out.
+ */
+bool send_string_async_is_busy(void);
+
+/**
+ * \brief Get the number of bytes left in the queue.
+ *
+ * Each queued string takes up its length plus three bytes.
+ */
+uint16_t send_string_async_free(void);
+
+/**
+ * \brief Drop everything that is still queued.
+ *
+ * The character being typed is finished first, so that no keys are left held down. A Unicode character is cancelled instead.
+ */
+void send_string_async_clear(void);
+
+/**
+ * \brief Type out the queued strings. Called from `quantum_task()`.
+ */
+void send_string_task(void);
+
+#    if defined(__AVR__) || defined(__DOXYGEN__)
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, TAP_CODE_DELAY).
+ *
+ * \param string The string to type out.
+ */
+bool send_string_async_P(const char *string);
+
+/**
+ * \brief Queue a PROGMEM string of ASCII characters to be typed out in the background, with a delay between each character.
+ *
+ * On ARM devices, this function is simply an alias for send_string_async_with_delay(string, interval).
+ *
+ * \param string The string to type out.
+ * \param interval The amount of time, in milliseconds, to wait before typing the next character.
+ */
+bool send_string_async_with_delay_P(const char *string, uint8_t interval);
+#    else
+#        define send_string_async_P(string) send_string_async_with_delay(string, TAP_CODE_DELAY)
+#        define send_string_async_with_delay_P(string, interval) send_string_async_with_delay(string, interval)
+#    endif
+
+/**
+ * \brief Shortcut macro for send_string_async_with_delay_P(PSTR(string), 0).
+ *
+ * On ARM devices, this define evaluates to send_string_async_with_delay(string, 0).
+ */
+#    define SEND_STRING_ASYNC(string) send_string_async_with_delay_P(PSTR(string), 0)
+#endif
+
 /** \} */
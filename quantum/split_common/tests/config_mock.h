@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 4
+#define MATRIX_COLS 4
+
+#define SPLIT_LED_STATE_ENABLE
+#define SPLIT_MODS_ENABLE
+#define NO_ACTION_ONESHOT
+
+#define FORCED_SYNC_THROTTLE_MS 100
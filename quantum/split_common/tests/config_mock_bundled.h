@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include "config_mock.h"
+
+#define SPLIT_TRANSPORT_BUNDLE
+// Room for the sync timer and LED state, but not the mods on top
+#define SPLIT_TRANSPORT_BUNDLE_SIZE 8
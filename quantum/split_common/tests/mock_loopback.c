@@ -0,0 +1,109 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock_loopback.h"
+#include "transactions.h"
+#include "transport.h"
+
+uint16_t loopback_transactions = 0;
+uint16_t loopback_transactions_by_id[NUM_TOTAL_TRANSACTIONS];
+bool     loopback_fail              = false;
+bool     loopback_corrupt_next_read = false;
+
+uint8_t mock_host_leds       = 0;
+uint8_t mock_slave_leds      = 0;
+uint8_t mock_mods            = 0;
+uint8_t mock_weak_mods       = 0;
+uint8_t mock_slave_mods      = 0;
+uint8_t mock_slave_weak_mods = 0;
+
+// Both halves run in the same process, so whichever side is running has its memory swapped into split_shmem
+static split_shared_memory_t shared_memory;
+static split_shared_memory_t other_side_memory;
+split_shared_memory_t *const split_shmem = &shared_memory;
+
+static void swap_sides(void) {
+    split_shared_memory_t temp;
+    memcpy(&temp, &shared_memory, sizeof(temp));
+    memcpy(&shared_memory, &other_side_memory, sizeof(temp));
+    memcpy(&other_side_memory, &temp, sizeof(temp));
+}
+
+void loopback_reset(void) {
+    loopback_transactions = 0;
+    memset(loopback_transactions_by_id, 0, sizeof(loopback_transactions_by_id));
+    loopback_fail              = false;
+    loopback_corrupt_next_read = false;
+}
+
+void loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    swap_sides();
+    transactions_slave(master_matrix, slave_matrix);
+    swap_sides();
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    loopback_transactions++;
+    loopback_transactions_by_id[id]++;
+    if (loopback_fail) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (initiator2target_length > 0) {
+        size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
+        memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+    }
+
+    // Send the full buffer across, as the serial transport does
+    memcpy((uint8_t *)&other_side_memory + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (trans->slave_callback) {
+        swap_sides();
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        swap_sides();
+    }
+    memcpy(split_trans_target2initiator_buffer(trans), (uint8_t *)&other_side_memory + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+
+    if (target2initiator_length > 0) {
+        if (loopback_corrupt_next_read) {
+            loopback_corrupt_next_read = false;
+            split_trans_target2initiator_buffer(trans)[0] ^= 0xFF;
+        }
+        size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+        memcpy(target2initiator_buf, split_trans_target2initiator_buffer(trans), len);
+    }
+    return true;
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+bool is_keyboard_master(void) {
+    return true;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return mock_host_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    mock_slave_leds = led_state;
+}
+
+uint8_t get_mods(void) {
+    return mock_mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return mock_weak_mods;
+}
+
+void set_mods(uint8_t mods) {
+    mock_slave_mods = mods;
+}
+
+void set_weak_mods(uint8_t mods) {
+    mock_slave_weak_mods = mods;
+}
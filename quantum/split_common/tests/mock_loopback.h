@@ -0,0 +1,30 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "matrix.h"
+#include "transaction_id_define.h"
+
+// Transactions executed since the last loopback_reset(), in total and by ID
+extern uint16_t loopback_transactions;
+extern uint16_t loopback_transactions_by_id[NUM_TOTAL_TRANSACTIONS];
+
+// Makes every transaction fail while set
+extern bool loopback_fail;
+// Flips the first byte returned by the next transaction reading from the slave
+extern bool loopback_corrupt_next_read;
+
+// Host state seen by the master, and as applied by the slave
+extern uint8_t mock_host_leds;
+extern uint8_t mock_slave_leds;
+extern uint8_t mock_mods;
+extern uint8_t mock_weak_mods;
+extern uint8_t mock_slave_mods;
+extern uint8_t mock_slave_weak_mods;
+
+void loopback_reset(void);
+
+// Runs transactions_slave() against the slave side of the shared memory
+void loopback_run_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
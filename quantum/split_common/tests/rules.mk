@@ -0,0 +1,24 @@
+split_transactions_DEFS := -DSPLIT_KEYBOARD
+split_transactions_INC := $(QUANTUM_PATH)/split_common
+split_transactions_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock.h
+
+split_transactions_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/tests/mock_loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp
+
+split_transactions_bundled_DEFS := -DSPLIT_KEYBOARD
+split_transactions_bundled_INC := $(QUANTUM_PATH)/split_common
+split_transactions_bundled_CONFIG := $(QUANTUM_PATH)/split_common/tests/config_mock_bundled.h
+
+split_transactions_bundled_SRC := \
+	platforms/test/timer.c \
+	$(QUANTUM_PATH)/crc.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/tests/mock_loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/transactions_tests.cpp \
+	$(QUANTUM_PATH)/split_common/tests/transactions_bundled_tests.cpp
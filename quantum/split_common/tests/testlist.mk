@@ -0,0 +1,3 @@
+TEST_LIST += \
+	split_transactions \
+	split_transactions_bundled
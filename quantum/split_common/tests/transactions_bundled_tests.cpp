@@ -0,0 +1,106 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock_loopback.h"
+#include "transactions.h"
+
+void advance_time(uint32_t ms);
+}
+
+class BundledTransactions : public ::testing::Test {
+   protected:
+    matrix_row_t master_keys[MATRIX_ROWS / 2];
+    matrix_row_t slave_keys[MATRIX_ROWS / 2];
+    matrix_row_t received_keys[MATRIX_ROWS / 2];
+    matrix_row_t mirrored_keys[MATRIX_ROWS / 2];
+
+    void SetUp() override {
+        memset(master_keys, 0, sizeof(master_keys));
+        memset(slave_keys, 0, sizeof(slave_keys));
+        memset(received_keys, 0, sizeof(received_keys));
+        memset(mirrored_keys, 0, sizeof(mirrored_keys));
+        mock_host_leds  = 0;
+        mock_mods       = 0;
+        mock_weak_mods  = 0;
+        mock_slave_leds = 0;
+        mock_slave_mods = 0;
+
+        loopback_reset();
+        for (int i = 0; i < 3; i++) {
+            scan();
+        }
+        loopback_reset();
+    }
+
+    bool scan() {
+        loopback_run_slave(mirrored_keys, slave_keys);
+        return transactions_master(master_keys, received_keys);
+    }
+};
+
+TEST_F(BundledTransactions, ForcedSyncIsStillOneExchange) {
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    slave_keys[1] = 0b0011;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(scan());
+    }
+    EXPECT_EQ(received_keys[1], 0b0011);
+    EXPECT_EQ(loopback_transactions, 3);
+    EXPECT_EQ(loopback_transactions_by_id[BUNDLE_EXCHANGE], 3);
+}
+
+TEST_F(BundledTransactions, UnchangedSlaveSectionsAreNotResent) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->bundle_s2m.length, 0);
+
+    slave_keys[0] = 0b0100;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->bundle_s2m.length, 1 + sizeof(split_shmem->smatrix.matrix));
+
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(split_shmem->bundle_s2m.length, 0);
+    EXPECT_EQ(received_keys[0], 0b0100);
+}
+
+TEST_F(BundledTransactions, CorruptResponseIsRetried) {
+    slave_keys[0]              = 0b0001;
+    loopback_corrupt_next_read = true;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_keys[0], 0b0001);
+    EXPECT_EQ(loopback_transactions_by_id[BUNDLE_EXCHANGE], 2);
+}
+
+TEST_F(BundledTransactions, SectionsThatDoNotFitGoWithTheNextExchange) {
+    advance_time(FORCED_SYNC_THROTTLE_MS);
+    mock_host_leds = 0x04;
+    mock_mods      = 0x01;
+
+    // Staged by the handlers
+    EXPECT_TRUE(scan());
+    // The sync timer and LED state fill the frame
+    EXPECT_TRUE(scan());
+    loopback_run_slave(mirrored_keys, slave_keys);
+    EXPECT_EQ(mock_slave_leds, 0x04);
+    EXPECT_EQ(mock_slave_mods, 0);
+
+    EXPECT_TRUE(scan());
+    loopback_run_slave(mirrored_keys, slave_keys);
+    EXPECT_EQ(mock_slave_mods, 0x01);
+    EXPECT_EQ(loopback_transactions, 3);
+}
+
+TEST_F(BundledTransactions, FailedExchangeKeepsStagedData) {
+    mock_mods = 0x20;
+    EXPECT_TRUE(scan());
+
+    loopback_fail = true;
+    EXPECT_FALSE(scan());
+    loopback_fail = false;
+
+    EXPECT_TRUE(scan());
+    loopback_run_slave(mirrored_keys, slave_keys);
+    EXPECT_EQ(mock_slave_mods, 0x20);
+}
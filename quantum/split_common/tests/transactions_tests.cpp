@@ -0,0 +1,105 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock_loopback.h"
+#include "transactions.h"
+}
+
+class Transactions : public ::testing::Test {
+   protected:
+    // The keys of each half, and what the master has received of the slave half
+    matrix_row_t master_keys[MATRIX_ROWS / 2];
+    matrix_row_t slave_keys[MATRIX_ROWS / 2];
+    matrix_row_t received_keys[MATRIX_ROWS / 2];
+    matrix_row_t mirrored_keys[MATRIX_ROWS / 2];
+
+    void SetUp() override {
+        memset(master_keys, 0, sizeof(master_keys));
+        memset(slave_keys, 0, sizeof(slave_keys));
+        memset(received_keys, 0, sizeof(received_keys));
+        memset(mirrored_keys, 0, sizeof(mirrored_keys));
+        mock_host_leds = 0;
+        mock_mods      = 0;
+        mock_weak_mods = 0;
+
+        // Flush anything left over from the previous test
+        loopback_reset();
+        for (int i = 0; i < 3; i++) {
+            scan();
+        }
+        loopback_reset();
+    }
+
+    bool scan() {
+        loopback_run_slave(mirrored_keys, slave_keys);
+        return transactions_master(master_keys, received_keys);
+    }
+};
+
+TEST_F(Transactions, SlaveMatrixReachesMaster) {
+    slave_keys[1] = 0b0101;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_keys[0], 0);
+    EXPECT_EQ(received_keys[1], 0b0101);
+
+    slave_keys[1] = 0;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_keys[1], 0);
+}
+
+TEST_F(Transactions, HostStateReachesSlave) {
+    mock_host_leds = 0x02;
+    mock_mods      = 0x12;
+    mock_weak_mods = 0x04;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_TRUE(scan());
+    }
+    loopback_run_slave(mirrored_keys, slave_keys);
+
+    EXPECT_EQ(mock_slave_leds, 0x02);
+    EXPECT_EQ(mock_slave_mods, 0x12);
+    EXPECT_EQ(mock_slave_weak_mods, 0x04);
+}
+
+TEST_F(Transactions, RecoversFromCorruptRead) {
+    slave_keys[0] = 0b1000;
+    loopback_corrupt_next_read = true;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_keys[0], 0b1000);
+}
+
+TEST_F(Transactions, FailedTransportKeepsLastMatrix) {
+    slave_keys[0] = 0b0010;
+    EXPECT_TRUE(scan());
+
+    loopback_fail = true;
+    slave_keys[0] = 0;
+    EXPECT_FALSE(scan());
+    EXPECT_EQ(received_keys[0], 0b0010);
+
+    loopback_fail = false;
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(received_keys[0], 0);
+}
+
+TEST_F(Transactions, IdleScanIsOneTransaction) {
+    EXPECT_TRUE(scan());
+    EXPECT_EQ(loopback_transactions, 1);
+}
+
+TEST_F(Transactions, TransactionsPerChangedScan) {
+    slave_keys[0]  = 0b0001;
+    mock_host_leds = 0x01;
+    mock_mods      = 0x02;
+    EXPECT_TRUE(scan());
+#ifdef SPLIT_TRANSPORT_BUNDLE
+    // Everything goes through the one exchange
+    EXPECT_EQ(loopback_transactions, 1);
+#else
+    // Matrix checksum and data, LED state, mods
+    EXPECT_EQ(loopback_transactions, 4);
+#endif
+}
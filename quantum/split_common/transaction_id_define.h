@@ -16,14 +16,24 @@
 
 #pragma once
 
+#include "util.h"
+
 enum serial_transaction_id {
 #ifdef USE_I2C
     I2C_EXECUTE_CALLBACK,
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BUNDLE
+    BUNDLE_EXCHANGE,
+#endif // SPLIT_TRANSPORT_BUNDLE
+
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
 
+#ifdef SPLIT_TRANSPORT_MATRIX_EVENTS
+    PUT_SLAVE_MATRIX_ACK,
+#endif // SPLIT_TRANSPORT_MATRIX_EVENTS
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -30,6 +30,7 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "profiling.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -144,7 +145,56 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         split_shared_memory_unlock();                         \
     } while (0)
 
+#ifdef SPLIT_TRANSPORT_BUNDLE
+
+_Static_assert(sizeof(split_bundle_frame_t) <= UINT8_MAX, "SPLIT_TRANSPORT_BUNDLE_SIZE too large for a single transaction");
+
+static uint32_t bundle_dirty = 0; // master: sections written since the last exchange
+static uint8_t  bundle_ack   = 0; // master: sequence of the last response received intact, 0 to ask for everything
+
+static uint8_t  bundle_sequence = 0;                              // slave: sequence of the last response
+static uint32_t bundle_included = 0;                              // slave: sections in the last response
+static uint8_t  bundle_section_seq[NUM_TOTAL_TRANSACTIONS];       // slave: bumped whenever a section changes
+static uint8_t  bundle_section_sent_seq[NUM_TOTAL_TRANSACTIONS];  // slave: value of the above in the last response
+static uint8_t  bundle_section_delivered[NUM_TOTAL_TRANSACTIONS]; // slave: value of the above the master has acknowledged
+
+#    define bundle_section_changed(id) (bundle_section_seq[id]++)
+
+static uint8_t bundle_checksum(const split_bundle_frame_t *frame) {
+    return crc8(&frame->sequence, sizeof(frame->sequence) + sizeof(frame->length) + frame->length);
+}
+
+static bool bundle_is_slave_section(int8_t id) {
+#    if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+    // RPC responses are only ever read on request
+    if (id == GET_RPC_RESP_DATA) {
+        return false;
+    }
+#    endif
+    return id != BUNDLE_EXCHANGE && split_transaction_table[id].target2initiator_buffer_size > 0;
+}
+
+// Stages the data in the local shared memory, to go out with the next exchange
+static bool bundled_write(int8_t id, const void *data, size_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    size_t                    len   = trans->initiator2target_buffer_size < length ? trans->initiator2target_buffer_size : length;
+    memmove(split_trans_initiator2target_buffer(trans), data, len);
+    bundle_dirty |= (uint32_t)1 << id;
+    return true;
+}
+
+#else // SPLIT_TRANSPORT_BUNDLE
+
+#    define bundled_write(id, data, length) transport_write(id, data, length)
+
+#endif // SPLIT_TRANSPORT_BUNDLE
+
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+#ifdef SPLIT_TRANSPORT_BUNDLE
+    // The exchange at the start of transactions_master() has already brought in anything that changed
+    memcpy(destination, equiv_shmem, length);
+    return true;
+#else
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
@@ -157,12 +207,13 @@ inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t tr
         memcpy(destination, equiv_shmem, length);
     }
     return okay;
+#endif // SPLIT_TRANSPORT_BUNDLE
 }
 
 inline static bool send_if_condition(int8_t trans_id, uint32_t *last_update, bool condition, void *source, size_t length) {
     bool okay = true;
     if (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || condition) {
-        okay &= transport_write(trans_id, source, length);
+        okay &= bundled_write(trans_id, source, length);
         if (okay) {
             *last_update = timer_read32();
         }
@@ -175,9 +226,269 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
     return send_if_condition(trans_id, last_update, (memcmp(source, equiv_shmem, length) != 0), source, length);
 }
 
+////////////////////////////////////////////////////
+// Bundle exchange
+
+#ifdef SPLIT_TRANSPORT_BUNDLE
+
+static bool bundle_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    split_bundle_frame_t request = {.sequence = bundle_ack, .length = 0};
+    uint32_t             sent    = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!(bundle_dirty & ((uint32_t)1 << id)) || request.length + 1 + trans->initiator2target_buffer_size > sizeof(request.data)) {
+            continue; // Anything that doesn't fit goes out with the next exchange
+        }
+        request.data[request.length++] = id;
+        memcpy(&request.data[request.length], split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+        request.length += trans->initiator2target_buffer_size;
+        sent |= (uint32_t)1 << id;
+    }
+    request.checksum = bundle_checksum(&request);
+
+    split_bundle_frame_t response;
+    if (!transport_execute_transaction(BUNDLE_EXCHANGE, &request, sizeof(request), &response, sizeof(response)) || response.sequence == 0 || response.length > sizeof(response.data) || response.checksum != bundle_checksum(&response)) {
+        // The slave will resend everything once it sees this
+        bundle_ack = 0;
+        return false;
+    }
+    bundle_dirty &= ~sent;
+
+    for (uint8_t pos = 0; pos < response.length;) {
+        uint8_t id = response.data[pos++];
+        if (id >= NUM_TOTAL_TRANSACTIONS || pos + split_transaction_table[id].target2initiator_buffer_size > response.length) {
+            bundle_ack = 0;
+            return false;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        memcpy(split_trans_target2initiator_buffer(trans), &response.data[pos], trans->target2initiator_buffer_size);
+        pos += trans->target2initiator_buffer_size;
+    }
+    bundle_ack = response.sequence;
+    return true;
+}
+
+static void bundle_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_bundle_frame_t *request  = &split_shmem->bundle_m2s;
+    split_bundle_frame_t       *response = &split_shmem->bundle_s2m;
+
+    response->sequence = 0;
+    response->length   = 0;
+    if (request->length > sizeof(request->data) || request->checksum != bundle_checksum(request)) {
+        // A response with no sequence tells the master to try again
+        response->checksum = bundle_checksum(response);
+        return;
+    }
+
+    for (uint8_t pos = 0; pos < request->length;) {
+        uint8_t id = request->data[pos++];
+        if (id >= NUM_TOTAL_TRANSACTIONS || pos + split_transaction_table[id].initiator2target_buffer_size > request->length) {
+            response->checksum = bundle_checksum(response);
+            return;
+        }
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        memcpy(split_trans_initiator2target_buffer(trans), &request->data[pos], trans->initiator2target_buffer_size);
+        pos += trans->initiator2target_buffer_size;
+        if (trans->slave_callback) {
+            trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+        }
+    }
+
+    if (request->sequence != 0 && request->sequence == bundle_sequence) {
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            if (bundle_included & ((uint32_t)1 << id)) {
+                bundle_section_delivered[id] = bundle_section_sent_seq[id];
+            }
+        }
+    } else {
+        // Our last response was lost, or either side has restarted -- send everything again
+        for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+            bundle_section_delivered[id] = bundle_section_seq[id] - 1;
+        }
+    }
+
+    if (++bundle_sequence == 0) {
+        bundle_sequence = 1;
+    }
+    response->sequence = bundle_sequence;
+    bundle_included    = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        split_transaction_desc_t *trans = &split_transaction_table[id];
+        if (!bundle_is_slave_section(id) || bundle_section_delivered[id] == bundle_section_seq[id] || response->length + 1 + trans->target2initiator_buffer_size > sizeof(response->data)) {
+            continue;
+        }
+        response->data[response->length++] = id;
+        memcpy(&response->data[response->length], split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+        response->length += trans->target2initiator_buffer_size;
+        bundle_section_sent_seq[id] = bundle_section_seq[id];
+        bundle_included |= (uint32_t)1 << id;
+    }
+    response->checksum = bundle_checksum(response);
+}
+
+// clang-format off
+#    define TRANSACTIONS_BUNDLE_MASTER() TRANSACTION_HANDLER_MASTER(bundle)
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS \
+    [BUNDLE_EXCHANGE] = { \
+        sizeof_member(split_shared_memory_t, bundle_m2s), offsetof(split_shared_memory_t, bundle_m2s), \
+        sizeof_member(split_shared_memory_t, bundle_s2m), offsetof(split_shared_memory_t, bundle_s2m), \
+        bundle_handlers_slave_exchange \
+    },
+// clang-format on
+
+#else // SPLIT_TRANSPORT_BUNDLE
+
+#    define TRANSACTIONS_BUNDLE_MASTER()
+#    define TRANSACTIONS_BUNDLE_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BUNDLE
+
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_TRANSPORT_MATRIX_EVENTS
+
+#    ifdef DISABLE_SYNC_TIMER
+#        error "SPLIT_TRANSPORT_MATRIX_EVENTS requires the sync timer, as the event times are in the master's time base"
+#    endif
+
+_Static_assert(MATRIX_COLS <= 128 && (MATRIX_ROWS) / 2 <= 256, "Matrix too large for SPLIT_TRANSPORT_MATRIX_EVENTS");
+
+static split_slave_matrix_events_t smatrix_frame;                                // master: last successfully-read events
+static matrix_row_t                smatrix_applied[(MATRIX_ROWS) / 2];           // master: matrix as of the last event applied
+static uint8_t                     smatrix_expected = 0;                         // master: sequence of the next event to apply
+static uint8_t                     smatrix_acked    = 0;                         // master: value of the above last sent to the slave
+static split_matrix_event_t        smatrix_scan_events[SPLIT_MATRIX_EVENTS_MAX]; // master: events applied by this scan
+static uint8_t                     smatrix_scan_count = 0;
+
+static matrix_row_t         smatrix_recorded[(MATRIX_ROWS) / 2];   // slave: matrix as of the last event recorded
+static split_matrix_event_t smatrix_ring[SPLIT_MATRIX_EVENTS_MAX]; // slave: events not yet acknowledged
+static uint8_t              smatrix_ring_sequence = 0;             // slave: sequence of smatrix_ring[0]
+static uint8_t              smatrix_ring_count    = 0;
+
+static bool slave_matrix_applied_this_scan(uint8_t row, uint8_t col) {
+    for (uint8_t i = 0; i < smatrix_scan_count; i++) {
+        if (smatrix_scan_events[i].row == row && smatrix_scan_events[i].col == col) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t             last_update = 0;
+    split_slave_matrix_events_t temp_frame; // holding area while we test whether or not checksum is correct
+
+    smatrix_scan_count = 0;
+    if (!read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, &temp_frame, &split_shmem->smatrix.events, sizeof(split_shmem->smatrix.events))) {
+        // Nothing is applied, so that a retry within the same scan still reports the times of what it applies
+        memcpy(slave_matrix, smatrix_applied, sizeof(smatrix_applied));
+        return false;
+    }
+    memcpy(&smatrix_frame, &temp_frame, sizeof(temp_frame));
+
+    uint8_t offset = smatrix_expected - smatrix_frame.sequence;
+    if (offset > smatrix_frame.count || smatrix_frame.count > SPLIT_MATRIX_EVENTS_MAX) {
+        // Events were dropped, or the slave restarted -- all that can be done is to catch up with its matrix
+        memcpy(smatrix_applied, smatrix_frame.matrix, sizeof(smatrix_applied));
+        smatrix_expected = smatrix_frame.sequence + smatrix_frame.count;
+    } else {
+        for (; offset < smatrix_frame.count; offset++, smatrix_expected++) {
+            const split_matrix_event_t *event = &smatrix_frame.events[offset];
+            if (event->row >= (MATRIX_ROWS) / 2 || event->col >= MATRIX_COLS) {
+                continue;
+            }
+            // A second change of the same key would be lost in the matrix, so it waits for the next scan
+            if (slave_matrix_applied_this_scan(event->row, event->col)) {
+                break;
+            }
+            if (event->pressed) {
+                smatrix_applied[event->row] |= (matrix_row_t)1 << event->col;
+            } else {
+                smatrix_applied[event->row] &= ~((matrix_row_t)1 << event->col);
+            }
+            smatrix_scan_events[smatrix_scan_count++] = *event;
+        }
+        if (offset == smatrix_frame.count && memcmp(smatrix_applied, smatrix_frame.matrix, sizeof(smatrix_applied)) != 0) {
+            // Everything has been applied, so the two should agree
+            memcpy(smatrix_applied, smatrix_frame.matrix, sizeof(smatrix_applied));
+        }
+    }
+    memcpy(slave_matrix, smatrix_applied, sizeof(smatrix_applied));
+
+    // Only lets the slave free up its buffer, failing here just means trying again later
+    if (smatrix_acked != smatrix_expected && bundled_write(PUT_SLAVE_MATRIX_ACK, &smatrix_expected, sizeof(smatrix_expected))) {
+        smatrix_acked = smatrix_expected;
+    }
+    return true;
+}
+
+static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    uint8_t acked = split_shmem->smatrix_ack - smatrix_ring_sequence;
+    if (acked <= smatrix_ring_count) {
+        memmove(smatrix_ring, smatrix_ring + acked, (smatrix_ring_count - acked) * sizeof(split_matrix_event_t));
+        smatrix_ring_sequence += acked;
+        smatrix_ring_count -= acked;
+    }
+
+    if (memcmp(smatrix_recorded, slave_matrix, sizeof(smatrix_recorded)) == 0) {
+        // Acknowledged events stay in the published frame until there is something new, the master skips them
+        return;
+    }
+
+    const uint16_t now = sync_timer_read();
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        matrix_row_t changes = smatrix_recorded[row] ^ slave_matrix[row];
+        for (uint8_t col = 0; changes; col++, changes >>= 1) {
+            if (!(changes & 1)) {
+                continue;
+            }
+            if (smatrix_ring_count == SPLIT_MATRIX_EVENTS_MAX) {
+                // Drop the oldest, the master will notice the gap in the sequence and resync from the matrix
+                memmove(smatrix_ring, smatrix_ring + 1, (SPLIT_MATRIX_EVENTS_MAX - 1) * sizeof(split_matrix_event_t));
+                smatrix_ring_sequence++;
+                smatrix_ring_count--;
+            }
+            smatrix_ring[smatrix_ring_count++] = (split_matrix_event_t){.time = now, .row = row, .col = col, .pressed = (slave_matrix[row] >> col) & 1};
+        }
+    }
+    memcpy(smatrix_recorded, slave_matrix, sizeof(smatrix_recorded));
+
+    split_slave_matrix_events_t *frame = &split_shmem->smatrix.events;
+    frame->sequence                    = smatrix_ring_sequence;
+    frame->count                       = smatrix_ring_count;
+    memcpy(frame->matrix, slave_matrix, sizeof(frame->matrix));
+    memcpy(frame->events, smatrix_ring, sizeof(frame->events));
+    split_shmem->smatrix.checksum = crc8(frame, sizeof(*frame));
+#    ifdef SPLIT_TRANSPORT_BUNDLE
+    bundle_section_changed(GET_SLAVE_MATRIX_DATA);
+#    endif // SPLIT_TRANSPORT_BUNDLE
+}
+
+bool transactions_slave_matrix_event_time(uint8_t row, uint8_t col, uint16_t *time) {
+    const uint8_t slave_row = row - (isLeftHand ? (MATRIX_ROWS) / 2 : 0);
+    for (uint8_t i = 0; i < smatrix_scan_count; i++) {
+        if (smatrix_scan_events[i].row == slave_row && smatrix_scan_events[i].col == col) {
+            // Bound by the current time, in case the clocks are briefly out of step
+            const uint16_t now = timer_read();
+            *time              = TIMER_DIFF_16(now, smatrix_scan_events[i].time) < UINT16_MAX / 2 ? smatrix_scan_events[i].time : now;
+            return true;
+        }
+    }
+    return false;
+}
+
+// clang-format off
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.events), \
+    [PUT_SLAVE_MATRIX_ACK]      = trans_initiator2target_initializer(smatrix_ack),
+// clang-format on
+
+#else // SPLIT_TRANSPORT_MATRIX_EVENTS
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
@@ -194,18 +505,25 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#    ifdef SPLIT_TRANSPORT_BUNDLE
+    if (memcmp(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix)) != 0) {
+        bundle_section_changed(GET_SLAVE_MATRIX_DATA);
+    }
+#    endif // SPLIT_TRANSPORT_BUNDLE
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
     split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
 }
 
 // clang-format off
-#define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
-#define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
+#    define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
+#    define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
     [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
     [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
 // clang-format on
 
+#endif // SPLIT_TRANSPORT_MATRIX_EVENTS
+
 ////////////////////////////////////////////////////
 // Master matrix
 
@@ -255,6 +573,7 @@ static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t s
             }
 
             if (actioned) {
+                // Never bundled, the slave has to drain its queue before it can add any more events
                 okay &= transport_exec(CMD_ENCODER_DRAIN);
             }
             last_checksum = split_shmem->encoders.checksum;
@@ -267,7 +586,17 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
     // Always prepare the encoder state for read.
     encoder_retrieve_events(&split_shmem->encoders.events);
     // Now update the checksum given that the encoders has been written to
+#    ifdef SPLIT_TRANSPORT_BUNDLE
+    uint8_t last_checksum = split_shmem->encoders.checksum;
+#    endif // SPLIT_TRANSPORT_BUNDLE
     split_shmem->encoders.checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+#    ifdef SPLIT_TRANSPORT_BUNDLE
+    if (split_shmem->encoders.checksum != last_checksum) {
+        // The master only processes events when it sees the checksum change
+        bundle_section_changed(GET_ENCODERS_CHECKSUM);
+        bundle_section_changed(GET_ENCODERS_DATA);
+    }
+#    endif // SPLIT_TRANSPORT_BUNDLE
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
@@ -302,7 +631,7 @@ static bool sync_timer_handlers_master(matrix_row_t master_matrix[], matrix_row_
     bool okay = true;
     if (timer_elapsed32(last_update) >= FORCED_SYNC_THROTTLE_MS) {
         uint32_t sync_timer = sync_timer_read32() + SYNC_TIMER_OFFSET;
-        okay &= transport_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
+        okay &= bundled_write(PUT_SYNC_TIMER, &sync_timer, sizeof(sync_timer));
         if (okay) {
             last_update = timer_read32();
         }
@@ -427,7 +756,7 @@ static bool mods_handlers_master(matrix_row_t master_matrix[], matrix_row_t slav
 
     bool okay = true;
     if (mods_need_sync) {
-        okay &= transport_write(PUT_MODS, &new_mods, sizeof(new_mods));
+        okay &= bundled_write(PUT_MODS, &new_mods, sizeof(new_mods));
         if (okay) {
             last_update = timer_read32();
         }
@@ -769,6 +1098,11 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
     pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
 
     split_shared_memory_lock();
+#    ifdef SPLIT_TRANSPORT_BUNDLE
+    if (pointing.checksum != split_shmem->pointing.checksum) {
+        bundle_section_changed(GET_POINTING_DATA);
+    }
+#    endif // SPLIT_TRANSPORT_BUNDLE
     memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
     split_shared_memory_unlock();
 }
@@ -793,7 +1127,7 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
 static bool watchdog_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     bool okay = true;
     if (!split_watchdog_check()) {
-        okay = transport_write(PUT_WATCHDOG, &okay, sizeof(okay));
+        okay = bundled_write(PUT_WATCHDOG, &okay, sizeof(okay));
         split_watchdog_update(okay);
     }
     return okay;
@@ -925,6 +1259,7 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // USE_I2C
 
     // clang-format off
+    TRANSACTIONS_BUNDLE_REGISTRATIONS
     TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS
     TRANSACTIONS_MASTER_MATRIX_REGISTRATIONS
     TRANSACTIONS_ENCODERS_REGISTRATIONS
@@ -954,7 +1289,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
-bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+static bool transactions_master_exchange(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_BUNDLE_MASTER();
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -977,6 +1313,14 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     return true;
 }
 
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    // Failed exchanges are recorded as well, since they include the retries
+    PROFILING_BEGIN(transactions_master);
+    bool okay = transactions_master_exchange(master_matrix, slave_matrix);
+    PROFILING_END(transactions_master);
+    return okay;
+}
+
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     TRANSACTIONS_SLAVE_MATRIX_SLAVE();
     TRANSACTIONS_MASTER_MATRIX_SLAVE();
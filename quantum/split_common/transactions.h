@@ -45,6 +45,11 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
+#ifdef SPLIT_TRANSPORT_MATRIX_EVENTS
+// Time at which the slave scanned a change to one of its keys, if that change was applied by this scan
+bool transactions_slave_matrix_event_time(uint8_t row, uint8_t col, uint16_t *time);
+#endif // SPLIT_TRANSPORT_MATRIX_EVENTS
+
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback);
 
 bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
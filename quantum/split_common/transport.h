@@ -31,6 +31,14 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifndef SPLIT_TRANSPORT_BUNDLE_SIZE
+#    define SPLIT_TRANSPORT_BUNDLE_SIZE 64
+#endif // SPLIT_TRANSPORT_BUNDLE_SIZE
+
+#ifndef SPLIT_MATRIX_EVENTS_MAX
+#    define SPLIT_MATRIX_EVENTS_MAX 4
+#endif // SPLIT_MATRIX_EVENTS_MAX
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -52,10 +60,31 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 #    include "rgblight.h"
 #endif // RGBLIGHT_ENABLE
 
+#ifdef SPLIT_TRANSPORT_MATRIX_EVENTS
+typedef struct _split_matrix_event_t {
+    uint16_t time; // sync_timer_read() on the slave when the change was scanned
+    uint8_t  row;
+    uint8_t  col : 7;
+    uint8_t  pressed : 1;
+} split_matrix_event_t;
+
+typedef struct _split_slave_matrix_events_t {
+    uint8_t              sequence; // of the first event listed
+    uint8_t              count;
+    matrix_row_t         matrix[(MATRIX_ROWS) / 2]; // state after the last event listed
+    split_matrix_event_t events[SPLIT_MATRIX_EVENTS_MAX];
+} split_slave_matrix_events_t;
+
+typedef struct _split_slave_matrix_sync_t {
+    uint8_t                     checksum;
+    split_slave_matrix_events_t events;
+} split_slave_matrix_sync_t;
+#else // SPLIT_TRANSPORT_MATRIX_EVENTS
 typedef struct _split_slave_matrix_sync_t {
     uint8_t      checksum;
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
+#endif // SPLIT_TRANSPORT_MATRIX_EVENTS
 
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
@@ -147,13 +176,32 @@ typedef struct _rpc_sync_info_t {
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BUNDLE
+// A batch of sections, each one a transaction ID followed by the data of that transaction
+typedef struct _split_bundle_frame_t {
+    uint8_t checksum; // crc8 of everything after it, up to the end of the used data
+    uint8_t sequence; // master: the last response received intact, slave: the number of this response
+    uint8_t length;
+    uint8_t data[SPLIT_TRANSPORT_BUNDLE_SIZE];
+} split_bundle_frame_t;
+#endif // SPLIT_TRANSPORT_BUNDLE
+
 typedef struct _split_shared_memory_t {
 #ifdef USE_I2C
     int8_t transaction_id;
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_BUNDLE
+    split_bundle_frame_t bundle_m2s;
+    split_bundle_frame_t bundle_s2m;
+#endif // SPLIT_TRANSPORT_BUNDLE
+
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSPORT_MATRIX_EVENTS
+    uint8_t smatrix_ack;
+#endif // SPLIT_TRANSPORT_MATRIX_EVENTS
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -312,19 +312,22 @@ __attribute__((weak)) void unicode_input_cancel(void) {
 
 // clang-format off
 
+uint8_t unicode_windows_digit_keycode(uint8_t digit) {
+    return digit < 10
+         ? KC_KP_1 + (10 + digit - 1) % 10
+         : KC_A + (digit - 10);
+}
+
+// clang-format on
+
 static void send_nibble_wrapper(uint8_t digit) {
     if (unicode_config.input_mode == UNICODE_MODE_WINDOWS) {
-        uint8_t kc = digit < 10
-                   ? KC_KP_1 + (10 + digit - 1) % 10
-                   : KC_A + (digit - 10);
-        tap_code(kc);
+        tap_code(unicode_windows_digit_keycode(digit));
         return;
     }
     send_nibble(digit);
 }
 
-// clang-format on
-
 void register_hex(uint16_t hex) {
     for (int i = 3; i >= 0; i--) {
         uint8_t digit = ((hex >> (i * 4)) & 0xF);
@@ -332,9 +335,10 @@ void register_hex(uint16_t hex) {
     }
 }
 
-void register_hex32(uint32_t hex) {
-    bool first_digit        = true;
-    bool needs_leading_zero = (unicode_config.input_mode == UNICODE_MODE_WINCOMPOSE);
+static uint8_t hex32_digits(uint32_t hex, uint8_t *digits) {
+    uint8_t count              = 0;
+    bool    first_digit        = true;
+    bool    needs_leading_zero = (unicode_config.input_mode == UNICODE_MODE_WINCOMPOSE);
     for (int i = 7; i >= 0; i--) {
         // Work out the digit we're going to transmit
         uint8_t digit = ((hex >> (i * 4)) & 0xF);
@@ -342,7 +346,7 @@ void register_hex32(uint32_t hex) {
         // If we're still searching for the first digit, and found one
         // that needs a leading zero sent out, send the zero.
         if (first_digit && needs_leading_zero && digit > 9) {
-            send_nibble_wrapper(0);
+            digits[count++] = 0;
         }
 
         // Always send digits (including zero) if we're down to the last
@@ -351,27 +355,47 @@ void register_hex32(uint32_t hex) {
 
         // If we've found a digit worth transmitting, do so.
         if (digit != 0 || !first_digit || must_send) {
-            send_nibble_wrapper(digit);
-            first_digit = false;
+            digits[count++] = digit;
+            first_digit     = false;
         }
     }
+    return count;
 }
 
-void register_unicode(uint32_t code_point) {
+void register_hex32(uint32_t hex) {
+    uint8_t digits[9]; // Up to 8 digits and a leading zero
+    uint8_t count = hex32_digits(hex, digits);
+    for (uint8_t i = 0; i < count; i++) {
+        send_nibble_wrapper(digits[i]);
+    }
+}
+
+uint8_t unicode_code_point_digits(uint32_t code_point, uint8_t *digits) {
     if (code_point > 0x10FFFF || (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_WINDOWS)) {
         // Code point out of range, do nothing
-        return;
+        return 0;
     }
 
-    unicode_input_start();
     if (code_point > 0xFFFF && unicode_config.input_mode == UNICODE_MODE_MACOS) {
         // Convert code point to UTF-16 surrogate pair on macOS
         code_point -= 0x10000;
         uint32_t lo = code_point & 0x3FF, hi = (code_point & 0xFFC00) >> 10;
-        register_hex32(hi + 0xD800);
-        register_hex32(lo + 0xDC00);
-    } else {
-        register_hex32(code_point);
+        uint8_t  count = hex32_digits(hi + 0xD800, digits);
+        return count + hex32_digits(lo + 0xDC00, digits + count);
+    }
+    return hex32_digits(code_point, digits);
+}
+
+void register_unicode(uint32_t code_point) {
+    uint8_t digits[16];
+    uint8_t count = unicode_code_point_digits(code_point, digits);
+    if (!count) {
+        return;
+    }
+
+    unicode_input_start();
+    for (uint8_t i = 0; i < count; i++) {
+        send_nibble_wrapper(digits[i]);
     }
     unicode_input_finish();
 }
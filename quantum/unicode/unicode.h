@@ -124,6 +124,25 @@ void register_hex32(uint32_t hex);
  */
 void register_unicode(uint32_t code_point);
 
+/**
+ * \brief Get the hex digits `register_unicode()` would send for a code point in the current input mode.
+ *
+ * \param code_point The code point of the character.
+ * \param digits Receives up to 16 digit values, most significant first.
+ *
+ * \return The number of digits, or 0 if the code point cannot be input in the current mode.
+ */
+uint8_t unicode_code_point_digits(uint32_t code_point, uint8_t *digits);
+
+/**
+ * \brief Get the keycode used to send a hex digit in Windows input mode, where numbers go through the keypad.
+ *
+ * \param digit The digit value, from 0 to 15.
+ *
+ * \return The keycode to tap.
+ */
+uint8_t unicode_windows_digit_keycode(uint8_t digit);
+
 /**
  * \brief Send a string containing Unicode characters.
  *
@@ -6,6 +6,11 @@
 
 #include "bitwise.h"
 
+// Headers shared with the C++ unit tests can use _Static_assert
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 // convert to string
 #define STR(s) XSTR(s)
 #define XSTR(s) #s
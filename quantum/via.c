@@ -112,6 +112,8 @@ void eeconfig_init_via(void) {
     dynamic_keymap_reset();
     // This resets the macros in EEPROM to nothing.
     dynamic_keymap_macro_reset();
+    // Make sure the reset keymaps and macros have reached EEPROM before the magic number does
+    dynamic_keymap_flush();
     // Save the magic number last, in case saving was interrupted
     via_eeprom_set_valid(true);
 }
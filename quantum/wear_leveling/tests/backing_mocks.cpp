@@ -18,11 +18,14 @@ void MockBackingStore::reset_instance() {
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
 
-    backing_init_invoke_count   = 0;
-    backing_unlock_invoke_count = 0;
-    backing_erase_invoke_count  = 0;
-    backing_write_invoke_count  = 0;
-    backing_lock_invoke_count   = 0;
+    backing_init_invoke_count        = 0;
+    backing_unlock_invoke_count      = 0;
+    backing_erase_invoke_count       = 0;
+    backing_erase_range_invoke_count = 0;
+    backing_write_invoke_count       = 0;
+    backing_lock_invoke_count        = 0;
+
+    backing_busy_time_us = 0;
 
     init_success_callback   = [](std::uint64_t) { return true; };
     erase_success_callback  = [](std::uint64_t) { return true; };
@@ -71,10 +74,37 @@ bool MockBackingStore::erase(void) {
     // Keep track of the erase in the write log so that we can verify during tests
     append_log(true);
 
+    backing_busy_time_us += backing_storage.size() * MOCK_ERASE_TIME_US_PER_ELEMENT::value;
     ++backing_erasure_count;
     return true;
 }
 
+bool MockBackingStore::erase_range(uint32_t address, std::size_t length) {
+    ++backing_erase_range_invoke_count;
+
+    EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
+    EXPECT_TRUE(length % BACKING_STORE_WRITE_SIZE == 0) << "Supplied length was not aligned with the backing store integral size";
+    EXPECT_TRUE(address + length <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
+    EXPECT_FALSE(is_locked()) << "Erase was attempted without being unlocked first";
+
+    // Erase each slot in the range
+    for (std::size_t i = address / BACKING_STORE_WRITE_SIZE; i < (address + length) / BACKING_STORE_WRITE_SIZE; ++i) {
+        // Drop out of erase early with failure if we need to
+        if (erase_success_callback && !erase_success_callback(backing_erase_invoke_count + backing_erase_range_invoke_count)) {
+            append_log(true);
+            return false;
+        }
+
+        backing_storage[i].erase();
+    }
+
+    // Keep track of the erase in the write log so that we can verify during tests
+    append_log(true);
+
+    backing_busy_time_us += (length / BACKING_STORE_WRITE_SIZE) * MOCK_ERASE_TIME_US_PER_ELEMENT::value;
+    return true;
+}
+
 bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     ++backing_write_invoke_count;
 
@@ -98,6 +128,8 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     // Keep track of the total number of writes into the backing store
     ++backing_total_write_count;
 
+    backing_busy_time_us += MOCK_WRITE_TIME_US::value;
+
     return true;
 }
 
@@ -141,6 +173,10 @@ extern "C" bool backing_store_erase(void) {
     return MockBackingStore::Instance().erase();
 }
 
+extern "C" bool backing_store_erase_range(uint32_t address, size_t length) {
+    return MockBackingStore::Instance().erase_range(address, length);
+}
+
 extern "C" bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return MockBackingStore::Instance().write(address, value);
 }
@@ -21,6 +21,10 @@ using MOCK_WRITE_LOG_MAX_ENTRIES = std::integral_constant<std::size_t, 1024>;
 using BACKING_STORE_INTEGRAL_COMPLEMENT = std::integral_constant<backing_store_int_t, ((backing_store_int_t)(~(backing_store_int_t)0))>;
 // Total number of elements stored in the backing arrays
 using BACKING_STORE_ELEMENT_COUNT = std::integral_constant<std::size_t, (WEAR_LEVELING_BACKING_SIZE / sizeof(backing_store_int_t))>;
+// Simulated time taken by a single write, in microseconds
+using MOCK_WRITE_TIME_US = std::integral_constant<std::uint64_t, 50>;
+// Simulated time taken to erase each element, in microseconds -- flash erases are much slower than writes
+using MOCK_ERASE_TIME_US_PER_ELEMENT = std::integral_constant<std::uint64_t, 200>;
 
 class MockBackingStoreElement {
    private:
@@ -89,11 +93,14 @@ class MockBackingStore {
     std::uint64_t backing_total_write_count;
     // The write log for the backing store
     std::vector<MockBackingStoreLogEntry> write_log;
+    // The simulated time spent in writes and erases
+    std::uint64_t backing_busy_time_us;
 
     // The number of times each API was invoked
     std::uint64_t backing_init_invoke_count;
     std::uint64_t backing_unlock_invoke_count;
     std::uint64_t backing_erase_invoke_count;
+    std::uint64_t backing_erase_range_invoke_count;
     std::uint64_t backing_write_invoke_count;
     std::uint64_t backing_lock_invoke_count;
 
@@ -130,6 +137,9 @@ class MockBackingStore {
     std::uint64_t total_write_count() const {
         return backing_total_write_count;
     }
+    std::uint64_t busy_time_us() const {
+        return backing_busy_time_us;
+    }
 
     // The number of times each API was invoked
     std::uint64_t init_invoke_count() const {
@@ -141,6 +151,9 @@ class MockBackingStore {
     std::uint64_t erase_invoke_count() const {
         return backing_erase_invoke_count;
     }
+    std::uint64_t erase_range_invoke_count() const {
+        return backing_erase_range_invoke_count;
+    }
     std::uint64_t write_invoke_count() const {
         return backing_write_invoke_count;
     }
@@ -159,6 +172,7 @@ class MockBackingStore {
     bool init();
     bool unlock();
     bool erase();
+    bool erase_range(std::uint32_t address, std::size_t length);
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
@@ -63,4 +63,32 @@ wear_leveling_8byte_SRC := \
 	$(wear_leveling_common_SRC) \
 	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_8byte.cpp
 wear_leveling_8byte_INC := \
-	$(wear_leveling_common_INC)
\ No newline at end of file
+	$(wear_leveling_common_INC)
+
+wear_leveling_banked_2byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=2 \
+	-DWEAR_LEVELING_BACKING_SIZE=256 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_BANK_COUNT=2 \
+	-DWEAR_LEVELING_BANK_ERASE_SIZE=32 \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=8
+wear_leveling_banked_2byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banked.cpp
+wear_leveling_banked_2byte_INC := \
+	$(wear_leveling_common_INC)
+
+wear_leveling_banked_4byte_DEFS := \
+	$(wear_leveling_common_DEFS) \
+	-DBACKING_STORE_WRITE_SIZE=4 \
+	-DWEAR_LEVELING_BACKING_SIZE=512 \
+	-DWEAR_LEVELING_LOGICAL_SIZE=32 \
+	-DWEAR_LEVELING_BANK_COUNT=4 \
+	-DWEAR_LEVELING_BANK_ERASE_SIZE=32 \
+	-DWEAR_LEVELING_CONSOLIDATION_STEP_SIZE=8
+wear_leveling_banked_4byte_SRC := \
+	$(wear_leveling_common_SRC) \
+	$(QUANTUM_PATH)/wear_leveling/tests/wear_leveling_banked.cpp
+wear_leveling_banked_4byte_INC := \
+	$(wear_leveling_common_INC)
@@ -3,4 +3,6 @@ TEST_LIST += \
 	wear_leveling_2byte_optimized_writes \
 	wear_leveling_2byte \
 	wear_leveling_4byte \
-	wear_leveling_8byte
+	wear_leveling_8byte \
+	wear_leveling_banked_2byte \
+	wear_leveling_banked_4byte
@@ -0,0 +1,254 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include <numeric>
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+#include "backing_mocks.hpp"
+
+class WearLevelingBanked : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        verify_data.fill(0);
+    }
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> verify_data;
+
+    wear_leveling_status_t test_write(const uint32_t address, const void* value, size_t length) {
+        memcpy(&verify_data[address], value, length);
+        return wear_leveling_write(address, value, length);
+    }
+
+    void verify_contents() {
+        std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> actual;
+        EXPECT_EQ(wear_leveling_read(0, actual.data(), actual.size()), WEAR_LEVELING_SUCCESS) << "Read returned incorrect status";
+        EXPECT_EQ(actual, verify_data) << "Logical data did not match";
+    }
+
+    // Single byte writes use a single log entry, and never generate consolidation on their own until the log is full
+    void fill_log_to_threshold() {
+        uint8_t value = 0x40;
+        while (wear_leveling_bytes_logged() < (WEAR_LEVELING_CONSOLIDATION_THRESHOLD)) {
+            uint32_t address = value % (WEAR_LEVELING_LOGICAL_SIZE);
+            ASSERT_EQ(test_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+            ++value;
+        }
+    }
+
+    // Number of bytes used in the write log of the live bank, derived from the mock's write log
+    std::size_t wear_leveling_bytes_logged() const {
+        auto&       inst  = MockBackingStore::Instance();
+        std::size_t count = 0;
+        for (auto it = inst.log_begin(); it != inst.log_end(); ++it) {
+            if (it->erased) {
+                count = 0;
+            } else if (it->address % (WEAR_LEVELING_BANK_SIZE) >= (WEAR_LEVELING_LOG_OFFSET)) {
+                count = it->address % (WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET) + BACKING_STORE_WRITE_SIZE;
+            }
+        }
+        return count;
+    }
+
+    // Runs background consolidation until the next bank becomes live, returning the number of steps
+    int run_consolidation() {
+        int steps = 0;
+        for (;;) {
+            ++steps;
+            wear_leveling_status_t status = wear_leveling_task();
+            EXPECT_NE(status, WEAR_LEVELING_FAILED) << "Consolidation step failed";
+            if (status != WEAR_LEVELING_SUCCESS || steps > 1000) {
+                break;
+            }
+        }
+        return steps;
+    }
+};
+
+/**
+ * This test verifies that the first write after initialisation occurs after the FNV1a_64 hash and sequence number.
+ */
+TEST_F(WearLevelingBanked, FirstWriteOccursAfterSequence) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+    test_write(0x02, &test_value, sizeof(test_value));
+    EXPECT_EQ(inst.log_begin()->address, WEAR_LEVELING_LOGICAL_SIZE + 16) << "Invalid first write address.";
+}
+
+/**
+ * This test verifies that nothing happens in the background until the write log passes the threshold.
+ */
+TEST_F(WearLevelingBanked, TaskIdleBelowThreshold) {
+    auto&   inst       = MockBackingStore::Instance();
+    uint8_t test_value = 0x15;
+    test_write(0x02, &test_value, sizeof(test_value));
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Unexpected erase";
+    EXPECT_EQ(inst.erase_range_invoke_count(), 0) << "Unexpected erase";
+    EXPECT_EQ(inst.unlock_invoke_count(), 1) << "Task unlocked the backing store while idle";
+}
+
+/**
+ * This test verifies that background consolidation moves the data into the next bank one erase unit at a time, without
+ * ever erasing the entire backing store.
+ */
+TEST_F(WearLevelingBanked, BackgroundConsolidationMovesToNextBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log_to_threshold();
+
+    int steps = run_consolidation();
+    EXPECT_EQ(steps, (WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BANK_ERASE_SIZE) + ((WEAR_LEVELING_LOGICAL_SIZE + WEAR_LEVELING_CONSOLIDATION_STEP_SIZE - 1) / WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) + 1) << "Unexpected number of consolidation steps";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Entire backing store was erased";
+    EXPECT_EQ(inst.erase_range_invoke_count(), WEAR_LEVELING_BANK_SIZE / WEAR_LEVELING_BANK_ERASE_SIZE) << "Unexpected number of erases";
+    verify_contents();
+
+    // Subsequent writes go to the write log of the next bank
+    uint8_t test_value = 0x99;
+    EXPECT_EQ(test_write(0x03, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_EQ((inst.log_end() - 1)->address, WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOG_OFFSET) << "Invalid write address after consolidation.";
+
+    // The data survives a reset
+    wear_leveling_init();
+    verify_contents();
+}
+
+/**
+ * This test verifies that writes made while the cache is being copied into the next bank are not lost.
+ */
+TEST_F(WearLevelingBanked, WritesDuringConsolidationSurvive) {
+    fill_log_to_threshold();
+
+    uint8_t value = 0xA0;
+    for (;;) {
+        uint32_t address = (value * 7) % (WEAR_LEVELING_LOGICAL_SIZE);
+        ASSERT_EQ(test_write(address, &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        ++value;
+        wear_leveling_status_t status = wear_leveling_task();
+        ASSERT_NE(status, WEAR_LEVELING_FAILED) << "Consolidation step failed";
+        if (status == WEAR_LEVELING_CONSOLIDATED) {
+            break;
+        }
+    }
+    verify_contents();
+
+    wear_leveling_init();
+    verify_contents();
+}
+
+/**
+ * This test verifies that a reset at any point during background consolidation does not lose any data.
+ */
+TEST_F(WearLevelingBanked, PowerLossDuringConsolidation) {
+    fill_log_to_threshold();
+    int total_steps = run_consolidation();
+
+    for (int steps = 1; steps < total_steps; ++steps) {
+        MockBackingStore::Instance().reset_instance();
+        wear_leveling_init();
+        verify_data.fill(0);
+        fill_log_to_threshold();
+
+        for (int i = 0; i < steps; ++i) {
+            ASSERT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task returned incorrect status";
+            uint8_t value = 0xC0 + i;
+            ASSERT_EQ(test_write(i % (WEAR_LEVELING_LOGICAL_SIZE), &value, sizeof(value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        }
+
+        wear_leveling_init();
+        verify_contents();
+    }
+}
+
+/**
+ * This test verifies that a failure to write the checksum of the next bank keeps the previous bank live.
+ */
+TEST_F(WearLevelingBanked, FailedCommitKeepsLiveBank) {
+    auto& inst = MockBackingStore::Instance();
+    fill_log_to_threshold();
+
+    inst.set_write_callback([](std::uint64_t, std::uint32_t address) { return address != WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOGICAL_SIZE; });
+    wear_leveling_status_t status;
+    do {
+        status = wear_leveling_task();
+    } while (status == WEAR_LEVELING_SUCCESS);
+    EXPECT_EQ(status, WEAR_LEVELING_FAILED) << "Commit should have failed";
+
+    wear_leveling_init();
+    verify_contents();
+    uint8_t test_value = 0x99;
+    EXPECT_EQ(test_write(0x03, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+    EXPECT_LT((inst.log_end() - 1)->address, WEAR_LEVELING_BANK_SIZE) << "Previous bank should still be live.";
+}
+
+/**
+ * This test verifies that the write log filling up before the background consolidation was given a chance to run
+ * consolidates into the next bank in-line, and that this rotates through all the banks.
+ */
+TEST_F(WearLevelingBanked, LogOverflowConsolidatesInline) {
+    auto& inst = MockBackingStore::Instance();
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    for (int bank = 1; bank <= WEAR_LEVELING_BANK_COUNT; ++bank) {
+        wear_leveling_status_t status;
+        int                    writes = 0;
+        do {
+            std::iota(testvalue.begin(), testvalue.end(), 0x20 + writes++);
+            status = test_write(0, testvalue.data(), testvalue.size());
+        } while (status == WEAR_LEVELING_SUCCESS);
+        EXPECT_EQ(status, WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+
+        uint8_t test_value = 0x99;
+        EXPECT_EQ(test_write(WEAR_LEVELING_LOGICAL_SIZE - 1, &test_value, sizeof(test_value)), WEAR_LEVELING_SUCCESS) << "Write returned incorrect status";
+        EXPECT_GE((inst.log_end() - 1)->address, (bank % WEAR_LEVELING_BANK_COUNT) * WEAR_LEVELING_BANK_SIZE + WEAR_LEVELING_LOG_OFFSET) << "Write went to the wrong bank";
+        EXPECT_LT((inst.log_end() - 1)->address, (bank % WEAR_LEVELING_BANK_COUNT + 1) * WEAR_LEVELING_BANK_SIZE) << "Write went to the wrong bank";
+
+        wear_leveling_init();
+        verify_contents();
+    }
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Entire backing store was erased";
+}
+
+/**
+ * This test runs a stream of writes with the background task invoked in between, and verifies that no single call
+ * blocks for longer than a single erase unit -- as opposed to erasing the whole backing store in one go.
+ */
+TEST_F(WearLevelingBanked, MaxBlockingTime) {
+    auto&         inst         = MockBackingStore::Instance();
+    std::uint64_t max_blocking = 0;
+    auto          measure      = [&](std::function<wear_leveling_status_t()> fn) {
+        std::uint64_t start = inst.busy_time_us();
+        EXPECT_NE(fn(), WEAR_LEVELING_FAILED) << "Call failed";
+        max_blocking = std::max(max_blocking, inst.busy_time_us() - start);
+    };
+
+    int consolidations = 0;
+    for (int i = 0; i < 1000; ++i) {
+        uint8_t  value   = (uint8_t)(i * 13);
+        uint32_t address = (i * 5) % (WEAR_LEVELING_LOGICAL_SIZE);
+        measure([&]() {
+            auto status = test_write(address, &value, sizeof(value));
+            EXPECT_NE(status, WEAR_LEVELING_CONSOLIDATED) << "Write should not have consolidated in-line";
+            return status;
+        });
+        for (int scan = 0; scan < 2; ++scan) {
+            measure([&]() {
+                auto status = wear_leveling_task();
+                consolidations += status == WEAR_LEVELING_CONSOLIDATED;
+                return status;
+            });
+        }
+    }
+
+    const std::uint64_t erase_unit_time = (WEAR_LEVELING_BANK_ERASE_SIZE / BACKING_STORE_WRITE_SIZE) * MOCK_ERASE_TIME_US_PER_ELEMENT::value;
+    const std::uint64_t full_erase_time = (WEAR_LEVELING_BACKING_SIZE / BACKING_STORE_WRITE_SIZE) * MOCK_ERASE_TIME_US_PER_ELEMENT::value;
+    EXPECT_GT(consolidations, WEAR_LEVELING_BANK_COUNT) << "Background consolidation did not run";
+    EXPECT_EQ(inst.erase_invoke_count(), 0) << "Entire backing store was erased";
+    EXPECT_LE(max_blocking, erase_unit_time) << "Blocked for longer than a single erase unit";
+    EXPECT_LT(max_blocking, full_erase_time / 4) << "Blocked for a significant fraction of a full erase";
+    verify_contents();
+
+    wear_leveling_init();
+    verify_contents();
+}
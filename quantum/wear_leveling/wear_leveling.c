@@ -61,6 +61,21 @@
             to other subsystems performing reads/writes. This must be a multiple
             of the write size.
 
+        - WEAR_LEVELING_BANK_COUNT: Optional. Splits the backing store into
+            this many equally-sized banks, see "Banked mode" below. Each bank
+            must be at least twice the size of the logical size.
+
+        - WEAR_LEVELING_BANK_ERASE_SIZE: The number of bytes erased per step
+            of background consolidation. Must match the erase granularity of
+            the backing store. Defaults to the bank size.
+
+        - WEAR_LEVELING_CONSOLIDATION_STEP_SIZE: The number of bytes of the
+            cache copied per step of background consolidation.
+
+        - WEAR_LEVELING_CONSOLIDATION_THRESHOLD: The number of bytes of the
+            write log in use before background consolidation starts. Defaults
+            to half of the write log.
+
     General algorithm:
 
         During initialization:
@@ -153,7 +168,38 @@
         ║  │Address >> 1 ║
         ║  └── Value: 1  ║
         ╚════════════════╝
-        0 <= Address <= 0x3FFE (16382) */
+        0 <= Address <= 0x3FFE (16382)
+
+    Banked mode:
+
+        Consolidating the whole backing store in one go erases all of it, which
+        can stall the caller for tens of milliseconds. When
+        WEAR_LEVELING_BANK_COUNT is set, the backing store is split into banks
+        which each have their own consolidated data and write log:
+
+        ╔ Bank ═══════════════╦══════════╦══════════╦═══════════╗
+        ║ Consolidated data   ║ FNV1a_64 ║ Sequence ║ Write log ║
+        ║ (logical size)      ║ 8 bytes  ║ 8 bytes  ║           ║
+        ╚═════════════════════╩══════════╩══════════╩═══════════╝
+
+        The FNV1a_64 covers both the consolidated data and the sequence number.
+        During initialization the valid bank with the highest sequence number
+        becomes the live bank, and its write log is played back.
+
+        Once the write log of the live bank passes the consolidation threshold,
+        wear_leveling_task() moves the cache into the next bank incrementally:
+            * The next bank is erased, one erase unit per call.
+            * The cache is copied into the next bank, one step per call. From
+                here on, writes are appended to the write logs of both banks, as
+                the cache may change after a section has already been copied.
+            * The sequence number is written, then the FNV1a_64 last, which
+                makes the next bank the live bank.
+
+        Until the FNV1a_64 has been written the previous bank stays valid and
+        has every write in its log, so a power loss during consolidation does
+        not lose any data. If the write log of the live bank fills up before
+        background consolidation finishes, consolidation into the next bank is
+        performed in-line instead. */
 
 /**
  * Storage area for the wear-leveling cache.
@@ -162,8 +208,39 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+#ifdef WEAR_LEVELING_BANK_COUNT
+    uint8_t  live_bank;
+    uint8_t  target_bank;
+    uint8_t  consolidation_state;
+    uint32_t consolidation_offset;
+    uint32_t target_write_address;
+    uint64_t target_hash;
+    uint64_t sequence;
+#endif // WEAR_LEVELING_BANK_COUNT
 } wear_leveling;
 
+#ifdef WEAR_LEVELING_BANK_COUNT
+/**
+ * Background consolidation state
+ */
+enum { CONSOLIDATION_IDLE = 0, CONSOLIDATION_ERASING, CONSOLIDATION_COPYING, CONSOLIDATION_COMMITTING };
+
+static inline uint32_t wear_leveling_bank_base(uint8_t bank) {
+    return (uint32_t)bank * (WEAR_LEVELING_BANK_SIZE);
+}
+#endif // WEAR_LEVELING_BANK_COUNT
+
+/**
+ * Start of the live section of the backing store, containing the consolidated data and the write log.
+ */
+static inline uint32_t wear_leveling_live_base(void) {
+#ifdef WEAR_LEVELING_BANK_COUNT
+    return wear_leveling_bank_base(wear_leveling.live_bank);
+#else
+    return 0;
+#endif // WEAR_LEVELING_BANK_COUNT
+}
+
 /**
  * Locking helper: status
  */
@@ -202,7 +279,38 @@ static inline backing_store_lock_status_t wear_leveling_lock(void) {
  */
 static void wear_leveling_clear_cache(void) {
     memset(wear_leveling.cache, 0, (WEAR_LEVELING_LOGICAL_SIZE));
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 is due to the FNV1a_64 of the consolidated buffer
+    wear_leveling.write_address = wear_leveling_live_base() + (WEAR_LEVELING_LOG_OFFSET);
+}
+
+/**
+ * Reads a 64-bit value, such as the FNV1a_64 of the consolidated data, from the backing store.
+ */
+static bool wear_leveling_read_u64(uint32_t address, uint64_t *value) {
+    write_log_entry_t entry = {.raw64 = 0};
+    bool              ok;
+#if BACKING_STORE_WRITE_SIZE == 2
+    ok = backing_store_read_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    ok = backing_store_read_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    ok = backing_store_read(address, &entry.raw64);
+#endif
+    *value = entry.raw64;
+    return ok;
+}
+
+/**
+ * Writes a 64-bit value, such as the FNV1a_64 of the consolidated data, to the backing store.
+ */
+static bool wear_leveling_write_u64(uint32_t address, uint64_t value) {
+    write_log_entry_t entry = {.raw64 = value};
+#if BACKING_STORE_WRITE_SIZE == 2
+    return backing_store_write_bulk(address, entry.raw16, 4);
+#elif BACKING_STORE_WRITE_SIZE == 4
+    return backing_store_write_bulk(address, entry.raw32, 2);
+#elif BACKING_STORE_WRITE_SIZE == 8
+    return backing_store_write(address, entry.raw64);
+#endif
 }
 
 /**
@@ -212,31 +320,34 @@ static void wear_leveling_clear_cache(void) {
 static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     wl_dprintf("Reading consolidated data\n");
 
+    const uint32_t         base   = wear_leveling_live_base();
     wear_leveling_status_t status = WEAR_LEVELING_SUCCESS;
-    if (!backing_store_read_bulk(0, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
+    if (!backing_store_read_bulk(base, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t))) {
         wl_dprintf("Failed to read from backing store\n");
         status = WEAR_LEVELING_FAILED;
     }
 
     // Verify the FNV1a_64 result
     if (status != WEAR_LEVELING_FAILED) {
-        uint64_t          expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
-        write_log_entry_t entry;
+        uint64_t expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        uint64_t checksum;
         wl_dprintf("Reading checksum\n");
-#if BACKING_STORE_WRITE_SIZE == 2
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4);
-#elif BACKING_STORE_WRITE_SIZE == 4
-        backing_store_read_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2);
-#elif BACKING_STORE_WRITE_SIZE == 8
-        backing_store_read((WEAR_LEVELING_LOGICAL_SIZE) + 0, &entry.raw64);
-#endif
+        wear_leveling_read_u64(base + (WEAR_LEVELING_LOGICAL_SIZE), &checksum);
+#ifdef WEAR_LEVELING_BANK_COUNT
+        // The sequence number is covered by the checksum, so that a partially-written bank is never considered valid
+        wear_leveling_read_u64(base + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &wear_leveling.sequence);
+        expected = fnv_64a_buf(&wear_leveling.sequence, sizeof(wear_leveling.sequence), expected);
+#endif // WEAR_LEVELING_BANK_COUNT
         // If we have a mismatch, clear the cache but do not flag a failure,
         // which will cater for the completely clean MCU case.
-        if (entry.raw64 == expected) {
+        if (checksum == expected) {
             wl_dprintf("Checksum matches, consolidated data is correct\n");
         } else {
             wl_dprintf("Checksum mismatch, clearing cache\n");
             wear_leveling_clear_cache();
+#ifdef WEAR_LEVELING_BANK_COUNT
+            wear_leveling.sequence = 0;
+#endif // WEAR_LEVELING_BANK_COUNT
         }
     }
 
@@ -248,6 +359,140 @@ static wear_leveling_status_t wear_leveling_read_consolidated(void) {
     return status;
 }
 
+#ifdef WEAR_LEVELING_BANK_COUNT
+
+/**
+ * Finds the valid bank with the highest sequence number and makes it the live bank.
+ * Falls back to the first bank if none are valid, which will cater for the completely clean MCU case.
+ * Uses the cache as scratch space.
+ */
+static void wear_leveling_select_live_bank(void) {
+    bool     found         = false;
+    uint64_t best_sequence = 0;
+
+    wear_leveling.live_bank = 0;
+    for (uint8_t bank = 0; bank < (WEAR_LEVELING_BANK_COUNT); ++bank) {
+        const uint32_t base = wear_leveling_bank_base(bank);
+        uint64_t       checksum;
+        uint64_t       sequence;
+        if (!backing_store_read_bulk(base, (backing_store_int_t *)wear_leveling.cache, sizeof(wear_leveling.cache) / sizeof(backing_store_int_t)) || !wear_leveling_read_u64(base + (WEAR_LEVELING_LOGICAL_SIZE), &checksum) || !wear_leveling_read_u64(base + (WEAR_LEVELING_LOGICAL_SIZE) + 8, &sequence)) {
+            wl_dprintf("Failed to read bank %d, skipping\n", (int)bank);
+            continue;
+        }
+
+        uint64_t expected = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
+        expected          = fnv_64a_buf(&sequence, sizeof(sequence), expected);
+        if (checksum == expected && (!found || sequence > best_sequence)) {
+            found                   = true;
+            best_sequence           = sequence;
+            wear_leveling.live_bank = bank;
+        }
+    }
+
+    wl_dprintf("Live bank is %d\n", (int)wear_leveling.live_bank);
+}
+
+/**
+ * Starts consolidation of the cache into the bank following the live bank, restarting it if it was already in progress.
+ */
+static void wear_leveling_consolidation_begin(void) {
+    wear_leveling.target_bank          = (wear_leveling.live_bank + 1) % (WEAR_LEVELING_BANK_COUNT);
+    wear_leveling.consolidation_offset = 0;
+    wear_leveling.consolidation_state  = CONSOLIDATION_ERASING;
+}
+
+/**
+ * Performs a single bounded step of consolidation into the target bank.
+ * Pre-condition: the backing store is unlocked.
+ *
+ * @return WEAR_LEVELING_CONSOLIDATED once the target bank has become the live bank
+ */
+static wear_leveling_status_t wear_leveling_consolidation_step(void) {
+    const uint32_t base = wear_leveling_bank_base(wear_leveling.target_bank);
+    switch (wear_leveling.consolidation_state) {
+        case CONSOLIDATION_ERASING: {
+            wl_dprintf("Erasing bank %d, offset %d\n", (int)wear_leveling.target_bank, (int)wear_leveling.consolidation_offset);
+            if (!backing_store_erase_range(base + wear_leveling.consolidation_offset, (WEAR_LEVELING_BANK_ERASE_SIZE))) {
+                break;
+            }
+
+            wear_leveling.consolidation_offset += (WEAR_LEVELING_BANK_ERASE_SIZE);
+            if (wear_leveling.consolidation_offset >= (WEAR_LEVELING_BANK_SIZE)) {
+                // Writes from here on are also appended to the target bank's write log, see wear_leveling_append_raw()
+                wear_leveling.consolidation_state  = CONSOLIDATION_COPYING;
+                wear_leveling.consolidation_offset = 0;
+                wear_leveling.target_write_address = base + (WEAR_LEVELING_LOG_OFFSET);
+                wear_leveling.target_hash          = FNV1A_64_INIT;
+            }
+            return WEAR_LEVELING_SUCCESS;
+        }
+
+        case CONSOLIDATION_COPYING: {
+            const uint32_t offset    = wear_leveling.consolidation_offset;
+            const uint32_t remaining = (WEAR_LEVELING_LOGICAL_SIZE) - offset;
+            const uint32_t length    = remaining < (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE) ? remaining : (WEAR_LEVELING_CONSOLIDATION_STEP_SIZE);
+            wl_dprintf("Copying to bank %d, offset %d\n", (int)wear_leveling.target_bank, (int)offset);
+            if (!backing_store_write_bulk(base + offset, (backing_store_int_t *)&wear_leveling.cache[offset], length / sizeof(backing_store_int_t))) {
+                break;
+            }
+
+            // The checksum covers what was actually written, later changes to this section are in the target bank's write log
+            wear_leveling.target_hash = fnv_64a_buf(&wear_leveling.cache[offset], length, wear_leveling.target_hash);
+            wear_leveling.consolidation_offset += length;
+            if (wear_leveling.consolidation_offset >= (WEAR_LEVELING_LOGICAL_SIZE)) {
+                wear_leveling.consolidation_state = CONSOLIDATION_COMMITTING;
+            }
+            return WEAR_LEVELING_SUCCESS;
+        }
+
+        case CONSOLIDATION_COMMITTING: {
+            // The checksum is written last, the target bank only becomes valid once everything else is in the backing store
+            uint64_t sequence = wear_leveling.sequence + 1;
+            wl_dprintf("Committing bank %d, sequence %d\n", (int)wear_leveling.target_bank, (int)sequence);
+            if (!wear_leveling_write_u64(base + (WEAR_LEVELING_LOGICAL_SIZE) + 8, sequence) || !wear_leveling_write_u64(base + (WEAR_LEVELING_LOGICAL_SIZE), fnv_64a_buf(&sequence, sizeof(sequence), wear_leveling.target_hash))) {
+                break;
+            }
+
+            wear_leveling.live_bank           = wear_leveling.target_bank;
+            wear_leveling.sequence            = sequence;
+            wear_leveling.write_address       = wear_leveling.target_write_address;
+            wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+            return WEAR_LEVELING_CONSOLIDATED;
+        }
+
+        default:
+            return WEAR_LEVELING_SUCCESS;
+    }
+
+    // The target bank never got its checksum, so the live bank is still intact -- start over next time
+    wl_dprintf("Failed to consolidate into bank %d\n", (int)wear_leveling.target_bank);
+    wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+    return WEAR_LEVELING_FAILED;
+}
+
+/**
+ * Forces a write of the current cache into the next bank, restarting any background consolidation in progress.
+ * The live bank is left untouched, so there is no potential for data loss if a power loss occurs.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wl_dprintf("Consolidating into next bank\n");
+
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    wear_leveling_status_t      status;
+
+    wear_leveling_consolidation_begin();
+    do {
+        status = wear_leveling_consolidation_step();
+    } while (status == WEAR_LEVELING_SUCCESS);
+
+    if (lock_status == STATUS_SUCCESS) {
+        wear_leveling_lock();
+    }
+    return status;
+}
+
+#else // WEAR_LEVELING_BANK_COUNT
+
 /**
  * Writes the current cache to consolidated data at the beginning of the backing store.
  * Does not clear the write log.
@@ -265,27 +510,10 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 
     if (status != WEAR_LEVELING_FAILED) {
         // Write out the FNV1a_64 result of the consolidated data
-        write_log_entry_t entry;
-        entry.raw64 = fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT);
         wl_dprintf("Writing checksum\n");
-        do {
-#if BACKING_STORE_WRITE_SIZE == 2
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw16, 4)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 4
-            if (!backing_store_write_bulk((WEAR_LEVELING_LOGICAL_SIZE), entry.raw32, 2)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#elif BACKING_STORE_WRITE_SIZE == 8
-            if (!backing_store_write((WEAR_LEVELING_LOGICAL_SIZE), entry.raw64)) {
-                status = WEAR_LEVELING_FAILED;
-                break;
-            }
-#endif
-        } while (0);
+        if (!wear_leveling_write_u64((WEAR_LEVELING_LOGICAL_SIZE), fnv_64a_buf(wear_leveling.cache, (WEAR_LEVELING_LOGICAL_SIZE), FNV1A_64_INIT))) {
+            status = WEAR_LEVELING_FAILED;
+        }
     }
 
     if (lock_status == STATUS_SUCCESS) {
@@ -316,11 +544,13 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
     }
 
     // Next write of the log occurs after the consolidated values at the start of the backing store.
-    wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.write_address = (WEAR_LEVELING_LOG_OFFSET);
 
     return status;
 }
 
+#endif // WEAR_LEVELING_BANK_COUNT
+
 /**
  * Potential write of the current cache to the backing store.
  * Skipped if the current write log position is not at the end of the backing store.
@@ -329,7 +559,7 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
  * @return true if consolidation occurred
  */
 static wear_leveling_status_t wear_leveling_consolidate_if_needed(void) {
-    if (wear_leveling.write_address >= (WEAR_LEVELING_BACKING_SIZE)) {
+    if (wear_leveling.write_address >= wear_leveling_live_base() + (WEAR_LEVELING_BANK_SIZE)) {
         return wear_leveling_consolidate_force();
     }
 
@@ -348,6 +578,21 @@ static wear_leveling_status_t wear_leveling_append_raw(backing_store_int_t value
         return WEAR_LEVELING_FAILED;
     }
     wear_leveling.write_address += (BACKING_STORE_WRITE_SIZE);
+
+#ifdef WEAR_LEVELING_BANK_COUNT
+    // Once copying has started, the target bank needs every write as well, as the cache may change after a section has been copied
+    if (wear_leveling.consolidation_state == CONSOLIDATION_COPYING || wear_leveling.consolidation_state == CONSOLIDATION_COMMITTING) {
+        const uint32_t target_end = wear_leveling_bank_base(wear_leveling.target_bank) + (WEAR_LEVELING_BANK_SIZE);
+        if (wear_leveling.target_write_address >= target_end || !backing_store_write(wear_leveling.target_write_address, value)) {
+            // The live bank still has everything, so just start over with a fresh copy of the cache
+            wl_dprintf("Failed to append to bank %d, restarting consolidation\n", (int)wear_leveling.target_bank);
+            wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+        } else {
+            wear_leveling.target_write_address += (BACKING_STORE_WRITE_SIZE);
+        }
+    }
+#endif // WEAR_LEVELING_BANK_COUNT
+
     return wear_leveling_consolidate_if_needed();
 }
 
@@ -477,8 +722,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 
     wear_leveling_status_t status          = WEAR_LEVELING_SUCCESS;
     bool                   cancel_playback = false;
-    uint32_t               address         = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
-    while (!cancel_playback && address < (WEAR_LEVELING_BACKING_SIZE)) {
+    uint32_t               address         = wear_leveling_live_base() + (WEAR_LEVELING_LOG_OFFSET);
+    uint32_t               end_address     = wear_leveling_live_base() + (WEAR_LEVELING_BANK_SIZE);
+    while (!cancel_playback && address < end_address) {
         backing_store_int_t value;
         bool                ok = backing_store_read(address, &value);
         if (!ok) {
@@ -627,6 +873,13 @@ wear_leveling_status_t wear_leveling_init(void) {
         return WEAR_LEVELING_FAILED;
     }
 
+#ifdef WEAR_LEVELING_BANK_COUNT
+    // Any consolidation in progress before a reset is discarded, the next bank gets erased again anyway
+    wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+    wear_leveling_select_live_bank();
+    wear_leveling_clear_cache();
+#endif // WEAR_LEVELING_BANK_COUNT
+
     // Read the previous consolidated values, then replay the existing write log so that the cache has the "live" values
     wear_leveling_status_t status = wear_leveling_read_consolidated();
     if (status == WEAR_LEVELING_FAILED) {
@@ -661,6 +914,11 @@ wear_leveling_status_t wear_leveling_erase(void) {
 
     // Perform the erase
     bool ret = backing_store_erase();
+#ifdef WEAR_LEVELING_BANK_COUNT
+    wear_leveling.live_bank           = 0;
+    wear_leveling.sequence            = 0;
+    wear_leveling.consolidation_state = CONSOLIDATION_IDLE;
+#endif // WEAR_LEVELING_BANK_COUNT
     wear_leveling_clear_cache();
 
     // Lock the backing store if we acquired the lock successfully
@@ -726,6 +984,39 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     return status;
 }
 
+#ifdef WEAR_LEVELING_BANK_COUNT
+/**
+ * Background consolidation into the next bank, one step per invocation.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (wear_leveling.consolidation_state == CONSOLIDATION_IDLE) {
+        // Only start consolidating once enough of the write log has been used up
+        if (wear_leveling.write_address - (wear_leveling_live_base() + (WEAR_LEVELING_LOG_OFFSET)) < (WEAR_LEVELING_CONSOLIDATION_THRESHOLD)) {
+            return WEAR_LEVELING_SUCCESS;
+        }
+        wl_dprintf("Starting background consolidation\n");
+        wear_leveling_consolidation_begin();
+    }
+
+    // Unlock the backing store
+    backing_store_lock_status_t lock_status = wear_leveling_unlock();
+    if (lock_status == STATUS_FAILURE) {
+        wear_leveling_lock();
+        return WEAR_LEVELING_FAILED;
+    }
+
+    wear_leveling_status_t status = wear_leveling_consolidation_step();
+
+    if (lock_status == STATUS_SUCCESS) {
+        if (wear_leveling_lock() == STATUS_FAILURE) {
+            status = WEAR_LEVELING_FAILED;
+        }
+    }
+
+    return status;
+}
+#endif // WEAR_LEVELING_BANK_COUNT
+
 /**
  * Reads logical data from the cache.
  */
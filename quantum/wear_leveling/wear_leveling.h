@@ -52,3 +52,16 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+#ifdef WEAR_LEVELING_BANK_COUNT
+/**
+ * Performs one step of background consolidation into the next bank.
+ *
+ * Consolidation is started once the write log of the live bank passes WEAR_LEVELING_CONSOLIDATION_THRESHOLD, and each
+ * call then erases at most WEAR_LEVELING_BANK_ERASE_SIZE bytes or copies at most WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+ * bytes of the cache. Should be invoked periodically, such as from the main loop.
+ *
+ * @return Status of the request, WEAR_LEVELING_CONSOLIDATED when the new bank was committed
+ */
+wear_leveling_status_t wear_leveling_task(void);
+#endif // WEAR_LEVELING_BANK_COUNT
@@ -2,12 +2,9 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 #pragma once
 
-#ifdef __cplusplus
-#    define _Static_assert static_assert
-#endif
-
 #include <stdint.h>
 #include <string.h>
+#include "util.h"
 
 #if BACKING_STORE_WRITE_SIZE == 2
 typedef uint16_t backing_store_int_t;
@@ -66,10 +63,35 @@ _Static_assert(WEAR_LEVELING_BACKING_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "
 _Static_assert(WEAR_LEVELING_LOGICAL_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Logical size must be a multiple of write size");
 _Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_LOGICAL_SIZE == 0, "Backing size must be a multiple of logical size");
 
+#ifdef WEAR_LEVELING_BANK_COUNT
+// Banked mode: the backing store is split into equally-sized banks, each holding [consolidated data][FNV1a_64][sequence][write log]
+#    define WEAR_LEVELING_BANK_SIZE ((WEAR_LEVELING_BACKING_SIZE) / (WEAR_LEVELING_BANK_COUNT))
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 16) // +16 is due to the FNV1a_64 and sequence number of the consolidated buffer
+#    ifndef WEAR_LEVELING_BANK_ERASE_SIZE
+#        define WEAR_LEVELING_BANK_ERASE_SIZE WEAR_LEVELING_BANK_SIZE
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATION_STEP_SIZE
+#        define WEAR_LEVELING_CONSOLIDATION_STEP_SIZE 64
+#    endif
+#    ifndef WEAR_LEVELING_CONSOLIDATION_THRESHOLD
+#        define WEAR_LEVELING_CONSOLIDATION_THRESHOLD (((WEAR_LEVELING_BANK_SIZE) - (WEAR_LEVELING_LOG_OFFSET)) / 2)
+#    endif
+_Static_assert(WEAR_LEVELING_BANK_COUNT >= 2, "Banked wear-leveling requires at least two banks");
+_Static_assert(WEAR_LEVELING_BACKING_SIZE % WEAR_LEVELING_BANK_COUNT == 0, "Backing size must be a multiple of the bank count");
+_Static_assert(WEAR_LEVELING_BANK_SIZE >= (WEAR_LEVELING_LOGICAL_SIZE * 2), "Bank size must be at least twice the size of the logical size");
+_Static_assert(WEAR_LEVELING_BANK_SIZE % WEAR_LEVELING_BANK_ERASE_SIZE == 0, "Bank size must be a multiple of the bank erase size");
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_STEP_SIZE % BACKING_STORE_WRITE_SIZE == 0, "Consolidation step size must be a multiple of write size");
+_Static_assert(WEAR_LEVELING_CONSOLIDATION_THRESHOLD < WEAR_LEVELING_BANK_SIZE - WEAR_LEVELING_LOG_OFFSET, "Consolidation threshold must be smaller than the write log of a bank");
+#else
+#    define WEAR_LEVELING_BANK_SIZE WEAR_LEVELING_BACKING_SIZE
+#    define WEAR_LEVELING_LOG_OFFSET ((WEAR_LEVELING_LOGICAL_SIZE) + 8) // +8 is due to the FNV1a_64 of the consolidated buffer
+#endif // WEAR_LEVELING_BANK_COUNT
+
 // Backing Store API, to be implemented elsewhere by flash driver etc.
 bool backing_store_init(void);
 bool backing_store_unlock(void);
 bool backing_store_erase(void);
+bool backing_store_erase_range(uint32_t address, size_t length); // only required when WEAR_LEVELING_BANK_COUNT is set, address and length must be aligned to the erase unit
 bool backing_store_write(uint32_t address, backing_store_int_t value);
 bool backing_store_write_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 bool backing_store_lock(void);
@@ -0,0 +1,39 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+uint16_t const jk_combo[]  = {KC_J, KC_K, COMBO_END};
+uint16_t const df_combo[]  = {KC_D, KC_F, COMBO_END};
+uint16_t const sdf_combo[] = {KC_S, KC_D, KC_F, COMBO_END};
+uint16_t const jkl_combo[] = {KC_J, KC_K, KC_L, COMBO_END};
+uint16_t const we_combo[]  = {KC_W, KC_E, COMBO_END};
+uint16_t const io_combo[]  = {KC_I, KC_O, COMBO_END};
+uint16_t const xc_combo[]  = {KC_X, KC_C, COMBO_END};
+uint16_t const mc_combo[]  = {KC_M, KC_COMM, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    COMBO(jk_combo, KC_ESC),
+    COMBO(df_combo, KC_TAB),
+    COMBO(sdf_combo, KC_ENT),
+    COMBO(jkl_combo, KC_BSPC),
+    COMBO(we_combo, KC_LPRN),
+    COMBO(io_combo, KC_RPRN),
+    COMBO(xc_combo, C(KC_C)),
+    COMBO(mc_combo, KC_MINS),
+};
+// clang-format on
+
+tap_dance_action_t tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_SCLN, KC_QUOT),
+};
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BSPC, KC_DEL);
+
+// clang-format off
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    NULL
+};
+// clang-format on
@@ -0,0 +1,16 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+AUTO_SHIFT_ENABLE = yes
+AUTOCORRECT_ENABLE = yes
+COMBO_ENABLE = yes
+KEY_OVERRIDE_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = benchmark_features.c
+
+include tests/benchmark/benchmark.mk
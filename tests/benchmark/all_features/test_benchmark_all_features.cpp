@@ -0,0 +1,59 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark_fixture.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AtLeast;
+using testing::NiceMock;
+
+class BenchmarkAllFeatures : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        for (const auto& key : benchmark_keymap({KeymapKey(0, 0, 1, LCTL_T(KC_A)), KeymapKey(0, 9, 1, TD(0))})) {
+            add_key(key);
+        }
+    }
+};
+
+TEST_F(BenchmarkAllFeatures, prose) {
+    NiceMock<TestDriver> driver;
+    auto                 trace = prose_trace();
+
+    EXPECT_ANY_REPORT(driver).Times(AtLeast(1));
+    auto result = replay(trace);
+    report(result);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(result.events, trace.events.size() * BENCHMARK_ITERATIONS);
+}
+
+TEST_F(BenchmarkAllFeatures, chords) {
+    NiceMock<TestDriver> driver;
+    auto                 trace = chord_trace();
+
+    EXPECT_ANY_REPORT(driver).Times(AtLeast(1));
+    auto result = replay(trace);
+    report(result);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(result.events, trace.events.size() * BENCHMARK_ITERATIONS);
+}
+
+TEST_F(BenchmarkAllFeatures, recorded) {
+    auto traces = recorded_traces();
+    if (traces.empty()) {
+        GTEST_SKIP() << "set BENCHMARK_KEY_TRACES to the paths of recorded key traces";
+    }
+
+    for (const auto& trace : traces) {
+        NiceMock<TestDriver> driver;
+
+        auto result = replay(trace);
+        report(result);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_EQ(result.events, trace.events.size() * BENCHMARK_ITERATIONS);
+    }
+}
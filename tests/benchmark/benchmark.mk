@@ -0,0 +1,40 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Shared build rules for the scan-loop benchmarks, include this at the end of
+# the test.mk of every benchmark feature set.
+
+VPATH += $(TOP_DIR)/tests/benchmark $(TOP_DIR)/tests/key_trace
+
+SRC += \
+	tests/benchmark/benchmark_fixture.cpp \
+	tests/benchmark/benchmark_probes.c \
+	tests/benchmark/benchmark_traces.cpp \
+	tests/key_trace/key_trace_file.cpp
+
+# Functions timed by benchmark_probes.c, they are intercepted at link time so
+# the code under test stays untouched. Only calls crossing a translation unit
+# boundary can be intercepted this way.
+BENCHMARK_PROBES := action_exec pre_process_record_quantum action_tapping_process process_record
+
+ifeq ($(strip $(COMBO_ENABLE)), yes)
+    BENCHMARK_PROBES += process_combo combo_task
+endif
+
+ifeq ($(strip $(TAP_DANCE_ENABLE)), yes)
+    BENCHMARK_PROBES += preprocess_tap_dance process_tap_dance tap_dance_task
+endif
+
+ifeq ($(strip $(KEY_OVERRIDE_ENABLE)), yes)
+    BENCHMARK_PROBES += process_key_override key_override_task
+endif
+
+ifeq ($(strip $(AUTOCORRECT_ENABLE)), yes)
+    BENCHMARK_PROBES += process_autocorrect
+endif
+
+ifeq ($(strip $(AUTO_SHIFT_ENABLE)), yes)
+    BENCHMARK_PROBES += process_auto_shift autoshift_matrix_scan
+endif
+
+LDFLAGS += $(foreach probe,$(BENCHMARK_PROBES),-Wl,--wrap=$(probe))
@@ -0,0 +1,80 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark_fixture.hpp"
+#include <iomanip>
+#include <iostream>
+#include "test_logger.hpp"
+
+extern "C" {
+#include "benchmark_probes.h"
+#include "keyboard.h"
+#include "test_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+double BenchmarkResult::ns_per_scan() const {
+    return scans ? static_cast<double>(total_ns) / scans : 0;
+}
+
+double BenchmarkResult::events_per_second() const {
+    return total_ns ? events * 1e9 / total_ns : 0;
+}
+
+BenchmarkResult BenchmarkFixture::replay(const BenchmarkTrace& trace, unsigned iterations) {
+    BenchmarkResult result;
+    result.trace = trace.name;
+
+    const uint32_t duration = (trace.events.empty() ? 0 : trace.events.back().time_ms) + BENCHMARK_SETTLE_MS;
+
+    benchmark_probes_reset();
+
+    for (unsigned i = 0; i < iterations; i++) {
+        auto event = trace.events.begin();
+        for (uint32_t time = 0; time <= duration; time++) {
+            for (; event != trace.events.end() && event->time_ms == time; event++) {
+                if (event->pressed) {
+                    press_key(event->col, event->row);
+                } else {
+                    release_key(event->col, event->row);
+                }
+                result.events++;
+            }
+
+            uint64_t start = benchmark_clock_ns();
+            keyboard_task();
+            uint64_t elapsed = benchmark_clock_ns() - start;
+
+            result.scans++;
+            result.total_ns += elapsed;
+            if (elapsed > result.max_scan_ns) {
+                result.max_scan_ns = elapsed;
+            }
+
+            housekeeping_task();
+            advance_time(1);
+        }
+
+        // Keep the test log from growing with every pass, the reports sent are not of interest here.
+        test_logger.reset();
+    }
+
+    return result;
+}
+
+void BenchmarkFixture::report(const BenchmarkResult& result) const {
+    std::ios_base::fmtflags flags(std::cout.flags());
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "[ BENCH    ] " << result.trace << ": " << result.scans << " scans, " << result.events << " events" << std::endl;
+    std::cout << "[ BENCH    ] " << result.trace << ": " << result.ns_per_scan() << " ns/scan, " << result.max_scan_ns << " ns worst scan, " << result.events_per_second() << " events/sec" << std::endl;
+
+    for (uint8_t i = 0; i < benchmark_probe_count(); i++) {
+        const benchmark_probe_t* probe = benchmark_probe_get(i);
+        double                   avg   = probe->calls ? static_cast<double>(probe->total_ns) / probe->calls : 0;
+        std::cout << "[ BENCH    ]   " << std::left << std::setw(24) << probe->name << std::right << std::setw(9) << probe->calls << " calls " << std::setw(10) << avg << " ns/call " << std::setw(9) << probe->max_ns << " ns max " << std::setw(12) << probe->total_ns << " ns total" << std::endl;
+    }
+
+    std::cout.flags(flags);
+}
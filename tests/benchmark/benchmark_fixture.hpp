@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "test_fixture.hpp"
+#include "benchmark_traces.hpp"
+
+#ifndef BENCHMARK_ITERATIONS
+#    define BENCHMARK_ITERATIONS 20
+#endif
+
+#ifndef BENCHMARK_SETTLE_MS
+#    define BENCHMARK_SETTLE_MS 500
+#endif
+
+struct BenchmarkResult {
+    std::string trace;
+    uint32_t    scans       = 0;
+    uint32_t    events      = 0;
+    uint64_t    total_ns    = 0;
+    uint64_t    max_scan_ns = 0;
+
+    double ns_per_scan() const;
+    double events_per_second() const;
+};
+
+/**
+ * @brief Replays key event traces through keyboard_task() and measures the time spent per scan.
+ *
+ * Time is measured with the host's monotonic clock, while the simulated timer from platforms/test advances by
+ * exactly 1ms per scan. Results are only comparable between runs on the same machine.
+ */
+class BenchmarkFixture : public TestFixture {
+   public:
+    /**
+     * @brief Plays `trace` `iterations` times, followed by BENCHMARK_SETTLE_MS idle scans after each pass.
+     */
+    BenchmarkResult replay(const BenchmarkTrace& trace, unsigned iterations = BENCHMARK_ITERATIONS);
+
+    /**
+     * @brief Prints the scan totals of `result` and the per-function probes collected during the last replay.
+     */
+    void report(const BenchmarkResult& result) const;
+};
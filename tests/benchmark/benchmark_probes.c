@@ -0,0 +1,143 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <time.h>
+#include "quantum.h"
+#include "benchmark_probes.h"
+
+// Every probe listed here must have a matching `--wrap` entry in benchmark.mk, and vice versa.
+enum benchmark_probes {
+    PROBE_action_exec,
+    PROBE_pre_process_record_quantum,
+    PROBE_action_tapping_process,
+    PROBE_process_record,
+#ifdef COMBO_ENABLE
+    PROBE_process_combo,
+    PROBE_combo_task,
+#endif
+#ifdef TAP_DANCE_ENABLE
+    PROBE_preprocess_tap_dance,
+    PROBE_process_tap_dance,
+    PROBE_tap_dance_task,
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+    PROBE_process_key_override,
+    PROBE_key_override_task,
+#endif
+#ifdef AUTOCORRECT_ENABLE
+    PROBE_process_autocorrect,
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+    PROBE_process_auto_shift,
+    PROBE_autoshift_matrix_scan,
+#endif
+    BENCHMARK_PROBE_COUNT
+};
+
+static benchmark_probe_t probes[BENCHMARK_PROBE_COUNT];
+
+uint64_t benchmark_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+static void benchmark_probe_record(uint8_t index, uint64_t start_ns) {
+    uint64_t elapsed = benchmark_clock_ns() - start_ns;
+    probes[index].calls++;
+    probes[index].total_ns += elapsed;
+    if (elapsed > probes[index].max_ns) {
+        probes[index].max_ns = elapsed;
+    }
+}
+
+#define PROBE_NAME(fn) [PROBE_##fn] = #fn
+
+void benchmark_probes_reset(void) {
+    static const char *const names[BENCHMARK_PROBE_COUNT] = {
+        PROBE_NAME(action_exec),
+        PROBE_NAME(pre_process_record_quantum),
+        PROBE_NAME(action_tapping_process),
+        PROBE_NAME(process_record),
+#ifdef COMBO_ENABLE
+        PROBE_NAME(process_combo),
+        PROBE_NAME(combo_task),
+#endif
+#ifdef TAP_DANCE_ENABLE
+        PROBE_NAME(preprocess_tap_dance),
+        PROBE_NAME(process_tap_dance),
+        PROBE_NAME(tap_dance_task),
+#endif
+#ifdef KEY_OVERRIDE_ENABLE
+        PROBE_NAME(process_key_override),
+        PROBE_NAME(key_override_task),
+#endif
+#ifdef AUTOCORRECT_ENABLE
+        PROBE_NAME(process_autocorrect),
+#endif
+#ifdef AUTO_SHIFT_ENABLE
+        PROBE_NAME(process_auto_shift),
+        PROBE_NAME(autoshift_matrix_scan),
+#endif
+    };
+
+    for (uint8_t i = 0; i < BENCHMARK_PROBE_COUNT; i++) {
+        probes[i] = (benchmark_probe_t){.name = names[i]};
+    }
+}
+
+uint8_t benchmark_probe_count(void) {
+    return BENCHMARK_PROBE_COUNT;
+}
+
+const benchmark_probe_t *benchmark_probe_get(uint8_t index) {
+    return index < BENCHMARK_PROBE_COUNT ? &probes[index] : NULL;
+}
+
+// The linker redirects every call to `fn` into `__wrap_fn`, the original is still reachable as `__real_fn`.
+#define PROBE_WRAP_VOID(fn, params, args)          \
+    void __real_##fn params;                       \
+    void __wrap_##fn params {                      \
+        uint64_t start = benchmark_clock_ns();     \
+        __real_##fn args;                          \
+        benchmark_probe_record(PROBE_##fn, start); \
+    }
+
+#define PROBE_WRAP_BOOL(fn, params, args)          \
+    bool __real_##fn params;                       \
+    bool __wrap_##fn params {                      \
+        uint64_t start = benchmark_clock_ns();     \
+        bool     ret   = __real_##fn args;         \
+        benchmark_probe_record(PROBE_##fn, start); \
+        return ret;                                \
+    }
+
+PROBE_WRAP_VOID(action_exec, (keyevent_t event), (event))
+PROBE_WRAP_BOOL(pre_process_record_quantum, (keyrecord_t * record), (record))
+PROBE_WRAP_VOID(action_tapping_process, (keyrecord_t record), (record))
+PROBE_WRAP_VOID(process_record, (keyrecord_t * record), (record))
+
+#ifdef COMBO_ENABLE
+PROBE_WRAP_BOOL(process_combo, (uint16_t keycode, keyrecord_t *record), (keycode, record))
+PROBE_WRAP_VOID(combo_task, (void), ())
+#endif
+
+#ifdef TAP_DANCE_ENABLE
+PROBE_WRAP_BOOL(preprocess_tap_dance, (uint16_t keycode, keyrecord_t *record), (keycode, record))
+PROBE_WRAP_BOOL(process_tap_dance, (uint16_t keycode, keyrecord_t *record), (keycode, record))
+PROBE_WRAP_VOID(tap_dance_task, (void), ())
+#endif
+
+#ifdef KEY_OVERRIDE_ENABLE
+PROBE_WRAP_BOOL(process_key_override, (const uint16_t keycode, const keyrecord_t *const record), (keycode, record))
+PROBE_WRAP_VOID(key_override_task, (void), ())
+#endif
+
+#ifdef AUTOCORRECT_ENABLE
+PROBE_WRAP_BOOL(process_autocorrect, (uint16_t keycode, keyrecord_t *record), (keycode, record))
+#endif
+
+#ifdef AUTO_SHIFT_ENABLE
+PROBE_WRAP_BOOL(process_auto_shift, (uint16_t keycode, keyrecord_t *record), (keycode, record))
+PROBE_WRAP_VOID(autoshift_matrix_scan, (void), ())
+#endif
@@ -0,0 +1,33 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Accumulated wall clock time of a single wrapped function.
+ *
+ * Probes are inclusive: the time spent in `process_record()` also contains the time of every `process_*`
+ * function it calls.
+ */
+typedef struct {
+    const char *name;
+    uint32_t    calls;
+    uint64_t    total_ns;
+    uint64_t    max_ns;
+} benchmark_probe_t;
+
+uint64_t benchmark_clock_ns(void);
+
+void                     benchmark_probes_reset(void);
+uint8_t                  benchmark_probe_count(void);
+const benchmark_probe_t *benchmark_probe_get(uint8_t index);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,180 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "benchmark_traces.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <sstream>
+#include "gtest/gtest.h"
+#include "keycode.h"
+
+namespace {
+// clang-format off
+const char layout[MATRIX_ROWS][MATRIX_COLS + 1] = {
+    "qwertyuiop",
+    "asdfghjkl;",
+    "zxcvbnm,./",
+    "     \b\n   ",
+};
+
+const uint16_t layout_keycodes[MATRIX_ROWS][MATRIX_COLS] = {
+    {KC_Q,    KC_W,    KC_E,    KC_R,    KC_T,   KC_Y,    KC_U,   KC_I,    KC_O,    KC_P},
+    {KC_A,    KC_S,    KC_D,    KC_F,    KC_G,   KC_H,    KC_J,   KC_K,    KC_L,    KC_SCLN},
+    {KC_Z,    KC_X,    KC_C,    KC_V,    KC_B,   KC_N,    KC_M,   KC_COMM, KC_DOT,  KC_SLSH},
+    {KC_LCTL, KC_LGUI, KC_LALT, KC_LSFT, KC_SPC, KC_BSPC, KC_ENT, KC_RALT, KC_RGUI, KC_RCTL},
+};
+// clang-format on
+
+const uint8_t shift_col = 3;
+const uint8_t shift_row = 3;
+const uint8_t space_col = 4;
+const uint8_t space_row = 3;
+
+bool find_position(char c, uint8_t& col, uint8_t& row) {
+    if (c == ' ') {
+        col = space_col;
+        row = space_row;
+        return true;
+    }
+    for (row = 0; row < MATRIX_ROWS; row++) {
+        for (col = 0; col < MATRIX_COLS; col++) {
+            if (layout[row][col] == c) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+void sort_events(BenchmarkTrace& trace) {
+    std::stable_sort(trace.events.begin(), trace.events.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time_ms < b.time_ms; });
+}
+} // namespace
+
+std::vector<KeymapKey> benchmark_keymap(std::initializer_list<KeymapKey> overrides) {
+    std::vector<KeymapKey> keys;
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            auto is_overridden = [&](const KeymapKey& key) { return key.layer == 0 && key.position.col == col && key.position.row == row; };
+            auto override      = std::find_if(overrides.begin(), overrides.end(), is_overridden);
+            if (override == overrides.end()) {
+                keys.push_back(KeymapKey(0, col, row, layout_keycodes[row][col]));
+            }
+        }
+    }
+    for (const auto& key : overrides) {
+        keys.push_back(key);
+    }
+    return keys;
+}
+
+BenchmarkTrace trace_from_text(const std::string& name, const std::string& text, uint16_t interval_ms, uint16_t hold_ms) {
+    BenchmarkTrace trace{name, {}};
+    uint16_t       time    = 0;
+    bool           shifted = false;
+    size_t         last_release[MATRIX_ROWS][MATRIX_COLS];
+    std::fill(&last_release[0][0], &last_release[0][0] + MATRIX_ROWS * MATRIX_COLS, SIZE_MAX);
+
+    for (char c : text) {
+        bool upper = std::isupper(static_cast<unsigned char>(c));
+        if (upper != shifted) {
+            trace.events.push_back({time, shift_col, shift_row, upper});
+            shifted = upper;
+            time += interval_ms / 2;
+        }
+
+        uint8_t col, row;
+        if (!find_position(std::tolower(static_cast<unsigned char>(c)), col, row)) {
+            continue;
+        }
+        // A repeated letter can't roll over itself, release the previous press first.
+        size_t previous = last_release[row][col];
+        if (previous != SIZE_MAX && trace.events[previous].time_ms >= time) {
+            trace.events[previous].time_ms = time - 1;
+        }
+        trace.events.push_back({time, col, row, true});
+        last_release[row][col] = trace.events.size();
+        trace.events.push_back({static_cast<uint16_t>(time + hold_ms), col, row, false});
+        time += interval_ms;
+    }
+
+    if (shifted) {
+        trace.events.push_back({static_cast<uint16_t>(time + hold_ms), shift_col, shift_row, false});
+    }
+
+    sort_events(trace);
+    return trace;
+}
+
+BenchmarkTrace trace_from_chords(const std::string& name, const std::vector<std::string>& chords, uint16_t interval_ms, uint16_t hold_ms) {
+    BenchmarkTrace trace{name, {}};
+    uint16_t       time = 0;
+
+    for (const auto& chord : chords) {
+        uint16_t offset = 0;
+        for (char c : chord) {
+            uint8_t col, row;
+            if (!find_position(c, col, row)) {
+                continue;
+            }
+            trace.events.push_back({static_cast<uint16_t>(time + offset), col, row, true});
+            trace.events.push_back({static_cast<uint16_t>(time + hold_ms), col, row, false});
+            offset += 2;
+        }
+        time += interval_ms;
+    }
+
+    sort_events(trace);
+    return trace;
+}
+
+BenchmarkTrace prose_trace() {
+    return trace_from_text("prose",
+                           "The quick brown fox jumps over thier lazy dog, then QMK types it again.\n"
+                           "Rolling fingers overlap keys; tpyo\b\b\bypo fixes happen all teh time.\n",
+                           55, 85);
+}
+
+BenchmarkTrace chord_trace() {
+    return trace_from_chords("chords", {"jk", "df", "sdf", "jkl", "we", "io", "xc", "m,", "jk", "df", "sdf", "jkl", "we", "io", "xc", "m,"}, 90, 20);
+}
+
+BenchmarkTrace trace_from_key_trace(const std::string& name, const KeyTrace& trace) {
+    BenchmarkTrace result{name, {}};
+
+    for (const auto& record : trace.records) {
+        uint32_t time = trace.elapsed_ms(record);
+        if ((record.event & KEY_TRACE_TYPE_MASK) != KEY_EVENT || time > UINT16_MAX || record.row >= MATRIX_ROWS || record.col >= MATRIX_COLS) {
+            continue;
+        }
+        result.events.push_back({static_cast<uint16_t>(time), record.col, record.row, static_cast<bool>(record.event & KEY_TRACE_PRESSED)});
+    }
+
+    return result;
+}
+
+std::vector<BenchmarkTrace> recorded_traces() {
+    std::vector<BenchmarkTrace> traces;
+    const char*                 paths = std::getenv("BENCHMARK_KEY_TRACES");
+    if (!paths) {
+        return traces;
+    }
+
+    std::istringstream list(paths);
+    std::string        path;
+    while (std::getline(list, path, ':')) {
+        KeyTrace    trace;
+        std::string error;
+        if (path.empty()) {
+            continue;
+        }
+        if (!KeyTrace::load(path, trace, &error)) {
+            ADD_FAILURE() << error;
+            continue;
+        }
+        traces.push_back(trace_from_key_trace(path, trace));
+    }
+    return traces;
+}
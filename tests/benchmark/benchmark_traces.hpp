@@ -0,0 +1,62 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "key_trace_file.hpp"
+#include "test_keymap_key.hpp"
+
+/**
+ * @brief A single matrix change, `time_ms` is relative to the start of the trace.
+ */
+struct TraceEvent {
+    uint16_t time_ms;
+    uint8_t  col;
+    uint8_t  row;
+    bool     pressed;
+};
+
+struct BenchmarkTrace {
+    std::string             name;
+    std::vector<TraceEvent> events;
+};
+
+/**
+ * @brief The QWERTY layout all traces are recorded against, on layer 0 of the 4x10 test matrix.
+ *
+ * Keys in `overrides` replace the default keycode at the same position, so feature sets can place
+ * tap dances or mod-taps without having to repeat the whole layout.
+ */
+std::vector<KeymapKey> benchmark_keymap(std::initializer_list<KeymapKey> overrides = {});
+
+/**
+ * @brief Builds a typing trace from `text`, pressing a key every `interval_ms` and holding it for `hold_ms`.
+ *
+ * A `hold_ms` larger than `interval_ms` produces rolling key presses. Upper case letters are typed with a held
+ * left shift, `\b` taps backspace. Characters that are not part of the benchmark layout are skipped.
+ */
+BenchmarkTrace trace_from_text(const std::string& name, const std::string& text, uint16_t interval_ms, uint16_t hold_ms);
+
+/**
+ * @brief Builds a trace of chords, the keys of each chord are pressed 2ms apart and released together after `hold_ms`.
+ */
+BenchmarkTrace trace_from_chords(const std::string& name, const std::vector<std::string>& chords, uint16_t interval_ms, uint16_t hold_ms);
+
+/* A paragraph of prose with rollover, typo corrections and shifted words. */
+BenchmarkTrace prose_trace();
+
+/* Short bursts of two and three key chords, as typed on stenography-style layouts. */
+BenchmarkTrace chord_trace();
+
+/**
+ * @brief Builds a trace from the key events of a trace dumped by the KEY_TRACE_ENABLE recorder.
+ *
+ * Events which are not matrix changes are left out, as are events more than 65s into the trace.
+ */
+BenchmarkTrace trace_from_key_trace(const std::string& name, const KeyTrace& trace);
+
+/* The recorded traces listed in the BENCHMARK_KEY_TRACES environment variable, as colon separated file paths. */
+std::vector<BenchmarkTrace> recorded_traces();
@@ -0,0 +1,119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+extern "C" {
+#include "quantum.h"
+
+extern combo_t key_combos[];
+}
+
+class ComboKeyIndex : public TestFixture {};
+
+TEST_F(ComboKeyIndex, combo_modtest_tapped) {
+    TestDriver driver;
+    KeymapKey  key_y(0, 0, 1, KC_Y);
+    KeymapKey  key_u(0, 0, 2, KC_U);
+    set_keymap({key_y, key_u});
+
+    EXPECT_REPORT(driver, (KC_SPACE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_y, key_u});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, combo_osmshift_tapped) {
+    TestDriver driver;
+    KeymapKey  key_z(0, 0, 1, KC_Z);
+    KeymapKey  key_x(0, 0, 2, KC_X);
+    KeymapKey  key_i(0, 0, 3, KC_I);
+    set_keymap({key_z, key_x, key_i});
+
+    EXPECT_NO_REPORT(driver);
+    tap_combo({key_z, key_x});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_I, KC_LEFT_SHIFT));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_i);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, overlapping_combo_with_more_keys_wins) {
+    TestDriver driver;
+    KeymapKey  key_s(0, 0, 1, KC_S);
+    KeymapKey  key_d(0, 0, 2, KC_D);
+    KeymapKey  key_f(0, 0, 3, KC_F);
+    set_keymap({key_s, key_d, key_f});
+
+    EXPECT_REPORT(driver, (KC_ENTER));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_s, key_d, key_f});
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_TAB));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_d, key_f});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, non_combo_key_is_not_delayed) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 1, KC_A);
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, repeated_key_in_combo) {
+    TestDriver driver;
+    KeymapKey  key_q(0, 0, 1, KC_Q);
+    KeymapKey  key_w(0, 0, 2, KC_W);
+    set_keymap({key_q, key_w});
+
+    /* The second KC_Q of the combo can never be pressed, so the combo never fires. */
+    EXPECT_REPORT(driver, (KC_Q));
+    EXPECT_REPORT(driver, (KC_Q, KC_W));
+    EXPECT_REPORT(driver, (KC_W));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_q, key_w});
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboKeyIndex, invalidate_after_changing_combo_keys) {
+    static uint16_t const jl_combo[] = {KC_J, KC_L, COMBO_END};
+    const uint16_t*       jk_keys    = key_combos[2].keys;
+
+    TestDriver driver;
+    KeymapKey  key_j(0, 0, 1, KC_J);
+    KeymapKey  key_l(0, 0, 2, KC_L);
+    set_keymap({key_j, key_l});
+
+    key_combos[2].keys = jl_combo;
+    combo_key_index_invalidate();
+
+    EXPECT_REPORT(driver, (KC_ESCAPE));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_combo({key_j, key_l});
+    VERIFY_AND_CLEAR(driver);
+
+    key_combos[2].keys = jk_keys;
+    combo_key_index_invalidate();
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { modtest, osmshift, esc, tab, enter, duplicate };
+
+uint16_t const modtest_combo[]   = {KC_Y, KC_U, COMBO_END};
+uint16_t const osmshift_combo[]  = {KC_Z, KC_X, COMBO_END};
+uint16_t const esc_combo[]       = {KC_J, KC_K, COMBO_END};
+uint16_t const tab_combo[]       = {KC_D, KC_F, COMBO_END};
+uint16_t const enter_combo[]     = {KC_S, KC_D, KC_F, COMBO_END};
+uint16_t const duplicate_combo[] = {KC_Q, KC_Q, KC_W, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [modtest]   = COMBO(modtest_combo, RSFT_T(KC_SPACE)),
+    [osmshift]  = COMBO(osmshift_combo, OSM(MOD_LSFT)),
+    [esc]       = COMBO(esc_combo, KC_ESC),
+    [tab]       = COMBO(tab_combo, KC_TAB),
+    [enter]     = COMBO(enter_combo, KC_ENT),
+    [duplicate] = COMBO(duplicate_combo, KC_DEL),
+};
+// clang-format on
@@ -0,0 +1,88 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <array>
+#include <vector>
+#include "benchmark_fixture.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::AtLeast;
+using testing::NiceMock;
+
+namespace {
+// clang-format off
+const uint16_t letters[] = {
+    KC_Q, KC_W, KC_E, KC_R, KC_T, KC_Y, KC_U, KC_I, KC_O, KC_P,
+    KC_A, KC_S, KC_D, KC_F, KC_G, KC_H, KC_J, KC_K, KC_L,
+    KC_Z, KC_X, KC_C, KC_V, KC_B, KC_N, KC_M,
+};
+// clang-format on
+const size_t letter_count = sizeof(letters) / sizeof(letters[0]);
+
+std::vector<std::array<uint16_t, 3>> combo_keys;
+std::vector<combo_t>                 combos;
+
+/* Every combo pairs a letter with a function key that is never pressed, so each letter takes part in
+ * count / 26 combos but no combo ever fires and the typed output is identical for every combo count. */
+void generate_combos(size_t count) {
+    combo_keys.clear();
+    combos.clear();
+    for (size_t i = 0; i < count; i++) {
+        combo_keys.push_back({letters[i % letter_count], static_cast<uint16_t>(KC_F1 + (i / letter_count) % 24), COMBO_END});
+    }
+    for (auto& keys : combo_keys) {
+        combos.push_back(COMBO(keys, KC_ESC));
+    }
+#ifdef COMBO_KEY_INDEX
+    combo_key_index_invalidate();
+#endif
+}
+} // namespace
+
+extern "C" uint16_t combo_count(void) {
+    return combos.size();
+}
+
+extern "C" combo_t* combo_get(uint16_t combo_idx) {
+    return &combos[combo_idx];
+}
+
+class ComboScaling : public BenchmarkFixture {
+   protected:
+    void SetUp() override {
+        for (const auto& key : benchmark_keymap()) {
+            add_key(key);
+        }
+    }
+
+    void run(size_t count) {
+        NiceMock<TestDriver> driver;
+        auto                 trace = prose_trace();
+        generate_combos(count);
+        trace.name += " with " + std::to_string(count) + " combos";
+
+        EXPECT_ANY_REPORT(driver).Times(AtLeast(1));
+        auto result = replay(trace);
+        report(result);
+        VERIFY_AND_CLEAR(driver);
+
+        EXPECT_EQ(result.events, trace.events.size() * BENCHMARK_ITERATIONS);
+    }
+};
+
+TEST_F(ComboScaling, combos_8) {
+    run(8);
+}
+
+TEST_F(ComboScaling, combos_64) {
+    run(64);
+}
+
+TEST_F(ComboScaling, combos_256) {
+    run(256);
+}
+
+TEST_F(ComboScaling, combos_512) {
+    run(512);
+}
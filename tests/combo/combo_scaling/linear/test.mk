@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = tests/combo/combo_scaling/scaling_combos.c
+
+SRC += tests/combo/combo_scaling/combo_scaling_benchmark.cpp
+
+include tests/benchmark/benchmark.mk
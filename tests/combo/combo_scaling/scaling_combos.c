@@ -0,0 +1,12 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// The benchmark generates its combos at runtime through combo_count() and combo_get(),
+// this only satisfies keymap introspection.
+uint16_t const unused_combo[] = {KC_F23, KC_F24, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(unused_combo, KC_NO),
+};
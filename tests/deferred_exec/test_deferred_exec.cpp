@@ -0,0 +1,253 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "deferred_exec.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+}
+
+namespace {
+struct Executor {
+    uint32_t              period;
+    uint32_t              calls;
+    uint32_t              max_jitter;
+    std::vector<uint32_t> trigger_times;
+    deferred_token        token;
+};
+
+std::vector<uint32_t> call_order;
+
+uint32_t record_call(uint32_t trigger_time, void *cb_arg) {
+    auto *executor = static_cast<Executor *>(cb_arg);
+    executor->calls++;
+    executor->max_jitter = std::max(executor->max_jitter, timer_read32() - trigger_time);
+    executor->trigger_times.push_back(trigger_time);
+    call_order.push_back(executor->period);
+    return executor->period;
+}
+
+uint32_t run_once(uint32_t trigger_time, void *cb_arg) {
+    record_call(trigger_time, cb_arg);
+    return 0;
+}
+} // namespace
+
+class DeferredExec : public TestFixture {
+   protected:
+    std::vector<Executor> executors;
+
+    void SetUp() override {
+        call_order.clear();
+
+        // The task remembers when it last ran, so each test starts later than the previous one finished
+        static uint32_t start = 0;
+        start += 1000000;
+        set_time(start);
+    }
+
+    void TearDown() override {
+        for (auto &executor : executors) {
+            cancel_deferred_exec(executor.token);
+        }
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_task();
+        }
+    }
+};
+
+TEST_F(DeferredExec, RunsInTriggerOrder) {
+    const uint32_t delays[] = {40, 5, 23, 17, 1, 30, 12, 8, 35, 2};
+    executors.reserve(sizeof(delays) / sizeof(delays[0]));
+    for (auto delay : delays) {
+        executors.push_back({delay});
+        executors.back().token = defer_exec(delay, run_once, &executors.back());
+        ASSERT_NE(executors.back().token, INVALID_DEFERRED_TOKEN);
+    }
+
+    run_for(50);
+
+    std::vector<uint32_t> sorted(std::begin(delays), std::end(delays));
+    std::sort(sorted.begin(), sorted.end());
+    EXPECT_EQ(call_order, sorted);
+    for (auto &executor : executors) {
+        EXPECT_EQ(executor.calls, 1u);
+        EXPECT_EQ(executor.max_jitter, 0u);
+    }
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+}
+
+TEST_F(DeferredExec, ManyRepeatingExecutorsKeepTheirPeriod) {
+    const uint32_t count    = MAX_DEFERRED_EXECUTORS;
+    const uint32_t duration = 1000;
+    executors.reserve(count);
+    for (uint32_t i = 0; i < count; i++) {
+        // Spread over 1..97ms so several are due on most milliseconds
+        uint32_t period = 1 + (i * 37) % 97;
+        executors.push_back({period});
+        executors.back().token = defer_exec(period, record_call, &executors.back());
+        ASSERT_NE(executors.back().token, INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer_exec(1, record_call, nullptr), INVALID_DEFERRED_TOKEN);
+
+    const uint32_t start = timer_read32();
+    run_for(duration);
+
+    for (auto &executor : executors) {
+        EXPECT_EQ(executor.calls, duration / executor.period) << "period " << executor.period;
+        EXPECT_EQ(executor.max_jitter, 0u) << "period " << executor.period;
+        for (size_t n = 0; n < executor.trigger_times.size(); n++) {
+            EXPECT_EQ(executor.trigger_times[n], start + (n + 1) * executor.period);
+        }
+    }
+}
+
+TEST_F(DeferredExec, CancelAndExtend) {
+    executors.reserve(100);
+    for (uint32_t i = 0; i < 100; i++) {
+        executors.push_back({10 + i});
+        executors.back().token = defer_exec(10 + i, run_once, &executors.back());
+    }
+
+    // Cancel every other executor, and push the rest back by 100ms
+    for (uint32_t i = 0; i < 100; i++) {
+        if (i % 2) {
+            EXPECT_TRUE(cancel_deferred_exec(executors[i].token));
+            EXPECT_FALSE(cancel_deferred_exec(executors[i].token));
+        } else {
+            EXPECT_TRUE(extend_deferred_exec(executors[i].token, 100 + i));
+        }
+    }
+
+    EXPECT_EQ(deferred_exec_time_until_next(), 100u);
+    run_for(99);
+    EXPECT_TRUE(call_order.empty());
+
+    run_for(100);
+    ASSERT_EQ(call_order.size(), 50u);
+    for (uint32_t i = 0; i < 100; i++) {
+        EXPECT_EQ(executors[i].calls, i % 2 ? 0u : 1u);
+        EXPECT_EQ(executors[i].max_jitter, 0u);
+    }
+    EXPECT_TRUE(std::is_sorted(call_order.begin(), call_order.end()));
+}
+
+TEST_F(DeferredExec, CallbacksCanRequeue) {
+    static Executor chained = {7};
+    static Executor first   = {3};
+
+    // Cancels itself and queues another executor from within its callback
+    auto requeue = [](uint32_t trigger_time, void *cb_arg) -> uint32_t {
+        auto *executor = static_cast<Executor *>(cb_arg);
+        record_call(trigger_time, executor);
+        cancel_deferred_exec(executor->token);
+        chained.token = defer_exec(chained.period, run_once, &chained);
+        return 5;
+    };
+    first.token = defer_exec(first.period, requeue, &first);
+
+    run_for(3);
+    EXPECT_EQ(first.calls, 1u);
+    EXPECT_EQ(deferred_exec_time_until_next(), 7u);
+
+    run_for(20);
+    EXPECT_EQ(first.calls, 1u);
+    EXPECT_EQ(chained.calls, 1u);
+    EXPECT_EQ(chained.max_jitter, 0u);
+}
+
+TEST_F(DeferredExec, TimeUntilNext) {
+    EXPECT_EQ(deferred_exec_time_until_next(), UINT32_MAX);
+
+    executors.reserve(2);
+    executors.push_back({50});
+    executors.back().token = defer_exec(50, run_once, &executors.back());
+    executors.push_back({80});
+    executors.back().token = defer_exec(80, run_once, &executors.back());
+    EXPECT_EQ(deferred_exec_time_until_next(), 50u);
+
+    // Not run for a while, so it is overdue
+    advance_time(60);
+    EXPECT_EQ(deferred_exec_time_until_next(), 0u);
+    deferred_exec_task();
+    EXPECT_EQ(executors[0].calls, 1u);
+    EXPECT_EQ(deferred_exec_time_until_next(), 20u);
+}
+
+TEST_F(DeferredExec, IdleTaskOnlyChecksTheEarliestExecutor) {
+    deferred_executor_t table[MAX_DEFERRED_EXECUTORS] = {};
+    uint32_t            last_exec                     = 0;
+
+    executors.reserve(MAX_DEFERRED_EXECUTORS);
+    for (uint32_t i = 0; i < MAX_DEFERRED_EXECUTORS; i++) {
+        executors.push_back({100 + i});
+        ASSERT_NE(defer_exec_advanced(table, MAX_DEFERRED_EXECUTORS, 100 + i, run_once, &executors.back()), INVALID_DEFERRED_TOKEN);
+    }
+
+    // Make every executor but the earliest look overdue. Only a task comparing more than one trigger time would run
+    // any of them.
+    for (uint32_t i = 1; i < MAX_DEFERRED_EXECUTORS; i++) {
+        table[i].trigger_time = timer_read32() - 1;
+    }
+    for (uint32_t i = 0; i < 99; i++) {
+        advance_time(1);
+        deferred_exec_advanced_task(table, MAX_DEFERRED_EXECUTORS, &last_exec);
+    }
+    EXPECT_TRUE(call_order.empty());
+
+    advance_time(1);
+    deferred_exec_advanced_task(table, MAX_DEFERRED_EXECUTORS, &last_exec);
+    EXPECT_FALSE(call_order.empty());
+    EXPECT_EQ(executors[0].calls, 1u);
+    executors.clear();
+}
+
+TEST_F(DeferredExec, IdleTaskBenchmark) {
+    using clock = std::chrono::steady_clock;
+
+    // Far enough in the future that none are due while measuring
+    auto idle_task_ns = [this](uint32_t count) {
+        executors.clear();
+        executors.reserve(count);
+        for (uint32_t i = 0; i < count; i++) {
+            executors.push_back({500000 + i});
+            executors.back().token = defer_exec(500000 + i, run_once, &executors.back());
+        }
+
+        const unsigned calls = 20000;
+        auto           best  = clock::duration::max();
+        for (int attempt = 0; attempt < 5; attempt++) {
+            auto start = clock::now();
+            for (unsigned i = 0; i < calls; i++) {
+                advance_time(1);
+                deferred_exec_task();
+            }
+            best = std::min(best, clock::now() - start);
+        }
+
+        for (auto &executor : executors) {
+            cancel_deferred_exec(executor.token);
+        }
+        executors.clear();
+        return std::chrono::duration<double, std::nano>(best).count() / calls;
+    };
+
+    double one  = idle_task_ns(1);
+    double many = idle_task_ns(MAX_DEFERRED_EXECUTORS);
+    std::cout << "[ BENCH    ] deferred_exec_task() with nothing due: " << one << " ns with 1 executor, " << many << " ns with " << MAX_DEFERRED_EXECUTORS << " executors" << std::endl;
+
+    // Only reported, the timing depends too much on the machine to assert on
+    EXPECT_TRUE(call_order.empty());
+}
@@ -0,0 +1,6 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+DYNAMIC_KEYMAP_ENABLE = yes
+DYNAMIC_KEYMAP_RAM_MIRROR = yes
+EEPROM_DRIVER = transient
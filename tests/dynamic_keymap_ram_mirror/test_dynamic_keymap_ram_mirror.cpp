@@ -0,0 +1,151 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "quantum.h"
+#include "keymap_introspection.h"
+}
+
+extern "C" {
+void set_time(uint32_t t);
+
+/* Reset the dynamic keymap from eeconfig_init() like VIA does, which the test build cannot enable. */
+void eeconfig_init_kb(void) {
+    dynamic_keymap_reset();
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_flush();
+}
+}
+
+namespace {
+uint16_t eeprom_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    const uint8_t* address = (const uint8_t*)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+    return (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+}
+
+/* Macros use the rest of the EEPROM after the keymaps. */
+const uint8_t* eeprom_macro_address(uint16_t offset) {
+    return (const uint8_t*)(uintptr_t)(TRANSIENT_EEPROM_SIZE - dynamic_keymap_macro_get_buffer_size() + offset);
+}
+
+/* Constructed before TestFixture restarts the timer, to remember where the previous test left it. */
+struct PreviousTestTime {
+    uint32_t time = timer_read32();
+};
+} // namespace
+
+class DynamicKeymapRamMirror : private PreviousTestTime, public TestFixture {
+   protected:
+    void SetUp() override {
+        /* The write back executor remembers the last time it ran, so carry on from the previous test rather than
+         * from zero. */
+        set_time(PreviousTestTime::time);
+
+        dynamic_keymap_set_keycode(0, 0, 0, KC_NO);
+        dynamic_keymap_set_keycode(1, 2, 3, KC_NO);
+        dynamic_keymap_flush();
+    }
+};
+
+TEST_F(DynamicKeymapRamMirror, SetKeycodeIsVisibleBeforeWriteBack) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_A);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(keycode_at_keymap_location(0, 0, 0), KC_A);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_NO);
+}
+
+TEST_F(DynamicKeymapRamMirror, WriteBackAfterDelay) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(1, 2, 3, LT(1, KC_B));
+
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY - 1);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_NO);
+
+    idle_for(2);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), LT(1, KC_B));
+}
+
+TEST_F(DynamicKeymapRamMirror, ChangesAreBatched) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_C);
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2);
+    dynamic_keymap_set_keycode(1, 2, 3, KC_D);
+
+    /* Both changes are committed by the write back scheduled for the first one. */
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY / 2 + 1);
+    EXPECT_EQ(eeprom_keycode(0, 0, 0), KC_C);
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_D);
+}
+
+TEST_F(DynamicKeymapRamMirror, FlushWritesImmediately) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(1, 2, 3, KC_E);
+    dynamic_keymap_flush();
+
+    EXPECT_EQ(eeprom_keycode(1, 2, 3), KC_E);
+}
+
+TEST_F(DynamicKeymapRamMirror, BufferRoundTrip) {
+    TestDriver driver;
+    uint8_t    data[4] = {0x00, KC_F, 0x00, KC_G};
+    dynamic_keymap_set_buffer(0, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_F);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_G);
+
+    uint8_t read[4] = {0};
+    dynamic_keymap_get_buffer(0, sizeof(read), read);
+    EXPECT_EQ(memcmp(data, read, sizeof(data)), 0);
+
+    dynamic_keymap_flush();
+    EXPECT_EQ(eeprom_keycode(0, 0, 1), KC_G);
+    dynamic_keymap_set_keycode(0, 0, 1, KC_NO);
+}
+
+TEST_F(DynamicKeymapRamMirror, MacroBufferRoundTrip) {
+    TestDriver driver;
+    uint16_t   size = dynamic_keymap_macro_get_buffer_size();
+    dynamic_keymap_macro_reset();
+
+    uint8_t macro[] = {'a', 'b', 0};
+    dynamic_keymap_macro_set_buffer(0, sizeof(macro), macro);
+
+    uint8_t read[sizeof(macro)] = {0};
+    dynamic_keymap_macro_get_buffer(0, sizeof(read), read);
+    EXPECT_EQ(memcmp(macro, read, sizeof(macro)), 0);
+
+    uint8_t last = 0xFF;
+    dynamic_keymap_macro_get_buffer(size - 1, 1, &last);
+    EXPECT_EQ(last, 0);
+
+    EXPECT_NE(eeprom_read_byte(eeprom_macro_address(0)), 'a');
+
+    idle_for(DYNAMIC_KEYMAP_WRITE_BACK_DELAY + 1);
+    uint8_t stored[sizeof(macro)] = {0};
+    eeprom_read_block(stored, eeprom_macro_address(0), sizeof(stored));
+    EXPECT_EQ(memcmp(macro, stored, sizeof(macro)), 0);
+    EXPECT_EQ(eeprom_read_byte(eeprom_macro_address(size - 1)), 0);
+}
+
+TEST_F(DynamicKeymapRamMirror, EeconfigInitRestoresEveryDefaultKeycode) {
+    TestDriver driver;
+    dynamic_keymap_set_keycode(0, 0, 0, KC_H);
+    dynamic_keymap_set_keycode(1, 2, 3, KC_I);
+    dynamic_keymap_flush();
+    dynamic_keymap_set_keycode(0, 0, 1, KC_J);
+
+    eeconfig_init();
+
+    for (uint8_t layer = 0; layer < dynamic_keymap_get_layer_count(); layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(eeprom_keycode(layer, row, column), keycode_at_keymap_location_raw(layer, row, column)) << "layer " << +layer << " row " << +row << " column " << +column;
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), keycode_at_keymap_location_raw(layer, row, column));
+            }
+        }
+    }
+}
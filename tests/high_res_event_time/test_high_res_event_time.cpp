@@ -0,0 +1,158 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+void advance_time_us(uint32_t us);
+}
+
+using testing::_;
+using testing::InSequence;
+
+// Polled at 8kHz, so the main loop runs every 125us
+#define SCAN_INTERVAL_US 125
+
+class HighResEventTime : public TestFixture {
+   protected:
+    void scan_for_us(uint32_t us) {
+        for (uint32_t elapsed = 0; elapsed < us; elapsed += SCAN_INTERVAL_US) {
+            keyboard_task();
+            housekeeping_task();
+            advance_time_us(SCAN_INTERVAL_US);
+        }
+    }
+};
+
+TEST_F(HighResEventTime, HoldIsDecidedAtTheDeadline) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap});
+
+    // Pressed half way through a millisecond
+    advance_time_us(500);
+    mod_tap.press();
+    const uint32_t pressed = timer_read_us();
+
+    EXPECT_NO_REPORT(driver);
+    scan_for_us(TAPPING_TERM * 1000);
+    EXPECT_EQ(timer_read_us() - pressed, TAPPING_TERM * 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    // Not at the start of the millisecond the tapping term ends in, but on the first scan after it
+    EXPECT_REPORT(driver, (KC_LSFT));
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap.release();
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HighResEventTime, TapAcrossMillisecondBoundaries) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap});
+
+    // Held for 199.875ms, although the millisecond count goes up by TAPPING_TERM
+    advance_time_us(875);
+    mod_tap.press();
+    EXPECT_NO_REPORT(driver);
+    scan_for_us(TAPPING_TERM * 1000 - SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap.release();
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HighResEventTime, TicksOnlyWhileATimeoutIsPending) {
+    TestDriver driver;
+    KeymapKey  mod_tap = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    set_keymap({mod_tap});
+    uint32_t deadline;
+
+    EXPECT_FALSE(action_tick_deadline(&deadline));
+
+    EXPECT_NO_REPORT(driver);
+    advance_time_us(250);
+    mod_tap.press();
+    const uint32_t pressed = timer_read_us();
+    scan_for_us(SCAN_INTERVAL_US);
+    ASSERT_TRUE(action_tick_deadline(&deadline));
+    EXPECT_EQ(deadline, pressed + TAPPING_TERM * 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    // Released as a tap, it waits for the tapping term to pass again for another tap
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    scan_for_us(10 * SCAN_INTERVAL_US);
+    mod_tap.release();
+    const uint32_t released = timer_read_us();
+    scan_for_us(SCAN_INTERVAL_US);
+    ASSERT_TRUE(action_tick_deadline(&deadline));
+    EXPECT_EQ(deadline, released + TAPPING_TERM * 1000);
+    VERIFY_AND_CLEAR(driver);
+
+    scan_for_us(TAPPING_TERM * 1000);
+    EXPECT_FALSE(action_tick_deadline(&deadline));
+}
+
+TEST_F(HighResEventTime, ComboTermIsTimedFromThePress) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    // 50.5ms apart, which is past the combo term although only 50 milliseconds have ticked over
+    advance_time_us(100);
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    scan_for_us(COMBO_TERM * 1000 + 500);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_EMPTY_REPORT(driver);
+    key_b.press();
+    scan_for_us(SCAN_INTERVAL_US);
+    key_a.release();
+    scan_for_us(SCAN_INTERVAL_US);
+    key_b.release();
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(HighResEventTime, ComboWithinTerm) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a = KeymapKey(0, 0, 0, KC_A);
+    KeymapKey  key_b = KeymapKey(0, 1, 0, KC_B);
+    set_keymap({key_a, key_b});
+
+    // 49.75ms apart, although 50 milliseconds have ticked over
+    advance_time_us(900);
+    EXPECT_NO_REPORT(driver);
+    key_a.press();
+    scan_for_us(COMBO_TERM * 1000 - 250);
+    key_b.press();
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    key_b.release();
+    scan_for_us(SCAN_INTERVAL_US);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,13 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Shared build rules for replaying recorded key traces, include this at the end
+# of the test.mk of every test that replays traces.
+
+KEY_TRACE_ENABLE = yes
+
+VPATH += $(TOP_DIR)/tests/key_trace
+
+SRC += \
+	tests/key_trace/key_trace_file.cpp \
+	tests/key_trace/key_trace_replay.cpp
@@ -0,0 +1,81 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_trace_file.hpp"
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <ostream>
+
+bool KeyTrace::time_us() const {
+    return header.flags & KEY_TRACE_FLAG_TIME_US;
+}
+
+uint32_t KeyTrace::elapsed_ms(const key_trace_record_t& record) const {
+    uint32_t elapsed = records.empty() ? 0 : record.time - records.front().time;
+    return time_us() ? elapsed / 1000 : elapsed;
+}
+
+namespace {
+bool fail(std::string* error, const std::string& message) {
+    if (error) {
+        *error = message;
+    }
+    return false;
+}
+} // namespace
+
+bool KeyTrace::parse(const std::vector<uint8_t>& bytes, KeyTrace& trace, std::string* error) {
+    if (bytes.size() < sizeof(trace.header)) {
+        return fail(error, "key trace is shorter than its header");
+    }
+    std::memcpy(&trace.header, bytes.data(), sizeof(trace.header));
+
+    if (std::memcmp(trace.header.magic, KEY_TRACE_MAGIC, sizeof(trace.header.magic)) != 0) {
+        return fail(error, "not a key trace");
+    }
+    if (trace.header.version != KEY_TRACE_VERSION || trace.header.record_size != sizeof(key_trace_record_t)) {
+        return fail(error, "unsupported key trace version " + std::to_string(trace.header.version));
+    }
+    if (bytes.size() != sizeof(trace.header) + trace.header.count * sizeof(key_trace_record_t)) {
+        return fail(error, "key trace holds " + std::to_string(trace.header.count) + " records, but is " + std::to_string(bytes.size()) + " bytes long");
+    }
+
+    trace.records.resize(trace.header.count);
+    std::memcpy(trace.records.data(), bytes.data() + sizeof(trace.header), trace.header.count * sizeof(key_trace_record_t));
+    return true;
+}
+
+bool KeyTrace::load(const std::string& path, KeyTrace& trace, std::string* error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return fail(error, "cannot open " + path);
+    }
+    return parse(std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()), trace, error);
+}
+
+std::vector<uint8_t> KeyTrace::serialize() const {
+    key_trace_header_t out = header;
+    out.count              = records.size();
+
+    std::vector<uint8_t> bytes(sizeof(out) + records.size() * sizeof(key_trace_record_t));
+    std::memcpy(bytes.data(), &out, sizeof(out));
+    std::memcpy(bytes.data() + sizeof(out), records.data(), records.size() * sizeof(key_trace_record_t));
+    return bytes;
+}
+
+bool KeyTrace::save(const std::string& path) const {
+    std::ofstream file(path, std::ios::binary);
+    auto          bytes = serialize();
+    file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    return static_cast<bool>(file);
+}
+
+std::ostream& operator<<(std::ostream& stream, const key_trace_record_t& record) {
+    const char* types[] = {"tick", "key", "encoder cw", "encoder ccw", "combo", "dip switch on", "dip switch off"};
+    uint8_t     type    = record.event & KEY_TRACE_TYPE_MASK;
+
+    stream << (type < sizeof(types) / sizeof(types[0]) ? types[type] : "unknown") << " (" << +record.row << ", " << +record.col << ") ";
+    stream << (record.event & KEY_TRACE_PRESSED ? "down" : "up");
+    return stream << " on layers 0x" << std::hex << record.layer_state << std::dec << ", default layer " << +record.default_layer;
+}
@@ -0,0 +1,47 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+extern "C" {
+#include "key_trace.h"
+}
+
+/**
+ * @brief A key event trace, as dumped from the recorder of a keyboard built with KEY_TRACE_ENABLE.
+ */
+struct KeyTrace {
+    key_trace_header_t              header = {};
+    std::vector<key_trace_record_t> records;
+
+    /**
+     * @brief Whether record times are in microseconds rather than milliseconds.
+     */
+    bool time_us() const;
+
+    /**
+     * @brief Milliseconds between the first record and `record`.
+     */
+    uint32_t elapsed_ms(const key_trace_record_t& record) const;
+
+    /**
+     * @brief Decodes a trace stream into `trace`.
+     *
+     * @return false if `bytes` is not a valid trace, with the reason in `error`
+     */
+    static bool parse(const std::vector<uint8_t>& bytes, KeyTrace& trace, std::string* error = nullptr);
+
+    /**
+     * @brief Reads a trace stream from a file, as saved from the raw HID dump.
+     */
+    static bool load(const std::string& path, KeyTrace& trace, std::string* error = nullptr);
+
+    std::vector<uint8_t> serialize() const;
+    bool                 save(const std::string& path) const;
+};
+
+std::ostream& operator<<(std::ostream& stream, const key_trace_record_t& record);
@@ -0,0 +1,233 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_trace_replay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include "keyboard_report_util.hpp"
+
+extern "C" {
+#include "action.h"
+#include "action_layer.h"
+#include "keyboard.h"
+#include "test_matrix.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void advance_time_us(uint32_t us);
+}
+
+using testing::_;
+using testing::Invoke;
+
+// Differences past this many are only counted
+#define KEY_TRACE_DIFF_LIMIT 5
+
+KeyTraceReportLog::KeyTraceReportLog(TestDriver& driver, uint32_t origin) {
+    // The expectation outlives the log, so it must not point back into it
+    auto sink = std::make_shared<std::vector<KeyTraceReport>>();
+    m_reports = sink;
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([sink, origin](report_keyboard_t& report) { sink->push_back({timer_read32() - origin, report}); }));
+}
+
+const std::vector<KeyTraceReport>& KeyTraceReportLog::reports() const {
+    return *m_reports;
+}
+
+KeyTrace capture_key_trace() {
+    std::vector<uint8_t> bytes(key_trace_size());
+    key_trace_read(0, bytes.data(), bytes.size());
+
+    KeyTrace    trace;
+    std::string error;
+    EXPECT_TRUE(KeyTrace::parse(bytes, trace, &error)) << error;
+    return trace;
+}
+
+static void replay_record(const key_trace_record_t& record) {
+    const bool    pressed = record.event & KEY_TRACE_PRESSED;
+    const uint8_t type    = record.event & KEY_TRACE_TYPE_MASK;
+
+    switch (type) {
+        case KEY_EVENT:
+            if (record.row >= MATRIX_ROWS || record.col >= MATRIX_COLS) {
+                ADD_FAILURE() << "key trace event outside of the test matrix: " << record;
+                break;
+            }
+            if (pressed) {
+                press_key(record.col, record.row);
+            } else {
+                release_key(record.col, record.row);
+            }
+            break;
+        case ENCODER_CW_EVENT:
+        case ENCODER_CCW_EVENT:
+        case DIP_SWITCH_ON_EVENT:
+        case DIP_SWITCH_OFF_EVENT: {
+            // These are not part of the matrix, and reach action_exec() straight from their own tasks
+            keyevent_t event = {};
+            event.key.row    = record.row;
+            event.key.col    = record.col;
+            event.time       = timer_read();
+#ifdef HIGH_RES_EVENT_TIME
+            event.time_us = timer_read_us();
+#endif
+            event.type    = static_cast<keyevent_type_t>(type);
+            event.pressed = pressed;
+            action_exec(event);
+            break;
+        }
+        default:
+            // Combo events are generated while processing the keys, they never pass through action_exec()
+            break;
+    }
+}
+
+KeyTraceReplay replay_key_trace(TestDriver& driver, const KeyTrace& trace, uint32_t settle_ms) {
+#ifdef HIGH_RES_EVENT_TIME
+    const bool build_time_us = true;
+#else
+    const bool build_time_us = false;
+#endif
+    KeyTraceReplay result;
+    if (trace.time_us() != build_time_us) {
+        ADD_FAILURE() << "key trace was recorded " << (trace.time_us() ? "with" : "without") << " HIGH_RES_EVENT_TIME, this build is not";
+        return result;
+    }
+
+    using clock = std::chrono::steady_clock;
+
+    const uint32_t scan_period = trace.time_us() ? 1000 : 1;
+    auto           advance     = [&](uint32_t units) { trace.time_us() ? advance_time_us(units) : advance_time(units); };
+
+    auto scan = [&]() {
+        auto start = clock::now();
+        keyboard_task();
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start).count();
+
+        result.scans++;
+        result.scan_ns += elapsed;
+        if (elapsed > result.max_scan_ns) {
+            result.max_scan_ns = elapsed;
+        }
+
+        housekeeping_task();
+        advance(scan_period);
+    };
+
+    // The trace may start in the middle of a session, with layers already on
+    if (!trace.records.empty()) {
+        default_layer_set((layer_state_t)1 << trace.records.front().default_layer);
+        layer_state_set(trace.records.front().layer_state);
+    }
+
+    key_trace_clear();
+    key_trace_set_enabled(true);
+    KeyTraceReportLog log(driver, timer_read32());
+
+    uint32_t now = 0;
+    for (size_t i = 0; i < trace.records.size();) {
+        const uint32_t time = trace.records[i].time - trace.records.front().time;
+        while (now + scan_period <= time) {
+            scan();
+            now += scan_period;
+        }
+        if (time > now) {
+            advance(time - now);
+            now = time;
+        }
+
+        // Everything that happened at the same time is picked up by one scan, unless a key changes twice
+        std::vector<uint16_t> changed;
+        for (; i < trace.records.size() && trace.records[i].time - trace.records.front().time == time; i++) {
+            uint16_t position = trace.records[i].row << 8 | trace.records[i].col;
+            if (std::find(changed.begin(), changed.end(), position) != changed.end()) {
+                break;
+            }
+            changed.push_back(position);
+            replay_record(trace.records[i]);
+        }
+        scan();
+        now += scan_period;
+    }
+
+    for (uint32_t i = 0; i < settle_ms; i++) {
+        scan();
+    }
+
+    result.reports = log.reports();
+    result.trace   = capture_key_trace();
+    return result;
+}
+
+// The keys and mods of a report on a single line, without the prefix the test log prints
+static std::string describe(const report_keyboard_t& report) {
+    std::ostringstream stream;
+    stream << report;
+
+    std::string text = stream.str();
+    text.erase(0, text.find_first_not_of(' ', text.find(':') + 1));
+    text.erase(text.find_last_not_of("\n ") + 1);
+    return text;
+}
+
+std::string diff_key_trace_reports(const std::vector<KeyTraceReport>& expected, const std::vector<KeyTraceReport>& actual) {
+    std::ostringstream diff;
+    unsigned           differences = 0;
+
+    for (size_t i = 0; i < std::max(expected.size(), actual.size()); i++) {
+        const bool has_expected = i < expected.size();
+        const bool has_actual   = i < actual.size();
+        if (has_expected && has_actual && expected[i].time_ms == actual[i].time_ms && expected[i].report == actual[i].report) {
+            continue;
+        }
+
+        if (differences++ < KEY_TRACE_DIFF_LIMIT) {
+            diff << "report " << i << ":";
+            if (has_expected) {
+                diff << " expected " << describe(expected[i].report) << " at " << expected[i].time_ms << "ms";
+            } else {
+                diff << " expected nothing";
+            }
+            if (has_actual) {
+                diff << ", got " << describe(actual[i].report) << " at " << actual[i].time_ms << "ms";
+            } else {
+                diff << ", got nothing";
+            }
+            diff << std::endl;
+        }
+    }
+
+    if (differences > KEY_TRACE_DIFF_LIMIT) {
+        diff << differences - KEY_TRACE_DIFF_LIMIT << " more differences" << std::endl;
+    }
+    return diff.str();
+}
+
+std::string diff_key_trace_layers(const KeyTrace& expected, const KeyTrace& actual) {
+    std::ostringstream diff;
+    unsigned           differences = 0;
+
+    if (expected.records.size() != actual.records.size()) {
+        diff << "expected " << expected.records.size() << " events, got " << actual.records.size() << std::endl;
+    }
+
+    for (size_t i = 0; i < std::min(expected.records.size(), actual.records.size()); i++) {
+        const key_trace_record_t& want = expected.records[i];
+        const key_trace_record_t& got  = actual.records[i];
+        if (expected.elapsed_ms(want) == actual.elapsed_ms(got) && want.row == got.row && want.col == got.col && want.event == got.event && want.layer_state == got.layer_state && want.default_layer == got.default_layer) {
+            continue;
+        }
+
+        if (differences++ < KEY_TRACE_DIFF_LIMIT) {
+            diff << "event " << i << ": expected " << want << " at " << expected.elapsed_ms(want) << "ms, got " << got << " at " << actual.elapsed_ms(got) << "ms" << std::endl;
+        }
+    }
+
+    if (differences > KEY_TRACE_DIFF_LIMIT) {
+        diff << differences - KEY_TRACE_DIFF_LIMIT << " more differences" << std::endl;
+    }
+    return diff.str();
+}
@@ -0,0 +1,72 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "key_trace_file.hpp"
+#include "test_driver.hpp"
+
+#ifndef KEY_TRACE_REPLAY_SETTLE_MS
+#    define KEY_TRACE_REPLAY_SETTLE_MS 1000
+#endif
+
+/**
+ * @brief A keyboard report, `time_ms` is relative to the first event of the trace.
+ */
+struct KeyTraceReport {
+    uint32_t          time_ms;
+    report_keyboard_t report;
+};
+
+/**
+ * @brief Collects the keyboard reports sent through `driver`, timed from the `origin` given by timer_read32().
+ *
+ * Takes precedence over the expectations on send_keyboard_mock() set before it, until those of `driver` are cleared.
+ */
+class KeyTraceReportLog {
+   public:
+    KeyTraceReportLog(TestDriver& driver, uint32_t origin);
+
+    const std::vector<KeyTraceReport>& reports() const;
+
+   private:
+    std::shared_ptr<std::vector<KeyTraceReport>> m_reports;
+};
+
+struct KeyTraceReplay {
+    std::vector<KeyTraceReport> reports;
+    KeyTrace                    trace; // recorded again while replaying
+    uint32_t                    scans       = 0;
+    uint64_t                    scan_ns     = 0; // host time spent in keyboard_task()
+    uint64_t                    max_scan_ns = 0;
+};
+
+/**
+ * @brief The trace held by the recorder of this build, read out the same way as over raw HID.
+ */
+KeyTrace capture_key_trace();
+
+/**
+ * @brief Feeds `trace` through the keymap of the running test, and collects the keyboard reports sent.
+ *
+ * Key events are replayed through the test matrix, scanning once every millisecond as the keyboard would, followed by
+ * `settle_ms` of idle scans. Encoder and DIP switch events go to action_exec() directly. The first event is replayed
+ * at the current time, the others keep their distance to it. The layer state and default layer are set to those seen by
+ * the first event beforehand.
+ */
+KeyTraceReplay replay_key_trace(TestDriver& driver, const KeyTrace& trace, uint32_t settle_ms = KEY_TRACE_REPLAY_SETTLE_MS);
+
+/**
+ * @brief Describes where two report sequences differ, or returns an empty string if they match.
+ */
+std::string diff_key_trace_reports(const std::vector<KeyTraceReport>& expected, const std::vector<KeyTraceReport>& actual);
+
+/**
+ * @brief Describes where the events or the layer state they were processed in differ between two traces, or returns
+ * an empty string if they match.
+ */
+std::string diff_key_trace_layers(const KeyTrace& expected, const KeyTrace& actual);
@@ -0,0 +1,305 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstring>
+#include "key_trace_replay.hpp"
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::NiceMock;
+
+class KeyTraceTest : public TestFixture {
+   protected:
+    KeymapKey mod_tap   = KeymapKey(0, 0, 0, LSFT_T(KC_P));
+    KeymapKey key_a     = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey key_b     = KeymapKey(0, 2, 0, KC_B);
+    KeymapKey layer_key = KeymapKey(0, 3, 0, MO(1));
+    KeymapKey key_x     = KeymapKey(1, 1, 0, KC_X);
+
+    void SetUp() override {
+        key_trace_clear();
+        key_trace_set_enabled(true);
+        set_keymap({mod_tap, key_a, key_b, layer_key, key_x});
+    }
+
+    // Rolls over a mod-tap, holds it, chords a combo and types on another layer
+    void type_session() {
+        mod_tap.press();
+        run_one_scan_loop();
+        idle_for(30);
+        key_a.press();
+        idle_for(20);
+        mod_tap.release();
+        idle_for(5);
+        key_a.release();
+        idle_for(TAPPING_TERM + 50);
+
+        mod_tap.press();
+        idle_for(TAPPING_TERM + 20);
+        tap_key(key_a);
+        mod_tap.release();
+        idle_for(100);
+
+        key_a.press();
+        idle_for(10);
+        key_b.press();
+        idle_for(40);
+        key_a.release();
+        key_b.release();
+        idle_for(100);
+
+        layer_key.press();
+        idle_for(15);
+        tap_key(key_a, 30);
+        layer_key.release();
+        idle_for(KEY_TRACE_REPLAY_SETTLE_MS);
+    }
+};
+
+TEST_F(KeyTraceTest, RecordsEventsWithTheirLayerState) {
+    NiceMock<TestDriver> driver;
+
+    const uint32_t start = timer_read32();
+    layer_key.press();
+    run_one_scan_loop();
+    tap_key(key_x, 10);
+    layer_key.release();
+    run_one_scan_loop();
+
+    ASSERT_EQ(key_trace_count(), 4);
+    key_trace_record_t records[4];
+    for (uint8_t i = 0; i < 4; i++) {
+        ASSERT_TRUE(key_trace_get(i, &records[i]));
+    }
+    EXPECT_FALSE(key_trace_get(4, &records[0]));
+
+    // Each event carries the layers active before it was processed
+    EXPECT_EQ(records[0].event, KEY_EVENT | KEY_TRACE_PRESSED);
+    EXPECT_EQ(records[0].col, 3);
+    EXPECT_EQ(records[0].row, 0);
+    EXPECT_EQ(records[0].layer_state, 0u);
+    EXPECT_EQ(records[0].time, start);
+
+    EXPECT_EQ(records[1].event, KEY_EVENT | KEY_TRACE_PRESSED);
+    EXPECT_EQ(records[1].col, 1);
+    EXPECT_EQ(records[1].layer_state, 1u << 1);
+    EXPECT_EQ(records[1].time, start + 1);
+
+    EXPECT_EQ(records[2].event, KEY_EVENT);
+    EXPECT_EQ(records[2].time, start + 11);
+
+    EXPECT_EQ(records[3].event, KEY_EVENT);
+    EXPECT_EQ(records[3].col, 3);
+    EXPECT_EQ(records[3].layer_state, 1u << 1);
+    EXPECT_EQ(records[3].default_layer, 0);
+}
+
+TEST_F(KeyTraceTest, KeepsTheNewestEventsOnceFull) {
+    NiceMock<TestDriver> driver;
+
+    for (int i = 0; i < KEY_TRACE_BUFFER_SIZE; i++) {
+        tap_key(key_b);
+    }
+    tap_key(key_a);
+
+    EXPECT_EQ(key_trace_count(), KEY_TRACE_BUFFER_SIZE);
+
+    KeyTrace trace = capture_key_trace();
+    EXPECT_EQ(trace.header.dropped, KEY_TRACE_BUFFER_SIZE + 2u);
+    EXPECT_EQ(trace.header.capacity, KEY_TRACE_BUFFER_SIZE);
+    ASSERT_EQ(trace.records.size(), KEY_TRACE_BUFFER_SIZE);
+    EXPECT_EQ(trace.records[KEY_TRACE_BUFFER_SIZE - 2].col, 1);
+    EXPECT_EQ(trace.records[KEY_TRACE_BUFFER_SIZE - 1].col, 1);
+    for (size_t i = 1; i < trace.records.size(); i++) {
+        EXPECT_LT(trace.records[i - 1].time, trace.records[i].time);
+    }
+
+    key_trace_clear();
+    EXPECT_EQ(key_trace_count(), 0);
+    EXPECT_EQ(capture_key_trace().header.dropped, 0u);
+}
+
+TEST_F(KeyTraceTest, ReadsTheSameStreamInAnyChunkSize) {
+    NiceMock<TestDriver> driver;
+
+    // Wraps around the end of the ring
+    for (int i = 0; i < KEY_TRACE_BUFFER_SIZE / 2 + 5; i++) {
+        tap_key(key_b);
+    }
+
+    std::vector<uint8_t> whole(key_trace_size());
+    EXPECT_EQ(key_trace_read(0, whole.data(), whole.size()), whole.size());
+    EXPECT_EQ(key_trace_read(whole.size(), whole.data(), 1), 0);
+
+    for (uint16_t chunk : {1, 5, 12, 27}) {
+        std::vector<uint8_t> pieces;
+        uint8_t              buffer[32];
+        uint16_t             read;
+        while ((read = key_trace_read(pieces.size(), buffer, chunk)) > 0) {
+            pieces.insert(pieces.end(), buffer, buffer + read);
+        }
+        EXPECT_EQ(pieces, whole) << "in chunks of " << chunk;
+    }
+
+    KeyTrace trace;
+    ASSERT_TRUE(KeyTrace::parse(whole, trace));
+    EXPECT_EQ(std::memcmp(trace.header.magic, KEY_TRACE_MAGIC, 4), 0);
+    EXPECT_EQ(trace.header.version, KEY_TRACE_VERSION);
+    EXPECT_EQ(trace.records.size(), KEY_TRACE_BUFFER_SIZE);
+}
+
+TEST_F(KeyTraceTest, DumpsOverRawHid) {
+    NiceMock<TestDriver> driver;
+    uint8_t              packet[32];
+
+    tap_keys(key_a, key_b, key_a);
+
+    auto command = [&](uint8_t id, uint8_t command, uint16_t argument) {
+        std::memset(packet, 0, sizeof(packet));
+        packet[0] = id;
+        packet[1] = command;
+        packet[2] = argument & 0xFF;
+        packet[3] = argument >> 8;
+        return key_trace_process_raw_hid(packet, sizeof(packet));
+    };
+
+    EXPECT_FALSE(command(KEY_TRACE_RAW_HID_ID + 1, key_trace_raw_hid_pause, 0));
+
+    ASSERT_TRUE(command(KEY_TRACE_RAW_HID_ID, key_trace_raw_hid_pause, 0));
+    const uint16_t size = packet[2] | packet[3] << 8;
+    EXPECT_EQ(size, sizeof(key_trace_header_t) + 6 * sizeof(key_trace_record_t));
+    EXPECT_FALSE(key_trace_is_enabled());
+
+    // Events while the host reads out the trace are not recorded
+    tap_key(key_b);
+
+    std::vector<uint8_t> dump;
+    while (dump.size() < size) {
+        ASSERT_TRUE(command(KEY_TRACE_RAW_HID_ID, key_trace_raw_hid_read, dump.size()));
+        ASSERT_GT(packet[4], 0);
+        EXPECT_LE(packet[4], sizeof(packet) - 5);
+        dump.insert(dump.end(), &packet[5], &packet[5] + packet[4]);
+    }
+    KeyTrace trace;
+    ASSERT_TRUE(KeyTrace::parse(dump, trace));
+    EXPECT_EQ(trace.serialize(), capture_key_trace().serialize());
+
+    ASSERT_TRUE(command(KEY_TRACE_RAW_HID_ID, key_trace_raw_hid_resume, 0));
+    EXPECT_TRUE(key_trace_is_enabled());
+    tap_key(key_b);
+    EXPECT_EQ(key_trace_count(), 8);
+
+    ASSERT_TRUE(command(KEY_TRACE_RAW_HID_ID, key_trace_raw_hid_clear, 0));
+    EXPECT_EQ(key_trace_count(), 0);
+
+    ASSERT_TRUE(command(KEY_TRACE_RAW_HID_ID, 0x42, 0));
+    EXPECT_EQ(packet[1], key_trace_raw_hid_unhandled);
+}
+
+TEST_F(KeyTraceTest, RejectsMalformedTraces) {
+    NiceMock<TestDriver> driver;
+    KeyTrace             trace;
+    std::string          error;
+    tap_key(key_a);
+
+    auto bytes = capture_key_trace().serialize();
+    EXPECT_TRUE(KeyTrace::parse(bytes, trace));
+
+    auto truncated = bytes;
+    truncated.pop_back();
+    EXPECT_FALSE(KeyTrace::parse(truncated, trace, &error));
+    EXPECT_EQ(error, "key trace holds 2 records, but is 39 bytes long");
+
+    auto wrong_magic = bytes;
+    wrong_magic[0]   = 'X';
+    EXPECT_FALSE(KeyTrace::parse(wrong_magic, trace, &error));
+    EXPECT_EQ(error, "not a key trace");
+
+    auto wrong_version = bytes;
+    wrong_version[4]++;
+    EXPECT_FALSE(KeyTrace::parse(wrong_version, trace, &error));
+
+    EXPECT_FALSE(KeyTrace::parse({}, trace));
+    EXPECT_FALSE(KeyTrace::load("/nonexistent/key_trace.bin", trace, &error));
+    EXPECT_EQ(error, "cannot open /nonexistent/key_trace.bin");
+}
+
+TEST_F(KeyTraceTest, ReplayReproducesTheRecordedReports) {
+    TestDriver driver;
+
+    KeyTraceReportLog live(driver, timer_read32());
+    type_session();
+    VERIFY_AND_CLEAR(driver);
+
+    KeyTrace recorded = capture_key_trace();
+    ASSERT_EQ(recorded.header.dropped, 0u);
+    ASSERT_FALSE(live.reports().empty());
+
+    // Through a file, as a dump from a keyboard would arrive
+    const std::string path = testing::TempDir() + "key_trace_replay.bin";
+    KeyTrace          loaded;
+    ASSERT_TRUE(recorded.save(path));
+    ASSERT_TRUE(KeyTrace::load(path, loaded));
+    std::remove(path.c_str());
+    EXPECT_EQ(loaded.serialize(), recorded.serialize());
+
+    KeyTraceReplay replay = replay_key_trace(driver, loaded);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(diff_key_trace_reports(live.reports(), replay.reports), "");
+    EXPECT_EQ(diff_key_trace_layers(recorded, replay.trace), "");
+    EXPECT_EQ(replay.scans, recorded.elapsed_ms(recorded.records.back()) + 1 + KEY_TRACE_REPLAY_SETTLE_MS);
+}
+
+TEST_F(KeyTraceTest, ReplayShowsWhereAKeymapChangeDiffers) {
+    TestDriver driver;
+
+    KeyTraceReportLog live(driver, timer_read32());
+    type_session();
+    VERIFY_AND_CLEAR(driver);
+    KeyTrace recorded = capture_key_trace();
+
+    // The same keys, but the mod-tap now holds control
+    set_keymap({KeymapKey(0, 0, 0, LCTL_T(KC_P)), key_a, key_b, layer_key, key_x});
+    KeyTraceReplay replay = replay_key_trace(driver, recorded);
+    VERIFY_AND_CLEAR(driver);
+
+    std::string reports = diff_key_trace_reports(live.reports(), replay.reports);
+    EXPECT_NE(reports.find("expected () [KC_LEFT_SHIFT]"), std::string::npos) << reports;
+    EXPECT_NE(reports.find("got () [KC_LEFT_CTRL]"), std::string::npos) << reports;
+    EXPECT_EQ(reports.rfind("report 4:", 0), 0u) << reports;
+    EXPECT_EQ(diff_key_trace_layers(recorded, replay.trace), "");
+}
+
+TEST_F(KeyTraceTest, ReplayStartsFromTheRecordedLayers) {
+    TestDriver driver;
+
+    // Recording starts with layers already on, e.g. from an earlier toggle
+    default_layer_set((layer_state_t)1 << 1);
+    layer_on(1);
+    key_trace_clear();
+    KeyTraceReportLog live(driver, timer_read32());
+    tap_key(key_a, 10);
+    idle_for(KEY_TRACE_REPLAY_SETTLE_MS);
+    VERIFY_AND_CLEAR(driver);
+    KeyTrace recorded = capture_key_trace();
+    ASSERT_EQ(recorded.records.front().layer_state, (layer_state_t)1 << 1);
+    ASSERT_FALSE(live.reports().empty());
+
+    default_layer_set((layer_state_t)1 << 0);
+    layer_clear();
+    KeyTraceReplay replay = replay_key_trace(driver, recorded);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(diff_key_trace_reports(live.reports(), replay.reports), "");
+    EXPECT_EQ(diff_key_trace_layers(recorded, replay.trace), "");
+    EXPECT_EQ(live.reports().front().report.keys[0], KC_X);
+
+    default_layer_set((layer_state_t)1 << 0);
+}
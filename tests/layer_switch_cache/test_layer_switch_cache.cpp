@@ -0,0 +1,136 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+/* The uncached lookup as done by layer_switch_get_layer() without LAYER_SWITCH_CACHE. */
+uint8_t reference_get_layer(keypos_t key) {
+    layer_state_t layers = layer_state | default_layer_state;
+    for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+        if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+            return i;
+        }
+    }
+    return 0;
+}
+} // namespace
+
+class LayerSwitchCache : public TestFixture {
+   protected:
+    static const uint8_t layer_count = 4;
+    static const uint8_t key_count   = 5;
+
+    /* Keys 0-4 on layers 0-3, every layer has a different mix of transparent keys. */
+    void set_transparent_keymap() {
+        const uint16_t codes[layer_count][key_count] = {
+            {KC_A, KC_B, KC_C, KC_D, KC_TRNS},
+            {KC_E, KC_TRNS, KC_F, KC_TRNS, KC_TRNS},
+            {KC_TRNS, KC_TRNS, KC_G, KC_H, KC_TRNS},
+            {KC_TRNS, KC_I, KC_TRNS, KC_TRNS, KC_TRNS},
+        };
+        for (uint8_t layer = 0; layer < layer_count; layer++) {
+            for (uint8_t col = 0; col < key_count; col++) {
+                add_key(KeymapKey(layer, col, 0, codes[layer][col]));
+            }
+        }
+    }
+};
+
+TEST_F(LayerSwitchCache, identical_to_scan_for_all_layer_states) {
+    TestDriver driver;
+    set_transparent_keymap();
+
+    for (layer_state_t default_layers = 1; default_layers < (1 << layer_count); default_layers++) {
+        default_layer_set(default_layers);
+        for (layer_state_t layers = 0; layers < (1 << layer_count); layers++) {
+            layer_state_set(layers);
+            for (uint8_t col = 0; col < key_count; col++) {
+                keypos_t key = {.col = col, .row = 0};
+                // The first lookup fills the cache, the second one is served from it.
+                EXPECT_EQ(layer_switch_get_layer(key), reference_get_layer(key)) << "layers " << +layers << " default " << +default_layers << " col " << +col;
+                EXPECT_EQ(layer_switch_get_layer(key), reference_get_layer(key)) << "layers " << +layers << " default " << +default_layers << " col " << +col;
+            }
+        }
+    }
+
+    default_layer_set(1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, direct_layer_state_write_is_detected) {
+    TestDriver driver;
+    set_transparent_keymap();
+    keypos_t key = {.col = 2, .row = 0};
+
+    layer_state_set(0);
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+
+    layer_state = (layer_state_t)1 << 2;
+    EXPECT_EQ(layer_switch_get_layer(key), 2);
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, invalidate_after_keymap_change) {
+    TestDriver driver;
+    KeymapKey  key_a(0, 0, 0, KC_A);
+    KeymapKey  key_trns(1, 0, 0, KC_TRNS);
+    set_keymap({key_a, key_trns});
+
+    layer_on(1);
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 0);
+
+    /* Replace the transparent key on layer 1, set_keymap() invalidates the cache like dynamic_keymap_set_keycode() does. */
+    KeymapKey key_b(1, 0, 0, KC_B);
+    set_keymap({key_a, key_b});
+    EXPECT_EQ(layer_switch_get_layer(key_a.position), 1);
+
+    layer_clear();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LayerSwitchCache, momentary_layer_through_transparent_keys) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_mo(0, 0, 1, MO(3));
+    KeymapKey  key_a(0, 1, 1, KC_A);
+    set_keymap({key_mo, key_a, KeymapKey(1, 0, 1, KC_TRNS), KeymapKey(1, 1, 1, KC_TRNS), KeymapKey(2, 0, 1, KC_TRNS), KeymapKey(2, 1, 1, KC_B), KeymapKey(3, 0, 1, KC_TRNS), KeymapKey(3, 1, 1, KC_TRNS)});
+    layer_on(1);
+    layer_on(2);
+
+    /* Layer 3 is transparent, so the key resolves to layer 2. */
+    key_mo.press();
+    run_one_scan_loop();
+    expect_layer_state(3);
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_a.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+
+    key_mo.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* Without layer 2 the key falls through to layer 0. */
+    layer_off(2);
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    layer_clear();
+}
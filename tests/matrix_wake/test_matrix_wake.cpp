@@ -0,0 +1,171 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "matrix_wake.h"
+}
+
+using testing::_;
+
+namespace {
+// Stand-in for the matrix driver arming its pin interrupts
+bool arm_succeeds = true;
+int  arm_count    = 0;
+int  disarm_count = 0;
+} // namespace
+
+extern "C" bool matrix_wake_arm(void) {
+    arm_count++;
+    return arm_succeeds;
+}
+
+extern "C" void matrix_wake_disarm(void) {
+    disarm_count++;
+}
+
+class MatrixWake : public TestFixture {
+   protected:
+    void SetUp() override {
+        matrix_wake_init();
+        arm_succeeds = true;
+        arm_count    = 0;
+        disarm_count = 0;
+    }
+};
+
+TEST_F(MatrixWake, GoesIdleAfterTimeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT - 1);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_ACTIVE);
+    EXPECT_EQ(arm_count, 0);
+
+    idle_for(2);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+    EXPECT_EQ(arm_count, 1);
+
+    // Staying idle does not arm again
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT * 2);
+    EXPECT_EQ(arm_count, 1);
+    EXPECT_EQ(disarm_count, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWake, HeldKeyKeepsScanning) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key.press();
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT * 2);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_ACTIVE);
+    EXPECT_EQ(arm_count, 0);
+    VERIFY_AND_CLEAR(driver);
+
+    // The timeout restarts from the release
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT - 1);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_ACTIVE);
+    idle_for(2);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWake, ScansResumeOnSignal) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT + 1);
+    ASSERT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+
+    // Without an interrupt the matrix is not looked at
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    matrix_wake_signal();
+    run_one_scan_loop();
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_ACTIVE);
+    EXPECT_EQ(disarm_count, 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWake, FailedArmRetriesAfterTimeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    arm_succeeds = false;
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT + 1);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_ACTIVE);
+    EXPECT_EQ(arm_count, 1);
+
+    arm_succeeds = true;
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT - 1);
+    EXPECT_EQ(arm_count, 1);
+    idle_for(2);
+    EXPECT_EQ(arm_count, 2);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWake, SignalBeforeIdleIsIgnored) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    matrix_wake_signal();
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT + 1);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+
+    run_one_scan_loop();
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+    EXPECT_EQ(disarm_count, 0);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(MatrixWake, TapResolvesBeforeIdle) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    set_keymap({key});
+
+    // Ticks keep running while the tap is resolved, the timeout only starts counting once the key is released
+    EXPECT_NO_REPORT(driver);
+    key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    idle_for(MATRIX_WAKE_IDLE_TIMEOUT + 1);
+    EXPECT_EQ(matrix_wake_get_state(), MATRIX_WAKE_IDLE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST(MatrixWakeLines, SharedLineIsRejected) {
+    uint32_t claimed = 0;
+
+    EXPECT_TRUE(matrix_wake_claim_line(&claimed, 3));
+    EXPECT_TRUE(matrix_wake_claim_line(&claimed, 0));
+    EXPECT_TRUE(matrix_wake_claim_line(&claimed, 31));
+
+    // e.g. A3 and B3 on STM32
+    EXPECT_FALSE(matrix_wake_claim_line(&claimed, 3));
+    EXPECT_EQ(claimed, (uint32_t)1 << 31 | 1 << 3 | 1 << 0);
+}
@@ -0,0 +1,5 @@
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+MOUSEKEY_ENABLE = yes
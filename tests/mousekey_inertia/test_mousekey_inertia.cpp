@@ -0,0 +1,203 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdlib>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "mousekey_inertia.h"
+}
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+struct FloatModel {
+    typedef float velocity_t;
+
+    static velocity_t accelerate(int8_t direction, velocity_t velocity, uint8_t time_to_max) {
+        return mousekey_inertia_accelerate_float(direction, velocity, time_to_max);
+    }
+    static void coast(velocity_t *vx, velocity_t *vy) {
+        mousekey_inertia_coast_float(vx, vy);
+    }
+    static int16_t move(int16_t base_move, velocity_t velocity, uint8_t max_speed, uint8_t time_to_max) {
+        return mousekey_inertia_move_float(base_move, velocity, max_speed, time_to_max);
+    }
+};
+
+struct FixedModel {
+    typedef int16_t velocity_t;
+
+    static velocity_t accelerate(int8_t direction, velocity_t velocity, uint8_t time_to_max) {
+        return mousekey_inertia_accelerate_fixed(direction, velocity, time_to_max);
+    }
+    static void coast(velocity_t *vx, velocity_t *vy) {
+        mousekey_inertia_coast_fixed(vx, vy);
+    }
+    static int16_t move(int16_t base_move, velocity_t velocity, uint8_t max_speed, uint8_t time_to_max) {
+        return mousekey_inertia_move_fixed(base_move, velocity, max_speed, time_to_max);
+    }
+};
+
+// The direction keys held on each frame
+struct Input {
+    int8_t  x;
+    int8_t  y;
+    uint8_t frames;
+};
+
+struct Movement {
+    int16_t x;
+    int16_t y;
+};
+
+static int16_t clamp_move(int16_t unit) {
+    return unit > MOUSEKEY_MOVE_MAX ? MOUSEKEY_MOVE_MAX : (unit < -MOUSEKEY_MOVE_MAX ? -MOUSEKEY_MOVE_MAX : unit);
+}
+
+// Replays the frames of mousekey_task() for a gesture, returning the movement of every frame
+template <typename Model>
+std::vector<Movement> trajectory(const std::vector<Input> &inputs, uint8_t max_speed, uint8_t time_to_max, uint16_t coast_frames) {
+    typename Model::velocity_t vx = 0, vy = 0;
+    std::vector<Movement>      result;
+    bool                       first = true;
+
+    std::vector<Input> frames = inputs;
+    frames.push_back({0, 0, 0});
+    for (auto &input : frames) {
+        uint16_t count = input.frames ? input.frames : coast_frames;
+        for (uint16_t i = 0; i < count; i++) {
+            if (input.x == 0 && input.y == 0) {
+                Model::coast(&vx, &vy);
+            } else {
+                vx = Model::accelerate(input.x, vx, time_to_max);
+                vy = Model::accelerate(input.y, vy, time_to_max);
+            }
+
+            int16_t base_x = input.x * MOUSEKEY_MOVE_DELTA * 2;
+            int16_t base_y = input.y * MOUSEKEY_MOVE_DELTA * 2;
+            if (first) {
+                result.push_back({base_x, base_y});
+                first = false;
+            } else {
+                result.push_back({clamp_move(Model::move(base_x, vx, max_speed, time_to_max)), clamp_move(Model::move(base_y, vy, max_speed, time_to_max))});
+            }
+        }
+    }
+    return result;
+}
+
+class MousekeyInertia : public TestFixture {
+   protected:
+    // The float and fixed point models should move the cursor the same way, give or take rounding
+    void expect_same_trajectory(const std::vector<Input> &inputs, uint8_t max_speed = MOUSEKEY_MAX_SPEED, uint8_t time_to_max = MOUSEKEY_TIME_TO_MAX) {
+        auto float_moves = trajectory<FloatModel>(inputs, max_speed, time_to_max, 300);
+        auto fixed_moves = trajectory<FixedModel>(inputs, max_speed, time_to_max, 300);
+        ASSERT_EQ(float_moves.size(), fixed_moves.size());
+
+        int32_t float_x = 0, float_y = 0, fixed_x = 0, fixed_y = 0, travel = 0;
+        for (size_t i = 0; i < float_moves.size(); i++) {
+            EXPECT_LE(abs(float_moves[i].x - fixed_moves[i].x), 1) << "frame " << i;
+            EXPECT_LE(abs(float_moves[i].y - fixed_moves[i].y), 1) << "frame " << i;
+            float_x += float_moves[i].x;
+            float_y += float_moves[i].y;
+            fixed_x += fixed_moves[i].x;
+            fixed_y += fixed_moves[i].y;
+            travel += abs(float_moves[i].x) + abs(float_moves[i].y);
+        }
+
+        // Where the cursor ends up differs by no more than 1% of the distance travelled
+        EXPECT_LE(abs(float_x - fixed_x) * 100, travel) << "float " << float_x << ", fixed " << fixed_x;
+        EXPECT_LE(abs(float_y - fixed_y) * 100, travel) << "float " << float_y << ", fixed " << fixed_y;
+
+        // Both come to a stop
+        EXPECT_EQ(float_moves.back().x, 0);
+        EXPECT_EQ(float_moves.back().y, 0);
+        EXPECT_EQ(fixed_moves.back().x, 0);
+        EXPECT_EQ(fixed_moves.back().y, 0);
+    }
+};
+
+TEST_F(MousekeyInertia, StraightLine) {
+    expect_same_trajectory({{1, 0, 60}});
+}
+
+TEST_F(MousekeyInertia, ShortTap) {
+    expect_same_trajectory({{0, -1, 5}});
+}
+
+TEST_F(MousekeyInertia, Diagonal) {
+    expect_same_trajectory({{1, 1, 20}, {-1, 1, 40}});
+}
+
+TEST_F(MousekeyInertia, Reversal) {
+    expect_same_trajectory({{1, 0, 40}, {-1, 0, 40}});
+}
+
+TEST_F(MousekeyInertia, TurnWhileMoving) {
+    // The released axis slows down while the other one is held
+    expect_same_trajectory({{1, 0, 40}, {0, 1, 40}});
+}
+
+TEST_F(MousekeyInertia, TurnWhileCoasting) {
+    expect_same_trajectory({{-1, -1, 30}, {0, 0, 10}, {0, 1, 20}});
+}
+
+TEST_F(MousekeyInertia, OtherSpeeds) {
+    expect_same_trajectory({{1, -1, 100}}, 10, 8);
+    // Beyond this the float model overflows its int8_t, where the fixed point one stays at top speed
+    expect_same_trajectory({{-1, 0, 200}}, 8, 127);
+    expect_same_trajectory({{0, 1, 200}}, 64, 127);
+}
+
+TEST_F(MousekeyInertia, FixedPointComesToRest) {
+    FixedModel::velocity_t vx = 0, vy = 0;
+    for (int i = 0; i < 100; i++) {
+        vx = FixedModel::accelerate(1, vx, MOUSEKEY_TIME_TO_MAX);
+        vy = FixedModel::accelerate(-1, vy, MOUSEKEY_TIME_TO_MAX);
+    }
+    EXPECT_EQ(vx, MOUSEKEY_TIME_TO_MAX * MOUSEKEY_INERTIA_ONE);
+    EXPECT_EQ(vy, -MOUSEKEY_TIME_TO_MAX * MOUSEKEY_INERTIA_ONE);
+
+    int frames = 0;
+    while (vx || vy) {
+        FixedModel::coast(&vx, &vy);
+        ASSERT_LT(++frames, 120);
+    }
+}
+
+TEST_F(MousekeyInertia, KeyPressMovesAndCoasts) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_MS_RIGHT);
+    set_keymap({key});
+
+    int32_t x = 0, y = 0;
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([&](report_mouse_t &report) {
+        x += report.x;
+        y += report.y;
+    }));
+
+    key.press();
+    idle_for(MOUSEKEY_DELAY + 60 * MOUSEKEY_INTERVAL);
+    int32_t held_x = x;
+    EXPECT_GT(held_x, 0);
+
+    // Keeps going for a while after release
+    key.release();
+    idle_for(10 * MOUSEKEY_INTERVAL);
+    EXPECT_GT(x, held_x);
+
+    // ...but not forever
+    idle_for(200 * MOUSEKEY_INTERVAL);
+    int32_t stopped_x = x;
+    idle_for(20 * MOUSEKEY_INTERVAL);
+    EXPECT_EQ(x, stopped_x);
+    EXPECT_EQ(y, 0);
+    testing::Mock::VerifyAndClearExpectations(&driver);
+}
@@ -0,0 +1,20 @@
+// Copyright 2022 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i lock-caps.png -f mono4`
+
+#include <qp.h>
+
+const uint32_t gfx_lock_caps_length = 108;
+
+// clang-format off
+const uint8_t gfx_lock_caps[108] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0x6C, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x10, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xE8, 0x03, 0x05, 0xFA, 0x3C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0xD0, 0x2F, 0x00, 0x00,
+    0xF4, 0x0B, 0x00, 0x00, 0xEE, 0x03, 0x00, 0xC0, 0xF7, 0x00, 0x00, 0xF0, 0x7D, 0x00, 0x00, 0x3D,
+    0x2F, 0x00, 0x40, 0x8F, 0x0B, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x6F, 0x7D,
+    0x00, 0xC0, 0x07, 0x2F, 0x00, 0xF4, 0xC1, 0x0B, 0x00, 0x00, 0x00, 0x00,
+};
+// clang-format on
@@ -0,0 +1,2265 @@
+// Copyright 2023 QMK -- generated source code only, image retains original copyright
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// This file was auto-generated by `qmk painter-convert-graphics -i splash.png -f pal256`
+
+#include <qp.h>
+
+const uint32_t gfx_splash_length = 36030;
+
+// clang-format off
+const uint8_t gfx_splash[36030] = {
+    0x00, 0xFF, 0x12, 0x00, 0x00, 0x51, 0x47, 0x46, 0x01, 0xBE, 0x8C, 0x00, 0x00, 0x41, 0x73, 0xFF,
+    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x01, 0x00, 0x01, 0xFE, 0x04, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00,
+    0x02, 0xFD, 0x06, 0x00, 0x00, 0x07, 0x00, 0x01, 0xFF, 0xE8, 0x03, 0x03, 0xFC, 0x00, 0x03, 0x00,
+    0x00, 0x00, 0xFF, 0x2A, 0xEB, 0xFF, 0x37, 0x25, 0xFF, 0x2A, 0xFF, 0xFF, 0x2C, 0xFF, 0xFF, 0x2D,
+    0xFF, 0xFF, 0x2E, 0xFF, 0xFF, 0x2F, 0xFF, 0xFF, 0x30, 0xFF, 0xFF, 0x31, 0xFF, 0xFF, 0x32, 0xFF,
+    0xFF, 0x38, 0xEE, 0xFF, 0x33, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0x35, 0xFF, 0xFF, 0x36, 0xFF, 0xFF,
+    0x37, 0xFF, 0xFF, 0x38, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x3A, 0xFF, 0xFF, 0x00, 0x02, 0xFD, 0x94,
+    0x02, 0xF7, 0xD9, 0x09, 0xF7, 0x00, 0x00, 0xE7, 0x29, 0xFF, 0xFF, 0x28, 0xFF, 0xFF, 0x27, 0xFF,
+    0xFF, 0x26, 0xFF, 0xFF, 0x00, 0x00, 0xD9, 0x23, 0x1E, 0xCB, 0x24, 0xFF, 0xFF, 0x23, 0xFF, 0xFF,
+    0x21, 0xFF, 0xFF, 0x20, 0xFF, 0xFF, 0x43, 0xEA, 0xFF, 0x3C, 0xFF, 0xFF, 0x3D, 0xFF, 0xFF, 0x3E,
+    0xFF, 0xFF, 0x3F, 0xFF, 0xFF, 0x41, 0xFF, 0xFF, 0x42, 0xFF, 0xFF, 0x43, 0xFF, 0xFF, 0x44, 0xFF,
+    0xFF, 0x45, 0xFF, 0xFF, 0x46, 0xFF, 0xFF, 0x47, 0xFF, 0xFF, 0x48, 0xFF, 0xFF, 0x49, 0xFF, 0xFF,
+    0x4A, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x4B, 0xFF, 0xFF, 0x90, 0x8B, 0xFF, 0x63, 0xF8, 0xFF, 0x4C,
+    0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4D, 0xFF, 0xFF, 0x4E, 0xFF, 0xFF, 0x4E, 0xFF, 0xFF, 0x4F, 0xFF,
+    0xFF, 0x4F, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0x50, 0xFF, 0xFF, 0x51, 0xFF, 0xFF, 0x51, 0xFF, 0xFF,
+    0x52, 0xFF, 0xFF, 0x53, 0xFF, 0xFF, 0x53, 0xFF, 0xFF, 0x54, 0xFF, 0xFF, 0x85, 0xFE, 0xFF, 0x7D,
+    0xFF, 0xFF, 0x7A, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0x76, 0xFF, 0xFF, 0x75, 0xFF, 0xFF, 0x73, 0xFF,
+    0xFF, 0x72, 0xFF, 0xFF, 0x70, 0xFF, 0xFF, 0x6F, 0xFF, 0xFF, 0x6E, 0xFF, 0xFF, 0x6C, 0xFF, 0xFF,
+    0x6B, 0xFF, 0xFF, 0x6A, 0xFF, 0xFF, 0x68, 0xFF, 0xFF, 0x67, 0xFF, 0xFF, 0x66, 0xFF, 0xFF, 0x65,
+    0xFF, 0xFF, 0x63, 0xFF, 0xFF, 0x62, 0xFF, 0xFF, 0x61, 0xFF, 0xFF, 0x60, 0xFF, 0xFF, 0x5F, 0xFF,
+    0xFF, 0x5E, 0xFF, 0xFF, 0x5D, 0xFF, 0xFF, 0x5C, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF, 0x5A, 0xFF, 0xFF,
+    0x59, 0xFF, 0xFF, 0x57, 0xFF, 0xFF, 0x56, 0xFF, 0xFF, 0x56, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x81,
+    0xFF, 0xFF, 0x83, 0xFF, 0xFF, 0x85, 0xFF, 0xFF, 0x87, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0x89, 0xFF,
+    0xFF, 0x8A, 0xFF, 0xFF, 0x1E, 0xFF, 0xFF, 0x1D, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF, 0x1C, 0xFF, 0xFF,
+    0x18, 0xE9, 0xFF, 0x1B, 0xFF, 0xFF, 0x1A, 0xFF, 0xFF, 0x19, 0xFF, 0xFF, 0x18, 0xFF, 0xFF, 0x00,
+    0x00, 0xB4, 0x00, 0x00, 0x9E, 0x17, 0xFF, 0xFF, 0x16, 0xFF, 0xFF, 0x13, 0xF4, 0xFF, 0x15, 0xFF,
+    0xFF, 0x14, 0xFF, 0xFF, 0x10, 0xF2, 0xFF, 0x13, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x11, 0xFF, 0xFF,
+    0x10, 0xFF, 0xFF, 0x00, 0x00, 0x8C, 0x8B, 0xFF, 0xFF, 0x8C, 0xFF, 0xFF, 0x8D, 0xFF, 0xFF, 0x8E,
+    0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0x90, 0xFF, 0xFF, 0x91, 0xFF, 0xFF, 0x92, 0xFF, 0xFF, 0x95, 0x44,
+    0x89, 0x93, 0xFF, 0xFF, 0x94, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x95, 0xFF, 0xFF, 0x96, 0xFF, 0xFF,
+    0x97, 0xFF, 0xFF, 0x98, 0xFF, 0xFF, 0x99, 0xFF, 0xFF, 0x0D, 0xF4, 0xFF, 0x0F, 0xFF, 0xFF, 0x0E,
+    0xFF, 0xFF, 0x0D, 0xFF, 0xFF, 0x0C, 0xFF, 0xFF, 0x0B, 0xFF, 0xFF, 0x0A, 0xFF, 0xFF, 0x0A, 0xFF,
+    0xFF, 0x09, 0xFF, 0xFF, 0x07, 0xFF, 0xFF, 0xE5, 0xFD, 0xFF, 0x05, 0xFF, 0xFF, 0x01, 0xFF, 0xFF,
+    0xC6, 0xCD, 0xB8, 0xB1, 0x27, 0x47, 0x00, 0x00, 0x33, 0x9A, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0x9C,
+    0xFF, 0xFF, 0x9D, 0xFF, 0xFF, 0x9E, 0xFF, 0xFF, 0x9F, 0xFF, 0xFF, 0xA0, 0xFF, 0xFF, 0xA1, 0xFF,
+    0xFF, 0x00, 0x00, 0x32, 0xA2, 0xFF, 0xFF, 0xA3, 0xFF, 0xFF, 0xA4, 0xFF, 0xFF, 0xA5, 0xFF, 0xFF,
+    0xAC, 0xFC, 0xFF, 0xA6, 0xFF, 0xFF, 0xA7, 0xFF, 0xFF, 0xA8, 0xFF, 0xFF, 0xA9, 0xFF, 0xFF, 0xD4,
+    0xFF, 0xFF, 0xD5, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xD6, 0xFF, 0xFF, 0xD7, 0xFF, 0xFF, 0xD8, 0xFF,
+    0xFF, 0xD8, 0xFF, 0xFF, 0xD9, 0xFF, 0xFF, 0xDA, 0xFF, 0xFF, 0xDB, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF,
+    0xDC, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xDE, 0xFF, 0xFF, 0xD4, 0xFF, 0xFF, 0xD3, 0xFF, 0xFF, 0xD2,
+    0xFF, 0xFF, 0xD1, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xD0, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xCE, 0xFF,
+    0xFF, 0xDF, 0xFF, 0xFF, 0xE1, 0xFF, 0xFF, 0xE2, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xE4, 0xFF, 0xFF,
+    0xE6, 0xFF, 0xFF, 0xE7, 0xFF, 0xFF, 0xE8, 0xFF, 0xFF, 0xEA, 0xFF, 0xFF, 0xEC, 0xFF, 0xFF, 0xED,
+    0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0xF3, 0xFF, 0xFF, 0xF8, 0xFF, 0xFF, 0xFD, 0xFF,
+    0xFF, 0xCE, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0xCB, 0xFF, 0xFF,
+    0xCB, 0xFF, 0xFF, 0xCA, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xC9, 0xFF, 0xFF, 0xC8, 0xFF, 0xFF, 0xC7,
+    0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xC5, 0xFF, 0xFF, 0xC4, 0xFF,
+    0xFF, 0xC4, 0xFF, 0xFF, 0xC3, 0xFF, 0xFF, 0xC2, 0xFF, 0xFF, 0xC1, 0xFF, 0xFF, 0xC0, 0xFF, 0xFF,
+    0xBF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 0xBB, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 0xB8,
+    0xFF, 0xFF, 0xB7, 0xFF, 0xFF, 0xB6, 0xFF, 0xFF, 0xB4, 0xFF, 0xFF, 0xB3, 0xFF, 0xFF, 0xB1, 0xFF,
+    0xFF, 0xB0, 0xFF, 0xFF, 0xAE, 0xFF, 0xFF, 0xAD, 0xFF, 0xFF, 0xAB, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF,
+    0x05, 0xFA, 0x89, 0x89, 0x00, 0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02,
+    0x96, 0x03, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x03,
+    0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x03,
+    0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x04, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x03, 0x1B, 0x03,
+    0x1A, 0x03, 0x19, 0x02, 0x18, 0x03, 0x03, 0x03, 0x04, 0x02, 0x05, 0x02, 0x06, 0x03, 0x07, 0x02,
+    0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F, 0x02, 0x10, 0x04,
+    0x11, 0x03, 0x12, 0x03, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25, 0x04, 0x26, 0x04, 0x27, 0x04,
+    0x28, 0x04, 0x29, 0x05, 0x2A, 0x05, 0x2B, 0x05, 0x2C, 0x05, 0x2D, 0x05, 0x2E, 0x08, 0x2F, 0x06,
+    0x30, 0x0A, 0x31, 0x0C, 0x32, 0x02, 0x35, 0x02, 0x32, 0x81, 0x35, 0x32, 0x02, 0x35, 0x0F, 0x32,
+    0x09, 0x31, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95,
+    0x03, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78,
+    0x03, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D,
+    0x03, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x04, 0x1B, 0x02, 0x1A, 0x03, 0x19,
+    0x03, 0x18, 0x02, 0x03, 0x03, 0x04, 0x03, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09,
+    0x03, 0x0A, 0x03, 0x0C, 0x03, 0x0D, 0x02, 0x0E, 0x03, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12,
+    0x03, 0x13, 0x03, 0x23, 0x04, 0x24, 0x03, 0x25, 0x04, 0x26, 0x04, 0x27, 0x04, 0x28, 0x04, 0x29,
+    0x04, 0x2A, 0x05, 0x2B, 0x05, 0x2C, 0x05, 0x2D, 0x05, 0x2E, 0x05, 0x2F, 0x08, 0x30, 0x06, 0x31,
+    0x07, 0x32, 0x21, 0x35, 0x08, 0x32, 0x03, 0x31, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x03, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D,
+    0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x04, 0x21, 0x03, 0x20, 0x04, 0x1F, 0x03, 0x1E,
+    0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x04, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x02, 0x06,
+    0x03, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x02, 0x0F,
+    0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25, 0x04, 0x26,
+    0x04, 0x27, 0x03, 0x28, 0x04, 0x29, 0x05, 0x2A, 0x05, 0x2B, 0x04, 0x2C, 0x04, 0x2D, 0x05, 0x2E,
+    0x05, 0x2F, 0x06, 0x30, 0x07, 0x31, 0x05, 0x32, 0x0A, 0x35, 0x02, 0x36, 0x80, 0x35, 0x16, 0x36,
+    0x0C, 0x35, 0x03, 0x32, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96,
+    0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03, 0x7A,
+    0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E,
+    0x02, 0x6D, 0x02, 0x6C, 0x04, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x03, 0x1B, 0x02, 0x1A,
+    0x03, 0x19, 0x03, 0x18, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08,
+    0x02, 0x09, 0x03, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x03, 0x0F, 0x02, 0x10, 0x03, 0x11,
+    0x03, 0x12, 0x03, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25, 0x04, 0x26, 0x03, 0x27, 0x04, 0x28,
+    0x04, 0x29, 0x04, 0x2A, 0x05, 0x2B, 0x04, 0x2C, 0x05, 0x2D, 0x03, 0x2E, 0x06, 0x2F, 0x06, 0x30,
+    0x05, 0x31, 0x04, 0x32, 0x06, 0x35, 0x80, 0x36, 0x02, 0x35, 0x06, 0x36, 0x81, 0x37, 0x36, 0x14,
+    0x37, 0x81, 0x36, 0x37, 0x0A, 0x36, 0x06, 0x35, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D,
+    0x02, 0x7B, 0x03, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x02, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F, 0x04, 0x1E,
+    0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x04, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x03, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x03, 0x0D, 0x02, 0x0E, 0x03, 0x0F,
+    0x03, 0x10, 0x03, 0x11, 0x02, 0x12, 0x03, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26,
+    0x04, 0x27, 0x04, 0x28, 0x03, 0x29, 0x05, 0x2A, 0x04, 0x2B, 0x04, 0x2C, 0x04, 0x2D, 0x04, 0x2E,
+    0x05, 0x2F, 0x05, 0x30, 0x05, 0x31, 0x04, 0x32, 0x06, 0x35, 0x07, 0x36, 0x0C, 0x37, 0x80, 0x38,
+    0x02, 0x37, 0x80, 0x38, 0x15, 0x37, 0x08, 0x36, 0x80, 0x35, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E,
+    0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x03, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x04, 0x1F,
+    0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x03, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x03, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x03, 0x0E,
+    0x02, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x02, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25,
+    0x03, 0x26, 0x04, 0x27, 0x03, 0x28, 0x04, 0x29, 0x04, 0x2A, 0x04, 0x2B, 0x04, 0x2C, 0x05, 0x2D,
+    0x03, 0x2E, 0x06, 0x2F, 0x03, 0x30, 0x05, 0x31, 0x03, 0x32, 0x06, 0x35, 0x05, 0x36, 0x09, 0x37,
+    0x09, 0x38, 0x83, 0x39, 0x38, 0x39, 0x38, 0x03, 0x39, 0x02, 0x38, 0x02, 0x39, 0x02, 0x38, 0x80,
+    0x39, 0x05, 0x38, 0x83, 0x37, 0x38, 0x37, 0x38, 0x09, 0x37, 0x02, 0x36, 0x80, 0x9B, 0x02, 0x9A,
+    0x03, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F,
+    0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x03, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73,
+    0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20,
+    0x04, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x03, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x03, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D,
+    0x03, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x03, 0x12, 0x02, 0x13, 0x04, 0x23, 0x03, 0x24,
+    0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x04, 0x28, 0x04, 0x29, 0x04, 0x2A, 0x04, 0x2B, 0x03, 0x2C,
+    0x05, 0x2D, 0x03, 0x2E, 0x05, 0x2F, 0x04, 0x30, 0x04, 0x31, 0x03, 0x32, 0x04, 0x35, 0x05, 0x36,
+    0x07, 0x37, 0x05, 0x38, 0x22, 0x39, 0x05, 0x38, 0x06, 0x37, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x03, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F,
+    0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05,
+    0x80, 0x06, 0x03, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x03, 0x0D, 0x02, 0x0E,
+    0x03, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x03, 0x12, 0x02, 0x13, 0x04, 0x23, 0x03, 0x24, 0x03, 0x25,
+    0x03, 0x26, 0x04, 0x27, 0x03, 0x28, 0x03, 0x29, 0x04, 0x2A, 0x04, 0x2B, 0x04, 0x2C, 0x03, 0x2D,
+    0x04, 0x2E, 0x04, 0x2F, 0x05, 0x30, 0x04, 0x31, 0x03, 0x32, 0x04, 0x35, 0x03, 0x36, 0x05, 0x37,
+    0x06, 0x38, 0x09, 0x39, 0x19, 0x3A, 0x0A, 0x39, 0x06, 0x38, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x02, 0x94, 0x03, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x03, 0x72,
+    0x02, 0x71, 0x80, 0x6F, 0x03, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F,
+    0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x03, 0x03, 0x02, 0x04, 0x02, 0x05,
+    0x02, 0x06, 0x03, 0x07, 0x02, 0x08, 0x80, 0x09, 0x03, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x03, 0x0E,
+    0x02, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x02, 0x12, 0x03, 0x13, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25,
+    0x03, 0x26, 0x04, 0x27, 0x03, 0x28, 0x04, 0x29, 0x03, 0x2A, 0x04, 0x2B, 0x04, 0x2C, 0x03, 0x2D,
+    0x03, 0x2E, 0x04, 0x2F, 0x04, 0x30, 0x04, 0x31, 0x02, 0x32, 0x04, 0x35, 0x04, 0x36, 0x05, 0x37,
+    0x03, 0x38, 0x07, 0x39, 0x09, 0x3A, 0x81, 0x3B, 0x3A, 0x15, 0x3B, 0x09, 0x3A, 0x08, 0x39, 0x80,
+    0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x03, 0x94, 0x80,
+    0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02,
+    0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x03,
+    0x21, 0x04, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x02,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03,
+    0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x03, 0x11, 0x02, 0x12, 0x03, 0x13, 0x03,
+    0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x04, 0x28, 0x03, 0x29, 0x04, 0x2A, 0x04,
+    0x2B, 0x03, 0x2C, 0x04, 0x2D, 0x02, 0x2E, 0x04, 0x2F, 0x05, 0x30, 0x03, 0x31, 0x02, 0x32, 0x04,
+    0x35, 0x02, 0x36, 0x06, 0x37, 0x02, 0x38, 0x05, 0x39, 0x07, 0x3A, 0x0E, 0x3B, 0x80, 0x3C, 0x17,
+    0x3B, 0x81, 0x3A, 0x3B, 0x06, 0x3A, 0x02, 0x39, 0x80, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x03, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D,
+    0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E,
+    0x03, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x03, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x03, 0x07, 0x80, 0x08, 0x03, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x02, 0x0F,
+    0x02, 0x10, 0x03, 0x11, 0x03, 0x12, 0x03, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x04, 0x26,
+    0x02, 0x27, 0x04, 0x28, 0x03, 0x29, 0x04, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x04, 0x2D, 0x03, 0x2E,
+    0x04, 0x2F, 0x03, 0x30, 0x04, 0x31, 0x02, 0x32, 0x04, 0x35, 0x02, 0x36, 0x05, 0x37, 0x80, 0x38,
+    0x06, 0x39, 0x03, 0x3A, 0x0A, 0x3B, 0x10, 0x3C, 0x80, 0x3D, 0x0E, 0x3C, 0x0A, 0x3B, 0x04, 0x3A,
+    0x80, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x03, 0x94,
+    0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03, 0x7A, 0x02, 0x78, 0x02, 0x77,
+    0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C,
+    0x04, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18,
+    0x02, 0x03, 0x03, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A,
+    0x03, 0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x03, 0x12, 0x03, 0x13,
+    0x03, 0x23, 0x03, 0x24, 0x02, 0x25, 0x03, 0x26, 0x03, 0x27, 0x04, 0x28, 0x03, 0x29, 0x03, 0x2A,
+    0x04, 0x2B, 0x03, 0x2C, 0x04, 0x2D, 0x02, 0x2E, 0x04, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x03, 0x32,
+    0x02, 0x35, 0x03, 0x36, 0x04, 0x37, 0x02, 0x38, 0x05, 0x39, 0x04, 0x3A, 0x06, 0x3B, 0x07, 0x3C,
+    0x1E, 0x3D, 0x08, 0x3C, 0x07, 0x3B, 0x80, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97,
+    0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x03, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F,
+    0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B,
+    0x02, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x80, 0x06, 0x03, 0x07,
+    0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x10,
+    0x03, 0x11, 0x03, 0x12, 0x02, 0x13, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x02, 0x27,
+    0x04, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x04, 0x2B, 0x02, 0x2C, 0x04, 0x2D, 0x03, 0x2E, 0x03, 0x2F,
+    0x04, 0x30, 0x03, 0x31, 0x80, 0x32, 0x03, 0x35, 0x03, 0x36, 0x04, 0x37, 0x80, 0x38, 0x04, 0x39,
+    0x04, 0x3A, 0x05, 0x3B, 0x06, 0x3C, 0x08, 0x3D, 0x1B, 0x3E, 0x09, 0x3D, 0x05, 0x3C, 0x02, 0x3B,
+    0x80, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03, 0x7A, 0x02, 0x78, 0x02, 0x77,
+    0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C,
+    0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x03, 0x19, 0x02, 0x18,
+    0x03, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x03, 0x0A,
+    0x02, 0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x03, 0x12, 0x02, 0x13,
+    0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x02, 0x28, 0x04, 0x29, 0x03, 0x2A,
+    0x04, 0x2B, 0x02, 0x2C, 0x04, 0x2D, 0x02, 0x2E, 0x04, 0x2F, 0x03, 0x30, 0x02, 0x31, 0x03, 0x32,
+    0x03, 0x35, 0x80, 0x36, 0x04, 0x37, 0x02, 0x38, 0x03, 0x39, 0x04, 0x3A, 0x04, 0x3B, 0x05, 0x3C,
+    0x06, 0x3D, 0x08, 0x3E, 0x18, 0x3F, 0x09, 0x3E, 0x06, 0x3D, 0x03, 0x3C, 0x80, 0x9B, 0x02, 0x9A,
+    0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x03, 0x7F,
+    0x80, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x02, 0x73,
+    0x80, 0x72, 0x03, 0x71, 0x80, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20,
+    0x04, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x03, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D,
+    0x03, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x03, 0x13, 0x03, 0x23, 0x02, 0x24,
+    0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C,
+    0x03, 0x2D, 0x03, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x03, 0x31, 0x02, 0x32, 0x02, 0x35, 0x03, 0x36,
+    0x02, 0x37, 0x02, 0x38, 0x04, 0x39, 0x02, 0x3A, 0x05, 0x3B, 0x04, 0x3C, 0x05, 0x3D, 0x04, 0x3E,
+    0x0E, 0x3F, 0x0B, 0x40, 0x83, 0x3F, 0x40, 0x3F, 0x40, 0x0C, 0x3F, 0x06, 0x3E, 0x04, 0x3D, 0x80,
+    0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02,
+    0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03,
+    0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x80, 0x06, 0x03, 0x07, 0x02, 0x08, 0x80, 0x09, 0x03, 0x0A, 0x02,
+    0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x03, 0x12, 0x02, 0x13, 0x03,
+    0x23, 0x02, 0x24, 0x03, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03,
+    0x2B, 0x03, 0x2C, 0x03, 0x2D, 0x02, 0x2E, 0x04, 0x2F, 0x03, 0x30, 0x02, 0x31, 0x02, 0x32, 0x03,
+    0x35, 0x02, 0x36, 0x03, 0x37, 0x02, 0x38, 0x02, 0x39, 0x04, 0x3A, 0x04, 0x3B, 0x02, 0x3C, 0x04,
+    0x3D, 0x05, 0x3E, 0x08, 0x3F, 0x0A, 0x40, 0x80, 0x41, 0x03, 0x40, 0x81, 0x41, 0x40, 0x05, 0x41,
+    0x0C, 0x40, 0x0A, 0x3F, 0x04, 0x3E, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x03, 0x98, 0x80, 0x97,
+    0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F,
+    0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B,
+    0x02, 0x1A, 0x03, 0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07,
+    0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x03, 0x0F, 0x02, 0x10,
+    0x03, 0x11, 0x02, 0x12, 0x02, 0x13, 0x03, 0x23, 0x03, 0x24, 0x03, 0x25, 0x02, 0x26, 0x03, 0x27,
+    0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x02, 0x2D, 0x03, 0x2E, 0x03, 0x2F,
+    0x03, 0x30, 0x03, 0x31, 0x02, 0x32, 0x02, 0x35, 0x02, 0x36, 0x03, 0x37, 0x80, 0x38, 0x03, 0x39,
+    0x03, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x04, 0x3D, 0x03, 0x3E, 0x07, 0x3F, 0x05, 0x40, 0x81, 0x41,
+    0x40, 0x1F, 0x41, 0x08, 0x40, 0x06, 0x3F, 0x81, 0x3E, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D,
+    0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F, 0x03, 0x1E,
+    0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x03, 0x04, 0x02, 0x05, 0x02, 0x06,
+    0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x02, 0x0E, 0x02, 0x0F,
+    0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x03, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26,
+    0x03, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x04, 0x2D, 0x02, 0x2E,
+    0x03, 0x2F, 0x03, 0x30, 0x02, 0x31, 0x02, 0x32, 0x02, 0x35, 0x02, 0x36, 0x03, 0x37, 0x80, 0x38,
+    0x03, 0x39, 0x02, 0x3A, 0x04, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x02, 0x3E, 0x06, 0x3F, 0x05, 0x40,
+    0x0A, 0x41, 0x19, 0x42, 0x0A, 0x41, 0x05, 0x40, 0x03, 0x3F, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x03, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F,
+    0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05,
+    0x02, 0x06, 0x03, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x03, 0x0E,
+    0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x03, 0x12, 0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25,
+    0x03, 0x26, 0x02, 0x27, 0x03, 0x28, 0x03, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x03, 0x2C, 0x02, 0x2D,
+    0x03, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x80, 0x31, 0x02, 0x32, 0x02, 0x35, 0x03, 0x36, 0x02, 0x37,
+    0x80, 0x38, 0x03, 0x39, 0x02, 0x3A, 0x03, 0x3B, 0x03, 0x3C, 0x03, 0x3D, 0x02, 0x3E, 0x05, 0x3F,
+    0x05, 0x40, 0x07, 0x41, 0x06, 0x42, 0x81, 0x43, 0x42, 0x16, 0x43, 0x08, 0x42, 0x08, 0x41, 0x04,
+    0x40, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x03, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02,
+    0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03,
+    0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02,
+    0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x03,
+    0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02,
+    0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x02,
+    0x13, 0x03, 0x23, 0x03, 0x24, 0x02, 0x25, 0x03, 0x26, 0x03, 0x27, 0x03, 0x28, 0x02, 0x29, 0x03,
+    0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x03, 0x2D, 0x03, 0x2E, 0x02, 0x2F, 0x03, 0x30, 0x02, 0x31, 0x02,
+    0x32, 0x02, 0x35, 0x02, 0x36, 0x02, 0x37, 0x02, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x03, 0x3B, 0x03,
+    0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x05, 0x3F, 0x03, 0x40, 0x06, 0x41, 0x06, 0x42, 0x25, 0x43, 0x07,
+    0x42, 0x06, 0x41, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02,
+    0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02,
+    0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02,
+    0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x04, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03,
+    0x19, 0x02, 0x18, 0x03, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02,
+    0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x03,
+    0x12, 0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x03, 0x27, 0x03, 0x28, 0x02,
+    0x29, 0x03, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x03, 0x2D, 0x02, 0x2E, 0x03, 0x2F, 0x03, 0x30, 0x02,
+    0x31, 0x80, 0x32, 0x03, 0x35, 0x80, 0x36, 0x03, 0x37, 0x80, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x03,
+    0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x03, 0x3E, 0x04, 0x3F, 0x03, 0x40, 0x05, 0x41, 0x03, 0x42, 0x81,
+    0x43, 0x42, 0x08, 0x43, 0x1B, 0x64, 0x0D, 0x43, 0x06, 0x42, 0x81, 0x41, 0x9B, 0x02, 0x9A, 0x02,
+    0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02,
+    0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02,
+    0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03,
+    0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x03, 0x03, 0x80, 0x04, 0x03,
+    0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x02,
+    0x0E, 0x02, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x02, 0x12, 0x03, 0x13, 0x02, 0x23, 0x03, 0x24, 0x02,
+    0x25, 0x03, 0x26, 0x02, 0x27, 0x03, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x03,
+    0x2D, 0x02, 0x2E, 0x03, 0x2F, 0x02, 0x30, 0x02, 0x31, 0x02, 0x32, 0x02, 0x35, 0x80, 0x36, 0x03,
+    0x37, 0x80, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x03, 0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x03, 0x3E, 0x03,
+    0x3F, 0x03, 0x40, 0x04, 0x41, 0x04, 0x42, 0x08, 0x43, 0x28, 0x64, 0x09, 0x43, 0x03, 0x42, 0x80,
+    0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80,
+    0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x03, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02,
+    0x03, 0x02, 0x04, 0x03, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02,
+    0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02,
+    0x23, 0x03, 0x24, 0x02, 0x25, 0x03, 0x26, 0x02, 0x27, 0x03, 0x28, 0x03, 0x29, 0x02, 0x2A, 0x03,
+    0x2B, 0x03, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x03, 0x2F, 0x02, 0x30, 0x02, 0x31, 0x80, 0x32, 0x03,
+    0x35, 0x80, 0x36, 0x03, 0x37, 0x03, 0x39, 0x02, 0x3A, 0x02, 0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x02,
+    0x3E, 0x03, 0x3F, 0x03, 0x40, 0x04, 0x41, 0x03, 0x42, 0x07, 0x43, 0x0C, 0x64, 0x1A, 0x63, 0x0C,
+    0x64, 0x07, 0x43, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02,
+    0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02,
+    0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x03, 0x6E, 0x80,
+    0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02,
+    0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x02,
+    0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x03, 0x10, 0x02, 0x11, 0x02,
+    0x12, 0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x03, 0x27, 0x02, 0x28, 0x03,
+    0x29, 0x03, 0x2A, 0x02, 0x2B, 0x03, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x03, 0x2F, 0x02, 0x30, 0x02,
+    0x31, 0x80, 0x32, 0x02, 0x35, 0x80, 0x36, 0x03, 0x37, 0x80, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x02,
+    0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x03, 0x3F, 0x02, 0x40, 0x04, 0x41, 0x03, 0x42, 0x06,
+    0x43, 0x08, 0x64, 0x28, 0x63, 0x0A, 0x64, 0x83, 0x43, 0x64, 0x43, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F,
+    0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x03, 0x03, 0x02, 0x04, 0x02, 0x05,
+    0x02, 0x06, 0x02, 0x07, 0x02, 0x08, 0x80, 0x09, 0x02, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x02, 0x0E,
+    0x02, 0x0F, 0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x03, 0x24, 0x02, 0x25,
+    0x03, 0x26, 0x02, 0x27, 0x03, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x03, 0x2D,
+    0x02, 0x2E, 0x03, 0x2F, 0x02, 0x30, 0x02, 0x31, 0x80, 0x32, 0x02, 0x35, 0x02, 0x36, 0x81, 0x37,
+    0x38, 0x03, 0x39, 0x80, 0x3A, 0x02, 0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x03, 0x3E, 0x02, 0x3F, 0x02,
+    0x40, 0x04, 0x41, 0x02, 0x42, 0x06, 0x43, 0x07, 0x64, 0x09, 0x63, 0x1D, 0x62, 0x0B, 0x63, 0x08,
+    0x64, 0x80, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02,
+    0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03,
+    0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02,
+    0x6C, 0x04, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02,
+    0x18, 0x03, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x03, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02,
+    0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x03, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x03, 0x12, 0x80,
+    0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x03, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03,
+    0x2A, 0x02, 0x2B, 0x03, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x03, 0x30, 0x80, 0x31, 0x02,
+    0x32, 0x02, 0x35, 0x80, 0x36, 0x02, 0x37, 0x80, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x02, 0x3B, 0x02,
+    0x3C, 0x80, 0x3D, 0x03, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x03, 0x41, 0x02, 0x42, 0x05, 0x43, 0x06,
+    0x64, 0x08, 0x63, 0x0E, 0x62, 0x82, 0x61, 0x62, 0x61, 0x02, 0x62, 0x82, 0x61, 0x62, 0x61, 0x02,
+    0x62, 0x80, 0x61, 0x10, 0x62, 0x09, 0x63, 0x04, 0x64, 0x02, 0x9B, 0x80, 0x9A, 0x02, 0x99, 0x03,
+    0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03,
+    0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02,
+    0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x04, 0x20, 0x02, 0x1F, 0x04,
+    0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x80,
+    0x06, 0x02, 0x07, 0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02,
+    0x0F, 0x02, 0x10, 0x03, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x03, 0x24, 0x02, 0x25, 0x02,
+    0x26, 0x03, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02,
+    0x2E, 0x03, 0x2F, 0x02, 0x30, 0x80, 0x31, 0x02, 0x32, 0x80, 0x35, 0x02, 0x36, 0x02, 0x37, 0x80,
+    0x38, 0x02, 0x39, 0x02, 0x3A, 0x80, 0x3B, 0x02, 0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02,
+    0x40, 0x03, 0x41, 0x02, 0x42, 0x04, 0x43, 0x07, 0x64, 0x05, 0x63, 0x0A, 0x62, 0x1D, 0x61, 0x02,
+    0x62, 0x80, 0x61, 0x09, 0x62, 0x08, 0x63, 0x80, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02,
+    0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02,
+    0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80,
+    0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x04, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02,
+    0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x03, 0x05, 0x80, 0x06, 0x02,
+    0x07, 0x02, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02,
+    0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x02,
+    0x27, 0x02, 0x28, 0x03, 0x29, 0x02, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x03,
+    0x2F, 0x02, 0x30, 0x80, 0x31, 0x02, 0x32, 0x80, 0x35, 0x02, 0x36, 0x81, 0x37, 0x38, 0x03, 0x39,
+    0x80, 0x3A, 0x02, 0x3B, 0x80, 0x3C, 0x02, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x03, 0x41,
+    0x02, 0x42, 0x04, 0x43, 0x06, 0x64, 0x05, 0x63, 0x07, 0x62, 0x29, 0x61, 0x80, 0x62, 0x02, 0x61,
+    0x08, 0x62, 0x03, 0x63, 0x80, 0x9B, 0x03, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96,
+    0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A,
+    0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x03, 0x71, 0x80, 0x6F, 0x02, 0x6E,
+    0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A,
+    0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x02, 0x08,
+    0x80, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x03, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x03, 0x10, 0x02, 0x11,
+    0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x03, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x03, 0x28,
+    0x02, 0x29, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x03, 0x2D, 0x80, 0x2E, 0x03, 0x2F, 0x02, 0x30,
+    0x80, 0x31, 0x02, 0x32, 0x81, 0x35, 0x36, 0x02, 0x37, 0x80, 0x38, 0x02, 0x39, 0x02, 0x3A, 0x02,
+    0x3B, 0x80, 0x3C, 0x02, 0x3D, 0x80, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x03, 0x41, 0x02, 0x42, 0x03,
+    0x43, 0x05, 0x64, 0x05, 0x63, 0x06, 0x62, 0x0D, 0x61, 0x17, 0x60, 0x10, 0x61, 0x08, 0x62, 0x80,
+    0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x03, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x03, 0x7E, 0x80, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02,
+    0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02,
+    0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x03, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02,
+    0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x03, 0x12, 0x80, 0x13, 0x03,
+    0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x02,
+    0x2B, 0x03, 0x2C, 0x80, 0x2D, 0x03, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x80, 0x31, 0x02, 0x32, 0x81,
+    0x35, 0x36, 0x02, 0x37, 0x80, 0x38, 0x02, 0x39, 0x80, 0x3A, 0x02, 0x3B, 0x02, 0x3C, 0x80, 0x3D,
+    0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x04, 0x43, 0x04, 0x64, 0x04, 0x63,
+    0x05, 0x62, 0x0A, 0x61, 0x26, 0x60, 0x0D, 0x61, 0x03, 0x62, 0x02, 0x9B, 0x80, 0x9A, 0x03, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F,
+    0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x80, 0x04, 0x03, 0x05,
+    0x80, 0x06, 0x03, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x03, 0x0C, 0x02, 0x0D, 0x02, 0x0E,
+    0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x02, 0x25,
+    0x02, 0x26, 0x02, 0x27, 0x03, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2D,
+    0x02, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x80, 0x31, 0x02, 0x32, 0x81, 0x35, 0x36, 0x02, 0x37, 0x81,
+    0x38, 0x39, 0x02, 0x3A, 0x02, 0x3B, 0x80, 0x3C, 0x02, 0x3D, 0x80, 0x3E, 0x02, 0x3F, 0x02, 0x40,
+    0x02, 0x41, 0x02, 0x42, 0x04, 0x43, 0x03, 0x64, 0x05, 0x63, 0x04, 0x62, 0x08, 0x61, 0x0B, 0x60,
+    0x1B, 0x5F, 0x0B, 0x60, 0x0A, 0x61, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97,
+    0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F,
+    0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B,
+    0x02, 0x1A, 0x02, 0x19, 0x03, 0x18, 0x02, 0x03, 0x80, 0x04, 0x03, 0x05, 0x80, 0x06, 0x02, 0x07,
+    0x02, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x03, 0x10,
+    0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x03, 0x26, 0x02, 0x27,
+    0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F,
+    0x02, 0x30, 0x80, 0x31, 0x02, 0x32, 0x81, 0x35, 0x36, 0x02, 0x37, 0x80, 0x38, 0x02, 0x39, 0x81,
+    0x3A, 0x3B, 0x02, 0x3C, 0x80, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x02, 0x40, 0x02, 0x41, 0x80, 0x42,
+    0x03, 0x43, 0x04, 0x64, 0x04, 0x63, 0x04, 0x62, 0x07, 0x61, 0x07, 0x60, 0x29, 0x5F, 0x09, 0x60,
+    0x06, 0x61, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95,
+    0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78,
+    0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D,
+    0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02, 0x1A, 0x02, 0x19,
+    0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09,
+    0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
+    0x02, 0x13, 0x03, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x03, 0x29,
+    0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x02, 0x31,
+    0x82, 0x32, 0x35, 0x36, 0x02, 0x37, 0x81, 0x38, 0x39, 0x02, 0x3A, 0x02, 0x3B, 0x81, 0x3C, 0x3D,
+    0x02, 0x3E, 0x80, 0x3F, 0x02, 0x40, 0x02, 0x41, 0x02, 0x42, 0x02, 0x43, 0x04, 0x64, 0x04, 0x63,
+    0x04, 0x62, 0x05, 0x61, 0x07, 0x60, 0x0B, 0x5F, 0x1A, 0x5E, 0x0D, 0x5F, 0x08, 0x60, 0x02, 0x61,
+    0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77,
+    0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x03, 0x6C,
+    0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x02, 0x18,
+    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A,
+    0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13,
+    0x02, 0x23, 0x02, 0x24, 0x03, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A,
+    0x03, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x80, 0x31, 0x02, 0x32,
+    0x81, 0x35, 0x36, 0x02, 0x37, 0x82, 0x38, 0x39, 0x3A, 0x02, 0x3B, 0x80, 0x3C, 0x02, 0x3D, 0x80,
+    0x3E, 0x02, 0x3F, 0x80, 0x40, 0x02, 0x41, 0x02, 0x42, 0x03, 0x43, 0x03, 0x64, 0x04, 0x63, 0x03,
+    0x62, 0x07, 0x61, 0x04, 0x60, 0x08, 0x5F, 0x27, 0x5E, 0x0B, 0x5F, 0x06, 0x60, 0x02, 0x9B, 0x02,
+    0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x80, 0x80, 0x02,
+    0x7F, 0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02,
+    0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03,
+    0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02,
+    0x04, 0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02,
+    0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13, 0x03, 0x23, 0x02,
+    0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x02, 0x2B, 0x02,
+    0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x02, 0x31, 0x82, 0x32, 0x35, 0x36, 0x02,
+    0x37, 0x81, 0x38, 0x39, 0x02, 0x3A, 0x82, 0x3B, 0x3C, 0x3D, 0x02, 0x3E, 0x02, 0x3F, 0x80, 0x40,
+    0x02, 0x41, 0x80, 0x42, 0x03, 0x43, 0x04, 0x64, 0x03, 0x63, 0x03, 0x62, 0x05, 0x61, 0x05, 0x60,
+    0x07, 0x5F, 0x0B, 0x5E, 0x19, 0x5D, 0x0D, 0x5E, 0x09, 0x5F, 0x02, 0x60, 0x02, 0x9B, 0x02, 0x9A,
+    0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x02, 0x80, 0x02, 0x7F,
+    0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73,
+    0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20,
+    0x03, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x80, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04,
+    0x02, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D,
+    0x02, 0x0E, 0x80, 0x0F, 0x03, 0x10, 0x80, 0x11, 0x03, 0x12, 0x80, 0x13, 0x03, 0x23, 0x80, 0x24,
+    0x03, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C,
+    0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x80, 0x30, 0x02, 0x31, 0x82, 0x32, 0x35, 0x36, 0x02, 0x37,
+    0x02, 0x39, 0x80, 0x3A, 0x02, 0x3B, 0x80, 0x3C, 0x02, 0x3D, 0x81, 0x3E, 0x3F, 0x02, 0x40, 0x80,
+    0x41, 0x02, 0x42, 0x03, 0x43, 0x03, 0x64, 0x02, 0x63, 0x04, 0x62, 0x05, 0x61, 0x04, 0x60, 0x05,
+    0x5F, 0x09, 0x5E, 0x27, 0x5D, 0x0A, 0x5E, 0x07, 0x5F, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02,
+    0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02,
+    0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02,
+    0x71, 0x80, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03,
+    0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80,
+    0x06, 0x03, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02,
+    0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02,
+    0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80,
+    0x2E, 0x02, 0x2F, 0x02, 0x30, 0x82, 0x31, 0x32, 0x35, 0x02, 0x36, 0x83, 0x37, 0x38, 0x39, 0x3A,
+    0x02, 0x3B, 0x81, 0x3C, 0x3D, 0x02, 0x3E, 0x80, 0x3F, 0x02, 0x40, 0x80, 0x41, 0x02, 0x42, 0x02,
+    0x43, 0x03, 0x64, 0x03, 0x63, 0x03, 0x62, 0x05, 0x61, 0x03, 0x60, 0x05, 0x5F, 0x07, 0x5E, 0x0D,
+    0x5D, 0x81, 0x5C, 0x5D, 0x0E, 0x5C, 0x80, 0x5D, 0x03, 0x5C, 0x0F, 0x5D, 0x0A, 0x5E, 0x03, 0x5F,
+    0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77,
+    0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C,
+    0x04, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02, 0x18,
+    0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x80, 0x09, 0x02, 0x0A,
+    0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13,
+    0x03, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A,
+    0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x81, 0x31, 0x32, 0x02,
+    0x35, 0x84, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x02, 0x3B, 0x82, 0x3C, 0x3D, 0x3E, 0x02, 0x3F, 0x80,
+    0x40, 0x02, 0x41, 0x80, 0x42, 0x02, 0x43, 0x04, 0x64, 0x02, 0x63, 0x03, 0x62, 0x04, 0x61, 0x04,
+    0x60, 0x04, 0x5F, 0x06, 0x5E, 0x0B, 0x5D, 0x21, 0x5C, 0x0D, 0x5D, 0x08, 0x5E, 0x03, 0x9B, 0x02,
+    0x9A, 0x02, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02,
+    0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80,
+    0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03,
+    0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02,
+    0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x80, 0x09, 0x02, 0x0A, 0x02, 0x0C, 0x02,
+    0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x03, 0x12, 0x80, 0x13, 0x03, 0x23, 0x02,
+    0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x03, 0x2A, 0x80, 0x2B, 0x02,
+    0x2C, 0x02, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x80, 0x30, 0x02, 0x31, 0x85, 0x32, 0x35, 0x36, 0x37,
+    0x38, 0x39, 0x02, 0x3A, 0x83, 0x3B, 0x3C, 0x3D, 0x3E, 0x02, 0x3F, 0x80, 0x40, 0x02, 0x41, 0x80,
+    0x42, 0x02, 0x43, 0x03, 0x64, 0x02, 0x63, 0x03, 0x62, 0x04, 0x61, 0x04, 0x60, 0x04, 0x5F, 0x06,
+    0x5E, 0x07, 0x5D, 0x0A, 0x5C, 0x17, 0x5B, 0x81, 0x5C, 0x5B, 0x0A, 0x5C, 0x0B, 0x5D, 0x04, 0x5E,
+    0x80, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95,
+    0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x80, 0x7A, 0x03, 0x78,
+    0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D,
+    0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19,
+    0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x80, 0x09,
+    0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
+    0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29,
+    0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x87, 0x31,
+    0x32, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x02, 0x3B, 0x82, 0x3C, 0x3D, 0x3E, 0x02, 0x3F, 0x81,
+    0x40, 0x41, 0x02, 0x42, 0x02, 0x43, 0x03, 0x64, 0x02, 0x63, 0x03, 0x62, 0x04, 0x61, 0x03, 0x60,
+    0x03, 0x5F, 0x06, 0x5E, 0x07, 0x5D, 0x05, 0x5C, 0x27, 0x5B, 0x08, 0x5C, 0x0A, 0x5D, 0x81, 0x5E,
+    0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02,
+    0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02,
+    0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02,
+    0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x02, 0x19, 0x02,
+    0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x02, 0x08, 0x80, 0x09, 0x02,
+    0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12, 0x02,
+    0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02,
+    0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x85, 0x31, 0x32,
+    0x35, 0x36, 0x37, 0x38, 0x02, 0x39, 0x02, 0x3B, 0x82, 0x3C, 0x3D, 0x3E, 0x02, 0x3F, 0x82, 0x40,
+    0x41, 0x42, 0x02, 0x43, 0x03, 0x64, 0x03, 0x63, 0x02, 0x62, 0x03, 0x61, 0x04, 0x60, 0x04, 0x5F,
+    0x04, 0x5E, 0x06, 0x5D, 0x05, 0x5C, 0x0E, 0x5B, 0x12, 0x5A, 0x10, 0x5B, 0x07, 0x5C, 0x07, 0x5D,
+    0x80, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95,
+    0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78,
+    0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D,
+    0x03, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19,
+    0x03, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09,
+    0x02, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
+    0x80, 0x13, 0x03, 0x23, 0x02, 0x24, 0x80, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29,
+    0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E, 0x02, 0x2F, 0x84, 0x30, 0x31, 0x32,
+    0x35, 0x36, 0x02, 0x37, 0x02, 0x39, 0x85, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x02, 0x40, 0x81,
+    0x41, 0x42, 0x03, 0x43, 0x02, 0x64, 0x02, 0x63, 0x03, 0x62, 0x03, 0x61, 0x03, 0x60, 0x03, 0x5F,
+    0x04, 0x5E, 0x06, 0x5D, 0x05, 0x5C, 0x09, 0x5B, 0x22, 0x5A, 0x0B, 0x5B, 0x08, 0x5C, 0x03, 0x5D,
+    0x80, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95,
+    0x03, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78,
+    0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D,
+    0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x03, 0x19,
+    0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09,
+    0x02, 0x0A, 0x80, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x02, 0x12,
+    0x80, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x02, 0x29,
+    0x02, 0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x02, 0x30, 0x80, 0x31,
+    0x02, 0x35, 0x89, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x02, 0x40, 0x81,
+    0x41, 0x42, 0x02, 0x43, 0x03, 0x64, 0x02, 0x63, 0x02, 0x62, 0x03, 0x61, 0x03, 0x60, 0x03, 0x5F,
+    0x04, 0x5E, 0x05, 0x5D, 0x04, 0x5C, 0x09, 0x5B, 0x0C, 0x5A, 0x10, 0x59, 0x0F, 0x5A, 0x0B, 0x5B,
+    0x06, 0x5C, 0x80, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96,
+    0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A,
+    0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E,
+    0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A,
+    0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08,
+    0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x80, 0x11,
+    0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x80, 0x27, 0x02, 0x28,
+    0x02, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E, 0x80, 0x2F, 0x02, 0x30,
+    0x8B, 0x31, 0x32, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x02, 0x3F, 0x81,
+    0x40, 0x41, 0x02, 0x42, 0x80, 0x43, 0x02, 0x64, 0x03, 0x63, 0x80, 0x62, 0x04, 0x61, 0x02, 0x60,
+    0x04, 0x5F, 0x03, 0x5E, 0x05, 0x5D, 0x03, 0x5C, 0x07, 0x5B, 0x08, 0x5A, 0x21, 0x59, 0x0B, 0x5A,
+    0x0A, 0x5B, 0x03, 0x5C, 0x02, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x80, 0x98, 0x02, 0x97,
+    0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F,
+    0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B,
+    0x02, 0x1A, 0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x02, 0x07,
+    0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x02, 0x0F, 0x02, 0x10,
+    0x80, 0x11, 0x02, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27,
+    0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x80, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F,
+    0x82, 0x30, 0x31, 0x32, 0x02, 0x35, 0x87, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x02,
+    0x3F, 0x82, 0x40, 0x41, 0x42, 0x02, 0x43, 0x02, 0x64, 0x02, 0x63, 0x03, 0x62, 0x02, 0x61, 0x03,
+    0x60, 0x03, 0x5F, 0x03, 0x5E, 0x04, 0x5D, 0x04, 0x5C, 0x05, 0x5B, 0x07, 0x5A, 0x2D, 0x59, 0x09,
+    0x5A, 0x08, 0x5B, 0x02, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02,
+    0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03,
+    0x7A, 0x80, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02,
+    0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x03, 0x1B, 0x02,
+    0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80,
+    0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x02,
+    0x11, 0x02, 0x12, 0x80, 0x13, 0x03, 0x23, 0x80, 0x24, 0x02, 0x25, 0x02, 0x26, 0x02, 0x27, 0x80,
+    0x28, 0x02, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E, 0x80, 0x2F, 0x02,
+    0x30, 0x84, 0x31, 0x32, 0x35, 0x36, 0x37, 0x02, 0x39, 0x02, 0x3B, 0x86, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x02, 0x43, 0x02, 0x64, 0x02, 0x63, 0x02, 0x62, 0x03, 0x61, 0x02, 0x60, 0x03,
+    0x5F, 0x03, 0x5E, 0x04, 0x5D, 0x03, 0x5C, 0x06, 0x5B, 0x05, 0x5A, 0x0C, 0x59, 0x18, 0x58, 0x11,
+    0x59, 0x07, 0x5A, 0x06, 0x5B, 0x02, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02,
+    0x97, 0x02, 0x96, 0x02, 0x95, 0x03, 0x94, 0x80, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02,
+    0x7B, 0x03, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80,
+    0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x03,
+    0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02,
+    0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02,
+    0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26, 0x80,
+    0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x80, 0x2C, 0x02, 0x2D, 0x80, 0x2E, 0x02,
+    0x2F, 0x90, 0x30, 0x31, 0x32, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x02, 0x43, 0x02, 0x64, 0x02, 0x63, 0x02, 0x62, 0x02, 0x61, 0x03, 0x60, 0x03,
+    0x5F, 0x03, 0x5E, 0x03, 0x5D, 0x04, 0x5C, 0x04, 0x5B, 0x06, 0x5A, 0x08, 0x59, 0x25, 0x58, 0x0D,
+    0x59, 0x07, 0x5A, 0x03, 0x5B, 0x02, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02,
+    0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x80, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x02,
+    0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02,
+    0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x03,
+    0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x02,
+    0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02,
+    0x10, 0x02, 0x11, 0x80, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02,
+    0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E, 0x81,
+    0x2F, 0x30, 0x02, 0x31, 0x02, 0x35, 0x8B, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F,
+    0x40, 0x41, 0x42, 0x02, 0x43, 0x02, 0x64, 0x02, 0x63, 0x02, 0x62, 0x02, 0x61, 0x02, 0x60, 0x03,
+    0x5F, 0x03, 0x5E, 0x03, 0x5D, 0x03, 0x5C, 0x05, 0x5B, 0x04, 0x5A, 0x08, 0x59, 0x0D, 0x58, 0x11,
+    0x57, 0x81, 0x58, 0x57, 0x0F, 0x58, 0x0A, 0x59, 0x07, 0x5A, 0x02, 0x9C, 0x03, 0x9B, 0x80, 0x9A,
+    0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x02, 0x80, 0x02, 0x7F,
+    0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73,
+    0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x80, 0x6C, 0x03, 0x21, 0x03, 0x20,
+    0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04,
+    0x80, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D,
+    0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x80, 0x12, 0x02, 0x13, 0x02, 0x23, 0x02, 0x24,
+    0x80, 0x25, 0x02, 0x26, 0x02, 0x27, 0x02, 0x28, 0x80, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x80, 0x2C,
+    0x02, 0x2D, 0x80, 0x2E, 0x02, 0x2F, 0x85, 0x30, 0x31, 0x32, 0x35, 0x36, 0x37, 0x02, 0x39, 0x87,
+    0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x02, 0x43, 0x02, 0x64, 0x02, 0x63, 0x80, 0x62,
+    0x03, 0x61, 0x02, 0x60, 0x02, 0x5F, 0x03, 0x5E, 0x04, 0x5D, 0x03, 0x5C, 0x03, 0x5B, 0x05, 0x5A,
+    0x06, 0x59, 0x09, 0x58, 0x21, 0x57, 0x0D, 0x58, 0x0A, 0x59, 0x03, 0x5A, 0x02, 0x9C, 0x03, 0x9B,
+    0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80,
+    0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74,
+    0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21,
+    0x03, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03,
+    0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C,
+    0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x02, 0x11, 0x80, 0x12, 0x02, 0x13, 0x02, 0x23,
+    0x80, 0x24, 0x02, 0x25, 0x02, 0x26, 0x80, 0x27, 0x02, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x80, 0x2B,
+    0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E, 0x80, 0x2F, 0x02, 0x30, 0x89, 0x32, 0x35, 0x36, 0x37, 0x38,
+    0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x02, 0x3F, 0x02, 0x41, 0x81, 0x42, 0x43, 0x02, 0x64, 0x02, 0x63,
+    0x80, 0x62, 0x03, 0x61, 0x02, 0x60, 0x02, 0x5F, 0x02, 0x5E, 0x04, 0x5D, 0x02, 0x5C, 0x04, 0x5B,
+    0x04, 0x5A, 0x06, 0x59, 0x06, 0x58, 0x0D, 0x57, 0x80, 0x56, 0x02, 0x57, 0x0B, 0x56, 0x13, 0x57,
+    0x0A, 0x58, 0x08, 0x59, 0x80, 0x5A, 0x02, 0x9C, 0x03, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D,
+    0x80, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E,
+    0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06,
+    0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F,
+    0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x02, 0x13, 0x80, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02, 0x26,
+    0x80, 0x27, 0x02, 0x28, 0x02, 0x29, 0x80, 0x2A, 0x02, 0x2B, 0x02, 0x2C, 0x81, 0x2D, 0x2E, 0x02,
+    0x2F, 0x90, 0x30, 0x31, 0x32, 0x35, 0x36, 0x37, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40,
+    0x41, 0x42, 0x43, 0x02, 0x64, 0x02, 0x63, 0x80, 0x62, 0x03, 0x61, 0x02, 0x60, 0x02, 0x5F, 0x02,
+    0x5E, 0x04, 0x5D, 0x80, 0x5C, 0x04, 0x5B, 0x04, 0x5A, 0x05, 0x59, 0x07, 0x58, 0x07, 0x57, 0x21,
+    0x56, 0x0B, 0x57, 0x09, 0x58, 0x07, 0x59, 0x03, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02,
+    0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x80,
+    0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x80, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02,
+    0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03,
+    0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80,
+    0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80,
+    0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x02,
+    0x26, 0x80, 0x27, 0x02, 0x28, 0x80, 0x29, 0x02, 0x2A, 0x02, 0x2B, 0x80, 0x2C, 0x02, 0x2D, 0x82,
+    0x2E, 0x2F, 0x30, 0x02, 0x31, 0x84, 0x35, 0x36, 0x37, 0x38, 0x39, 0x02, 0x3B, 0x86, 0x3D, 0x3E,
+    0x3F, 0x40, 0x41, 0x42, 0x43, 0x02, 0x64, 0x02, 0x63, 0x80, 0x62, 0x03, 0x61, 0x02, 0x60, 0x02,
+    0x5F, 0x02, 0x5E, 0x03, 0x5D, 0x02, 0x5C, 0x04, 0x5B, 0x03, 0x5A, 0x05, 0x59, 0x05, 0x58, 0x07,
+    0x57, 0x10, 0x56, 0x83, 0x55, 0x56, 0x55, 0x56, 0x02, 0x55, 0x02, 0x56, 0x80, 0x55, 0x11, 0x56,
+    0x0A, 0x57, 0x09, 0x58, 0x03, 0x59, 0x03, 0x9C, 0x03, 0x9B, 0x02, 0x9A, 0x80, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D,
+    0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71,
+    0x80, 0x6F, 0x03, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E,
+    0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06,
+    0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F,
+    0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x02, 0x24, 0x02, 0x25, 0x80, 0x26,
+    0x02, 0x27, 0x80, 0x28, 0x02, 0x29, 0x02, 0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x80, 0x2D, 0x02, 0x2E,
+    0x8F, 0x2F, 0x30, 0x31, 0x32, 0x35, 0x36, 0x37, 0x39, 0x3A, 0x3B, 0x3C, 0x3E, 0x3F, 0x40, 0x41,
+    0x42, 0x02, 0x43, 0x80, 0x64, 0x02, 0x63, 0x80, 0x62, 0x03, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x03,
+    0x5E, 0x02, 0x5D, 0x03, 0x5C, 0x03, 0x5B, 0x03, 0x5A, 0x04, 0x59, 0x05, 0x58, 0x06, 0x57, 0x0A,
+    0x56, 0x18, 0x55, 0x80, 0x56, 0x04, 0x55, 0x0C, 0x56, 0x08, 0x57, 0x08, 0x58, 0x80, 0x59, 0x03,
+    0x9C, 0x03, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02,
+    0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03,
+    0x77, 0x80, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x03,
+    0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x03, 0x1A, 0x80, 0x19, 0x03,
+    0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80,
+    0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80,
+    0x13, 0x02, 0x23, 0x02, 0x24, 0x80, 0x25, 0x02, 0x26, 0x02, 0x27, 0x80, 0x28, 0x02, 0x29, 0x80,
+    0x2A, 0x02, 0x2B, 0x80, 0x2C, 0x02, 0x2D, 0x81, 0x2E, 0x2F, 0x02, 0x30, 0x83, 0x31, 0x35, 0x36,
+    0x37, 0x02, 0x39, 0x86, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x02, 0x43, 0x02, 0x64, 0x81,
+    0x63, 0x62, 0x03, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x03, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x03, 0x5B,
+    0x03, 0x5A, 0x04, 0x59, 0x05, 0x58, 0x05, 0x57, 0x08, 0x56, 0x26, 0x55, 0x0B, 0x56, 0x09, 0x57,
+    0x05, 0x58, 0x04, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96,
+    0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x03, 0x7A,
+    0x02, 0x78, 0x02, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02, 0x6F, 0x02, 0x6E,
+    0x80, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x03, 0x1B, 0x80, 0x1A,
+    0x03, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08,
+    0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x02, 0x10, 0x80, 0x11,
+    0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x02, 0x24, 0x80, 0x25, 0x02, 0x26, 0x80, 0x27, 0x02, 0x28,
+    0x02, 0x29, 0x80, 0x2A, 0x02, 0x2B, 0x80, 0x2C, 0x02, 0x2D, 0x91, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+    0x35, 0x36, 0x38, 0x39, 0x3A, 0x3B, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x02, 0x64, 0x80,
+    0x63, 0x02, 0x62, 0x02, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x02, 0x5E, 0x03, 0x5D, 0x02, 0x5C, 0x03,
+    0x5B, 0x02, 0x5A, 0x04, 0x59, 0x04, 0x58, 0x05, 0x57, 0x06, 0x56, 0x0C, 0x55, 0x16, 0x54, 0x0E,
+    0x55, 0x0A, 0x56, 0x08, 0x57, 0x02, 0x58, 0x04, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02,
+    0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x80, 0x80, 0x02, 0x7F, 0x03, 0x7E, 0x02,
+    0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02,
+    0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03,
+    0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x80,
+    0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02,
+    0x0F, 0x80, 0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x02,
+    0x26, 0x80, 0x27, 0x02, 0x28, 0x80, 0x29, 0x02, 0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x81, 0x2D, 0x2E,
+    0x02, 0x2F, 0x8E, 0x30, 0x31, 0x32, 0x36, 0x37, 0x38, 0x3A, 0x3B, 0x3C, 0x3D, 0x3F, 0x40, 0x41,
+    0x42, 0x43, 0x02, 0x64, 0x80, 0x63, 0x02, 0x62, 0x02, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x02, 0x5E,
+    0x03, 0x5D, 0x80, 0x5C, 0x03, 0x5B, 0x03, 0x5A, 0x03, 0x59, 0x04, 0x58, 0x04, 0x57, 0x06, 0x56,
+    0x08, 0x55, 0x22, 0x54, 0x81, 0x55, 0x54, 0x0B, 0x55, 0x08, 0x56, 0x08, 0x57, 0x05, 0x9C, 0x02,
+    0x9B, 0x02, 0x9A, 0x02, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02,
+    0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02,
+    0x03, 0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02,
+    0x0C, 0x02, 0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x80, 0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02,
+    0x23, 0x80, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27, 0x02, 0x28, 0x80, 0x29, 0x02, 0x2A, 0x81,
+    0x2B, 0x2C, 0x02, 0x2D, 0x90, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x35, 0x36, 0x37, 0x39, 0x3A, 0x3B,
+    0x3D, 0x3E, 0x3F, 0x40, 0x42, 0x43, 0x02, 0x64, 0x80, 0x63, 0x02, 0x62, 0x02, 0x61, 0x80, 0x60,
+    0x02, 0x5F, 0x02, 0x5E, 0x03, 0x5D, 0x80, 0x5C, 0x03, 0x5B, 0x02, 0x5A, 0x04, 0x59, 0x03, 0x58,
+    0x04, 0x57, 0x05, 0x56, 0x07, 0x55, 0x0B, 0x54, 0x12, 0x53, 0x81, 0x54, 0x53, 0x0D, 0x54, 0x0B,
+    0x55, 0x07, 0x56, 0x05, 0x57, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02,
+    0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02,
+    0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02,
+    0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02,
+    0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x80,
+    0x07, 0x02, 0x08, 0x81, 0x09, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x81, 0x0F, 0x10, 0x02,
+    0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27, 0x80,
+    0x28, 0x02, 0x29, 0x80, 0x2A, 0x02, 0x2B, 0x81, 0x2C, 0x2D, 0x02, 0x2E, 0x90, 0x2F, 0x30, 0x31,
+    0x32, 0x35, 0x37, 0x38, 0x3A, 0x3B, 0x3C, 0x3D, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x64, 0x02, 0x63,
+    0x80, 0x62, 0x02, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x02, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x02, 0x5B,
+    0x03, 0x5A, 0x03, 0x59, 0x03, 0x58, 0x04, 0x57, 0x04, 0x56, 0x07, 0x55, 0x07, 0x54, 0x81, 0x53,
+    0x54, 0x20, 0x53, 0x0B, 0x54, 0x08, 0x55, 0x07, 0x56, 0x03, 0x57, 0x05, 0x9C, 0x02, 0x9B, 0x02,
+    0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02,
+    0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x80, 0x74, 0x02,
+    0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03,
+    0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x02,
+    0x04, 0x80, 0x05, 0x02, 0x06, 0x02, 0x07, 0x82, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x80,
+    0x0E, 0x02, 0x0F, 0x80, 0x10, 0x02, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02,
+    0x25, 0x80, 0x26, 0x02, 0x27, 0x80, 0x28, 0x02, 0x29, 0x80, 0x2A, 0x02, 0x2B, 0x82, 0x2C, 0x2D,
+    0x2E, 0x02, 0x2F, 0x8D, 0x30, 0x31, 0x35, 0x36, 0x37, 0x39, 0x3A, 0x3C, 0x3D, 0x3E, 0x3F, 0x41,
+    0x42, 0x43, 0x02, 0x64, 0x81, 0x63, 0x62, 0x02, 0x61, 0x02, 0x60, 0x80, 0x5F, 0x02, 0x5E, 0x02,
+    0x5D, 0x02, 0x5C, 0x02, 0x5B, 0x02, 0x5A, 0x03, 0x59, 0x04, 0x58, 0x03, 0x57, 0x04, 0x56, 0x05,
+    0x55, 0x06, 0x54, 0x0C, 0x53, 0x10, 0x52, 0x0F, 0x53, 0x09, 0x54, 0x0A, 0x55, 0x06, 0x56, 0x05,
+    0x9C, 0x03, 0x9B, 0x80, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02,
+    0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02,
+    0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02,
+    0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02,
+    0x18, 0x02, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x81, 0x08, 0x09, 0x02, 0x0A,
+    0x80, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80, 0x13,
+    0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27, 0x80, 0x28, 0x02, 0x29, 0x80, 0x2A,
+    0x02, 0x2B, 0x90, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x35, 0x37, 0x38, 0x3A, 0x3B, 0x3C,
+    0x3E, 0x3F, 0x40, 0x41, 0x02, 0x43, 0x81, 0x64, 0x63, 0x02, 0x62, 0x80, 0x61, 0x02, 0x60, 0x80,
+    0x5F, 0x02, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x02, 0x5B, 0x02, 0x5A, 0x03, 0x59, 0x03, 0x58, 0x03,
+    0x57, 0x04, 0x56, 0x04, 0x55, 0x06, 0x54, 0x08, 0x53, 0x1F, 0x52, 0x0C, 0x53, 0x08, 0x54, 0x08,
+    0x55, 0x04, 0x56, 0x80, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02,
+    0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02,
+    0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02,
+    0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02,
+    0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02,
+    0x07, 0x81, 0x08, 0x09, 0x02, 0x0A, 0x80, 0x0C, 0x02, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10,
+    0x80, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x80, 0x26, 0x02, 0x27,
+    0x81, 0x28, 0x29, 0x02, 0x2A, 0x80, 0x2B, 0x02, 0x2C, 0x91, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32,
+    0x36, 0x37, 0x39, 0x3A, 0x3B, 0x3D, 0x3E, 0x40, 0x41, 0x42, 0x43, 0x64, 0x02, 0x63, 0x80, 0x62,
+    0x02, 0x61, 0x81, 0x60, 0x5F, 0x02, 0x5E, 0x02, 0x5D, 0x80, 0x5C, 0x03, 0x5B, 0x02, 0x5A, 0x02,
+    0x59, 0x03, 0x58, 0x03, 0x57, 0x04, 0x56, 0x04, 0x55, 0x05, 0x54, 0x06, 0x53, 0x0E, 0x52, 0x0B,
+    0x51, 0x03, 0x52, 0x80, 0x51, 0x0D, 0x52, 0x09, 0x53, 0x07, 0x54, 0x08, 0x55, 0x02, 0x56, 0x80,
+    0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02,
+    0x95, 0x80, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02,
+    0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02,
+    0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02,
+    0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02,
+    0x09, 0x80, 0x0A, 0x02, 0x0C, 0x80, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02,
+    0x12, 0x80, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x81, 0x26, 0x27, 0x02, 0x28, 0x80, 0x29,
+    0x02, 0x2A, 0x81, 0x2B, 0x2C, 0x02, 0x2D, 0x8E, 0x2E, 0x2F, 0x30, 0x31, 0x35, 0x36, 0x38, 0x39,
+    0x3B, 0x3C, 0x3E, 0x3F, 0x40, 0x41, 0x43, 0x02, 0x64, 0x81, 0x63, 0x62, 0x02, 0x61, 0x80, 0x60,
+    0x02, 0x5F, 0x80, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x03, 0x59, 0x03, 0x58,
+    0x02, 0x57, 0x04, 0x56, 0x04, 0x55, 0x04, 0x54, 0x05, 0x53, 0x08, 0x52, 0x1E, 0x51, 0x0B, 0x52,
+    0x09, 0x53, 0x07, 0x54, 0x07, 0x55, 0x80, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E,
+    0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F,
+    0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05,
+    0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x80, 0x0D, 0x02, 0x0E,
+    0x80, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x81, 0x24, 0x25, 0x02,
+    0x26, 0x80, 0x27, 0x02, 0x28, 0x80, 0x29, 0x02, 0x2A, 0x84, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x02,
+    0x30, 0x8E, 0x32, 0x35, 0x37, 0x38, 0x3A, 0x3B, 0x3C, 0x3E, 0x40, 0x41, 0x42, 0x43, 0x64, 0x63,
+    0x62, 0x02, 0x61, 0x80, 0x60, 0x02, 0x5F, 0x80, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x80, 0x5B, 0x02,
+    0x5A, 0x03, 0x59, 0x03, 0x58, 0x02, 0x57, 0x03, 0x56, 0x04, 0x55, 0x04, 0x54, 0x04, 0x53, 0x06,
+    0x52, 0x2A, 0x51, 0x08, 0x52, 0x08, 0x53, 0x07, 0x54, 0x04, 0x55, 0x02, 0x9E, 0x05, 0x9C, 0x02,
+    0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80,
+    0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x80, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02,
+    0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x81, 0x07, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C,
+    0x80, 0x0D, 0x02, 0x0E, 0x80, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12, 0x80, 0x13, 0x02, 0x23,
+    0x81, 0x24, 0x25, 0x02, 0x26, 0x80, 0x27, 0x02, 0x28, 0x81, 0x29, 0x2A, 0x02, 0x2B, 0x90, 0x2C,
+    0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x36, 0x37, 0x39, 0x3A, 0x3C, 0x3D, 0x3F, 0x40, 0x42, 0x43,
+    0x02, 0x64, 0x02, 0x62, 0x80, 0x61, 0x02, 0x60, 0x81, 0x5F, 0x5E, 0x02, 0x5D, 0x02, 0x5C, 0x02,
+    0x5B, 0x80, 0x5A, 0x03, 0x59, 0x02, 0x58, 0x03, 0x57, 0x02, 0x56, 0x04, 0x55, 0x03, 0x54, 0x05,
+    0x53, 0x05, 0x52, 0x0A, 0x51, 0x17, 0x50, 0x0F, 0x51, 0x08, 0x52, 0x08, 0x53, 0x06, 0x54, 0x02,
+    0x55, 0x02, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03,
+    0x96, 0x02, 0x95, 0x02, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02,
+    0x7A, 0x80, 0x78, 0x03, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02,
+    0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02,
+    0x1A, 0x02, 0x19, 0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x82,
+    0x08, 0x09, 0x0A, 0x02, 0x0C, 0x02, 0x0D, 0x81, 0x0E, 0x0F, 0x02, 0x10, 0x80, 0x11, 0x02, 0x12,
+    0x80, 0x13, 0x02, 0x23, 0x81, 0x24, 0x25, 0x02, 0x26, 0x81, 0x27, 0x28, 0x02, 0x29, 0x80, 0x2A,
+    0x02, 0x2B, 0x93, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x35, 0x36, 0x38, 0x39, 0x3B, 0x3C, 0x3E,
+    0x3F, 0x41, 0x42, 0x43, 0x64, 0x63, 0x62, 0x02, 0x61, 0x81, 0x60, 0x5F, 0x02, 0x5E, 0x80, 0x5D,
+    0x02, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x03, 0x59, 0x02, 0x58, 0x02, 0x57, 0x03, 0x56, 0x03, 0x55,
+    0x03, 0x54, 0x04, 0x53, 0x05, 0x52, 0x08, 0x51, 0x23, 0x50, 0x0D, 0x51, 0x07, 0x52, 0x06, 0x53,
+    0x06, 0x54, 0x02, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x80, 0x9A, 0x03, 0x99, 0x02, 0x98, 0x80, 0x97,
+    0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F,
+    0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B,
+    0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07,
+    0x81, 0x08, 0x09, 0x02, 0x0A, 0x80, 0x0C, 0x02, 0x0D, 0x81, 0x0E, 0x0F, 0x02, 0x10, 0x80, 0x11,
+    0x02, 0x12, 0x80, 0x13, 0x02, 0x23, 0x81, 0x24, 0x25, 0x02, 0x26, 0x80, 0x27, 0x02, 0x28, 0x82,
+    0x29, 0x2A, 0x2B, 0x02, 0x2C, 0x91, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x35, 0x37, 0x38, 0x3A, 0x3B,
+    0x3D, 0x3F, 0x40, 0x41, 0x43, 0x64, 0x63, 0x62, 0x02, 0x61, 0x81, 0x60, 0x5F, 0x02, 0x5E, 0x02,
+    0x5D, 0x80, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x02, 0x59, 0x02, 0x58, 0x03, 0x57, 0x02, 0x56, 0x03,
+    0x55, 0x03, 0x54, 0x04, 0x53, 0x04, 0x52, 0x07, 0x51, 0x0A, 0x50, 0x81, 0x4F, 0x50, 0x10, 0x4F,
+    0x0F, 0x50, 0x0B, 0x51, 0x07, 0x52, 0x07, 0x53, 0x03, 0x54, 0x03, 0x9E, 0x05, 0x9C, 0x02, 0x9B,
+    0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x03, 0x94, 0x80, 0x80,
+    0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x80, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74,
+    0x02, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21,
+    0x03, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x03, 0x1B, 0x80, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03,
+    0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x80, 0x08, 0x02, 0x09, 0x81, 0x0A, 0x0C, 0x02,
+    0x0D, 0x80, 0x0E, 0x02, 0x0F, 0x80, 0x10, 0x02, 0x11, 0x81, 0x12, 0x13, 0x02, 0x23, 0x80, 0x24,
+    0x02, 0x25, 0x82, 0x26, 0x27, 0x28, 0x02, 0x29, 0x82, 0x2A, 0x2B, 0x2C, 0x02, 0x2D, 0x02, 0x2F,
+    0x8E, 0x30, 0x32, 0x36, 0x37, 0x39, 0x3A, 0x3C, 0x3E, 0x3F, 0x41, 0x42, 0x43, 0x64, 0x63, 0x62,
+    0x02, 0x61, 0x02, 0x5F, 0x80, 0x5E, 0x02, 0x5D, 0x80, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x02, 0x59,
+    0x02, 0x58, 0x02, 0x57, 0x03, 0x56, 0x03, 0x55, 0x03, 0x54, 0x03, 0x53, 0x03, 0x52, 0x07, 0x51,
+    0x08, 0x50, 0x1D, 0x4F, 0x81, 0x50, 0x4F, 0x0A, 0x50, 0x0B, 0x51, 0x07, 0x52, 0x05, 0x53, 0x02,
+    0x54, 0x03, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03,
+    0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02,
+    0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02,
+    0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02,
+    0x1A, 0x02, 0x19, 0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x81, 0x07, 0x08,
+    0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x80, 0x0D, 0x02, 0x0E, 0x81, 0x0F, 0x10, 0x02, 0x11, 0x81,
+    0x12, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x82, 0x26, 0x27, 0x28, 0x02, 0x29, 0x94, 0x2A,
+    0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x36, 0x38, 0x39, 0x3B, 0x3C, 0x3E, 0x40, 0x41,
+    0x43, 0x64, 0x63, 0x62, 0x02, 0x61, 0x82, 0x60, 0x5F, 0x5E, 0x02, 0x5D, 0x80, 0x5C, 0x02, 0x5B,
+    0x80, 0x5A, 0x02, 0x59, 0x02, 0x58, 0x02, 0x57, 0x02, 0x56, 0x03, 0x55, 0x03, 0x54, 0x03, 0x53,
+    0x03, 0x52, 0x05, 0x51, 0x07, 0x50, 0x0E, 0x4F, 0x05, 0x4E, 0x80, 0x4F, 0x03, 0x4E, 0x12, 0x4F,
+    0x09, 0x50, 0x0A, 0x51, 0x05, 0x52, 0x06, 0x53, 0x04, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A,
+    0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F,
+    0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73,
+    0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20,
+    0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04,
+    0x02, 0x05, 0x81, 0x06, 0x07, 0x02, 0x08, 0x81, 0x09, 0x0A, 0x02, 0x0C, 0x80, 0x0D, 0x02, 0x0E,
+    0x81, 0x0F, 0x10, 0x02, 0x11, 0x81, 0x12, 0x13, 0x02, 0x23, 0x81, 0x24, 0x25, 0x02, 0x26, 0x81,
+    0x27, 0x28, 0x02, 0x29, 0x97, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x35, 0x36, 0x38,
+    0x3A, 0x3B, 0x3D, 0x3F, 0x41, 0x42, 0x43, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F, 0x02, 0x5E, 0x81,
+    0x5D, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x02, 0x59, 0x02, 0x58, 0x02, 0x57, 0x02, 0x56, 0x03, 0x55,
+    0x02, 0x54, 0x03, 0x53, 0x03, 0x52, 0x05, 0x51, 0x05, 0x50, 0x08, 0x4F, 0x1C, 0x4E, 0x0D, 0x4F,
+    0x09, 0x50, 0x08, 0x51, 0x06, 0x52, 0x03, 0x53, 0x04, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A,
+    0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x80, 0x7F,
+    0x03, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73,
+    0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x03, 0x6C, 0x02, 0x21, 0x03, 0x20,
+    0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x80, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04,
+    0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x82, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x80, 0x0D, 0x02, 0x0E,
+    0x80, 0x0F, 0x02, 0x10, 0x82, 0x11, 0x12, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02, 0x25, 0x82, 0x26,
+    0x27, 0x28, 0x02, 0x29, 0x93, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x35, 0x37, 0x39,
+    0x3A, 0x3C, 0x3E, 0x3F, 0x41, 0x43, 0x64, 0x63, 0x62, 0x02, 0x61, 0x82, 0x60, 0x5F, 0x5E, 0x02,
+    0x5D, 0x81, 0x5C, 0x5B, 0x02, 0x5A, 0x80, 0x59, 0x02, 0x58, 0x02, 0x57, 0x02, 0x56, 0x02, 0x55,
+    0x03, 0x54, 0x02, 0x53, 0x03, 0x52, 0x04, 0x51, 0x05, 0x50, 0x06, 0x4F, 0x13, 0x4E, 0x80, 0x4D,
+    0x13, 0x4E, 0x0A, 0x4F, 0x08, 0x50, 0x08, 0x51, 0x06, 0x52, 0x80, 0x53, 0x05, 0x9E, 0x05, 0x9C,
+    0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77,
+    0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C,
+    0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18,
+    0x80, 0x03, 0x02, 0x04, 0x80, 0x05, 0x02, 0x06, 0x81, 0x07, 0x08, 0x02, 0x09, 0x81, 0x0A, 0x0C,
+    0x02, 0x0D, 0x81, 0x0E, 0x0F, 0x02, 0x10, 0x82, 0x11, 0x12, 0x13, 0x02, 0x23, 0x80, 0x24, 0x02,
+    0x25, 0x82, 0x26, 0x27, 0x28, 0x02, 0x29, 0x97, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x32,
+    0x35, 0x37, 0x39, 0x3B, 0x3C, 0x3E, 0x40, 0x42, 0x43, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F, 0x5E,
+    0x02, 0x5D, 0x81, 0x5C, 0x5B, 0x02, 0x5A, 0x02, 0x59, 0x80, 0x58, 0x02, 0x57, 0x02, 0x56, 0x02,
+    0x55, 0x02, 0x54, 0x03, 0x53, 0x02, 0x52, 0x04, 0x51, 0x04, 0x50, 0x06, 0x4F, 0x09, 0x4E, 0x19,
+    0x4D, 0x0C, 0x4E, 0x09, 0x4F, 0x08, 0x50, 0x07, 0x51, 0x05, 0x52, 0x05, 0x9E, 0x05, 0x9C, 0x02,
+    0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x80, 0x94, 0x03,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02,
+    0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x02, 0x20, 0x03, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x80, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x02,
+    0x03, 0x80, 0x04, 0x02, 0x05, 0x82, 0x06, 0x07, 0x08, 0x02, 0x09, 0x80, 0x0A, 0x02, 0x0C, 0x81,
+    0x0D, 0x0E, 0x02, 0x0F, 0x81, 0x10, 0x11, 0x02, 0x12, 0x82, 0x13, 0x23, 0x24, 0x02, 0x25, 0x82,
+    0x26, 0x27, 0x28, 0x02, 0x29, 0x8F, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x32, 0x36, 0x37,
+    0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x42, 0x02, 0x64, 0x80, 0x63, 0x02, 0x61, 0x02, 0x5F, 0x82, 0x5E,
+    0x5D, 0x5C, 0x02, 0x5B, 0x80, 0x5A, 0x02, 0x59, 0x80, 0x58, 0x02, 0x57, 0x02, 0x56, 0x02, 0x55,
+    0x02, 0x54, 0x02, 0x53, 0x03, 0x52, 0x03, 0x51, 0x04, 0x50, 0x04, 0x4F, 0x07, 0x4E, 0x25, 0x4D,
+    0x09, 0x4E, 0x09, 0x4F, 0x07, 0x50, 0x07, 0x51, 0x03, 0x52, 0x05, 0x9E, 0x06, 0x9C, 0x02, 0x9B,
+    0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80,
+    0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74,
+    0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21,
+    0x03, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02, 0x03,
+    0x80, 0x04, 0x02, 0x05, 0x80, 0x06, 0x02, 0x07, 0x82, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x80, 0x0D,
+    0x02, 0x0E, 0x82, 0x0F, 0x10, 0x11, 0x02, 0x12, 0x81, 0x13, 0x23, 0x02, 0x24, 0x83, 0x25, 0x26,
+    0x27, 0x28, 0x02, 0x29, 0x98, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x31, 0x32, 0x36, 0x38, 0x3A,
+    0x3C, 0x3D, 0x3F, 0x41, 0x43, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x02, 0x5B,
+    0x80, 0x5A, 0x02, 0x59, 0x80, 0x58, 0x02, 0x57, 0x80, 0x56, 0x03, 0x55, 0x02, 0x54, 0x02, 0x53,
+    0x02, 0x52, 0x04, 0x51, 0x03, 0x50, 0x04, 0x4F, 0x05, 0x4E, 0x0C, 0x4D, 0x11, 0x4C, 0x02, 0x4D,
+    0x80, 0x4C, 0x0C, 0x4D, 0x0A, 0x4E, 0x08, 0x4F, 0x06, 0x50, 0x06, 0x51, 0x02, 0x52, 0x06, 0x9E,
+    0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95,
+    0x03, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78,
+    0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D,
+    0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19,
+    0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0x02, 0x05, 0x83, 0x06, 0x07, 0x08, 0x09, 0x02, 0x0A, 0x80,
+    0x0C, 0x02, 0x0D, 0x82, 0x0E, 0x0F, 0x10, 0x02, 0x11, 0x82, 0x12, 0x13, 0x23, 0x02, 0x24, 0x83,
+    0x25, 0x26, 0x27, 0x28, 0x02, 0x29, 0x91, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x31, 0x32, 0x37,
+    0x39, 0x3A, 0x3C, 0x3E, 0x40, 0x42, 0x43, 0x64, 0x63, 0x02, 0x61, 0x86, 0x60, 0x5F, 0x5E, 0x5D,
+    0x5C, 0x5B, 0x5A, 0x02, 0x59, 0x80, 0x58, 0x02, 0x57, 0x02, 0x56, 0x80, 0x55, 0x02, 0x54, 0x02,
+    0x53, 0x03, 0x52, 0x03, 0x51, 0x03, 0x50, 0x03, 0x4F, 0x05, 0x4E, 0x08, 0x4D, 0x21, 0x4C, 0x0B,
+    0x4D, 0x08, 0x4E, 0x07, 0x4F, 0x06, 0x50, 0x06, 0x51, 0x06, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x02,
+    0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02,
+    0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02,
+    0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03,
+    0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80,
+    0x04, 0x02, 0x05, 0x81, 0x06, 0x07, 0x02, 0x08, 0x82, 0x09, 0x0A, 0x0C, 0x02, 0x0D, 0x81, 0x0E,
+    0x0F, 0x02, 0x10, 0x82, 0x11, 0x12, 0x13, 0x02, 0x23, 0x83, 0x24, 0x25, 0x26, 0x27, 0x02, 0x28,
+    0x99, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x31, 0x35, 0x37, 0x39, 0x3B, 0x3C, 0x3E, 0x41,
+    0x42, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 0x02, 0x5A, 0x80, 0x59, 0x02,
+    0x58, 0x81, 0x57, 0x56, 0x03, 0x55, 0x80, 0x54, 0x02, 0x53, 0x02, 0x52, 0x03, 0x51, 0x03, 0x50,
+    0x03, 0x4F, 0x04, 0x4E, 0x06, 0x4D, 0x09, 0x4C, 0x15, 0x4B, 0x0C, 0x4C, 0x0A, 0x4D, 0x07, 0x4E,
+    0x07, 0x4F, 0x06, 0x50, 0x04, 0x51, 0x07, 0x9E, 0x05, 0x9C, 0x03, 0x9B, 0x80, 0x9A, 0x03, 0x99,
+    0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x80, 0x7F, 0x03, 0x7E,
+    0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F,
+    0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x80, 0x18, 0x02, 0x03, 0x02, 0x04, 0x81, 0x05,
+    0x06, 0x02, 0x07, 0x82, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x81, 0x0D, 0x0E, 0x02, 0x0F, 0x83, 0x10,
+    0x11, 0x12, 0x13, 0x02, 0x23, 0x83, 0x24, 0x25, 0x26, 0x27, 0x02, 0x28, 0x93, 0x29, 0x2A, 0x2B,
+    0x2C, 0x2D, 0x2F, 0x30, 0x31, 0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x43, 0x64, 0x63, 0x62,
+    0x61, 0x02, 0x5F, 0x02, 0x5D, 0x83, 0x5C, 0x5B, 0x5A, 0x59, 0x02, 0x58, 0x80, 0x57, 0x02, 0x56,
+    0x80, 0x55, 0x02, 0x54, 0x02, 0x53, 0x02, 0x52, 0x02, 0x51, 0x03, 0x50, 0x03, 0x4F, 0x04, 0x4E,
+    0x05, 0x4D, 0x05, 0x4C, 0x22, 0x4B, 0x09, 0x4C, 0x0A, 0x4D, 0x07, 0x4E, 0x06, 0x4F, 0x06, 0x50,
+    0x02, 0x51, 0x08, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97,
+    0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02, 0x6F,
+    0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B,
+    0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x82, 0x06, 0x07, 0x08,
+    0x02, 0x09, 0x82, 0x0A, 0x0C, 0x0D, 0x02, 0x0E, 0x82, 0x0F, 0x10, 0x11, 0x02, 0x12, 0x84, 0x13,
+    0x23, 0x24, 0x25, 0x26, 0x02, 0x27, 0x9A, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2F, 0x30, 0x31,
+    0x35, 0x37, 0x39, 0x3B, 0x3D, 0x3F, 0x41, 0x43, 0x64, 0x62, 0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C,
+    0x5B, 0x5A, 0x02, 0x59, 0x81, 0x58, 0x57, 0x02, 0x56, 0x80, 0x55, 0x02, 0x54, 0x02, 0x53, 0x80,
+    0x52, 0x03, 0x51, 0x02, 0x50, 0x03, 0x4F, 0x03, 0x4E, 0x05, 0x4D, 0x04, 0x4C, 0x0C, 0x4B, 0x11,
+    0x4A, 0x0E, 0x4B, 0x08, 0x4C, 0x08, 0x4D, 0x07, 0x4E, 0x06, 0x4F, 0x06, 0x50, 0x80, 0x9F, 0x07,
+    0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02,
+    0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02,
+    0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02,
+    0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02,
+    0x19, 0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0x81, 0x05, 0x06, 0x02, 0x07, 0x82, 0x08, 0x09, 0x0A,
+    0x02, 0x0C, 0x83, 0x0D, 0x0E, 0x0F, 0x10, 0x02, 0x11, 0x83, 0x12, 0x13, 0x23, 0x24, 0x02, 0x25,
+    0x97, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2F, 0x30, 0x31, 0x35, 0x37, 0x3A, 0x3B,
+    0x3E, 0x40, 0x42, 0x64, 0x63, 0x62, 0x61, 0x60, 0x5F, 0x02, 0x5D, 0x80, 0x5B, 0x02, 0x5A, 0x81,
+    0x59, 0x58, 0x02, 0x57, 0x81, 0x56, 0x55, 0x02, 0x54, 0x02, 0x53, 0x80, 0x52, 0x03, 0x51, 0x02,
+    0x50, 0x03, 0x4F, 0x02, 0x4E, 0x05, 0x4D, 0x04, 0x4C, 0x07, 0x4B, 0x1E, 0x4A, 0x0C, 0x4B, 0x06,
+    0x4C, 0x08, 0x4D, 0x07, 0x4E, 0x06, 0x4F, 0x04, 0x50, 0x80, 0x9F, 0x08, 0x9E, 0x05, 0x9C, 0x02,
+    0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x03, 0x7D, 0x80, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x03, 0x77, 0x80,
+    0x74, 0x02, 0x73, 0x02, 0x72, 0x80, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03,
+    0x21, 0x02, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02,
+    0x03, 0x80, 0x04, 0x02, 0x05, 0x84, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x81, 0x0D, 0x0E,
+    0x02, 0x0F, 0x84, 0x10, 0x11, 0x12, 0x13, 0x23, 0x02, 0x24, 0x9E, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2A, 0x2B, 0x2C, 0x2D, 0x2F, 0x30, 0x31, 0x35, 0x37, 0x3A, 0x3C, 0x3E, 0x40, 0x42, 0x64, 0x63,
+    0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5C, 0x5B, 0x5A, 0x59, 0x58, 0x02, 0x57, 0x80, 0x56, 0x02, 0x55,
+    0x80, 0x54, 0x02, 0x53, 0x80, 0x52, 0x02, 0x51, 0x03, 0x50, 0x02, 0x4F, 0x03, 0x4E, 0x03, 0x4D,
+    0x04, 0x4C, 0x06, 0x4B, 0x0C, 0x4A, 0x06, 0x49, 0x80, 0x4A, 0x04, 0x49, 0x10, 0x4A, 0x0A, 0x4B,
+    0x06, 0x4C, 0x08, 0x4D, 0x06, 0x4E, 0x06, 0x4F, 0x02, 0x50, 0x02, 0x9F, 0x07, 0x9E, 0x05, 0x9C,
+    0x02, 0x9B, 0x03, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x80, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77,
+    0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C,
+    0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x02, 0x18,
+    0x80, 0x03, 0x02, 0x04, 0x83, 0x05, 0x06, 0x07, 0x08, 0x02, 0x09, 0x81, 0x0A, 0x0C, 0x02, 0x0D,
+    0x85, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x02, 0x23, 0x9C, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29,
+    0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x30, 0x32, 0x35, 0x38, 0x3A, 0x3C, 0x3F, 0x41, 0x43, 0x64, 0x62,
+    0x61, 0x60, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x02, 0x59, 0x82, 0x58, 0x57, 0x56, 0x02, 0x55, 0x80,
+    0x54, 0x02, 0x53, 0x80, 0x52, 0x02, 0x51, 0x02, 0x50, 0x02, 0x4F, 0x03, 0x4E, 0x03, 0x4D, 0x03,
+    0x4C, 0x05, 0x4B, 0x08, 0x4A, 0x1A, 0x49, 0x0C, 0x4A, 0x09, 0x4B, 0x06, 0x4C, 0x07, 0x4D, 0x07,
+    0x4E, 0x05, 0x4F, 0x80, 0x50, 0x03, 0x9F, 0x07, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02,
+    0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x80, 0x80, 0x03, 0x7F, 0x02,
+    0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02,
+    0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03,
+    0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02, 0x03, 0x81, 0x04, 0x05,
+    0x02, 0x06, 0x83, 0x07, 0x08, 0x09, 0x0A, 0x02, 0x0C, 0x83, 0x0D, 0x0E, 0x0F, 0x10, 0x02, 0x11,
+    0xA3, 0x12, 0x13, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x30,
+    0x32, 0x36, 0x38, 0x3A, 0x3D, 0x3F, 0x41, 0x43, 0x64, 0x62, 0x61, 0x60, 0x5E, 0x5D, 0x5C, 0x5B,
+    0x5A, 0x59, 0x58, 0x57, 0x56, 0x02, 0x55, 0x81, 0x54, 0x53, 0x02, 0x52, 0x02, 0x51, 0x02, 0x50,
+    0x02, 0x4F, 0x02, 0x4E, 0x03, 0x4D, 0x03, 0x4C, 0x04, 0x4B, 0x06, 0x4A, 0x0D, 0x49, 0x80, 0x48,
+    0x05, 0x49, 0x80, 0x48, 0x11, 0x49, 0x0A, 0x4A, 0x08, 0x4B, 0x06, 0x4C, 0x07, 0x4D, 0x05, 0x4E,
+    0x05, 0x4F, 0x03, 0x9F, 0x07, 0x9E, 0x05, 0x9C, 0x03, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98,
+    0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D,
+    0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71,
+    0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x03, 0x1E,
+    0x80, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x80, 0x18, 0x02, 0x03, 0x02, 0x04, 0x83, 0x05, 0x06, 0x07,
+    0x08, 0x02, 0x09, 0x83, 0x0A, 0x0C, 0x0D, 0x0E, 0x02, 0x0F, 0xA1, 0x10, 0x11, 0x12, 0x13, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x30, 0x32, 0x36, 0x38, 0x3B,
+    0x3D, 0x3F, 0x42, 0x43, 0x63, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x59, 0x02, 0x58, 0x83,
+    0x57, 0x56, 0x55, 0x54, 0x02, 0x53, 0x80, 0x52, 0x02, 0x51, 0x80, 0x50, 0x02, 0x4F, 0x03, 0x4E,
+    0x02, 0x4D, 0x03, 0x4C, 0x04, 0x4B, 0x04, 0x4A, 0x09, 0x49, 0x17, 0x48, 0x0D, 0x49, 0x09, 0x4A,
+    0x07, 0x4B, 0x06, 0x4C, 0x07, 0x4D, 0x05, 0x4E, 0x03, 0x4F, 0x04, 0x9F, 0x07, 0x9E, 0x05, 0x9C,
+    0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94,
+    0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77,
+    0x02, 0x74, 0x80, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x02, 0x6D, 0x02, 0x6C,
+    0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18,
+    0x02, 0x03, 0x80, 0x04, 0x02, 0x05, 0x02, 0x07, 0x83, 0x08, 0x09, 0x0A, 0x0C, 0x02, 0x0D, 0x85,
+    0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x02, 0x23, 0xA0, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2B,
+    0x2C, 0x2D, 0x2E, 0x30, 0x32, 0x36, 0x39, 0x3B, 0x3D, 0x40, 0x42, 0x64, 0x63, 0x61, 0x60, 0x5F,
+    0x5D, 0x5C, 0x5B, 0x5A, 0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x02, 0x53, 0x80, 0x52, 0x02, 0x51,
+    0x80, 0x50, 0x02, 0x4F, 0x02, 0x4E, 0x03, 0x4D, 0x02, 0x4C, 0x03, 0x4B, 0x04, 0x4A, 0x07, 0x49,
+    0x22, 0x48, 0x0A, 0x49, 0x08, 0x4A, 0x08, 0x4B, 0x05, 0x4C, 0x07, 0x4D, 0x05, 0x4E, 0x80, 0x4F,
+    0x04, 0x9F, 0x08, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97,
+    0x03, 0x96, 0x80, 0x95, 0x02, 0x94, 0x02, 0x80, 0x03, 0x7F, 0x80, 0x7E, 0x03, 0x7D, 0x02, 0x7B,
+    0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x80, 0x74, 0x02, 0x73, 0x02, 0x72, 0x02, 0x71, 0x80, 0x6F,
+    0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x02, 0x1F, 0x03, 0x1E, 0x02, 0x1B,
+    0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x81, 0x03, 0x04, 0x02, 0x05, 0x82, 0x06, 0x07, 0x08, 0x02,
+    0x09, 0x85, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x02, 0x11, 0xA0, 0x12, 0x13, 0x23, 0x24, 0x25,
+    0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2D, 0x2E, 0x30, 0x32, 0x36, 0x38, 0x3B, 0x3D, 0x40, 0x42,
+    0x64, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x5C, 0x5A, 0x59, 0x58, 0x57, 0x56, 0x02, 0x55, 0x82, 0x54,
+    0x53, 0x52, 0x02, 0x51, 0x80, 0x50, 0x02, 0x4F, 0x02, 0x4E, 0x02, 0x4D, 0x02, 0x4C, 0x03, 0x4B,
+    0x04, 0x4A, 0x04, 0x49, 0x08, 0x48, 0x17, 0x47, 0x0C, 0x48, 0x09, 0x49, 0x08, 0x4A, 0x07, 0x4B,
+    0x05, 0x4C, 0x06, 0x4D, 0x05, 0x4E, 0x05, 0x9F, 0x07, 0x9E, 0x05, 0x9C, 0x03, 0x9B, 0x02, 0x9A,
+    0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F,
+    0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x03, 0x78, 0x02, 0x77, 0x80, 0x74, 0x02, 0x73,
+    0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20,
+    0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x80, 0x18, 0x02, 0x03, 0x80, 0x04,
+    0x02, 0x05, 0x85, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x02, 0x0D, 0xA8, 0x0E, 0x0F, 0x10, 0x11,
+    0x12, 0x13, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2D, 0x2E, 0x30, 0x31, 0x36,
+    0x39, 0x3B, 0x3E, 0x40, 0x43, 0x64, 0x62, 0x61, 0x5F, 0x5E, 0x5D, 0x5B, 0x5A, 0x59, 0x58, 0x57,
+    0x56, 0x55, 0x54, 0x53, 0x52, 0x02, 0x51, 0x80, 0x50, 0x02, 0x4F, 0x80, 0x4E, 0x03, 0x4D, 0x80,
+    0x4C, 0x03, 0x4B, 0x03, 0x4A, 0x05, 0x49, 0x06, 0x48, 0x21, 0x47, 0x0A, 0x48, 0x07, 0x49, 0x08,
+    0x4A, 0x07, 0x4B, 0x05, 0x4C, 0x06, 0x4D, 0x03, 0x4E, 0x05, 0x9F, 0x08, 0x9E, 0x05, 0x9C, 0x02,
+    0x9B, 0x02, 0x9A, 0x03, 0x99, 0x80, 0x98, 0x02, 0x97, 0x03, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02,
+    0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02,
+    0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E, 0x02, 0x6D, 0x02, 0x6C, 0x02,
+    0x21, 0x02, 0x20, 0x03, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02,
+    0x03, 0x82, 0x04, 0x05, 0x06, 0x02, 0x07, 0x87, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10,
+    0x02, 0x11, 0xA2, 0x13, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2E, 0x2F,
+    0x31, 0x36, 0x39, 0x3B, 0x3E, 0x41, 0x43, 0x64, 0x62, 0x60, 0x5F, 0x5D, 0x5C, 0x5B, 0x59, 0x58,
+    0x57, 0x56, 0x55, 0x54, 0x53, 0x52, 0x02, 0x51, 0x80, 0x50, 0x02, 0x4F, 0x80, 0x4E, 0x02, 0x4D,
+    0x02, 0x4C, 0x02, 0x4B, 0x03, 0x4A, 0x04, 0x49, 0x04, 0x48, 0x0E, 0x47, 0x81, 0x46, 0x47, 0x06,
+    0x46, 0x81, 0x47, 0x46, 0x12, 0x47, 0x09, 0x48, 0x07, 0x49, 0x07, 0x4A, 0x07, 0x4B, 0x04, 0x4C,
+    0x06, 0x4D, 0x02, 0x4E, 0x06, 0x9F, 0x07, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99,
+    0x02, 0x98, 0x02, 0x97, 0x03, 0x96, 0x80, 0x95, 0x03, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E,
+    0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73, 0x02, 0x72,
+    0x02, 0x71, 0x80, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20, 0x03, 0x1F,
+    0x02, 0x1E, 0x02, 0x1B, 0x80, 0x1A, 0x02, 0x19, 0x02, 0x18, 0x81, 0x03, 0x04, 0x02, 0x05, 0x85,
+    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x02, 0x0D, 0xA1, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x23,
+    0x24, 0x25, 0x26, 0x27, 0x29, 0x2A, 0x2B, 0x2C, 0x2E, 0x2F, 0x31, 0x36, 0x39, 0x3B, 0x3E, 0x41,
+    0x43, 0x63, 0x61, 0x60, 0x5E, 0x5D, 0x5B, 0x5A, 0x59, 0x58, 0x57, 0x02, 0x55, 0x80, 0x53, 0x02,
+    0x52, 0x81, 0x51, 0x50, 0x02, 0x4F, 0x80, 0x4E, 0x02, 0x4D, 0x02, 0x4C, 0x02, 0x4B, 0x02, 0x4A,
+    0x03, 0x49, 0x04, 0x48, 0x08, 0x47, 0x19, 0x46, 0x0F, 0x47, 0x08, 0x48, 0x08, 0x49, 0x06, 0x4A,
+    0x06, 0x4B, 0x05, 0x4C, 0x06, 0x4D, 0x07, 0x9F, 0x07, 0x9E, 0x05, 0x9C, 0x03, 0x9B, 0x02, 0x9A,
+    0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x03, 0x94, 0x80, 0x80, 0x02, 0x7F,
+    0x02, 0x7E, 0x02, 0x7D, 0x03, 0x7B, 0x02, 0x7A, 0x02, 0x78, 0x02, 0x77, 0x02, 0x74, 0x80, 0x73,
+    0x02, 0x72, 0x80, 0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x03, 0x21, 0x02, 0x20,
+    0x02, 0x1F, 0x03, 0x1E, 0x80, 0x1B, 0x02, 0x1A, 0x02, 0x19, 0x80, 0x18, 0x02, 0x03, 0x80, 0x04,
+    0x02, 0x05, 0x02, 0x07, 0xAD, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13,
+    0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2B, 0x2C, 0x2D, 0x2F, 0x31, 0x35, 0x39, 0x3B, 0x3E,
+    0x41, 0x43, 0x63, 0x61, 0x5F, 0x5E, 0x5D, 0x5B, 0x59, 0x58, 0x57, 0x56, 0x55, 0x54, 0x53, 0x52,
+    0x51, 0x50, 0x4F, 0x02, 0x4E, 0x02, 0x4D, 0x80, 0x4C, 0x02, 0x4B, 0x02, 0x4A, 0x03, 0x49, 0x04,
+    0x48, 0x06, 0x47, 0x23, 0x46, 0x0C, 0x47, 0x08, 0x48, 0x06, 0x49, 0x07, 0x4A, 0x07, 0x4B, 0x04,
+    0x4C, 0x04, 0x4D, 0x08, 0x9F, 0x07, 0x9E, 0x05, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x03, 0x99, 0x02,
+    0x98, 0x02, 0x97, 0x02, 0x96, 0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02,
+    0x7D, 0x02, 0x7B, 0x03, 0x7A, 0x80, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02,
+    0x71, 0x02, 0x6F, 0x02, 0x6E, 0x80, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x02,
+    0x1E, 0x02, 0x1B, 0x02, 0x1A, 0x80, 0x19, 0x02, 0x18, 0x02, 0x03, 0x86, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0A, 0x02, 0x0C, 0xA7, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x23, 0x24, 0x25,
+    0x27, 0x28, 0x29, 0x2A, 0x2C, 0x2D, 0x2F, 0x31, 0x35, 0x38, 0x3B, 0x3E, 0x41, 0x64, 0x63, 0x61,
+    0x5F, 0x5D, 0x5C, 0x5A, 0x59, 0x58, 0x57, 0x55, 0x54, 0x53, 0x52, 0x51, 0x50, 0x4F, 0x02, 0x4E,
+    0x80, 0x4D, 0x02, 0x4C, 0x02, 0x4B, 0x02, 0x4A, 0x02, 0x49, 0x03, 0x48, 0x06, 0x47, 0x2B, 0x46,
+    0x0A, 0x47, 0x07, 0x48, 0x06, 0x49, 0x07, 0x4A, 0x06, 0x4B, 0x04, 0x4C, 0x03, 0x4D, 0x08, 0x9F,
+    0x07, 0x9E, 0x06, 0x9C, 0x02, 0x9B, 0x02, 0x9A, 0x02, 0x99, 0x02, 0x98, 0x02, 0x97, 0x03, 0x96,
+    0x02, 0x95, 0x02, 0x94, 0x02, 0x80, 0x02, 0x7F, 0x02, 0x7E, 0x02, 0x7D, 0x02, 0x7B, 0x02, 0x7A,
+    0x02, 0x78, 0x03, 0x77, 0x80, 0x74, 0x02, 0x73, 0x80, 0x72, 0x02, 0x71, 0x02, 0x6F, 0x80, 0x6E,
+    0x02, 0x6D, 0x02, 0x6C, 0x02, 0x21, 0x03, 0x20, 0x02, 0x1F, 0x02, 0x1E, 0x02, 0x1B, 0x02, 0x1A,
+    0x80, 0x19, 0x02, 0x18, 0x80, 0x03, 0x02, 0x04, 0xAC, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C,
+    0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x23, 0x24, 0x25, 0x26, 0x27, 0x29, 0x2A, 0x2B, 0x2D,
+    0x2F, 0x30, 0x35, 0x38, 0x3B, 0x3F, 0x41, 0x64, 0x62, 0x61, 0x5F, 0x5D, 0x5B, 0x5A, 0x59, 0x57,
+    0x56, 0x55, 0x54, 0x52, 0x51, 0x50, 0x02, 0x4F, 0x81, 0x4E, 0x4D, 0x02, 0x4C, 0x80, 0x4B, 0x02,
+    0x4A, 0x02, 0x49, 0x03, 0x48, 0x05, 0x47, 0x09, 0x46, 0x16, 0x45, 0x11, 0x46, 0x0B, 0x47, 0x06,
+    0x48, 0x07, 0x49, 0x06, 0x4A, 0x05, 0x4B, 0x05, 0x4C, 0x81, 0x4D, 0xDA, 0x08, 0x9F, 0x07, 0x9E,
+    0x05, 0x9C, 0x83, 0x9B, 0x70, 0x1C, 0x16, 0x52, 0x14, 0x1B, 0x15, 0x51, 0x14, 0x82, 0x15, 0x17,
+    0x33, 0x07, 0x49, 0x05, 0x4A, 0x06, 0x4B, 0x04, 0x4C, 0x80, 0xDA, 0x08, 0x9F, 0x08, 0x9E, 0x04,
+    0x9C, 0x81, 0x1D, 0x14, 0x7F, 0x00, 0x44, 0x00, 0x81, 0x1C, 0x48, 0x06, 0x49, 0x06, 0x4A, 0x05,
+    0x4B, 0x03, 0x4C, 0x02, 0xDA, 0x08, 0x9F, 0x08, 0x9E, 0x02, 0x9C, 0x81, 0x70, 0x14, 0x7F, 0x00,
+    0x46, 0x00, 0x80, 0x33, 0x02, 0x48, 0x06, 0x49, 0x06, 0x4A, 0x05, 0x4B, 0x80, 0x4C, 0x03, 0xDA,
+    0x08, 0x9F, 0x07, 0x9E, 0x02, 0x9C, 0x80, 0x17, 0x7F, 0x00, 0x47, 0x00, 0x80, 0x17, 0x04, 0x48,
+    0x06, 0x49, 0x05, 0x4A, 0x05, 0x4B, 0x03, 0xDA, 0x09, 0x9F, 0x07, 0x9E, 0x81, 0x9C, 0x14, 0x7F,
+    0x00, 0x47, 0x00, 0x80, 0x14, 0x05, 0x48, 0x06, 0x49, 0x06, 0x4A, 0x03, 0x4B, 0x04, 0xDA, 0x09,
+    0x9F, 0x07, 0x9E, 0x7F, 0x00, 0x49, 0x00, 0x80, 0x47, 0x06, 0x48, 0x06, 0x49, 0x05, 0x4A, 0x02,
+    0x4B, 0x05, 0xDA, 0x08, 0x9F, 0x07, 0x9E, 0x7F, 0x00, 0x49, 0x00, 0x03, 0x47, 0x06, 0x48, 0x05,
+    0x49, 0x05, 0x4A, 0x80, 0x4B, 0x06, 0xDA, 0x08, 0x9F, 0x06, 0x9E, 0x7F, 0x00, 0x49, 0x00, 0x05,
+    0x47, 0x05, 0x48, 0x05, 0x49, 0x05, 0x4A, 0x07, 0xDA, 0x08, 0x9F, 0x05, 0x9E, 0x7F, 0x00, 0x49,
+    0x00, 0x06, 0x47, 0x05, 0x48, 0x06, 0x49, 0x03, 0x4A, 0x07, 0xDA, 0x09, 0x9F, 0x04, 0x9E, 0x7F,
+    0x00, 0x49, 0x00, 0x80, 0x46, 0x07, 0x47, 0x05, 0x48, 0x05, 0x49, 0x02, 0x4A, 0x08, 0xDA, 0x09,
+    0x9F, 0x03, 0x9E, 0x7F, 0x00, 0x49, 0x00, 0x02, 0x46, 0x07, 0x47, 0x05, 0x48, 0x05, 0x49, 0x80,
+    0x4A, 0x09, 0xDA, 0x09, 0x9F, 0x02, 0x9E, 0x11, 0x00, 0x8E, 0x75, 0x76, 0x15, 0x00, 0x1C, 0x76,
+    0x17, 0x00, 0x17, 0x76, 0x1C, 0x00, 0x14, 0x76, 0x75, 0x02, 0x00, 0x82, 0x1D, 0x76, 0x15, 0x7F,
+    0x00, 0x24, 0x00, 0x03, 0x46, 0x07, 0x47, 0x05, 0x48, 0x05, 0x49, 0x0A, 0xDA, 0x09, 0x9F, 0x80,
+    0x9E, 0x11, 0x00, 0x93, 0x76, 0x81, 0x16, 0x00, 0x1D, 0x81, 0x1C, 0x00, 0x1C, 0x81, 0x75, 0x00,
+    0x15, 0x81, 0x76, 0x14, 0x00, 0x76, 0x81, 0x17, 0x4B, 0x00, 0x82, 0x15, 0x75, 0x16, 0x05, 0x00,
+    0x82, 0x16, 0x76, 0x15, 0x4D, 0x00, 0x05, 0x46, 0x07, 0x47, 0x05, 0x48, 0x03, 0x49, 0x0B, 0xDA,
+    0x09, 0x9F, 0x11, 0x00, 0x93, 0x76, 0x81, 0x16, 0x00, 0x1D, 0x81, 0x1C, 0x00, 0x1C, 0x81, 0x75,
+    0x00, 0x15, 0x81, 0x76, 0x14, 0x00, 0x76, 0x81, 0x17, 0x11, 0x00, 0x80, 0x1C, 0x02, 0x8A, 0x02,
+    0x81, 0x81, 0x1D, 0x14, 0x33, 0x00, 0x82, 0x17, 0xA2, 0x17, 0x05, 0x00, 0x82, 0x17, 0xAB, 0x17,
+    0x4D, 0x00, 0x07, 0x46, 0x06, 0x47, 0x05, 0x48, 0x02, 0x49, 0x0C, 0xDA, 0x08, 0x9F, 0x0F, 0x00,
+    0x8E, 0x14, 0x15, 0x76, 0x81, 0x17, 0x15, 0x75, 0x81, 0x1C, 0x15, 0x1C, 0x81, 0x75, 0x15, 0x17,
+    0x02, 0x81, 0x02, 0x15, 0x83, 0x76, 0x81, 0x17, 0x14, 0x10, 0x00, 0x81, 0x75, 0xA1, 0x02, 0x1C,
+    0x82, 0x75, 0xA1, 0x76, 0x33, 0x00, 0x82, 0x17, 0xA2, 0x17, 0x05, 0x00, 0x82, 0x17, 0xAB, 0x17,
+    0x4D, 0x00, 0x08, 0x46, 0x06, 0x47, 0x05, 0x48, 0x81, 0x49, 0xD9, 0x0C, 0xDA, 0x07, 0x9F, 0x0D,
+    0x00, 0x82, 0x15, 0x76, 0xA1, 0x15, 0xAB, 0x82, 0xA2, 0x81, 0x1C, 0x0E, 0x00, 0x82, 0x75, 0xA1,
+    0x14, 0x02, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x03, 0x00, 0x82, 0x14, 0x15, 0x14, 0x13, 0x00, 0x81,
+    0x15, 0x14, 0x07, 0x00, 0x80, 0x15, 0x04, 0x00, 0x81, 0x14, 0x15, 0x06, 0x00, 0x85, 0x14, 0x15,
+    0x00, 0x17, 0xA2, 0x17, 0x05, 0x00, 0x85, 0x17, 0xAB, 0x17, 0x00, 0x15, 0x14, 0x4A, 0x00, 0x80,
+    0x45, 0x08, 0x46, 0x07, 0x47, 0x04, 0x48, 0x02, 0xD9, 0x0C, 0xDA, 0x06, 0x9F, 0x0C, 0x00, 0x81,
+    0x15, 0x8A, 0x19, 0xA2, 0x81, 0xA1, 0x1C, 0x0D, 0x00, 0x82, 0x75, 0xA1, 0x14, 0x02, 0x00, 0x85,
+    0x1C, 0xA2, 0x1C, 0x00, 0x15, 0x76, 0x03, 0xA1, 0x84, 0x75, 0x14, 0x00, 0x75, 0x81, 0x03, 0x00,
+    0x81, 0x76, 0x81, 0x03, 0x00, 0x81, 0x75, 0x81, 0x02, 0x00, 0x81, 0x1C, 0x8A, 0x02, 0xA1, 0x81,
+    0x75, 0x14, 0x02, 0x00, 0x87, 0x81, 0x1C, 0x76, 0xA1, 0x75, 0x00, 0x15, 0x76, 0x02, 0xA1, 0x81,
+    0x8A, 0x17, 0x03, 0x00, 0x86, 0x1C, 0x8A, 0xA1, 0x8A, 0x1D, 0xA2, 0x17, 0x05, 0x00, 0x83, 0x17,
+    0xAB, 0x1C, 0x81, 0x02, 0xA1, 0x84, 0x1D, 0x00, 0x15, 0xA1, 0x1C, 0x03, 0x00, 0x82, 0x1C, 0xA1,
+    0x15, 0x3F, 0x00, 0x02, 0x45, 0x08, 0x46, 0x07, 0x47, 0x03, 0x48, 0x03, 0xD9, 0x0C, 0xDA, 0x05,
+    0x9F, 0x0C, 0x00, 0x80, 0x75, 0x1B, 0xA2, 0x81, 0x8A, 0x14, 0x0C, 0x00, 0x82, 0x75, 0xA1, 0x14,
+    0x02, 0x00, 0x93, 0x1D, 0xA2, 0x16, 0x00, 0x81, 0x8A, 0x1C, 0x17, 0x1D, 0xA1, 0x75, 0x00, 0x1C,
+    0xA2, 0x15, 0x00, 0x14, 0xA1, 0xA2, 0x16, 0x02, 0x00, 0x89, 0x8A, 0x75, 0x00, 0x1C, 0xA1, 0x1C,
+    0x15, 0x1C, 0xA1, 0x75, 0x02, 0x00, 0x82, 0x8A, 0xA1, 0x76, 0x02, 0x1C, 0x80, 0x14, 0x02, 0x81,
+    0x8D, 0x17, 0x15, 0x75, 0xA1, 0x15, 0x00, 0x17, 0xA2, 0x75, 0x17, 0x1D, 0xA1, 0xA2, 0x17, 0x05,
+    0x00, 0x88, 0x17, 0xA2, 0xA1, 0x1D, 0x17, 0x75, 0xA2, 0x1C, 0x00, 0x02, 0x81, 0x03, 0x00, 0x81,
+    0x76, 0x81, 0x40, 0x00, 0x04, 0x45, 0x07, 0x46, 0x07, 0x47, 0x02, 0x48, 0x04, 0xD9, 0x0C, 0xDA,
+    0x04, 0x9F, 0x0C, 0x00, 0x80, 0x8A, 0x1C, 0xA2, 0x80, 0x17, 0x0C, 0x00, 0x81, 0x75, 0xA1, 0x02,
+    0x17, 0x86, 0x1D, 0xA1, 0x76, 0x00, 0x1C, 0xA2, 0x17, 0x03, 0x00, 0x87, 0x75, 0xA1, 0x00, 0x15,
+    0xA1, 0x1C, 0x00, 0x1C, 0x02, 0xA1, 0x87, 0x1C, 0x00, 0x17, 0xAB, 0x17, 0x00, 0x81, 0x75, 0x03,
+    0x00, 0x81, 0x75, 0x8A, 0x02, 0x00, 0x02, 0x8A, 0x80, 0x14, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x16,
+    0x02, 0x00, 0x86, 0x14, 0xA1, 0x1C, 0x00, 0x75, 0x8A, 0x14, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x17,
+    0x05, 0x00, 0x82, 0x17, 0xA2, 0x1C, 0x02, 0x00, 0x8A, 0x14, 0x8A, 0x76, 0x00, 0x1C, 0xA2, 0x16,
+    0x00, 0x15, 0xA1, 0x1C, 0x40, 0x00, 0x05, 0x45, 0x08, 0x46, 0x06, 0x47, 0x80, 0x48, 0x05, 0xD9,
+    0x0C, 0xDA, 0x03, 0x9F, 0x0B, 0x00, 0x81, 0x14, 0xA1, 0x1C, 0xA2, 0x80, 0x1C, 0x0C, 0x00, 0x80,
+    0x75, 0x02, 0xA2, 0x87, 0xA1, 0x8A, 0x75, 0x14, 0x00, 0x1D, 0xA1, 0x14, 0x03, 0x00, 0x87, 0x1C,
+    0xA2, 0x15, 0x00, 0x81, 0x76, 0x00, 0x75, 0x03, 0x76, 0x82, 0x00, 0x1D, 0x8A, 0x02, 0x14, 0x81,
+    0xA1, 0x81, 0x03, 0x75, 0x85, 0x81, 0xA1, 0x14, 0x00, 0x8A, 0x75, 0x03, 0x00, 0x81, 0x1D, 0xA1,
+    0x04, 0x75, 0x84, 0xA1, 0x75, 0x00, 0x81, 0x76, 0x03, 0x00, 0x82, 0x17, 0xA2, 0x17, 0x05, 0x00,
+    0x82, 0x17, 0xAB, 0x17, 0x03, 0x00, 0x89, 0x76, 0x81, 0x00, 0x15, 0xA1, 0x1D, 0x00, 0x1C, 0xA1,
+    0x15, 0x40, 0x00, 0x06, 0x45, 0x08, 0x46, 0x06, 0x47, 0x06, 0xD9, 0x0C, 0xDA, 0x02, 0x9F, 0x08,
+    0x00, 0x80, 0x75, 0x03, 0x81, 0x80, 0xA1, 0x05, 0xA2, 0x82, 0x8A, 0x81, 0x8A, 0x04, 0xA2, 0x82,
+    0xA1, 0x81, 0x8A, 0x04, 0xA2, 0x82, 0xA1, 0x81, 0x8A, 0x06, 0xA2, 0x80, 0x8A, 0x02, 0x81, 0x81,
+    0x76, 0x14, 0x08, 0x00, 0x81, 0x75, 0xA1, 0x02, 0x14, 0x04, 0x00, 0x81, 0x75, 0xA1, 0x04, 0x00,
+    0x91, 0x1C, 0xA2, 0x16, 0x00, 0x1D, 0xA1, 0x14, 0x81, 0x1D, 0x1C, 0xA1, 0x14, 0x81, 0x75, 0x00,
+    0x14, 0xAB, 0x76, 0x04, 0x1D, 0x80, 0x1C, 0x02, 0x00, 0x81, 0x8A, 0x75, 0x03, 0x00, 0x81, 0x75,
+    0xA1, 0x05, 0x1D, 0x83, 0x17, 0x00, 0x81, 0x76, 0x03, 0x00, 0x82, 0x17, 0xA2, 0x17, 0x05, 0x00,
+    0x82, 0x17, 0xAB, 0x17, 0x03, 0x00, 0x81, 0x76, 0x81, 0x02, 0x00, 0x84, 0x76, 0x8A, 0x00, 0x81,
+    0x76, 0x41, 0x00, 0x07, 0x45, 0x08, 0x46, 0x05, 0x47, 0x07, 0xD9, 0x0C, 0xDA, 0x80, 0x9F, 0x08,
+    0x00, 0x80, 0x75, 0x03, 0x81, 0x06, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00,
+    0x16, 0xAB, 0x03, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x8A, 0x03, 0x81,
+    0x80, 0x14, 0x08, 0x00, 0x82, 0x75, 0xA1, 0x14, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x16, 0x03, 0x00,
+    0x8D, 0x75, 0xA1, 0x14, 0x00, 0x17, 0xA2, 0x1C, 0xA1, 0x17, 0x15, 0xA1, 0x1C, 0xA1, 0x1C, 0x02,
+    0x00, 0x81, 0xA1, 0x75, 0x07, 0x00, 0x81, 0x8A, 0x75, 0x03, 0x00, 0x82, 0x1C, 0xA2, 0x15, 0x06,
+    0x00, 0x02, 0x81, 0x03, 0x00, 0x82, 0x17, 0xA2, 0x17, 0x05, 0x00, 0x82, 0x17, 0xAB, 0x17, 0x03,
+    0x00, 0x81, 0x8A, 0x76, 0x02, 0x00, 0x84, 0x1C, 0xA2, 0x1C, 0xA1, 0x1C, 0x41, 0x00, 0x09, 0x45,
+    0x07, 0x46, 0x04, 0x47, 0x08, 0xD9, 0x0C, 0xDA, 0x08, 0x00, 0x80, 0x14, 0x03, 0x15, 0x80, 0xA1,
+    0x05, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x03, 0xA2, 0x80,
+    0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x1C, 0x02, 0x15, 0x80, 0x14, 0x09, 0x00, 0x82,
+    0x75, 0xA1, 0x14, 0x05, 0x00, 0x87, 0x15, 0xA1, 0x76, 0x14, 0x00, 0x17, 0xA1, 0x75, 0x03, 0x00,
+    0x03, 0x8A, 0x02, 0x00, 0x83, 0x81, 0x8A, 0xA1, 0x14, 0x02, 0x00, 0x82, 0x75, 0x8A, 0x16, 0x02,
+    0x00, 0x81, 0x15, 0x17, 0x02, 0x00, 0x81, 0x8A, 0x75, 0x03, 0x00, 0x83, 0x15, 0xA1, 0x75, 0x14,
+    0x02, 0x00, 0x8A, 0x17, 0x14, 0x00, 0x1D, 0xA2, 0x1C, 0x00, 0x17, 0x8A, 0xA2, 0x17, 0x05, 0x00,
+    0x87, 0x17, 0xA2, 0x8A, 0x16, 0x00, 0x1C, 0xA2, 0x1C, 0x02, 0x00, 0x80, 0x14, 0x02, 0x8A, 0x81,
+    0xA1, 0x14, 0x41, 0x00, 0x80, 0x65, 0x09, 0x45, 0x07, 0x46, 0x03, 0x47, 0x09, 0xD9, 0x0B, 0xDA,
+    0x0B, 0x00, 0x81, 0x14, 0xA1, 0x05, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00,
+    0x15, 0xAB, 0x03, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x1C, 0x0C, 0x00,
+    0x82, 0x75, 0xA1, 0x14, 0x06, 0x00, 0x80, 0x1C, 0x02, 0xA1, 0x83, 0x8A, 0xA1, 0x76, 0x14, 0x03,
+    0x00, 0x82, 0x75, 0xA2, 0x76, 0x02, 0x00, 0x82, 0x75, 0xA2, 0x76, 0x03, 0x00, 0x86, 0x15, 0x81,
+    0xA1, 0x81, 0x8A, 0xA1, 0x75, 0x02, 0x00, 0x81, 0x8A, 0x75, 0x04, 0x00, 0x8F, 0x1C, 0xA1, 0x8A,
+    0x81, 0x8A, 0xA1, 0x16, 0x00, 0x14, 0x81, 0xA1, 0x8A, 0xA1, 0x1D, 0xA2, 0x17, 0x05, 0x00, 0x86,
+    0x17, 0xA1, 0x75, 0xA1, 0x8A, 0xA2, 0x76, 0x04, 0x00, 0x82, 0x75, 0xA2, 0x75, 0x42, 0x00, 0x02,
+    0x65, 0x09, 0x45, 0x07, 0x46, 0x02, 0x47, 0x0A, 0xD9, 0x0A, 0xDA, 0x08, 0x00, 0x80, 0x1C, 0x03,
+    0x75, 0x80, 0xA1, 0x05, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB,
+    0x03, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x76, 0x03, 0x75, 0x80, 0x14,
+    0x08, 0x00, 0x81, 0x15, 0x17, 0x08, 0x00, 0x80, 0x15, 0x02, 0x1C, 0x80, 0x17, 0x05, 0x00, 0x82,
+    0x15, 0x1C, 0x15, 0x02, 0x00, 0x82, 0x15, 0x1C, 0x15, 0x05, 0x00, 0x80, 0x17, 0x02, 0x1C, 0x80,
+    0x16, 0x03, 0x00, 0x81, 0x17, 0x16, 0x05, 0x00, 0x80, 0x15, 0x03, 0x1C, 0x80, 0x14, 0x03, 0x00,
+    0x80, 0x14, 0x02, 0x1C, 0x83, 0x16, 0x00, 0x17, 0x14, 0x05, 0x00, 0x85, 0x14, 0x17, 0x00, 0x17,
+    0x1C, 0x17, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x17, 0x42, 0x00, 0x03, 0x65, 0x09, 0x45, 0x07, 0x46,
+    0x80, 0x47, 0x0B, 0xD9, 0x09, 0xDA, 0x08, 0x00, 0x80, 0x75, 0x03, 0x81, 0x06, 0xA2, 0x82, 0x1C,
+    0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x03, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x80,
+    0xA1, 0x05, 0xA2, 0x80, 0x8A, 0x03, 0x81, 0x80, 0x15, 0x55, 0x00, 0x81, 0x76, 0x8A, 0x43, 0x00,
+    0x04, 0x65, 0x09, 0x45, 0x07, 0x46, 0x0C, 0xD9, 0x08, 0xDA, 0x08, 0x00, 0x80, 0x16, 0x03, 0x1C,
+    0x80, 0xA1, 0x05, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x03,
+    0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x75, 0x02, 0x1C, 0x80, 0x17, 0x55,
+    0x00, 0x82, 0x15, 0xA1, 0x75, 0x43, 0x00, 0x05, 0x65, 0x09, 0x45, 0x06, 0x46, 0x0E, 0xD9, 0x06,
+    0xDA, 0x0B, 0x00, 0x81, 0x14, 0xA1, 0x05, 0xA2, 0x82, 0x1C, 0x00, 0x1C, 0x04, 0xA2, 0x83, 0x75,
+    0x00, 0x15, 0xAB, 0x03, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0xA1, 0x05, 0xA2, 0x80, 0x1C, 0x58,
+    0x00, 0x82, 0x14, 0x1C, 0x14, 0x43, 0x00, 0x06, 0x65, 0x09, 0x45, 0x05, 0x46, 0x80, 0xD8, 0x0E,
+    0xD9, 0x05, 0xDA, 0x08, 0x00, 0x80, 0x17, 0x03, 0x1C, 0x80, 0xA1, 0x05, 0xA2, 0x82, 0x1C, 0x00,
+    0x1C, 0x04, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x03, 0xA2, 0x83, 0x76, 0x00, 0x14, 0xA1, 0x05,
+    0xA2, 0x80, 0x75, 0x03, 0x1C, 0x7F, 0x00, 0x1C, 0x00, 0x07, 0x65, 0x09, 0x45, 0x04, 0x46, 0x80,
+    0xD8, 0x0F, 0xD9, 0x04, 0xDA, 0x08, 0x00, 0x80, 0x75, 0x03, 0x81, 0x06, 0xA2, 0x83, 0x1D, 0x00,
+    0x16, 0xAB, 0x03, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x03, 0xA2, 0x82, 0x75, 0x00, 0x15, 0x06,
+    0xA2, 0x80, 0x8A, 0x03, 0x81, 0x80, 0x15, 0x0C, 0x00, 0x80, 0x15, 0x02, 0x17, 0x80, 0x15, 0x08,
+    0x00, 0x02, 0x14, 0x0B, 0x00, 0x80, 0x14, 0x05, 0x00, 0x02, 0x14, 0x05, 0x00, 0x02, 0x14, 0x09,
+    0x00, 0x06, 0x14, 0x03, 0x00, 0x82, 0x16, 0x1C, 0x14, 0x51, 0x00, 0x08, 0x65, 0x08, 0x45, 0x04,
+    0x46, 0x02, 0xD8, 0x10, 0xD9, 0x02, 0xDA, 0x08, 0x00, 0x80, 0x1C, 0x03, 0x1D, 0x80, 0xA1, 0x05,
+    0xA2, 0x80, 0x76, 0x02, 0x00, 0x80, 0x81, 0x03, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x02, 0xA2,
+    0x83, 0xA1, 0x17, 0x00, 0x1C, 0x06, 0xA2, 0x80, 0x76, 0x03, 0x1D, 0x80, 0x14, 0x0A, 0x00, 0x82,
+    0x1C, 0x81, 0xA1, 0x02, 0xAB, 0x82, 0xA1, 0x81, 0x1C, 0x05, 0x00, 0x80, 0x1C, 0x02, 0xA1, 0x81,
+    0x81, 0x14, 0x07, 0x00, 0x81, 0x14, 0x81, 0x02, 0xA1, 0x80, 0x16, 0x03, 0x00, 0x82, 0x8A, 0xA1,
+    0x14, 0x03, 0x00, 0x83, 0x16, 0x8A, 0xA1, 0x16, 0x07, 0x00, 0x80, 0x81, 0x06, 0xA1, 0x80, 0x76,
+    0x02, 0x00, 0x82, 0x81, 0xA2, 0x1D, 0x51, 0x00, 0x09, 0x65, 0x09, 0x45, 0x02, 0x46, 0x04, 0xD8,
+    0x0F, 0xD9, 0x80, 0xDA, 0x0B, 0x00, 0x81, 0x14, 0xA1, 0x05, 0xA2, 0x84, 0xA1, 0x15, 0x00, 0x17,
+    0x8A, 0x02, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x02, 0xA2, 0x80, 0x1D, 0x02, 0x00, 0x80, 0x81,
+    0x06, 0xA2, 0x80, 0x1C, 0x0D, 0x00, 0x83, 0x75, 0xA2, 0xA1, 0x76, 0x02, 0x75, 0x80, 0x81, 0x02,
+    0xA2, 0x80, 0x1D, 0x04, 0x00, 0x84, 0x1D, 0xA2, 0xA1, 0xA2, 0x1C, 0x07, 0x00, 0x84, 0x1C, 0xA2,
+    0xA1, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1, 0x80, 0x14, 0x02, 0x00, 0x83, 0x14, 0x81, 0xA2, 0x1D,
+    0x08, 0x00, 0x81, 0x8A, 0xA2, 0x05, 0x76, 0x80, 0x1C, 0x02, 0x00, 0x82, 0x75, 0x8A, 0x17, 0x51,
+    0x00, 0x80, 0x66, 0x09, 0x65, 0x08, 0x45, 0x02, 0x46, 0x05, 0xD8, 0x0F, 0xD9, 0x08, 0x00, 0x80,
+    0x15, 0x02, 0x16, 0x81, 0x17, 0xA1, 0x06, 0xA2, 0x80, 0x76, 0x02, 0x00, 0x88, 0x15, 0x75, 0x81,
+    0x1D, 0x00, 0x15, 0x81, 0x75, 0x17, 0x02, 0x00, 0x80, 0x1D, 0x07, 0xA2, 0x80, 0x1D, 0x02, 0x16,
+    0x80, 0x15, 0x09, 0x00, 0x83, 0x1C, 0xA2, 0x8A, 0x17, 0x04, 0x00, 0x83, 0x1C, 0xA1, 0xA2, 0x17,
+    0x03, 0x00, 0x84, 0x1D, 0xA2, 0x76, 0xA2, 0x81, 0x07, 0x00, 0x84, 0x81, 0xA1, 0x76, 0xA2, 0x1C,
+    0x03, 0x00, 0x02, 0xA1, 0x80, 0x14, 0x02, 0x00, 0x82, 0x76, 0xA2, 0x76, 0x09, 0x00, 0x82, 0x8A,
+    0xA2, 0x15, 0x5B, 0x00, 0x02, 0x66, 0x09, 0x65, 0x08, 0x45, 0x80, 0x46, 0x06, 0xD8, 0x0E, 0xD9,
+    0x08, 0x00, 0x80, 0x75, 0x03, 0x81, 0x08, 0xA2, 0x81, 0x76, 0x15, 0x09, 0x00, 0x81, 0x14, 0x75,
+    0x08, 0xA2, 0x80, 0x8A, 0x03, 0x81, 0x80, 0x14, 0x07, 0x00, 0x83, 0x14, 0x8A, 0xA2, 0x17, 0x06,
+    0x00, 0x82, 0x1D, 0xA2, 0x76, 0x03, 0x00, 0x85, 0x1D, 0xA2, 0x75, 0x81, 0xA2, 0x17, 0x05, 0x00,
+    0x85, 0x17, 0xA2, 0x75, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1, 0x85, 0x14, 0x00, 0x1D, 0xA2,
+    0x81, 0x14, 0x09, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00, 0x82, 0x15, 0x17, 0x14, 0x02, 0x00,
+    0x83, 0x14, 0x17, 0x14, 0x00, 0x02, 0x1C, 0x88, 0x15, 0x00, 0x14, 0x17, 0x14, 0x00, 0x17, 0x1C,
+    0x17, 0x03, 0x00, 0x80, 0x14, 0x02, 0x1C, 0x80, 0x15, 0x03, 0x00, 0x82, 0x14, 0x17, 0x15, 0x04,
+    0x00, 0x81, 0x16, 0x17, 0x05, 0x00, 0x81, 0x17, 0x16, 0x03, 0x00, 0x80, 0x15, 0x03, 0x1C, 0x80,
+    0x14, 0x04, 0x00, 0x86, 0x14, 0x17, 0x14, 0x00, 0x17, 0x1C, 0x15, 0x03, 0x00, 0x81, 0x14, 0x17,
+    0x02, 0x1C, 0x80, 0x14, 0x0B, 0x00, 0x03, 0x66, 0x09, 0x65, 0x08, 0x45, 0x08, 0xD8, 0x0C, 0xD9,
+    0x08, 0x00, 0x80, 0x1D, 0x03, 0x76, 0x80, 0xA1, 0x08, 0xA2, 0x84, 0xA1, 0x75, 0x1C, 0x17, 0x15,
+    0x02, 0x00, 0x83, 0x17, 0x1C, 0x75, 0x8A, 0x09, 0xA2, 0x80, 0x81, 0x03, 0x76, 0x80, 0x14, 0x07,
+    0x00, 0x82, 0x1C, 0xA2, 0x81, 0x07, 0x00, 0x80, 0x15, 0x02, 0xA1, 0x80, 0x14, 0x02, 0x00, 0x85,
+    0x1D, 0xA2, 0x75, 0x1C, 0xA2, 0x75, 0x05, 0x00, 0x85, 0x76, 0xA2, 0x17, 0x76, 0xA2, 0x1C, 0x03,
+    0x00, 0x02, 0xA1, 0x84, 0x14, 0x17, 0xA1, 0x8A, 0x15, 0x0A, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07,
+    0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x83, 0x1C, 0xA2, 0x1C, 0x81, 0x02, 0xA2, 0x85, 0x75,
+    0x00, 0x1C, 0xA2, 0x1C, 0x76, 0x03, 0xA2, 0x83, 0x81, 0x15, 0x17, 0x8A, 0x02, 0xA2, 0x81, 0xA1,
+    0x1C, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x76, 0x04, 0x00, 0x82, 0x8A, 0xA2, 0x17, 0x03, 0x00, 0x86,
+    0x17, 0xA2, 0x76, 0x00, 0x15, 0x76, 0xA1, 0x03, 0xA2, 0x81, 0xA1, 0x1C, 0x03, 0x00, 0x83, 0x1C,
+    0xA2, 0x1C, 0x76, 0x02, 0xA2, 0x80, 0x75, 0x02, 0x00, 0x81, 0x1C, 0x8A, 0x03, 0xA2, 0x81, 0xA1,
+    0x1C, 0x0A, 0x00, 0x04, 0x66, 0x09, 0x65, 0x07, 0x45, 0x09, 0xD8, 0x0B, 0xD9, 0x0B, 0x00, 0x81,
+    0x14, 0xA1, 0x0C, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x0C, 0xA2, 0x80, 0x1C, 0x0B, 0x00, 0x82,
+    0x1D, 0xA2, 0x75, 0x08, 0x00, 0x82, 0x8A, 0xA2, 0x17, 0x02, 0x00, 0x86, 0x1D, 0xA2, 0x75, 0x14,
+    0xA1, 0x8A, 0x14, 0x03, 0x00, 0x86, 0x15, 0xA1, 0x81, 0x00, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02,
+    0xA1, 0x83, 0x17, 0x8A, 0xA1, 0x17, 0x0B, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00, 0x82, 0x75,
+    0xA2, 0x17, 0x02, 0x00, 0x94, 0x1C, 0xA2, 0x8A, 0xA1, 0x75, 0x1D, 0x1C, 0x00, 0x1C, 0xA2, 0x8A,
+    0xA1, 0x1D, 0x1C, 0x81, 0xA2, 0x81, 0xA1, 0x76, 0x1C, 0x1D, 0x02, 0xA1, 0x84, 0x15, 0x00, 0x15,
+    0xA1, 0x8A, 0x03, 0x00, 0x80, 0x17, 0x02, 0xA2, 0x80, 0x1D, 0x03, 0x00, 0x86, 0x75, 0xA2, 0x1C,
+    0x00, 0x1C, 0x8A, 0x1D, 0x02, 0x17, 0x80, 0x1D, 0x02, 0xA1, 0x80, 0x14, 0x02, 0x00, 0x90, 0x1C,
+    0xA2, 0x8A, 0xA1, 0x75, 0x1D, 0x1C, 0x00, 0x1C, 0xA2, 0x8A, 0x1C, 0x16, 0x1C, 0x8A, 0xA1, 0x17,
+    0x09, 0x00, 0x05, 0x66, 0x09, 0x65, 0x06, 0x45, 0x0A, 0xD8, 0x0A, 0xD9, 0x0B, 0x00, 0x81, 0x14,
+    0xA1, 0x0C, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x0C, 0xA2, 0x80, 0x1C, 0x0B, 0x00, 0x82, 0x75,
+    0xA2, 0x1D, 0x08, 0x00, 0x82, 0x81, 0xA2, 0x1C, 0x02, 0x00, 0x86, 0x1D, 0xA2, 0x75, 0x00, 0x75,
+    0xA2, 0x1C, 0x03, 0x00, 0x86, 0x1D, 0xA2, 0x1C, 0x00, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1,
+    0x82, 0x81, 0xA2, 0x1C, 0x0C, 0x00, 0x81, 0x8A, 0xA2, 0x05, 0x1D, 0x80, 0x16, 0x02, 0x00, 0x82,
+    0x75, 0xA2, 0x17, 0x02, 0x00, 0x80, 0x1C, 0x02, 0xA2, 0x80, 0x1C, 0x04, 0x00, 0x83, 0x1C, 0xA2,
+    0x8A, 0x17, 0x02, 0x00, 0x80, 0x17, 0x02, 0xA2, 0x80, 0x75, 0x03, 0x00, 0x82, 0x75, 0xA2, 0x1C,
+    0x02, 0x00, 0x82, 0x81, 0xAB, 0x17, 0x02, 0x00, 0x80, 0x1D, 0x02, 0xA2, 0x80, 0x81, 0x03, 0x00,
+    0x83, 0x81, 0xA1, 0x15, 0x00, 0x02, 0x14, 0x04, 0x00, 0x82, 0x76, 0xA2, 0x17, 0x02, 0x00, 0x80,
+    0x1C, 0x02, 0xA2, 0x80, 0x1C, 0x04, 0x00, 0x82, 0x81, 0xA1, 0x15, 0x03, 0x00, 0x82, 0x17, 0xA2,
+    0x76, 0x09, 0x00, 0x06, 0x66, 0x08, 0x65, 0x06, 0x45, 0x0C, 0xD8, 0x08, 0xD9, 0x08, 0x00, 0x80,
+    0x1D, 0x03, 0x76, 0x80, 0xA1, 0x0C, 0xA2, 0x83, 0x75, 0x00, 0x15, 0xAB, 0x0C, 0xA2, 0x80, 0x81,
+    0x03, 0x76, 0x80, 0x14, 0x07, 0x00, 0x82, 0x75, 0xA2, 0x1D, 0x08, 0x00, 0x82, 0x81, 0xA2, 0x1C,
+    0x02, 0x00, 0x86, 0x1D, 0xA2, 0x75, 0x00, 0x17, 0xA2, 0x81, 0x03, 0x00, 0x86, 0x8A, 0xA1, 0x14,
+    0x00, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1, 0x82, 0x76, 0xA2, 0x76, 0x0C, 0x00, 0x80, 0x8A,
+    0x06, 0xA2, 0x80, 0x1C, 0x02, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x75,
+    0x05, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x02, 0xA1, 0x80, 0x14, 0x03, 0x00, 0x82, 0x1D,
+    0xA2, 0x1D, 0x02, 0x00, 0x82, 0x1D, 0xA2, 0x75, 0x02, 0x00, 0x88, 0x76, 0x8A, 0x81, 0xA1, 0x15,
+    0x00, 0x15, 0xA1, 0x81, 0x08, 0x00, 0x82, 0x75, 0xA2, 0x1C, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x76,
+    0x04, 0x00, 0x82, 0x16, 0xA2, 0x76, 0x04, 0x00, 0x82, 0x14, 0xA1, 0x8A, 0x09, 0x00, 0x80, 0x44,
+    0x06, 0x66, 0x08, 0x65, 0x05, 0x45, 0x0D, 0xD8, 0x07, 0xD9, 0x08, 0x00, 0x80, 0x75, 0x03, 0x81,
+    0x0D, 0xA2, 0x83, 0x81, 0x1D, 0x75, 0xAB, 0x0C, 0xA2, 0x80, 0x8A, 0x03, 0x81, 0x80, 0x14, 0x07,
+    0x00, 0x82, 0x75, 0xA2, 0x75, 0x08, 0x00, 0x82, 0x81, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1D, 0xA2,
+    0x75, 0x02, 0x00, 0x86, 0x8A, 0xA2, 0x16, 0x00, 0x1C, 0xA2, 0x75, 0x02, 0x00, 0x82, 0x76, 0xA2,
+    0x1C, 0x03, 0x00, 0x02, 0xA1, 0x83, 0x15, 0x8A, 0xA2, 0x1D, 0x0B, 0x00, 0x81, 0x8A, 0xA2, 0x05,
+    0x17, 0x80, 0x14, 0x02, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x05,
+    0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x82, 0x8A, 0xA1, 0x14, 0x03, 0x00, 0x82, 0x1C, 0xA2,
+    0x75, 0x02, 0x00, 0x8D, 0x16, 0xA2, 0x81, 0x00, 0x14, 0xA1, 0x75, 0x1D, 0xA2, 0x1C, 0x00, 0x1C,
+    0xA2, 0x1D, 0x03, 0x00, 0x82, 0x14, 0x1C, 0x75, 0x02, 0x76, 0x82, 0x8A, 0xA2, 0x1C, 0x02, 0x00,
+    0x82, 0x1C, 0xA2, 0x75, 0x04, 0x00, 0x82, 0x17, 0xA2, 0xA1, 0x05, 0x81, 0x02, 0xA1, 0x09, 0x00,
+    0x02, 0x44, 0x05, 0x66, 0x09, 0x65, 0x04, 0x45, 0x80, 0xD7, 0x0E, 0xD8, 0x05, 0xD9, 0x08, 0x00,
+    0x80, 0x14, 0x02, 0x15, 0x81, 0x16, 0xA1, 0x1C, 0xA2, 0x80, 0x1C, 0x03, 0x15, 0x08, 0x00, 0x82,
+    0x1D, 0xA2, 0x76, 0x07, 0x00, 0x80, 0x14, 0x02, 0xA1, 0x80, 0x15, 0x02, 0x00, 0x82, 0x1D, 0xA2,
+    0x75, 0x02, 0x00, 0x86, 0x1D, 0xA2, 0x75, 0x00, 0x76, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x76, 0xA2,
+    0x1C, 0x03, 0x00, 0x02, 0xA1, 0x81, 0x14, 0x17, 0x02, 0xA1, 0x80, 0x17, 0x0A, 0x00, 0x82, 0x8A,
+    0xA2, 0x15, 0x07, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x05, 0x00,
+    0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x82, 0x8A, 0xA1, 0x14, 0x03, 0x00, 0x82, 0x1C, 0xA2, 0x75,
+    0x03, 0x00, 0x8C, 0x81, 0xA2, 0x15, 0x17, 0xA2, 0x1C, 0x16, 0xA2, 0x76, 0x00, 0x76, 0xA2, 0x16,
+    0x02, 0x00, 0x83, 0x16, 0x8A, 0xA2, 0x81, 0x02, 0x76, 0x82, 0x81, 0xA2, 0x1C, 0x02, 0x00, 0x82,
+    0x1C, 0xA2, 0x75, 0x04, 0x00, 0x82, 0x1C, 0xA2, 0x8A, 0x06, 0x75, 0x80, 0x1C, 0x09, 0x00, 0x80,
+    0x67, 0x02, 0x44, 0x05, 0x66, 0x09, 0x65, 0x03, 0x45, 0x02, 0xD7, 0x0E, 0xD8, 0x04, 0xD9, 0x0C,
+    0x00, 0x80, 0x8A, 0x1C, 0xA2, 0x80, 0x1C, 0x0B, 0x00, 0x83, 0x17, 0xA2, 0x8A, 0x14, 0x06, 0x00,
+    0x82, 0x1C, 0xA2, 0x81, 0x03, 0x00, 0x82, 0x1D, 0xA2, 0x75, 0x02, 0x00, 0x85, 0x15, 0xA1, 0x8A,
+    0x16, 0xA1, 0x81, 0x03, 0x00, 0x82, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1, 0x85, 0x14, 0x00,
+    0x1C, 0xA2, 0x8A, 0x15, 0x09, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00, 0x82, 0x75, 0xA2, 0x17,
+    0x02, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x82, 0x8A,
+    0xA1, 0x14, 0x03, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x03, 0x00, 0x86, 0x75, 0xA2, 0x1C, 0x75, 0xA2,
+    0x15, 0x00, 0x02, 0x8A, 0x82, 0x14, 0xA1, 0x81, 0x03, 0x00, 0x82, 0x76, 0xA2, 0x1C, 0x03, 0x00,
+    0x82, 0x75, 0xA2, 0x1C, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x04, 0x00, 0x82, 0x17, 0xA2, 0x76,
+    0x10, 0x00, 0x80, 0x67, 0x03, 0x44, 0x05, 0x66, 0x08, 0x65, 0x03, 0x45, 0x03, 0xD7, 0x0F, 0xD8,
+    0x02, 0xD9, 0x0C, 0x00, 0x80, 0x76, 0x1B, 0xA2, 0x81, 0xA1, 0x14, 0x0C, 0x00, 0x82, 0x8A, 0xA2,
+    0x1D, 0x05, 0x00, 0x83, 0x15, 0x8A, 0xA2, 0x1C, 0x03, 0x00, 0x82, 0x1D, 0xA2, 0x75, 0x03, 0x00,
+    0x84, 0x76, 0xA2, 0x81, 0xA2, 0x1C, 0x03, 0x00, 0x82, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1,
+    0x80, 0x14, 0x02, 0x00, 0x82, 0x76, 0xA2, 0x76, 0x09, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00,
+    0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x1D,
+    0x04, 0x00, 0x82, 0x8A, 0xA1, 0x14, 0x03, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x03, 0x00, 0x82, 0x17,
+    0xA2, 0x76, 0x02, 0x81, 0x02, 0x00, 0x84, 0x75, 0xA2, 0x1D, 0xAB, 0x75, 0x03, 0x00, 0x82, 0x8A,
+    0xA1, 0x14, 0x03, 0x00, 0x82, 0x75, 0xA2, 0x1C, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x04, 0x00,
+    0x80, 0x14, 0x02, 0xA1, 0x80, 0x14, 0x0F, 0x00, 0x02, 0x67, 0x02, 0x44, 0x06, 0x66, 0x08, 0x65,
+    0x02, 0x45, 0x04, 0xD7, 0x10, 0xD8, 0x0C, 0x00, 0x81, 0x16, 0xA1, 0x1A, 0xA2, 0x80, 0x1D, 0x0D,
+    0x00, 0x80, 0x1C, 0x02, 0xA2, 0x81, 0x75, 0x16, 0x02, 0x14, 0x84, 0x1C, 0x8A, 0xA2, 0x81, 0x14,
+    0x03, 0x00, 0x82, 0x1D, 0xA2, 0x75, 0x03, 0x00, 0x80, 0x1C, 0x02, 0xA2, 0x81, 0x8A, 0x14, 0x03,
+    0x00, 0x82, 0x76, 0xA2, 0x1C, 0x03, 0x00, 0x02, 0xA1, 0x80, 0x14, 0x02, 0x00, 0x83, 0x15, 0x8A,
+    0xA2, 0x1D, 0x08, 0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00,
+    0x82, 0x1C, 0xA2, 0x1D, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x82, 0x8A, 0xA1, 0x14,
+    0x03, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x04, 0x00, 0x80, 0x8A, 0x02, 0xA1, 0x80, 0x75, 0x02, 0x00,
+    0x84, 0x1C, 0xA2, 0xA1, 0xAB, 0x17, 0x03, 0x00, 0x82, 0x81, 0xA2, 0x1C, 0x02, 0x00, 0x83, 0x1C,
+    0xA1, 0xA2, 0x1C, 0x02, 0x00, 0x82, 0x1C, 0xA2, 0x75, 0x05, 0x00, 0x83, 0x75, 0xA2, 0x76, 0x15,
+    0x02, 0x00, 0x82, 0x14, 0x1C, 0x17, 0x09, 0x00, 0x03, 0x67, 0x02, 0x44, 0x05, 0x66, 0x09, 0x65,
+    0x80, 0x45, 0x06, 0xD7, 0x0E, 0xD8, 0x0D, 0x00, 0x81, 0x17, 0x81, 0x17, 0xA2, 0x81, 0xA1, 0x1C,
+    0x0F, 0x00, 0x84, 0x1C, 0xA1, 0xA2, 0xAB, 0xA1, 0x02, 0xA2, 0x03, 0xA1, 0x80, 0x1C, 0x03, 0x00,
+    0x82, 0x1D, 0xA2, 0x75, 0x03, 0x00, 0x83, 0x14, 0x8A, 0xA2, 0x75, 0x04, 0x00, 0x82, 0x76, 0xA2,
+    0x1C, 0x03, 0x00, 0x02, 0xA1, 0x80, 0x14, 0x03, 0x00, 0x80, 0x17, 0x02, 0xA1, 0x80, 0x17, 0x07,
+    0x00, 0x82, 0x8A, 0xA2, 0x15, 0x07, 0x00, 0x82, 0x75, 0xA2, 0x17, 0x02, 0x00, 0x82, 0x1C, 0xA2,
+    0x1D, 0x05, 0x00, 0x82, 0x1C, 0xA2, 0x1D, 0x04, 0x00, 0x82, 0x8A, 0xA1, 0x14, 0x03, 0x00, 0x82,
+    0x1C, 0xA2, 0x75, 0x04, 0x00, 0x80, 0x75, 0x02, 0xA2, 0x80, 0x1C, 0x02, 0x00, 0x83, 0x14, 0xA1,
+    0xA2, 0x8A, 0x04, 0x00, 0x88, 0x1C, 0xA1, 0xA2, 0x81, 0x8A, 0xA1, 0x76, 0xA2, 0x1C, 0x02, 0x00,
+    0x82, 0x1C, 0xA2, 0x75, 0x05, 0x00, 0x83, 0x14, 0x81, 0xA2, 0xA1, 0x02, 0x8A, 0x82, 0xA1, 0xAB,
+    0x1D, 0x09, 0x00, 0x80, 0x68, 0x03, 0x67, 0x02, 0x44, 0x05, 0x66, 0x09, 0x65, 0x07, 0xD7, 0x0D,
+    0xD8, 0x0F, 0x00, 0x83, 0x16, 0x1C, 0x81, 0x8A, 0x02, 0x1C, 0x86, 0x75, 0x81, 0x75, 0x1C, 0x1D,
+    0x81, 0x76, 0x02, 0x1C, 0x02, 0x81, 0x02, 0x1C, 0x02, 0x81, 0x82, 0x1C, 0x17, 0x14, 0x11, 0x00,
+    0x82, 0x15, 0x1C, 0x75, 0x02, 0x76, 0x8A, 0x1D, 0x16, 0x1C, 0xA1, 0xA2, 0x81, 0x1C, 0x00, 0x17,
+    0x75, 0x17, 0x04, 0x00, 0x82, 0x1C, 0x75, 0x15, 0x04, 0x00, 0x82, 0x1C, 0x75, 0x15, 0x03, 0x00,
+    0x02, 0x1D, 0x80, 0x14, 0x04, 0x00, 0x82, 0x1C, 0x75, 0x17, 0x07, 0x00, 0x82, 0x1D, 0x75, 0x14,
+    0x07, 0x00, 0x82, 0x1C, 0x75, 0x15, 0x02, 0x00, 0x82, 0x17, 0x75, 0x17, 0x05, 0x00, 0x82, 0x17,
+    0x75, 0x17, 0x04, 0x00, 0x02, 0x1D, 0x04, 0x00, 0x82, 0x17, 0x75, 0x17, 0x04, 0x00, 0x80, 0x17,
+    0x02, 0x75, 0x80, 0x14, 0x03, 0x00, 0x82, 0x1C, 0x75, 0x1C, 0x05, 0x00, 0x87, 0x17, 0x75, 0x76,
+    0x75, 0x17, 0x15, 0x75, 0x16, 0x02, 0x00, 0x82, 0x16, 0x75, 0x1C, 0x07, 0x00, 0x81, 0x1C, 0x75,
+    0x02, 0x76, 0x81, 0x75, 0x17, 0x0A, 0x00, 0x02, 0x68, 0x03, 0x67, 0x80, 0x44, 0x06, 0x66, 0x08,
+    0x65, 0x80, 0xD6, 0x08, 0xD7, 0x0B, 0xD8, 0x11, 0x00, 0x93, 0x76, 0x81, 0x16, 0x00, 0x1D, 0x81,
+    0x1C, 0x00, 0x1C, 0x81, 0x75, 0x00, 0x15, 0x81, 0x76, 0x14, 0x00, 0x76, 0x81, 0x17, 0x1B, 0x00,
+    0x84, 0x16, 0x76, 0xA2, 0xA1, 0x15, 0x7F, 0x00, 0x04, 0x00, 0x02, 0x68, 0x03, 0x67, 0x02, 0x44,
+    0x06, 0x66, 0x07, 0x65, 0x02, 0xD6, 0x09, 0xD7, 0x09, 0xD8, 0x11, 0x00, 0x93, 0x76, 0x81, 0x16,
+    0x00, 0x1D, 0x81, 0x1C, 0x00, 0x1C, 0x81, 0x75, 0x00, 0x15, 0x81, 0x76, 0x14, 0x00, 0x76, 0x81,
+    0x17, 0x1D, 0x00, 0x82, 0x17, 0x75, 0x14, 0x7F, 0x00, 0x04, 0x00, 0x03, 0x68, 0x03, 0x67, 0x03,
+    0x44, 0x04, 0x66, 0x07, 0x65, 0x03, 0xD6, 0x09, 0xD7, 0x08, 0xD8, 0x11, 0x00, 0x8E, 0x75, 0x81,
+    0x15, 0x00, 0x1C, 0x81, 0x1C, 0x00, 0x17, 0x81, 0x1D, 0x00, 0x14, 0x81, 0x76, 0x02, 0x00, 0x82,
+    0x75, 0x81, 0x16, 0x7F, 0x00, 0x24, 0x00, 0x80, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x05,
+    0x66, 0x06, 0x65, 0x05, 0xD6, 0x09, 0xD7, 0x06, 0xD8, 0x12, 0x00, 0x80, 0x14, 0x03, 0x00, 0x80,
+    0x14, 0x03, 0x00, 0x80, 0x14, 0x03, 0x00, 0x80, 0x14, 0x04, 0x00, 0x80, 0x14, 0x7F, 0x00, 0x25,
+    0x00, 0x80, 0x69, 0x04, 0x68, 0x02, 0x67, 0x03, 0x44, 0x05, 0x66, 0x05, 0x65, 0x07, 0xD6, 0x09,
+    0xD7, 0x04, 0xD8, 0x7F, 0x00, 0x49, 0x00, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x06,
+    0x66, 0x04, 0x65, 0x02, 0xD5, 0x06, 0xD6, 0x0A, 0xD7, 0x02, 0xD8, 0x7F, 0x00, 0x49, 0x00, 0x03,
+    0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x05, 0x66, 0x04, 0x65, 0x03, 0xD5, 0x07, 0xD6, 0x0A,
+    0xD7, 0x7F, 0x00, 0x49, 0x00, 0x80, 0x6A, 0x03, 0x69, 0x03, 0x68, 0x02, 0x67, 0x02, 0x44, 0x06,
+    0x66, 0x03, 0x65, 0x05, 0xD5, 0x07, 0xD6, 0x08, 0xD7, 0x7F, 0x00, 0x49, 0x00, 0x02, 0x6A, 0x02,
+    0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x05, 0x66, 0x03, 0x65, 0x07, 0xD5, 0x07, 0xD6, 0x06,
+    0xD7, 0x7F, 0x00, 0x49, 0x00, 0x80, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x02, 0x67, 0x02,
+    0x44, 0x06, 0x66, 0x02, 0x65, 0x02, 0xD4, 0x06, 0xD5, 0x08, 0xD6, 0x04, 0xD7, 0x80, 0x16, 0x7F,
+    0x00, 0x47, 0x00, 0x80, 0x15, 0x02, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02,
+    0x44, 0x05, 0x66, 0x02, 0x65, 0x04, 0xD4, 0x06, 0xD5, 0x08, 0xD6, 0x02, 0xD7, 0x80, 0x17, 0x7F,
+    0x00, 0x47, 0x00, 0x80, 0x17, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02,
+    0x44, 0x05, 0x66, 0x80, 0x65, 0x06, 0xD4, 0x06, 0xD5, 0x08, 0xD6, 0x81, 0xD2, 0x14, 0x7F, 0x00,
+    0x45, 0x00, 0x81, 0x14, 0x33, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x04, 0x68, 0x02, 0x67, 0x02,
+    0x44, 0x06, 0x66, 0x80, 0xD3, 0x06, 0xD4, 0x07, 0xD5, 0x07, 0xD6, 0x81, 0x1D, 0x14, 0x7F, 0x00,
+    0x43, 0x00, 0x81, 0x14, 0x33, 0x02, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x02,
+    0x67, 0x03, 0x44, 0x05, 0x66, 0x02, 0xD3, 0x08, 0xD4, 0x07, 0xD5, 0x05, 0xD6, 0x81, 0xD3, 0x1C,
+    0x7F, 0x16, 0x1D, 0x16, 0x24, 0x15, 0x81, 0x17, 0x33, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03,
+    0x69, 0x03, 0x68, 0x02, 0x67, 0x02, 0x44, 0x05, 0x66, 0x04, 0xD3, 0x07, 0xD4, 0x08, 0xD5, 0x0A,
+    0xD6, 0x12, 0xD7, 0x15, 0xD8, 0x0D, 0xD7, 0x06, 0xD6, 0x03, 0xD5, 0x03, 0xD4, 0x03, 0xD3, 0x02,
+    0xD2, 0x02, 0xD1, 0x02, 0xD0, 0x82, 0x9D, 0xCF, 0xCE, 0x02, 0xCD, 0x02, 0xCC, 0xA1, 0xCB, 0xC2,
+    0xC1, 0xC0, 0xBE, 0xBD, 0xBB, 0xBA, 0xB9, 0xB7, 0xB5, 0xC3, 0xC4, 0xC6, 0xC7, 0xC9, 0xDB, 0xDD,
+    0xDF, 0xE1, 0xE2, 0xE4, 0xE5, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0xF3,
+    0x02, 0xF4, 0x80, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x80, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB,
+    0x80, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1,
+    0x80, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x80, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x80, 0x91, 0x02, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68,
+    0x03, 0x67, 0x02, 0x44, 0x04, 0x66, 0x06, 0xD3, 0x08, 0xD4, 0x08, 0xD5, 0x0A, 0xD6, 0x2E, 0xD7,
+    0x06, 0xD6, 0x04, 0xD5, 0x03, 0xD4, 0x04, 0xD3, 0x02, 0xD2, 0x02, 0xD1, 0x02, 0xD0, 0x81, 0x9D,
+    0xCF, 0x02, 0xCE, 0x80, 0xCD, 0x02, 0xCC, 0x80, 0xCB, 0x02, 0xC2, 0x9E, 0xC0, 0xBF, 0xBD, 0xBC,
+    0xBB, 0xBA, 0xB8, 0xB7, 0xB5, 0xC3, 0xC5, 0xC6, 0xC8, 0xC9, 0xDB, 0xDD, 0xDF, 0xE1, 0xE2, 0xE3,
+    0xE5, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0x02, 0xF3, 0x80, 0xF4, 0x02,
+    0xF5, 0x80, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x80, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x81,
+    0xFD, 0xB0, 0x02, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF,
+    0x80, 0xAE, 0x02, 0xAD, 0x80, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6,
+    0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x80, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85,
+    0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x03, 0x68, 0x03, 0x67,
+    0x02, 0x44, 0x03, 0x66, 0x08, 0xD3, 0x08, 0xD4, 0x08, 0xD5, 0x0B, 0xD6, 0x27, 0xD7, 0x07, 0xD6,
+    0x05, 0xD5, 0x04, 0xD4, 0x03, 0xD3, 0x03, 0xD2, 0x02, 0xD1, 0x02, 0xD0, 0x81, 0x9D, 0xCF, 0x02,
+    0xCE, 0x80, 0xCD, 0x02, 0xCC, 0x02, 0xCB, 0xA0, 0xC2, 0xC1, 0xC0, 0xBE, 0xBD, 0xBC, 0xBB, 0xB9,
+    0xB8, 0xB6, 0xC3, 0xC4, 0xC5, 0xC7, 0xC8, 0xCA, 0xDB, 0xDD, 0xE0, 0xE1, 0xE2, 0xE4, 0xE5, 0xE8,
+    0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0xF2, 0x02, 0xF3, 0x80, 0xF4, 0x02, 0xF5, 0x02,
+    0xF6, 0x80, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x80, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02,
+    0xFE, 0x02, 0xFF, 0x81, 0xB4, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD,
+    0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6, 0x02, 0xA5, 0x02, 0xA4,
+    0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C,
+    0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83,
+    0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x03, 0x66,
+    0x02, 0xD2, 0x08, 0xD3, 0x09, 0xD4, 0x09, 0xD5, 0x0D, 0xD6, 0x1D, 0xD7, 0x09, 0xD6, 0x05, 0xD5,
+    0x04, 0xD4, 0x04, 0xD3, 0x03, 0xD2, 0x02, 0xD1, 0x02, 0xD0, 0x81, 0x9D, 0xCF, 0x02, 0xCE, 0x02,
+    0xCD, 0x80, 0xCC, 0x02, 0xCB, 0xA0, 0xC2, 0xC1, 0xC0, 0xBF, 0xBD, 0xBC, 0xBB, 0xBA, 0xB9, 0xB7,
+    0xB5, 0xC3, 0xC4, 0xC6, 0xC7, 0xC8, 0xCA, 0xDC, 0xDE, 0xE0, 0xE1, 0xE2, 0xE4, 0xE5, 0xE8, 0xE9,
+    0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0x02, 0xF2, 0x80, 0xF3, 0x02, 0xF4, 0x80, 0xF5, 0x02,
+    0xF6, 0x02, 0xF7, 0x80, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x80, 0xFB, 0x03, 0xFC, 0x82, 0xFD, 0xB0,
+    0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x80, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80,
+    0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02,
+    0x83, 0x03, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x02,
+    0x66, 0x04, 0xD2, 0x09, 0xD3, 0x09, 0xD4, 0x09, 0xD5, 0x11, 0xD6, 0x0F, 0xD7, 0x0D, 0xD6, 0x05,
+    0xD5, 0x05, 0xD4, 0x04, 0xD3, 0x03, 0xD2, 0x03, 0xD1, 0x02, 0xD0, 0x02, 0xCF, 0x02, 0xCE, 0x02,
+    0xCD, 0x80, 0xCC, 0x02, 0xCB, 0x02, 0xC2, 0x83, 0xC0, 0xBF, 0xBE, 0xBD, 0x02, 0xBB, 0x99, 0xB9,
+    0xB8, 0xB6, 0xB5, 0xC3, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xDC, 0xDE, 0xE0, 0xE1, 0xE2, 0xE4, 0xE6,
+    0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0x02, 0xF2, 0x80, 0xF3, 0x02, 0xF4, 0x80,
+    0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x80, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02,
+    0xFD, 0x02, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF, 0x02,
+    0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6, 0x02,
+    0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02,
+    0x8D, 0x02, 0x8C, 0x80, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02,
+    0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x02,
+    0x44, 0x02, 0x66, 0x06, 0xD2, 0x0A, 0xD3, 0x08, 0xD4, 0x0B, 0xD5, 0x25, 0xD6, 0x07, 0xD5, 0x05,
+    0xD4, 0x05, 0xD3, 0x02, 0xD2, 0x03, 0xD1, 0x03, 0xD0, 0x02, 0xCF, 0x02, 0xCE, 0x02, 0xCD, 0x02,
+    0xCC, 0x80, 0xCB, 0x02, 0xC2, 0xA0, 0xC1, 0xC0, 0xBE, 0xBD, 0xBC, 0xBB, 0xBA, 0xB9, 0xB7, 0xB6,
+    0xC3, 0xC4, 0xC5, 0xC6, 0xC8, 0xC9, 0xDB, 0xDD, 0xDF, 0xE0, 0xE1, 0xE3, 0xE4, 0xE6, 0xE8, 0xE9,
+    0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0xF1, 0x02, 0xF2, 0x80, 0xF3, 0x02, 0xF4, 0x80, 0xF5, 0x02,
+    0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x80, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02,
+    0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x80, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80,
+    0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x03, 0x68, 0x02, 0x67, 0x02, 0x44, 0x02,
+    0x66, 0x02, 0xD1, 0x07, 0xD2, 0x09, 0xD3, 0x0A, 0xD4, 0x0E, 0xD5, 0x19, 0xD6, 0x09, 0xD5, 0x06,
+    0xD4, 0x05, 0xD3, 0x03, 0xD2, 0x03, 0xD1, 0x02, 0xD0, 0x80, 0x9D, 0x02, 0xCF, 0x02, 0xCE, 0x02,
+    0xCD, 0x02, 0xCC, 0x02, 0xCB, 0xA1, 0xC2, 0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0xBB, 0xBA, 0xB9, 0xB8,
+    0xB7, 0xB5, 0xC3, 0xC4, 0xC6, 0xC7, 0xC8, 0xC9, 0xDB, 0xDD, 0xDF, 0xE1, 0xE2, 0xE3, 0xE4, 0xE6,
+    0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x81, 0xF2, 0xF3, 0x02, 0xF4, 0x02,
+    0xF5, 0x80, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x81,
+    0xFD, 0xB0, 0x02, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF,
+    0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6,
+    0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85,
+    0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67,
+    0x02, 0x44, 0x80, 0x66, 0x04, 0xD1, 0x07, 0xD2, 0x09, 0xD3, 0x0C, 0xD4, 0x15, 0xD5, 0x80, 0xD6,
+    0x12, 0xD5, 0x07, 0xD4, 0x06, 0xD3, 0x03, 0xD2, 0x03, 0xD1, 0x03, 0xD0, 0x80, 0x9D, 0x02, 0xCF,
+    0x02, 0xCE, 0x02, 0xCD, 0x02, 0xCC, 0x02, 0xCB, 0xA2, 0xC2, 0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0xBC,
+    0xBB, 0xBA, 0xB9, 0xB7, 0xB6, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xDC, 0xDD, 0xDF, 0xE1,
+    0xE2, 0xE3, 0xE4, 0xE6, 0xE8, 0xE9, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2,
+    0x02, 0xF3, 0x80, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x80, 0xF8, 0x02, 0xF9, 0x02, 0xFA,
+    0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x81, 0xB2,
+    0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x02, 0xA6, 0x80, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x80, 0x85, 0x03, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x04,
+    0x68, 0x02, 0x67, 0x02, 0x44, 0x80, 0x66, 0x07, 0xD1, 0x06, 0xD2, 0x0B, 0xD3, 0x0D, 0xD4, 0x1F,
+    0xD5, 0x08, 0xD4, 0x07, 0xD3, 0x04, 0xD2, 0x03, 0xD1, 0x02, 0xD0, 0x02, 0x9D, 0x02, 0xCF, 0x02,
+    0xCE, 0x02, 0xCD, 0x02, 0xCC, 0x02, 0xCB, 0x81, 0xC2, 0xC1, 0x02, 0xC0, 0x9F, 0xBE, 0xBD, 0xBC,
+    0xBB, 0xBA, 0xB9, 0xB8, 0xB7, 0xB5, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xDC, 0xDE, 0xE0,
+    0xE1, 0xE2, 0xE3, 0xE5, 0xE6, 0xE8, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80,
+    0xF2, 0x02, 0xF3, 0x80, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x80, 0xF9, 0x02,
+    0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80,
+    0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x80,
+    0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02,
+    0x90, 0x02, 0x8F, 0x02, 0x8E, 0x80, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02,
+    0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02,
+    0x69, 0x03, 0x68, 0x03, 0x67, 0x02, 0x44, 0x80, 0xD0, 0x08, 0xD1, 0x08, 0xD2, 0x0A, 0xD3, 0x10,
+    0xD4, 0x81, 0xD5, 0xD4, 0x11, 0xD5, 0x0B, 0xD4, 0x07, 0xD3, 0x05, 0xD2, 0x03, 0xD1, 0x03, 0xD0,
+    0x80, 0x9D, 0x02, 0xCF, 0x02, 0xCE, 0x03, 0xCD, 0x02, 0xCC, 0x02, 0xCB, 0x02, 0xC2, 0x84, 0xC1,
+    0xC0, 0xBF, 0xBE, 0xBD, 0x02, 0xBB, 0x83, 0xBA, 0xB9, 0xB7, 0xB6, 0x02, 0xC3, 0x92, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xDB, 0xDC, 0xDE, 0xE0, 0xE1, 0xE2, 0xE3, 0xE5, 0xE6, 0xE8, 0xE9, 0xEB, 0xEC,
+    0xED, 0x02, 0xEE, 0x80, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x80, 0xF5, 0x02,
+    0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x80, 0xFB, 0x03, 0xFC, 0x80, 0xFD, 0x03,
+    0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x80, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02,
+    0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x02, 0x68, 0x03, 0x67, 0x02, 0x44, 0x04,
+    0xD0, 0x07, 0xD1, 0x09, 0xD2, 0x0D, 0xD3, 0x24, 0xD4, 0x09, 0xD3, 0x04, 0xD2, 0x04, 0xD1, 0x04,
+    0xD0, 0x80, 0x9D, 0x02, 0xCF, 0x02, 0xCE, 0x03, 0xCD, 0x02, 0xCC, 0x02, 0xCB, 0x02, 0xC2, 0xA3,
+    0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0xBC, 0xBB, 0xBA, 0xB9, 0xB8, 0xB6, 0xB5, 0xC3, 0xC4, 0xC5, 0xC6,
+    0xC7, 0xC9, 0xCA, 0xDB, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE5, 0xE7, 0xE8, 0xEA, 0xEB, 0xEC,
+    0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x80, 0xF5, 0x02, 0xF6,
+    0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE,
+    0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x80, 0xAD,
+    0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4,
+    0x02, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x80, 0x8C,
+    0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83,
+    0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x80, 0x44, 0x05, 0xD0,
+    0x0A, 0xD1, 0x07, 0xD2, 0x0E, 0xD3, 0x81, 0xD4, 0xD3, 0x19, 0xD4, 0x0C, 0xD3, 0x05, 0xD2, 0x05,
+    0xD1, 0x03, 0xD0, 0x80, 0x9D, 0x02, 0xCF, 0x03, 0xCE, 0x02, 0xCD, 0x03, 0xCC, 0x02, 0xCB, 0x02,
+    0xC2, 0x85, 0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0xBC, 0x02, 0xBB, 0x9C, 0xBA, 0xB9, 0xB7, 0xB6, 0xB5,
+    0xC3, 0xC4, 0xC5, 0xC7, 0xC8, 0xC9, 0xDB, 0xDC, 0xDD, 0xDF, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7,
+    0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4,
+    0x80, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC,
+    0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF,
+    0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6,
+    0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85,
+    0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67,
+    0x81, 0x44, 0x9D, 0x07, 0xD0, 0x09, 0xD1, 0x0A, 0xD2, 0x16, 0xD3, 0x03, 0xD4, 0x13, 0xD3, 0x06,
+    0xD2, 0x06, 0xD1, 0x03, 0xD0, 0x80, 0x9D, 0x03, 0xCF, 0x03, 0xCE, 0x02, 0xCD, 0x03, 0xCC, 0x02,
+    0xCB, 0x02, 0xC2, 0x84, 0xC1, 0xC0, 0xBF, 0xBE, 0xBD, 0x02, 0xBC, 0x9E, 0xBB, 0xBA, 0xB9, 0xB8,
+    0xB6, 0xB5, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xDB, 0xDD, 0xDE, 0xE0, 0xE1, 0xE2, 0xE3,
+    0xE4, 0xE5, 0xE7, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02,
+    0xF3, 0x02, 0xF4, 0x80, 0xF5, 0x03, 0xF6, 0x80, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02,
+    0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x80,
+    0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x80, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x02,
+    0x68, 0x03, 0x67, 0x81, 0x44, 0xCF, 0x03, 0x9D, 0x06, 0xD0, 0x0A, 0xD1, 0x0B, 0xD2, 0x24, 0xD3,
+    0x07, 0xD2, 0x06, 0xD1, 0x04, 0xD0, 0x02, 0x9D, 0x02, 0xCF, 0x03, 0xCE, 0x03, 0xCD, 0x02, 0xCC,
+    0x03, 0xCB, 0x02, 0xC2, 0x82, 0xC1, 0xC0, 0xBF, 0x02, 0xBE, 0x82, 0xBD, 0xBC, 0xBB, 0x02, 0xBA,
+    0x97, 0xB8, 0xB7, 0xB6, 0xB5, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC9, 0xCA, 0xDB, 0xDD, 0xDE, 0xE0,
+    0xE1, 0xE2, 0xE3, 0xE4, 0xE6, 0xE7, 0xE9, 0xEA, 0xEB, 0x02, 0xED, 0x82, 0xEE, 0xEF, 0xF0, 0x02,
+    0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x80, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x80,
+    0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x80, 0xFF, 0x02,
+    0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02,
+    0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x80,
+    0x92, 0x03, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02,
+    0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x03, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03,
+    0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x03, 0xCF, 0x04, 0x9D, 0x06, 0xD0, 0x0A,
+    0xD1, 0x0E, 0xD2, 0x19, 0xD3, 0x09, 0xD2, 0x07, 0xD1, 0x05, 0xD0, 0x80, 0x9D, 0x03, 0xCF, 0x03,
+    0xCE, 0x02, 0xCD, 0x03, 0xCC, 0x03, 0xCB, 0x02, 0xC2, 0x80, 0xC1, 0x02, 0xC0, 0x02, 0xBE, 0x81,
+    0xBD, 0xBC, 0x02, 0xBB, 0x9E, 0xBA, 0xB9, 0xB7, 0xB6, 0xB5, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8,
+    0xC9, 0xDB, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC,
+    0xED, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6,
+    0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE,
+    0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD,
+    0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6, 0x02, 0xA5, 0x02, 0xA4,
+    0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x80, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C,
+    0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83,
+    0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0x67, 0x06, 0xCF, 0x03, 0x9D,
+    0x07, 0xD0, 0x0C, 0xD1, 0x27, 0xD2, 0x08, 0xD1, 0x05, 0xD0, 0x02, 0x9D, 0x03, 0xCF, 0x03, 0xCE,
+    0x03, 0xCD, 0x03, 0xCC, 0x03, 0xCB, 0x02, 0xC2, 0x80, 0xC1, 0x02, 0xC0, 0x02, 0xBE, 0x81, 0xBD,
+    0xBC, 0x02, 0xBB, 0x84, 0xBA, 0xB9, 0xB8, 0xB7, 0xB5, 0x02, 0xC3, 0x93, 0xC4, 0xC5, 0xC6, 0xC7,
+    0xC8, 0xCA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE0, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEC,
+    0x02, 0xED, 0x82, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5,
+    0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD,
+    0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02, 0xAF, 0x80, 0xAE,
+    0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x80, 0xA5,
+    0x03, 0xA4, 0x02, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x03, 0x84,
+    0x02, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x02, 0x67, 0x02, 0xCE,
+    0x07, 0xCF, 0x03, 0x9D, 0x07, 0xD0, 0x0E, 0xD1, 0x1E, 0xD2, 0x0A, 0xD1, 0x04, 0xD0, 0x03, 0x9D,
+    0x03, 0xCF, 0x03, 0xCE, 0x04, 0xCD, 0x03, 0xCC, 0x02, 0xCB, 0x03, 0xC2, 0x80, 0xC1, 0x02, 0xC0,
+    0x02, 0xBE, 0x81, 0xBD, 0xBC, 0x02, 0xBB, 0x9B, 0xBA, 0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xC3, 0xC4,
+    0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xDC, 0xDD, 0xDE, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE6, 0xE7,
+    0xE8, 0xE9, 0xEB, 0xEC, 0x02, 0xED, 0x82, 0xEE, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3,
+    0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB,
+    0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x80, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x80, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68,
+    0x02, 0x67, 0x05, 0xCE, 0x06, 0xCF, 0x03, 0x9D, 0x09, 0xD0, 0x14, 0xD1, 0x02, 0xD2, 0x80, 0xD1,
+    0x06, 0xD2, 0x02, 0xD1, 0x80, 0xD2, 0x0E, 0xD1, 0x06, 0xD0, 0x02, 0x9D, 0x04, 0xCF, 0x04, 0xCE,
+    0x03, 0xCD, 0x03, 0xCC, 0x03, 0xCB, 0x03, 0xC2, 0x80, 0xC1, 0x02, 0xC0, 0x82, 0xBF, 0xBE, 0xBD,
+    0x02, 0xBC, 0x87, 0xBB, 0xBA, 0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xC3, 0x02, 0xC4, 0x94, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xDB, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE5, 0xE6, 0xE7, 0xE8, 0xEA,
+    0xEB, 0xEC, 0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x80, 0xF2, 0x02, 0xF3, 0x02, 0xF4,
+    0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC,
+    0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF,
+    0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6,
+    0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85,
+    0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x02, 0x67,
+    0x80, 0xCD, 0x06, 0xCE, 0x08, 0xCF, 0x03, 0x9D, 0x0A, 0xD0, 0x25, 0xD1, 0x07, 0xD0, 0x03, 0x9D,
+    0x04, 0xCF, 0x04, 0xCE, 0x03, 0xCD, 0x04, 0xCC, 0x03, 0xCB, 0x03, 0xC2, 0x81, 0xC1, 0xC0, 0x02,
+    0xBF, 0x81, 0xBE, 0xBD, 0x02, 0xBC, 0x80, 0xBB, 0x02, 0xBA, 0x80, 0xB9, 0x02, 0xB7, 0x8E, 0xB6,
+    0xB5, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE1, 0x02, 0xE2,
+    0x88, 0xE3, 0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0x02, 0xEE, 0x82, 0xEF, 0xF0, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x02, 0xB3,
+    0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9,
+    0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x80, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A,
+    0x03, 0x69, 0x03, 0x68, 0x80, 0x67, 0x03, 0xCD, 0x08, 0xCE, 0x06, 0xCF, 0x04, 0x9D, 0x0D, 0xD0,
+    0x19, 0xD1, 0x0A, 0xD0, 0x03, 0x9D, 0x04, 0xCF, 0x04, 0xCE, 0x05, 0xCD, 0x03, 0xCC, 0x04, 0xCB,
+    0x02, 0xC2, 0x02, 0xC1, 0x80, 0xC0, 0x02, 0xBF, 0x81, 0xBE, 0xBD, 0x02, 0xBC, 0x80, 0xBB, 0x02,
+    0xBA, 0x85, 0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xC3, 0x02, 0xC4, 0x80, 0xC6, 0x02, 0xC7, 0x92, 0xC8,
+    0xC9, 0xDB, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB,
+    0xEC, 0xED, 0x02, 0xEE, 0x82, 0xEF, 0xF0, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5,
+    0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x03, 0xFD,
+    0x02, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE,
+    0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5,
+    0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x80, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84,
+    0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x80, 0x67, 0x06, 0xCD,
+    0x07, 0xCE, 0x09, 0xCF, 0x05, 0x9D, 0x25, 0xD0, 0x04, 0x9D, 0x05, 0xCF, 0x05, 0xCE, 0x05, 0xCD,
+    0x04, 0xCC, 0x03, 0xCB, 0x03, 0xC2, 0x02, 0xC1, 0x81, 0xC0, 0xBF, 0x02, 0xBE, 0x80, 0xBD, 0x02,
+    0xBC, 0x02, 0xBB, 0x86, 0xBA, 0xB9, 0xB8, 0xB7, 0xB6, 0xB5, 0xC3, 0x02, 0xC4, 0x96, 0xC5, 0xC6,
+    0xC7, 0xC8, 0xC9, 0xCA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8,
+    0xE9, 0xEA, 0xEB, 0xEC, 0xED, 0x02, 0xEE, 0x82, 0xEF, 0xF0, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02,
+    0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x03,
+    0xFC, 0x81, 0xFD, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x80, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x02, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x03, 0x68,
+    0x80, 0xCC, 0x08, 0xCD, 0x08, 0xCE, 0x08, 0xCF, 0x81, 0x9D, 0xCF, 0x06, 0x9D, 0x19, 0xD0, 0x05,
+    0x9D, 0x08, 0xCF, 0x05, 0xCE, 0x05, 0xCD, 0x04, 0xCC, 0x04, 0xCB, 0x03, 0xC2, 0x80, 0xC1, 0x02,
+    0xC0, 0x80, 0xBF, 0x02, 0xBE, 0x80, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x84, 0xBA, 0xB9, 0xB8, 0xB7,
+    0xB6, 0x02, 0xB5, 0x83, 0xC3, 0xC4, 0xC5, 0xC6, 0x02, 0xC7, 0x88, 0xC8, 0xCA, 0xDB, 0xDC, 0xDD,
+    0xDF, 0xE0, 0xE1, 0xE2, 0x02, 0xE3, 0x86, 0xE5, 0xE6, 0xE7, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED,
+    0x80, 0xEE, 0x02, 0xEF, 0x81, 0xF0, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02,
+    0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x02,
+    0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x03, 0x84, 0x02,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x03, 0xCC, 0x08, 0xCD, 0x0A,
+    0xCE, 0x0C, 0xCF, 0x0A, 0x9D, 0x04, 0xD0, 0x0A, 0x9D, 0x09, 0xCF, 0x07, 0xCE, 0x06, 0xCD, 0x04,
+    0xCC, 0x04, 0xCB, 0x03, 0xC2, 0x02, 0xC1, 0x02, 0xC0, 0x80, 0xBF, 0x02, 0xBE, 0x80, 0xBD, 0x02,
+    0xBC, 0x02, 0xBB, 0x80, 0xBA, 0x02, 0xB9, 0x80, 0xB7, 0x02, 0xB6, 0x82, 0xB5, 0xC3, 0xC4, 0x02,
+    0xC5, 0x94, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xDB, 0xDC, 0xDD, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4,
+    0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x81, 0xEE, 0xEF, 0x02, 0xF0, 0x80, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3,
+    0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9,
+    0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x03, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A,
+    0x02, 0x69, 0x03, 0x68, 0x06, 0xCC, 0x09, 0xCD, 0x0A, 0xCE, 0x11, 0xCF, 0x82, 0x9D, 0xCF, 0x9D,
+    0x12, 0xCF, 0x07, 0xCE, 0x06, 0xCD, 0x06, 0xCC, 0x03, 0xCB, 0x04, 0xC2, 0x02, 0xC1, 0x02, 0xC0,
+    0x80, 0xBF, 0x02, 0xBE, 0x80, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x80, 0xBA, 0x02, 0xB9, 0x84, 0xB8,
+    0xB7, 0xB6, 0xB5, 0xC3, 0x02, 0xC4, 0x82, 0xC5, 0xC6, 0xC7, 0x02, 0xC8, 0x85, 0xC9, 0xDB, 0xDC,
+    0xDD, 0xDE, 0xE0, 0x02, 0xE1, 0x8A, 0xE2, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC,
+    0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5,
+    0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD,
+    0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x80, 0xAE,
+    0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5,
+    0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x80, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84,
+    0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x03, 0x68, 0x09, 0xCC, 0x0A, 0xCD,
+    0x0C, 0xCE, 0x81, 0xCF, 0xCE, 0x17, 0xCF, 0x0B, 0xCE, 0x07, 0xCD, 0x05, 0xCC, 0x05, 0xCB, 0x03,
+    0xC2, 0x02, 0xC1, 0x02, 0xC0, 0x80, 0xBF, 0x02, 0xBE, 0x02, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x80,
+    0xBA, 0x02, 0xB9, 0x83, 0xB8, 0xB7, 0xB6, 0xB5, 0x02, 0xC3, 0x80, 0xC4, 0x02, 0xC5, 0x02, 0xC7,
+    0x91, 0xC8, 0xC9, 0xCA, 0xDB, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7,
+    0xE8, 0xE9, 0xEB, 0x02, 0xEC, 0x80, 0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x02, 0xF2,
+    0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA,
+    0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2,
+    0x02, 0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8,
+    0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87,
+    0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69,
+    0x02, 0x68, 0x03, 0xCB, 0x08, 0xCC, 0x0C, 0xCD, 0x27, 0xCE, 0x09, 0xCD, 0x06, 0xCC, 0x05, 0xCB,
+    0x03, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x80, 0xBF, 0x02, 0xBE, 0x02, 0xBD, 0x02, 0xBC, 0x02, 0xBB,
+    0x80, 0xBA, 0x02, 0xB9, 0x83, 0xB8, 0xB7, 0xB6, 0xB5, 0x02, 0xC3, 0x80, 0xC4, 0x02, 0xC5, 0x89,
+    0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0x02, 0xE1, 0x89, 0xE2, 0xE3, 0xE4,
+    0xE5, 0xE6, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x03, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x80, 0xFF, 0x02, 0xB4, 0x02, 0xB3,
+    0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9,
+    0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x80, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A,
+    0x02, 0x69, 0x02, 0x68, 0x05, 0xCB, 0x0B, 0xCC, 0x0D, 0xCD, 0x1B, 0xCE, 0x0C, 0xCD, 0x06, 0xCC,
+    0x06, 0xCB, 0x04, 0xC2, 0x02, 0xC1, 0x02, 0xC0, 0x02, 0xBF, 0x02, 0xBE, 0x80, 0xBD, 0x02, 0xBC,
+    0x03, 0xBB, 0x80, 0xBA, 0x02, 0xB9, 0x83, 0xB8, 0xB7, 0xB6, 0xB5, 0x02, 0xC3, 0x80, 0xC4, 0x02,
+    0xC5, 0x80, 0xC6, 0x02, 0xC7, 0x89, 0xC8, 0xC9, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0xE2,
+    0x02, 0xE3, 0x87, 0xE4, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x80, 0xEE, 0x02,
+    0xEF, 0x81, 0xF0, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x02, 0xF7,
+    0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x02, 0xFE, 0x02, 0xFF,
+    0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x80, 0xAC,
+    0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x80, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3,
+    0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x02, 0x8B,
+    0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82,
+    0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x02, 0x68, 0x08, 0xCB, 0x0C, 0xCC, 0x15, 0xCD, 0x80, 0xCE,
+    0x16, 0xCD, 0x08, 0xCC, 0x06, 0xCB, 0x04, 0xC2, 0x02, 0xC1, 0x02, 0xC0, 0x02, 0xBF, 0x02, 0xBE,
+    0x02, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x02, 0xBA, 0x80, 0xB9, 0x02, 0xB8, 0x81, 0xB7, 0xB6, 0x02,
+    0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x81, 0xC5, 0xC6, 0x02, 0xC7, 0x87, 0xC8, 0xC9, 0xCA, 0xDB, 0xDC,
+    0xDD, 0xDE, 0xE0, 0x02, 0xE1, 0x86, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0x02, 0xEA, 0x82,
+    0xEB, 0xEC, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x80, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02,
+    0xF4, 0x03, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x02,
+    0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x80, 0xB1, 0x02,
+    0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02,
+    0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02,
+    0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02,
+    0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x02, 0x68, 0x02,
+    0xC2, 0x0A, 0xCB, 0x0D, 0xCC, 0x21, 0xCD, 0x0B, 0xCC, 0x06, 0xCB, 0x05, 0xC2, 0x02, 0xC1, 0x03,
+    0xC0, 0x80, 0xBF, 0x03, 0xBE, 0x02, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x02, 0xBA, 0x80, 0xB9, 0x02,
+    0xB8, 0x81, 0xB7, 0xB6, 0x02, 0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x81, 0xC5, 0xC6, 0x02, 0xC7, 0x89,
+    0xC8, 0xC9, 0xCA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0x02, 0xE2, 0x87, 0xE3, 0xE4, 0xE5,
+    0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0x02, 0xEC, 0x80, 0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3,
+    0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9,
+    0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91,
+    0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A,
+    0x02, 0x69, 0x02, 0x68, 0x05, 0xC2, 0x0B, 0xCB, 0x11, 0xCC, 0x13, 0xCD, 0x0E, 0xCC, 0x07, 0xCB,
+    0x05, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x02, 0xBF, 0x02, 0xBE, 0x02, 0xBD, 0x02, 0xBC, 0x03, 0xBB,
+    0x02, 0xBA, 0x81, 0xB9, 0xB8, 0x02, 0xB7, 0x80, 0xB6, 0x02, 0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x02,
+    0xC5, 0x82, 0xC6, 0xC7, 0xC8, 0x02, 0xC9, 0x02, 0xDB, 0x02, 0xDD, 0x81, 0xDF, 0xE0, 0x02, 0xE1,
+    0x8A, 0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x02, 0xEE,
+    0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03,
+    0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02,
+    0xFE, 0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x80, 0x84, 0x03,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x80, 0x68, 0x08, 0xC2, 0x0C, 0xCB, 0x28,
+    0xCC, 0x81, 0xCB, 0xCC, 0x08, 0xCB, 0x06, 0xC2, 0x02, 0xC1, 0x03, 0xC0, 0x02, 0xBF, 0x03, 0xBE,
+    0x02, 0xBD, 0x02, 0xBC, 0x02, 0xBB, 0x02, 0xBA, 0x02, 0xB9, 0x02, 0xB8, 0x81, 0xB7, 0xB6, 0x02,
+    0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x80, 0xC6, 0x02, 0xC7, 0x89, 0xC8, 0xC9, 0xCA, 0xDB,
+    0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0x02, 0xE2, 0x87, 0xE3, 0xE4, 0xE5, 0xE7, 0xE8, 0xE9, 0xEA,
+    0xEB, 0x02, 0xEC, 0x02, 0xED, 0x80, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02,
+    0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02,
+    0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02,
+    0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80,
+    0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02,
+    0x90, 0x02, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02,
+    0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02,
+    0x69, 0x80, 0x68, 0x03, 0xC1, 0x09, 0xC2, 0x0E, 0xCB, 0x1E, 0xCC, 0x0B, 0xCB, 0x06, 0xC2, 0x03,
+    0xC1, 0x03, 0xC0, 0x02, 0xBF, 0x03, 0xBE, 0x02, 0xBD, 0x03, 0xBC, 0x02, 0xBB, 0x02, 0xBA, 0x02,
+    0xB9, 0x80, 0xB8, 0x02, 0xB7, 0x80, 0xB6, 0x02, 0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x80,
+    0xC6, 0x02, 0xC7, 0x88, 0xC8, 0xC9, 0xCA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0x02, 0xE1, 0x8A,
+    0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x80,
+    0xEF, 0x02, 0xF0, 0x80, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03,
+    0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02,
+    0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x80,
+    0x8C, 0x03, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02,
+    0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x80, 0x68, 0x02, 0xC0, 0x04, 0xC1, 0x0A,
+    0xC2, 0x13, 0xCB, 0x80, 0xCC, 0x02, 0xCB, 0x04, 0xCC, 0x81, 0xCB, 0xCC, 0x13, 0xCB, 0x07, 0xC2,
+    0x03, 0xC1, 0x04, 0xC0, 0x02, 0xBF, 0x03, 0xBE, 0x02, 0xBD, 0x03, 0xBC, 0x03, 0xBB, 0x02, 0xBA,
+    0x02, 0xB9, 0x81, 0xB8, 0xB7, 0x02, 0xB6, 0x02, 0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x80,
+    0xC6, 0x02, 0xC7, 0x80, 0xC8, 0x02, 0xC9, 0x02, 0xDB, 0x02, 0xDD, 0x81, 0xDE, 0xDF, 0x02, 0xE1,
+    0x80, 0xE2, 0x02, 0xE3, 0x83, 0xE4, 0xE5, 0xE6, 0xE7, 0x02, 0xE9, 0x82, 0xEA, 0xEB, 0xEC, 0x02,
+    0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5,
+    0x02, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD,
+    0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF,
+    0x80, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x02, 0xA6,
+    0x03, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85,
+    0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x80, 0x68, 0x04, 0xC0,
+    0x06, 0xC1, 0x0B, 0xC2, 0x25, 0xCB, 0x09, 0xC2, 0x03, 0xC1, 0x05, 0xC0, 0x02, 0xBF, 0x03, 0xBE,
+    0x02, 0xBD, 0x03, 0xBC, 0x03, 0xBB, 0x02, 0xBA, 0x02, 0xB9, 0x02, 0xB8, 0x80, 0xB7, 0x02, 0xB6,
+    0x80, 0xB5, 0x02, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x81, 0xC7, 0xC8, 0x02, 0xC9, 0x87,
+    0xCA, 0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0xE1, 0x02, 0xE2, 0x88, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7,
+    0xE8, 0xE9, 0xEA, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x80, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x02, 0xF9,
+    0x03, 0xFA, 0x80, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x80, 0xB4,
+    0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA,
+    0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x02, 0x92,
+    0x80, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89,
+    0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B,
+    0x80, 0x6A, 0x03, 0x69, 0x02, 0xBF, 0x06, 0xC0, 0x05, 0xC1, 0x0E, 0xC2, 0x81, 0xCB, 0xC2, 0x15,
+    0xCB, 0x80, 0xC2, 0x02, 0xCB, 0x0B, 0xC2, 0x04, 0xC1, 0x04, 0xC0, 0x03, 0xBF, 0x03, 0xBE, 0x02,
+    0xBD, 0x03, 0xBC, 0x04, 0xBB, 0x02, 0xBA, 0x02, 0xB9, 0x80, 0xB8, 0x02, 0xB7, 0x80, 0xB6, 0x03,
+    0xB5, 0x80, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x81, 0xC7, 0xC8, 0x02, 0xC9, 0x86, 0xCA,
+    0xDB, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0, 0x02, 0xE1, 0x80, 0xE2, 0x02, 0xE3, 0x82, 0xE4, 0xE5, 0xE6,
+    0x02, 0xE8, 0x83, 0xE9, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02,
+    0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x02, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x02,
+    0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02,
+    0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80,
+    0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x80,
+    0x92, 0x03, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02,
+    0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03,
+    0x6B, 0x02, 0x6A, 0x02, 0x69, 0x80, 0xBE, 0x04, 0xBF, 0x07, 0xC0, 0x06, 0xC1, 0x29, 0xC2, 0x06,
+    0xC1, 0x04, 0xC0, 0x03, 0xBF, 0x04, 0xBE, 0x02, 0xBD, 0x04, 0xBC, 0x03, 0xBB, 0x03, 0xBA, 0x80,
+    0xB9, 0x02, 0xB8, 0x02, 0xB7, 0x02, 0xB6, 0x80, 0xB5, 0x02, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x02,
+    0xC6, 0x81, 0xC7, 0xC8, 0x02, 0xC9, 0x83, 0xCA, 0xDB, 0xDC, 0xDD, 0x02, 0xDE, 0x02, 0xE0, 0x80,
+    0xE1, 0x02, 0xE2, 0x88, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0x02, 0xEC, 0x02,
+    0xED, 0x02, 0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5,
+    0x03, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x02, 0xFD,
+    0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE,
+    0x80, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5,
+    0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84,
+    0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x04, 0xBE, 0x05, 0xBF, 0x07, 0xC0,
+    0x0A, 0xC1, 0x1C, 0xC2, 0x06, 0xC1, 0x06, 0xC0, 0x03, 0xBF, 0x04, 0xBE, 0x03, 0xBD, 0x04, 0xBC,
+    0x03, 0xBB, 0x03, 0xBA, 0x02, 0xB9, 0x02, 0xB8, 0x02, 0xB7, 0x80, 0xB6, 0x02, 0xB5, 0x02, 0xC3,
+    0x02, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x80, 0xC7, 0x02, 0xC8, 0x81, 0xC9, 0xCA, 0x02, 0xDB, 0x02,
+    0xDD, 0x82, 0xDE, 0xDF, 0xE0, 0x02, 0xE1, 0x80, 0xE2, 0x02, 0xE3, 0x02, 0xE5, 0x81, 0xE6, 0xE8,
+    0x02, 0xE9, 0x82, 0xEA, 0xEB, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1,
+    0x02, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x02, 0xF9,
+    0x03, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3,
+    0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9,
+    0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A,
+    0x02, 0x69, 0x80, 0xBD, 0x06, 0xBE, 0x06, 0xBF, 0x08, 0xC0, 0x11, 0xC1, 0x02, 0xC2, 0x0E, 0xC1,
+    0x08, 0xC0, 0x03, 0xBF, 0x06, 0xBE, 0x03, 0xBD, 0x04, 0xBC, 0x03, 0xBB, 0x03, 0xBA, 0x03, 0xB9,
+    0x80, 0xB8, 0x02, 0xB7, 0x02, 0xB6, 0x02, 0xB5, 0x02, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x80, 0xC6,
+    0x02, 0xC7, 0x80, 0xC8, 0x02, 0xC9, 0x80, 0xCA, 0x02, 0xDB, 0x84, 0xDC, 0xDD, 0xDE, 0xDF, 0xE0,
+    0x02, 0xE1, 0x80, 0xE2, 0x02, 0xE3, 0x87, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xEB, 0x02,
+    0xEC, 0x02, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02, 0xF3, 0x03,
+    0xF4, 0x02, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x03,
+    0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x05,
+    0xBD, 0x07, 0xBE, 0x06, 0xBF, 0x0C, 0xC0, 0x0F, 0xC1, 0x81, 0xC0, 0xC1, 0x0B, 0xC0, 0x05, 0xBF,
+    0x05, 0xBE, 0x03, 0xBD, 0x04, 0xBC, 0x04, 0xBB, 0x04, 0xBA, 0x02, 0xB9, 0x80, 0xB8, 0x03, 0xB7,
+    0x80, 0xB6, 0x02, 0xB5, 0x03, 0xC3, 0x02, 0xC4, 0x80, 0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x82, 0xC8,
+    0xC9, 0xCA, 0x02, 0xDB, 0x83, 0xDC, 0xDD, 0xDE, 0xDF, 0x02, 0xE0, 0x80, 0xE1, 0x02, 0xE2, 0x81,
+    0xE3, 0xE4, 0x02, 0xE5, 0x81, 0xE7, 0xE8, 0x02, 0xE9, 0x82, 0xEA, 0xEB, 0xEC, 0x03, 0xED, 0x80,
+    0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x03, 0xF3, 0x02, 0xF4, 0x03, 0xF5, 0x02,
+    0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03,
+    0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x80, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x80,
+    0x8C, 0x03, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02,
+    0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x03, 0xBC, 0x05, 0xBD, 0x09, 0xBE, 0x07,
+    0xBF, 0x1C, 0xC0, 0x06, 0xBF, 0x06, 0xBE, 0x05, 0xBD, 0x04, 0xBC, 0x04, 0xBB, 0x04, 0xBA, 0x02,
+    0xB9, 0x02, 0xB8, 0x02, 0xB7, 0x02, 0xB6, 0x02, 0xB5, 0x02, 0xC3, 0x03, 0xC4, 0x02, 0xC5, 0x80,
+    0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x80, 0xC9, 0x02, 0xCA, 0x81, 0xDB, 0xDC, 0x02, 0xDD, 0x80, 0xDE,
+    0x02, 0xE0, 0x80, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x87, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA,
+    0xEB, 0x02, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x02,
+    0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02,
+    0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x05,
+    0xBC, 0x07, 0xBD, 0x0B, 0xBE, 0x0B, 0xBF, 0x02, 0xC0, 0x81, 0xBF, 0xC0, 0x0E, 0xBF, 0x08, 0xBE,
+    0x05, 0xBD, 0x05, 0xBC, 0x05, 0xBB, 0x04, 0xBA, 0x02, 0xB9, 0x02, 0xB8, 0x02, 0xB7, 0x02, 0xB6,
+    0x02, 0xB5, 0x03, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x80, 0xC9,
+    0x02, 0xCA, 0x82, 0xDB, 0xDC, 0xDD, 0x02, 0xDE, 0x81, 0xDF, 0xE0, 0x02, 0xE1, 0x80, 0xE2, 0x02,
+    0xE3, 0x84, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0x02, 0xE9, 0x82, 0xEA, 0xEB, 0xEC, 0x03, 0xED, 0x02,
+    0xEE, 0x81, 0xEF, 0xF0, 0x02, 0xF1, 0x03, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6,
+    0x02, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE,
+    0x02, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD,
+    0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4,
+    0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C,
+    0x02, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83,
+    0x02, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x82, 0xBB, 0xBC, 0xBB, 0x07, 0xBC, 0x07, 0xBD,
+    0x81, 0xBE, 0xBD, 0x0E, 0xBE, 0x81, 0xBF, 0xBE, 0x02, 0xBF, 0x03, 0xBE, 0x80, 0xBF, 0x0F, 0xBE,
+    0x06, 0xBD, 0x06, 0xBC, 0x05, 0xBB, 0x04, 0xBA, 0x02, 0xB9, 0x02, 0xB8, 0x03, 0xB7, 0x02, 0xB6,
+    0x02, 0xB5, 0x03, 0xC3, 0x02, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x81, 0xC9,
+    0xCA, 0x02, 0xDB, 0x81, 0xDC, 0xDD, 0x02, 0xDE, 0x81, 0xDF, 0xE0, 0x02, 0xE1, 0x02, 0xE2, 0x82,
+    0xE3, 0xE4, 0xE5, 0x02, 0xE6, 0x02, 0xE8, 0x82, 0xE9, 0xEA, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x02,
+    0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x03, 0xF3, 0x02, 0xF4, 0x03, 0xF5, 0x02,
+    0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x03, 0xF9, 0x02, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x03, 0xFD, 0x02,
+    0xFE, 0x02, 0xFF, 0x03, 0xB4, 0x80, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02,
+    0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x03, 0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x80, 0x85, 0x02, 0x84, 0x03,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x80, 0x69, 0x07, 0xBB, 0x08, 0xBC, 0x09, 0xBD, 0x02,
+    0xBE, 0x80, 0xBD, 0x16, 0xBE, 0x08, 0xBD, 0x08, 0xBC, 0x05, 0xBB, 0x04, 0xBA, 0x03, 0xB9, 0x02,
+    0xB8, 0x03, 0xB7, 0x02, 0xB6, 0x03, 0xB5, 0x02, 0xC3, 0x03, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x02,
+    0xC7, 0x02, 0xC8, 0x80, 0xC9, 0x02, 0xCA, 0x81, 0xDB, 0xDC, 0x02, 0xDD, 0x82, 0xDE, 0xDF, 0xE0,
+    0x02, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x85, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0x02, 0xEA, 0x81,
+    0xEB, 0xEC, 0x03, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x03, 0xF3,
+    0x02, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x03, 0xF9, 0x02, 0xFA, 0x03, 0xFB,
+    0x02, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x03, 0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x80, 0x85, 0x03, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x81, 0x69, 0xBA, 0x0A,
+    0xBB, 0x0A, 0xBC, 0x81, 0xBD, 0xBC, 0x1C, 0xBD, 0x81, 0xBC, 0xBD, 0x08, 0xBC, 0x06, 0xBB, 0x04,
+    0xBA, 0x04, 0xB9, 0x02, 0xB8, 0x04, 0xB7, 0x80, 0xB6, 0x03, 0xB5, 0x02, 0xC3, 0x03, 0xC4, 0x02,
+    0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x02, 0xC8, 0x81, 0xC9, 0xCA, 0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD,
+    0x82, 0xDE, 0xDF, 0xE0, 0x02, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x84, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8,
+    0x02, 0xE9, 0x81, 0xEA, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02,
+    0xF1, 0x03, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x03,
+    0xF9, 0x02, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02,
+    0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x80, 0xAA, 0x03,
+    0xA9, 0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x03,
+    0x91, 0x80, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02,
+    0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02,
+    0x6A, 0x80, 0x69, 0x04, 0xBA, 0x0D, 0xBB, 0x10, 0xBC, 0x02, 0xBD, 0x80, 0xBC, 0x03, 0xBD, 0x81,
+    0xBC, 0xBD, 0x0E, 0xBC, 0x08, 0xBB, 0x06, 0xBA, 0x03, 0xB9, 0x03, 0xB8, 0x03, 0xB7, 0x02, 0xB6,
+    0x03, 0xB5, 0x03, 0xC3, 0x02, 0xC4, 0x03, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02, 0xC9,
+    0x80, 0xCA, 0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD, 0x82, 0xDE, 0xDF, 0xE0, 0x02, 0xE1, 0x02, 0xE2,
+    0x02, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x02, 0xE7, 0x82, 0xE8, 0xE9, 0xEA, 0x02, 0xEB, 0x80, 0xEC,
+    0x03, 0xED, 0x02, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x03, 0xF3, 0x02, 0xF4,
+    0x03, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x03, 0xFC,
+    0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x02, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x03, 0x91, 0x80, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x80, 0x69, 0x02, 0xB9,
+    0x07, 0xBA, 0x0E, 0xBB, 0x1A, 0xBC, 0x0B, 0xBB, 0x06, 0xBA, 0x04, 0xB9, 0x03, 0xB8, 0x03, 0xB7,
+    0x03, 0xB6, 0x02, 0xB5, 0x03, 0xC3, 0x03, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x02, 0xC8,
+    0x02, 0xC9, 0x80, 0xCA, 0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD, 0x81, 0xDE, 0xDF, 0x02, 0xE0, 0x02,
+    0xE1, 0x80, 0xE2, 0x02, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x02, 0xE7, 0x81, 0xE8, 0xE9, 0x02, 0xEA,
+    0x80, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1, 0x03, 0xF2,
+    0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA,
+    0x02, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3,
+    0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x80, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x03, 0xA9,
+    0x80, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x80, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A,
+    0x80, 0x69, 0x06, 0xB9, 0x08, 0xBA, 0x29, 0xBB, 0x08, 0xBA, 0x04, 0xB9, 0x03, 0xB8, 0x03, 0xB7,
+    0x03, 0xB6, 0x03, 0xB5, 0x03, 0xC3, 0x04, 0xC4, 0x02, 0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x02, 0xC8,
+    0x02, 0xC9, 0x80, 0xCA, 0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD, 0x81, 0xDE, 0xDF, 0x02, 0xE0, 0x02,
+    0xE1, 0x80, 0xE2, 0x02, 0xE3, 0x02, 0xE4, 0x82, 0xE5, 0xE6, 0xE7, 0x02, 0xE8, 0x81, 0xE9, 0xEA,
+    0x02, 0xEB, 0x80, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2,
+    0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x03, 0xF9, 0x02, 0xFA,
+    0x03, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2,
+    0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x80, 0xA8,
+    0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87,
+    0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x03,
+    0xB8, 0x07, 0xB9, 0x0B, 0xBA, 0x1C, 0xBB, 0x09, 0xBA, 0x06, 0xB9, 0x02, 0xB8, 0x05, 0xB7, 0x03,
+    0xB6, 0x03, 0xB5, 0x03, 0xC3, 0x04, 0xC4, 0x03, 0xC5, 0x02, 0xC6, 0x02, 0xC7, 0x02, 0xC8, 0x02,
+    0xC9, 0x02, 0xCA, 0x80, 0xDB, 0x02, 0xDC, 0x02, 0xDD, 0x81, 0xDE, 0xDF, 0x02, 0xE0, 0x02, 0xE1,
+    0x02, 0xE2, 0x02, 0xE3, 0x83, 0xE4, 0xE5, 0xE6, 0xE7, 0x02, 0xE8, 0x81, 0xE9, 0xEA, 0x02, 0xEB,
+    0x80, 0xEC, 0x03, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x03, 0xF1, 0x02, 0xF2, 0x03, 0xF3,
+    0x02, 0xF4, 0x03, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x03, 0xFB,
+    0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x80, 0xB1,
+    0x02, 0xAF, 0x03, 0xAE, 0x80, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x80, 0x91, 0x02, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x80, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x02, 0xB7, 0x05,
+    0xB8, 0x09, 0xB9, 0x0F, 0xBA, 0x80, 0xBB, 0x15, 0xBA, 0x06, 0xB9, 0x05, 0xB8, 0x04, 0xB7, 0x04,
+    0xB6, 0x03, 0xB5, 0x04, 0xC3, 0x03, 0xC4, 0x03, 0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x80, 0xC8, 0x03,
+    0xC9, 0x02, 0xCA, 0x80, 0xDB, 0x02, 0xDC, 0x80, 0xDD, 0x02, 0xDE, 0x80, 0xDF, 0x02, 0xE0, 0x02,
+    0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x81, 0xE4, 0xE5, 0x02, 0xE6, 0x82, 0xE7, 0xE8, 0xE9, 0x02, 0xEA,
+    0x80, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2,
+    0x02, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA,
+    0x02, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2,
+    0x02, 0xB1, 0x80, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8,
+    0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87,
+    0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x06,
+    0xB7, 0x06, 0xB8, 0x0A, 0xB9, 0x17, 0xBA, 0x81, 0xB9, 0xBA, 0x09, 0xB9, 0x03, 0xB8, 0x05, 0xB7,
+    0x05, 0xB6, 0x03, 0xB5, 0x04, 0xC3, 0x03, 0xC4, 0x04, 0xC5, 0x02, 0xC6, 0x03, 0xC7, 0x03, 0xC8,
+    0x80, 0xC9, 0x02, 0xCA, 0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD, 0x02, 0xDE, 0x80, 0xDF, 0x02, 0xE0,
+    0x02, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x81, 0xE4, 0xE5, 0x02, 0xE6, 0x02, 0xE8, 0x02, 0xE9, 0x80,
+    0xEA, 0x02, 0xEB, 0x80, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x02, 0xF1, 0x03,
+    0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03,
+    0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x02,
+    0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02,
+    0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x80, 0x91, 0x02,
+    0x90, 0x03, 0x8F, 0x80, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02,
+    0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69,
+    0x04, 0xB6, 0x07, 0xB7, 0x08, 0xB8, 0x1F, 0xB9, 0x06, 0xB8, 0x05, 0xB7, 0x05, 0xB6, 0x04, 0xB5,
+    0x03, 0xC3, 0x04, 0xC4, 0x04, 0xC5, 0x03, 0xC6, 0x03, 0xC7, 0x02, 0xC8, 0x02, 0xC9, 0x02, 0xCA,
+    0x02, 0xDB, 0x80, 0xDC, 0x02, 0xDD, 0x80, 0xDE, 0x02, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x02, 0xE2,
+    0x02, 0xE3, 0x81, 0xE4, 0xE5, 0x02, 0xE6, 0x81, 0xE7, 0xE8, 0x02, 0xE9, 0x80, 0xEA, 0x02, 0xEB,
+    0x02, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x02, 0xF2, 0x03, 0xF3,
+    0x03, 0xF4, 0x03, 0xF5, 0x02, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x02, 0xFA, 0x03, 0xFB,
+    0x03, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2,
+    0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x02, 0xA8,
+    0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87,
+    0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0xB5,
+    0x06, 0xB6, 0x09, 0xB7, 0x0D, 0xB8, 0x86, 0xB9, 0xB8, 0xB9, 0xB8, 0xB9, 0xB8, 0xB9, 0x02, 0xB8,
+    0x80, 0xB9, 0x09, 0xB8, 0x08, 0xB7, 0x06, 0xB6, 0x04, 0xB5, 0x04, 0xC3, 0x05, 0xC4, 0x04, 0xC5,
+    0x02, 0xC6, 0x03, 0xC7, 0x03, 0xC8, 0x02, 0xC9, 0x80, 0xCA, 0x02, 0xDB, 0x02, 0xDC, 0x02, 0xDD,
+    0x81, 0xDE, 0xDF, 0x02, 0xE0, 0x03, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x82,
+    0xE6, 0xE7, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x80, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x80,
+    0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03,
+    0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x02, 0xFD, 0x03, 0xFE, 0x03,
+    0xFF, 0x80, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02,
+    0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x08, 0xB5, 0x06, 0xB6, 0x0E, 0xB7, 0x80, 0xB8, 0x02, 0xB7,
+    0x04, 0xB8, 0x02, 0xB7, 0x80, 0xB8, 0x0D, 0xB7, 0x07, 0xB6, 0x06, 0xB5, 0x05, 0xC3, 0x05, 0xC4,
+    0x03, 0xC5, 0x03, 0xC6, 0x03, 0xC7, 0x03, 0xC8, 0x02, 0xC9, 0x02, 0xCA, 0x02, 0xDB, 0x80, 0xDC,
+    0x03, 0xDD, 0x81, 0xDE, 0xDF, 0x03, 0xE0, 0x02, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x80, 0xE4, 0x02,
+    0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x80, 0xE9, 0x02, 0xEA, 0x80, 0xEB, 0x02, 0xEC, 0x02, 0xED,
+    0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x03, 0xF5,
+    0x03, 0xF6, 0x03, 0xF7, 0x02, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x02, 0xFD,
+    0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE,
+    0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5,
+    0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84,
+    0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x04, 0xC3, 0x08, 0xB5, 0x0B, 0xB6, 0x14,
+    0xB7, 0x81, 0xB6, 0xB7, 0x08, 0xB6, 0x07, 0xB5, 0x06, 0xC3, 0x04, 0xC4, 0x05, 0xC5, 0x03, 0xC6,
+    0x04, 0xC7, 0x02, 0xC8, 0x03, 0xC9, 0x80, 0xCA, 0x02, 0xDB, 0x02, 0xDC, 0x02, 0xDD, 0x02, 0xDE,
+    0x80, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x03, 0xE2, 0x02, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x81, 0xE6,
+    0xE7, 0x02, 0xE8, 0x80, 0xE9, 0x02, 0xEA, 0x80, 0xEB, 0x03, 0xEC, 0x02, 0xED, 0x02, 0xEE, 0x02,
+    0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x03,
+    0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02,
+    0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x03, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x09, 0xC3, 0x0B, 0xB5, 0x1B, 0xB6, 0x08, 0xB5, 0x07, 0xC3, 0x06,
+    0xC4, 0x05, 0xC5, 0x02, 0xC6, 0x04, 0xC7, 0x03, 0xC8, 0x03, 0xC9, 0x02, 0xCA, 0x02, 0xDB, 0x02,
+    0xDC, 0x02, 0xDD, 0x02, 0xDE, 0x80, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x03, 0xE2, 0x02, 0xE3, 0x80,
+    0xE4, 0x02, 0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x81, 0xEA, 0xEB, 0x02, 0xEC, 0x03,
+    0xED, 0x03, 0xEE, 0x80, 0xEF, 0x02, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x02, 0xF3, 0x03, 0xF4, 0x03,
+    0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x02,
+    0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02,
+    0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02,
+    0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03, 0x8F, 0x80,
+    0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02,
+    0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x04, 0xC4, 0x09, 0xC3, 0x81,
+    0xB5, 0xC3, 0x0F, 0xB5, 0x02, 0xB6, 0x80, 0xB5, 0x02, 0xB6, 0x0E, 0xB5, 0x81, 0xC3, 0xB5, 0x08,
+    0xC3, 0x06, 0xC4, 0x05, 0xC5, 0x04, 0xC6, 0x03, 0xC7, 0x03, 0xC8, 0x02, 0xC9, 0x03, 0xCA, 0x02,
+    0xDB, 0x02, 0xDC, 0x03, 0xDD, 0x80, 0xDE, 0x02, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x02, 0xE2, 0x03,
+    0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x80, 0xEA, 0x02, 0xEB,
+    0x02, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2, 0x03, 0xF3,
+    0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x02, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB,
+    0x02, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2,
+    0x03, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x80, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8,
+    0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x03, 0x91, 0x80, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x80, 0x87,
+    0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x08, 0xC4,
+    0x10, 0xC3, 0x11, 0xB5, 0x0D, 0xC3, 0x08, 0xC4, 0x05, 0xC5, 0x04, 0xC6, 0x04, 0xC7, 0x03, 0xC8,
+    0x03, 0xC9, 0x02, 0xCA, 0x03, 0xDB, 0x80, 0xDC, 0x03, 0xDD, 0x02, 0xDE, 0x80, 0xDF, 0x02, 0xE0,
+    0x03, 0xE1, 0x02, 0xE2, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x02,
+    0xE9, 0x80, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x03, 0xED, 0x02, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02,
+    0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x03,
+    0xF9, 0x03, 0xFA, 0x02, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x02,
+    0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02,
+    0xA9, 0x02, 0xA8, 0x80, 0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02,
+    0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03,
+    0x88, 0x80, 0x87, 0x03, 0x86, 0x02, 0x85, 0x03, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02,
+    0x6A, 0x03, 0xC5, 0x81, 0xC4, 0xC5, 0x0B, 0xC4, 0x21, 0xC3, 0x09, 0xC4, 0x06, 0xC5, 0x04, 0xC6,
+    0x05, 0xC7, 0x03, 0xC8, 0x03, 0xC9, 0x02, 0xCA, 0x03, 0xDB, 0x02, 0xDC, 0x03, 0xDD, 0x80, 0xDE,
+    0x02, 0xDF, 0x02, 0xE0, 0x02, 0xE1, 0x03, 0xE2, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x81, 0xE6,
+    0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x80, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x03, 0xED, 0x02, 0xEE, 0x03,
+    0xEF, 0x80, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x02, 0xF5, 0x04, 0xF6, 0x03,
+    0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03,
+    0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x09, 0xC5, 0x0E, 0xC4, 0x0B, 0xC3, 0x80, 0xC4, 0x04, 0xC3, 0x81,
+    0xC4, 0xC3, 0x0C, 0xC4, 0x07, 0xC5, 0x05, 0xC6, 0x06, 0xC7, 0x03, 0xC8, 0x03, 0xC9, 0x03, 0xCA,
+    0x02, 0xDB, 0x02, 0xDC, 0x03, 0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x80, 0xE0, 0x04, 0xE1, 0x02, 0xE2,
+    0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x80, 0xEA, 0x02,
+    0xEB, 0x02, 0xEC, 0x03, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x80, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x03,
+    0xF3, 0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x02,
+    0xFB, 0x04, 0xFC, 0x02, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02,
+    0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02,
+    0xA8, 0x02, 0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02,
+    0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03,
+    0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x03,
+    0xC6, 0x0D, 0xC5, 0x1F, 0xC4, 0x0A, 0xC5, 0x05, 0xC6, 0x06, 0xC7, 0x04, 0xC8, 0x03, 0xC9, 0x02,
+    0xCA, 0x03, 0xDB, 0x03, 0xDC, 0x02, 0xDD, 0x80, 0xDE, 0x02, 0xDF, 0x03, 0xE0, 0x03, 0xE1, 0x03,
+    0xE2, 0x02, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x81, 0xE6, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0xEA,
+    0x80, 0xEB, 0x02, 0xEC, 0x03, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x02, 0xF1, 0x03, 0xF2,
+    0x03, 0xF3, 0x04, 0xF4, 0x02, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x02, 0xF9, 0x04, 0xFA,
+    0x02, 0xFB, 0x04, 0xFC, 0x81, 0xFD, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x80, 0xB3, 0x03,
+    0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02,
+    0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02,
+    0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03,
+    0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02,
+    0xC7, 0x09, 0xC6, 0x12, 0xC5, 0x82, 0xC4, 0xC5, 0xC4, 0x14, 0xC5, 0x06, 0xC6, 0x06, 0xC7, 0x04,
+    0xC8, 0x05, 0xC9, 0x02, 0xCA, 0x03, 0xDB, 0x02, 0xDC, 0x03, 0xDD, 0x02, 0xDE, 0x02, 0xDF, 0x02,
+    0xE0, 0x03, 0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x02, 0xE6, 0x80, 0xE7, 0x02,
+    0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x80, 0xEC, 0x03, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02,
+    0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x03,
+    0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02,
+    0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x03, 0xB1, 0x80, 0xAF, 0x03, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02,
+    0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03, 0xA5, 0x80, 0xA4, 0x03, 0xA3, 0x02,
+    0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02,
+    0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03,
+    0x6B, 0x02, 0x6A, 0x07, 0xC7, 0x0A, 0xC6, 0x1B, 0xC5, 0x0B, 0xC6, 0x06, 0xC7, 0x05, 0xC8, 0x04,
+    0xC9, 0x03, 0xCA, 0x02, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xDE, 0x02, 0xDF, 0x02, 0xE0, 0x03,
+    0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x80, 0xE4, 0x02, 0xE5, 0x80, 0xE6, 0x02, 0xE7, 0x02, 0xE8, 0x02,
+    0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x04,
+    0xF1, 0x02, 0xF2, 0x03, 0xF3, 0x04, 0xF4, 0x02, 0xF5, 0x04, 0xF6, 0x03, 0xF7, 0x03, 0xF8, 0x03,
+    0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x02, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02,
+    0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02,
+    0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02,
+    0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02,
+    0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02,
+    0x6A, 0x80, 0xC8, 0x0B, 0xC7, 0x24, 0xC6, 0x09, 0xC7, 0x05, 0xC8, 0x05, 0xC9, 0x03, 0xCA, 0x03,
+    0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x02, 0xDE, 0x03, 0xDF, 0x02, 0xE0, 0x03, 0xE1, 0x03, 0xE2, 0x03,
+    0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x80, 0xE6, 0x02, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02,
+    0xEB, 0x02, 0xEC, 0x02, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x03, 0xF0, 0x02, 0xF1, 0x04, 0xF2, 0x02,
+    0xF3, 0x04, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x04, 0xF8, 0x02, 0xF9, 0x03, 0xFA, 0x03,
+    0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x03, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x06, 0xC8,
+    0x81, 0xC7, 0xC8, 0x0C, 0xC7, 0x80, 0xC6, 0x04, 0xC7, 0x0B, 0xC6, 0x80, 0xC7, 0x02, 0xC6, 0x0E,
+    0xC7, 0x06, 0xC8, 0x05, 0xC9, 0x03, 0xCA, 0x04, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xDE, 0x02,
+    0xDF, 0x03, 0xE0, 0x03, 0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x80, 0xE4, 0x03, 0xE5, 0x80, 0xE6, 0x02,
+    0xE7, 0x80, 0xE8, 0x02, 0xE9, 0x03, 0xEA, 0x80, 0xEB, 0x02, 0xEC, 0x04, 0xED, 0x03, 0xEE, 0x02,
+    0xEF, 0x02, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x04,
+    0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02,
+    0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03,
+    0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x80, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x04, 0xC9, 0x09, 0xC8, 0x22, 0xC7, 0x08, 0xC8, 0x04, 0xC9, 0x81,
+    0xCA, 0xC9, 0x04, 0xCA, 0x03, 0xDB, 0x03, 0xDC, 0x03, 0xDD, 0x03, 0xDE, 0x03, 0xDF, 0x02, 0xE0,
+    0x04, 0xE1, 0x03, 0xE2, 0x03, 0xE3, 0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6, 0x02, 0xE7, 0x80, 0xE8,
+    0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x04, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0,
+    0x03, 0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x03, 0xF4, 0x04, 0xF5, 0x03, 0xF6, 0x03, 0xF7, 0x04, 0xF8,
+    0x02, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x02, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x03, 0xFF,
+    0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x03, 0xAE, 0x02, 0xAD, 0x02, 0xAC,
+    0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x03, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x02, 0xA3,
+    0x02, 0x92, 0x03, 0x91, 0x80, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B,
+    0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82,
+    0x03, 0x6B, 0x02, 0x6A, 0x09, 0xC9, 0x10, 0xC8, 0x82, 0xC7, 0xC8, 0xC7, 0x02, 0xC8, 0x02, 0xC7,
+    0x02, 0xC8, 0x02, 0xC7, 0x0A, 0xC8, 0x80, 0xC9, 0x02, 0xC8, 0x07, 0xC9, 0x04, 0xCA, 0x05, 0xDB,
+    0x04, 0xDC, 0x04, 0xDD, 0x02, 0xDE, 0x03, 0xDF, 0x03, 0xE0, 0x03, 0xE1, 0x04, 0xE2, 0x03, 0xE3,
+    0x80, 0xE4, 0x03, 0xE5, 0x02, 0xE6, 0x80, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB,
+    0x03, 0xEC, 0x03, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x03, 0xF3,
+    0x04, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB,
+    0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x03, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x80, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x02, 0x8D, 0x03, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x80, 0x69, 0x06, 0xCA,
+    0x81, 0xC9, 0xCA, 0x08, 0xC9, 0x81, 0xC8, 0xC9, 0x17, 0xC8, 0x0A, 0xC9, 0x06, 0xCA, 0x06, 0xDB,
+    0x02, 0xDC, 0x04, 0xDD, 0x04, 0xDE, 0x03, 0xDF, 0x03, 0xE0, 0x03, 0xE1, 0x04, 0xE2, 0x03, 0xE3,
+    0x02, 0xE4, 0x02, 0xE5, 0x02, 0xE6, 0x02, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB,
+    0x02, 0xEC, 0x04, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x04, 0xF3,
+    0x03, 0xF4, 0x03, 0xF5, 0x04, 0xF6, 0x03, 0xF7, 0x04, 0xF8, 0x02, 0xF9, 0x04, 0xFA, 0x03, 0xFB,
+    0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1,
+    0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7,
+    0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F,
+    0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86,
+    0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x04, 0xDB, 0x08,
+    0xCA, 0x22, 0xC9, 0x06, 0xCA, 0x07, 0xDB, 0x03, 0xDC, 0x06, 0xDD, 0x02, 0xDE, 0x03, 0xDF, 0x03,
+    0xE0, 0x04, 0xE1, 0x04, 0xE2, 0x03, 0xE3, 0x02, 0xE4, 0x03, 0xE5, 0x80, 0xE6, 0x02, 0xE7, 0x03,
+    0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x02, 0xEC, 0x04, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02,
+    0xF0, 0x04, 0xF1, 0x02, 0xF2, 0x04, 0xF3, 0x04, 0xF4, 0x03, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03,
+    0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x02, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03,
+    0xAC, 0x80, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x02,
+    0x8B, 0x03, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03,
+    0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x02, 0xDC, 0x09, 0xDB, 0x0B, 0xCA, 0x02, 0xC9, 0x80, 0xCA,
+    0x02, 0xC9, 0x80, 0xCA, 0x03, 0xC9, 0x03, 0xCA, 0x02, 0xC9, 0x0A, 0xCA, 0x08, 0xDB, 0x05, 0xDC,
+    0x04, 0xDD, 0x04, 0xDE, 0x03, 0xDF, 0x04, 0xE0, 0x04, 0xE1, 0x04, 0xE2, 0x04, 0xE3, 0x02, 0xE4,
+    0x02, 0xE5, 0x02, 0xE6, 0x02, 0xE7, 0x02, 0xE8, 0x03, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x02, 0xEC,
+    0x04, 0xED, 0x03, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x03, 0xF1, 0x04, 0xF2, 0x03, 0xF3, 0x04, 0xF4,
+    0x03, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x03, 0xFC,
+    0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x03, 0xAF,
+    0x02, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6,
+    0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x03, 0x85,
+    0x02, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x07, 0xDC, 0x0D, 0xDB, 0x81,
+    0xCA, 0xDB, 0x0C, 0xCA, 0x02, 0xDB, 0x02, 0xCA, 0x0B, 0xDB, 0x06, 0xDC, 0x06, 0xDD, 0x03, 0xDE,
+    0x04, 0xDF, 0x04, 0xE0, 0x04, 0xE1, 0x04, 0xE2, 0x04, 0xE3, 0x02, 0xE4, 0x03, 0xE5, 0x80, 0xE6,
+    0x03, 0xE7, 0x02, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x03, 0xEC, 0x04, 0xED, 0x03, 0xEE,
+    0x02, 0xEF, 0x02, 0xF0, 0x04, 0xF1, 0x03, 0xF2, 0x04, 0xF3, 0x03, 0xF4, 0x03, 0xF5, 0x04, 0xF6,
+    0x03, 0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x02, 0xFD, 0x80, 0xB0,
+    0x02, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE,
+    0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x03, 0xA7, 0x02, 0xA6, 0x02, 0xA5,
+    0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x03, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x02, 0x85, 0x03, 0x84,
+    0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x06, 0xDD, 0x08, 0xDC, 0x1A, 0xDB, 0x81,
+    0xDC, 0xDB, 0x08, 0xDC, 0x07, 0xDD, 0x04, 0xDE, 0x04, 0xDF, 0x03, 0xE0, 0x81, 0xE1, 0xE0, 0x03,
+    0xE1, 0x05, 0xE2, 0x04, 0xE3, 0x02, 0xE4, 0x03, 0xE5, 0x80, 0xE6, 0x03, 0xE7, 0x02, 0xE8, 0x03,
+    0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x03, 0xEC, 0x03, 0xED, 0x04, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x04,
+    0xF1, 0x03, 0xF2, 0x03, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x03,
+    0xF9, 0x03, 0xFA, 0x04, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02,
+    0xB3, 0x02, 0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x80, 0xAA, 0x03,
+    0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x80, 0x92, 0x03,
+    0x91, 0x80, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02,
+    0x88, 0x03, 0x87, 0x03, 0x86, 0x80, 0x85, 0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81,
+    0x6A, 0x69, 0x03, 0xDE, 0x0A, 0xDD, 0x02, 0xDC, 0x80, 0xDD, 0x1A, 0xDC, 0x09, 0xDD, 0x07, 0xDE,
+    0x03, 0xDF, 0x06, 0xE0, 0x05, 0xE1, 0x04, 0xE2, 0x04, 0xE3, 0x02, 0xE4, 0x03, 0xE5, 0x02, 0xE6,
+    0x02, 0xE7, 0x03, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x03, 0xEB, 0x03, 0xEC, 0x03, 0xED, 0x04, 0xEE,
+    0x02, 0xEF, 0x03, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x04, 0xF3, 0x04, 0xF4, 0x03, 0xF5, 0x04, 0xF6,
+    0x03, 0xF7, 0x03, 0xF8, 0x04, 0xF9, 0x03, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x02, 0xFD, 0x80, 0xB0,
+    0x03, 0xFE, 0x02, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x03, 0xAF, 0x02, 0xAE,
+    0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x80, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03, 0xA5,
+    0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x80, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D,
+    0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x03, 0x84,
+    0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x81, 0x6A, 0x69, 0x03, 0xDF, 0x05, 0xDE, 0x25, 0xDD, 0x09,
+    0xDE, 0x04, 0xDF, 0x05, 0xE0, 0x06, 0xE1, 0x05, 0xE2, 0x04, 0xE3, 0x02, 0xE4, 0x03, 0xE5, 0x02,
+    0xE6, 0x03, 0xE7, 0x02, 0xE8, 0x03, 0xE9, 0x02, 0xEA, 0x02, 0xEB, 0x03, 0xEC, 0x04, 0xED, 0x04,
+    0xEE, 0x02, 0xEF, 0x03, 0xF0, 0x03, 0xF1, 0x03, 0xF2, 0x04, 0xF3, 0x04, 0xF4, 0x03, 0xF5, 0x04,
+    0xF6, 0x03, 0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x03, 0xFC, 0x03, 0xFD, 0x04,
+    0xFE, 0x02, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03,
+    0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02,
+    0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x82, 0x69, 0xDF, 0xE0, 0x04, 0xDF, 0x0D, 0xDE, 0x0E,
+    0xDD, 0x80, 0xDE, 0x03, 0xDD, 0x09, 0xDE, 0x07, 0xDF, 0x06, 0xE0, 0x06, 0xE1, 0x06, 0xE2, 0x04,
+    0xE3, 0x03, 0xE4, 0x03, 0xE5, 0x03, 0xE6, 0x02, 0xE7, 0x03, 0xE8, 0x02, 0xE9, 0x02, 0xEA, 0x03,
+    0xEB, 0x03, 0xEC, 0x04, 0xED, 0x04, 0xEE, 0x02, 0xEF, 0x02, 0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x03,
+    0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03,
+    0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x80, 0x69, 0x06,
+    0xE0, 0x0A, 0xDF, 0x14, 0xDE, 0x83, 0xDF, 0xDE, 0xDF, 0xDE, 0x07, 0xDF, 0x08, 0xE0, 0x07, 0xE1,
+    0x06, 0xE2, 0x05, 0xE3, 0x03, 0xE4, 0x03, 0xE5, 0x02, 0xE6, 0x03, 0xE7, 0x03, 0xE8, 0x02, 0xE9,
+    0x03, 0xEA, 0x03, 0xEB, 0x03, 0xEC, 0x04, 0xED, 0x03, 0xEE, 0x03, 0xEF, 0x02, 0xF0, 0x03, 0xF1,
+    0x05, 0xF2, 0x03, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x03, 0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x03, 0xF9,
+    0x03, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x02, 0xFF, 0x02, 0xB4,
+    0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x03, 0xAE, 0x02, 0xAD, 0x02, 0xAC, 0x03, 0xAA,
+    0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92,
+    0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x03, 0x8B, 0x80, 0x89,
+    0x03, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x02, 0x6B,
+    0x02, 0x6A, 0x80, 0x69, 0x02, 0xE1, 0x81, 0xE0, 0xE1, 0x09, 0xE0, 0x03, 0xDF, 0x80, 0xE0, 0x17,
+    0xDF, 0x0B, 0xE0, 0x09, 0xE1, 0x05, 0xE2, 0x06, 0xE3, 0x02, 0xE4, 0x04, 0xE5, 0x02, 0xE6, 0x03,
+    0xE7, 0x03, 0xE8, 0x03, 0xE9, 0x02, 0xEA, 0x03, 0xEB, 0x03, 0xEC, 0x04, 0xED, 0x04, 0xEE, 0x02,
+    0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x03, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x03,
+    0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x03, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x03, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x02,
+    0xAC, 0x02, 0xAA, 0x03, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02,
+    0xA3, 0x02, 0x92, 0x03, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x02, 0x86, 0x03, 0x85, 0x02, 0x84, 0x02, 0x83, 0x03,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x80, 0x69, 0x09, 0xE1, 0x23, 0xE0, 0x0A, 0xE1, 0x08, 0xE2, 0x05,
+    0xE3, 0x04, 0xE4, 0x03, 0xE5, 0x04, 0xE6, 0x02, 0xE7, 0x03, 0xE8, 0x03, 0xE9, 0x03, 0xEA, 0x03,
+    0xEB, 0x03, 0xEC, 0x04, 0xED, 0x04, 0xEE, 0x02, 0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x03,
+    0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x04, 0xF9, 0x03, 0xFA, 0x03,
+    0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x04, 0xFE, 0x02, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x03,
+    0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x03,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03,
+    0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x03,
+    0x86, 0x80, 0x85, 0x03, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x81, 0x69, 0xE2,
+    0x14, 0xE1, 0x02, 0xE0, 0x80, 0xE1, 0x02, 0xE0, 0x03, 0xE1, 0x81, 0xE0, 0xE1, 0x02, 0xE0, 0x03,
+    0xE1, 0x80, 0xE0, 0x0C, 0xE1, 0x09, 0xE2, 0x06, 0xE3, 0x04, 0xE4, 0x04, 0xE5, 0x03, 0xE6, 0x03,
+    0xE7, 0x03, 0xE8, 0x03, 0xE9, 0x03, 0xEA, 0x02, 0xEB, 0x04, 0xEC, 0x04, 0xED, 0x05, 0xEE, 0x02,
+    0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x03, 0xF2, 0x04, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04,
+    0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x03, 0xFA, 0x04, 0xFB, 0x03, 0xFC, 0x04, 0xFD, 0x03, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x03, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x02,
+    0xAC, 0x03, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02, 0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x03,
+    0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x03, 0x84, 0x02, 0x83, 0x03,
+    0x82, 0x03, 0x6B, 0x80, 0x6A, 0x02, 0x69, 0x09, 0xE2, 0x22, 0xE1, 0x81, 0xE2, 0xE1, 0x0A, 0xE2,
+    0x06, 0xE3, 0x04, 0xE4, 0x04, 0xE5, 0x03, 0xE6, 0x03, 0xE7, 0x04, 0xE8, 0x03, 0xE9, 0x03, 0xEA,
+    0x03, 0xEB, 0x03, 0xEC, 0x05, 0xED, 0x04, 0xEE, 0x03, 0xEF, 0x03, 0xF0, 0x03, 0xF1, 0x05, 0xF2,
+    0x03, 0xF3, 0x04, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x04, 0xFA,
+    0x03, 0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x02, 0xB3,
+    0x02, 0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x02, 0xAC, 0x02, 0xAA, 0x03, 0xA9,
+    0x02, 0xA8, 0x02, 0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91,
+    0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88,
+    0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x03, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A,
+    0x02, 0x69, 0x02, 0xE3, 0x13, 0xE2, 0x05, 0xE1, 0x80, 0xE2, 0x05, 0xE1, 0x11, 0xE2, 0x09, 0xE3,
+    0x04, 0xE4, 0x05, 0xE5, 0x03, 0xE6, 0x03, 0xE7, 0x04, 0xE8, 0x03, 0xE9, 0x03, 0xEA, 0x04, 0xEB,
+    0x03, 0xEC, 0x04, 0xED, 0x05, 0xEE, 0x03, 0xEF, 0x02, 0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x04, 0xF3,
+    0x05, 0xF4, 0x03, 0xF5, 0x05, 0xF6, 0x04, 0xF7, 0x03, 0xF8, 0x04, 0xF9, 0x04, 0xFA, 0x03, 0xFB,
+    0x03, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2,
+    0x02, 0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8,
+    0x03, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x02, 0x90,
+    0x02, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x03, 0x8B, 0x80, 0x89, 0x03, 0x88, 0x02, 0x87,
+    0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69,
+    0x0B, 0xE3, 0x1E, 0xE2, 0x81, 0xE3, 0xE2, 0x0A, 0xE3, 0x05, 0xE4, 0x05, 0xE5, 0x05, 0xE6, 0x03,
+    0xE7, 0x03, 0xE8, 0x04, 0xE9, 0x04, 0xEA, 0x02, 0xEB, 0x04, 0xEC, 0x05, 0xED, 0x04, 0xEE, 0x03,
+    0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x05, 0xF2, 0x03, 0xF3, 0x05, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x03,
+    0xF7, 0x05, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x04, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x03,
+    0xAC, 0x80, 0xAA, 0x03, 0xA9, 0x02, 0xA8, 0x03, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x02, 0xE4, 0x14, 0xE3, 0x88, 0xE2, 0xE3, 0xE2, 0xE3,
+    0xE2, 0xE3, 0xE2, 0xE3, 0xE2, 0x11, 0xE3, 0x06, 0xE4, 0x06, 0xE5, 0x05, 0xE6, 0x02, 0xE7, 0x05,
+    0xE8, 0x04, 0xE9, 0x03, 0xEA, 0x03, 0xEB, 0x04, 0xEC, 0x05, 0xED, 0x05, 0xEE, 0x03, 0xEF, 0x03,
+    0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x04, 0xF3, 0x05, 0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x04,
+    0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03,
+    0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03,
+    0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03, 0xA5, 0x02, 0xA4, 0x03,
+    0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x02, 0x8C, 0x02,
+    0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02,
+    0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x0A, 0xE4, 0x20, 0xE3, 0x07, 0xE4, 0x08, 0xE5, 0x03,
+    0xE6, 0x04, 0xE7, 0x05, 0xE8, 0x04, 0xE9, 0x04, 0xEA, 0x03, 0xEB, 0x04, 0xEC, 0x06, 0xED, 0x04,
+    0xEE, 0x04, 0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x04, 0xF2, 0x04, 0xF3, 0x05, 0xF4, 0x04, 0xF5, 0x04,
+    0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x04, 0xFB, 0x03, 0xFC, 0x04, 0xFD, 0x03,
+    0xFE, 0x03, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x03, 0xB2, 0x02, 0xB1, 0x02, 0xAF, 0x03, 0xAE, 0x02,
+    0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03,
+    0xA4, 0x02, 0xA3, 0x03, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02, 0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x80,
+    0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x02, 0x86, 0x02, 0x85, 0x03, 0x84, 0x03,
+    0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x08, 0xE5, 0x10, 0xE4, 0x80, 0xE3, 0x12,
+    0xE4, 0x08, 0xE5, 0x06, 0xE6, 0x04, 0xE7, 0x06, 0xE8, 0x04, 0xE9, 0x04, 0xEA, 0x03, 0xEB, 0x04,
+    0xEC, 0x06, 0xED, 0x05, 0xEE, 0x03, 0xEF, 0x03, 0xF0, 0x04, 0xF1, 0x05, 0xF2, 0x04, 0xF3, 0x05,
+    0xF4, 0x03, 0xF5, 0x05, 0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x03, 0xFA, 0x04, 0xFB, 0x04,
+    0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x03, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x03, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x80, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x02, 0x85, 0x03, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x02,
+    0xE6, 0x10, 0xE5, 0x05, 0xE4, 0x80, 0xE5, 0x04, 0xE4, 0x02, 0xE5, 0x02, 0xE4, 0x0E, 0xE5, 0x07,
+    0xE6, 0x04, 0xE7, 0x06, 0xE8, 0x05, 0xE9, 0x05, 0xEA, 0x03, 0xEB, 0x05, 0xEC, 0x05, 0xED, 0x05,
+    0xEE, 0x03, 0xEF, 0x04, 0xF0, 0x04, 0xF1, 0x05, 0xF2, 0x04, 0xF3, 0x05, 0xF4, 0x04, 0xF5, 0x04,
+    0xF6, 0x04, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x04, 0xFA, 0x03, 0xFB, 0x05, 0xFC, 0x03, 0xFD, 0x03,
+    0xFE, 0x03, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x02, 0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x03, 0xAE, 0x02,
+    0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03, 0xA5, 0x02,
+    0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02, 0x8D, 0x02,
+    0x8C, 0x02, 0x8B, 0x03, 0x89, 0x02, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02, 0x85, 0x03, 0x84, 0x02,
+    0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x02, 0xE7, 0x08, 0xE6, 0x03, 0xE5, 0x80,
+    0xE6, 0x19, 0xE5, 0x09, 0xE6, 0x05, 0xE7, 0x06, 0xE8, 0x06, 0xE9, 0x04, 0xEA, 0x05, 0xEB, 0x04,
+    0xEC, 0x06, 0xED, 0x05, 0xEE, 0x04, 0xEF, 0x03, 0xF0, 0x05, 0xF1, 0x05, 0xF2, 0x04, 0xF3, 0x05,
+    0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x05, 0xF8, 0x03, 0xF9, 0x04, 0xFA, 0x04, 0xFB, 0x04,
+    0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02,
+    0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x03, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x02, 0xA8, 0x03,
+    0xA7, 0x02, 0xA6, 0x02, 0xA5, 0x03, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x03, 0x8E, 0x02, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x03,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x02, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x80,
+    0x68, 0x09, 0xE7, 0x1E, 0xE6, 0x0A, 0xE7, 0x06, 0xE8, 0x07, 0xE9, 0x04, 0xEA, 0x04, 0xEB, 0x06,
+    0xEC, 0x06, 0xED, 0x06, 0xEE, 0x03, 0xEF, 0x03, 0xF0, 0x05, 0xF1, 0x05, 0xF2, 0x04, 0xF3, 0x06,
+    0xF4, 0x04, 0xF5, 0x04, 0xF6, 0x04, 0xF7, 0x05, 0xF8, 0x04, 0xF9, 0x03, 0xFA, 0x04, 0xFB, 0x04,
+    0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x03, 0xB2, 0x02,
+    0xB1, 0x03, 0xAF, 0x02, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x03, 0xA9, 0x02, 0xA8, 0x02,
+    0xA7, 0x03, 0xA6, 0x02, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x02, 0x90, 0x02,
+    0x8F, 0x02, 0x8E, 0x03, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x03,
+    0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x02, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x80,
+    0x68, 0x07, 0xE8, 0x21, 0xE7, 0x0C, 0xE8, 0x06, 0xE9, 0x05, 0xEA, 0x05, 0xEB, 0x05, 0xEC, 0x07,
+    0xED, 0x05, 0xEE, 0x05, 0xEF, 0x03, 0xF0, 0x05, 0xF1, 0x05, 0xF2, 0x04, 0xF3, 0x05, 0xF4, 0x04,
+    0xF5, 0x05, 0xF6, 0x05, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x03, 0xFA, 0x04, 0xFB, 0x04, 0xFC, 0x04,
+    0xFD, 0x03, 0xFE, 0x03, 0xFF, 0x03, 0xB4, 0x03, 0xB3, 0x02, 0xB2, 0x02, 0xB1, 0x03, 0xAF, 0x02,
+    0xAE, 0x03, 0xAD, 0x02, 0xAC, 0x03, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02, 0xA6, 0x03,
+    0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03, 0x8F, 0x02, 0x8E, 0x02,
+    0x8D, 0x02, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x03, 0x86, 0x02, 0x85, 0x02,
+    0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x02, 0x6A, 0x02, 0x69, 0x80, 0x68, 0x03, 0xE9, 0x0F,
+    0xE8, 0x82, 0xE7, 0xE8, 0xE7, 0x07, 0xE8, 0x02, 0xE7, 0x0F, 0xE8, 0x09, 0xE9, 0x06, 0xEA, 0x05,
+    0xEB, 0x06, 0xEC, 0x07, 0xED, 0x06, 0xEE, 0x04, 0xEF, 0x03, 0xF0, 0x05, 0xF1, 0x05, 0xF2, 0x05,
+    0xF3, 0x05, 0xF4, 0x04, 0xF5, 0x05, 0xF6, 0x05, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x04, 0xFA, 0x04,
+    0xFB, 0x04, 0xFC, 0x03, 0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x02,
+    0xB2, 0x03, 0xB1, 0x02, 0xAF, 0x03, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x03, 0xA9, 0x02,
+    0xA8, 0x03, 0xA7, 0x02, 0xA6, 0x03, 0xA5, 0x02, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x02,
+    0x90, 0x03, 0x8F, 0x80, 0x8E, 0x03, 0x8D, 0x02, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x02,
+    0x87, 0x03, 0x86, 0x02, 0x85, 0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03,
+    0x69, 0x80, 0x68, 0x0C, 0xE9, 0x1B, 0xE8, 0x0A, 0xE9, 0x07, 0xEA, 0x05, 0xEB, 0x07, 0xEC, 0x07,
+    0xED, 0x06, 0xEE, 0x04, 0xEF, 0x04, 0xF0, 0x05, 0xF1, 0x06, 0xF2, 0x04, 0xF3, 0x06, 0xF4, 0x04,
+    0xF5, 0x05, 0xF6, 0x04, 0xF7, 0x05, 0xF8, 0x04, 0xF9, 0x04, 0xFA, 0x04, 0xFB, 0x04, 0xFC, 0x03,
+    0xFD, 0x80, 0xB0, 0x03, 0xFE, 0x03, 0xFF, 0x03, 0xB4, 0x02, 0xB3, 0x03, 0xB2, 0x02, 0xB1, 0x03,
+    0xAF, 0x03, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x02, 0xA9, 0x03, 0xA8, 0x02, 0xA7, 0x02,
+    0xA6, 0x03, 0xA5, 0x03, 0xA4, 0x02, 0xA3, 0x02, 0x92, 0x03, 0x91, 0x80, 0x90, 0x03, 0x8F, 0x02,
+    0x8E, 0x02, 0x8D, 0x03, 0x8C, 0x02, 0x8B, 0x02, 0x89, 0x03, 0x88, 0x02, 0x87, 0x03, 0x86, 0x02,
+    0x85, 0x03, 0x84, 0x02, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x80, 0x68, 0x04,
+    0xEA, 0x80, 0xE9, 0x02, 0xEA, 0x21, 0xE9, 0x81, 0xEA, 0xE9, 0x09, 0xEA, 0x07, 0xEB, 0x07, 0xEC,
+    0x07, 0xED, 0x08, 0xEE, 0x04, 0xEF, 0x04, 0xF0, 0x05, 0xF1, 0x05, 0xF2, 0x05, 0xF3, 0x06, 0xF4,
+    0x04, 0xF5, 0x05, 0xF6, 0x05, 0xF7, 0x04, 0xF8, 0x04, 0xF9, 0x05, 0xFA, 0x03, 0xFB, 0x04, 0xFC,
+    0x04, 0xFD, 0x04, 0xFE, 0x03, 0xFF, 0x02, 0xB4, 0x03, 0xB3, 0x03, 0xB2, 0x02, 0xB1, 0x02, 0xAF,
+    0x03, 0xAE, 0x02, 0xAD, 0x03, 0xAC, 0x02, 0xAA, 0x03, 0xA9, 0x02, 0xA8, 0x03, 0xA7, 0x02, 0xA6,
+    0x03, 0xA5, 0x02, 0xA4, 0x03, 0xA3, 0x02, 0x92, 0x02, 0x91, 0x02, 0x90, 0x03, 0x8F, 0x02, 0x8E,
+    0x02, 0x8D, 0x02, 0x8C, 0x03, 0x8B, 0x02, 0x89, 0x02, 0x88, 0x03, 0x87, 0x03, 0x86, 0x02, 0x85,
+    0x02, 0x84, 0x03, 0x83, 0x03, 0x82, 0x03, 0x6B, 0x80, 0x6A, 0x03, 0x69, 0x80, 0x68,
+};
+// clang-format on
@@ -0,0 +1,260 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+}
+
+namespace {
+const uint16_t width  = 240;
+const uint16_t height = 320;
+
+// Rendered in bands of a tenth of the screen, as LVGL does by default
+const uint16_t band_rows   = height / 10;
+const uint32_t band_pixels = uint32_t(width) * band_rows;
+
+// 40MHz SPI
+const uint32_t ns_per_byte = 200;
+
+// Simulated time, in nanoseconds, advanced by rendering and by sending or waiting for bytes
+uint64_t now;
+
+// What the display has received so far
+std::vector<uint8_t> received;
+
+// The transfer in progress, which is only read out once it completes, as DMA would
+const uint8_t* transfer_data;
+uint32_t       transfer_length;
+uint64_t       transfer_end;
+
+uint32_t sim_comms_send(painter_device_t device, const void* data, uint32_t byte_count) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    received.insert(received.end(), bytes, bytes + byte_count);
+    now += uint64_t(byte_count) * ns_per_byte;
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+bool sim_comms_send_async(painter_device_t device, const void* data, uint32_t byte_count) {
+    transfer_data   = (const uint8_t*)data;
+    transfer_length = byte_count;
+    transfer_end    = now + uint64_t(byte_count) * ns_per_byte;
+    return true;
+}
+
+// Each poll while the transfer is in progress takes a microsecond
+bool sim_comms_busy(painter_device_t device) {
+    if (now < transfer_end) {
+        now += 1000;
+        return true;
+    }
+    if (transfer_data) {
+        received.insert(received.end(), transfer_data, transfer_data + transfer_length);
+        transfer_data = nullptr;
+    }
+    return false;
+}
+
+bool sim_comms_init(painter_device_t device) {
+    return dummy_comms_vtable.comms_init(device);
+}
+
+bool sim_comms_start(painter_device_t device) {
+    return dummy_comms_vtable.comms_start(device);
+}
+
+void sim_comms_stop(painter_device_t device) {
+    dummy_comms_vtable.comms_stop(device);
+}
+
+const painter_comms_vtable_t sync_comms_vtable = {
+    .comms_init  = sim_comms_init,
+    .comms_start = sim_comms_start,
+    .comms_stop  = sim_comms_stop,
+    .comms_send  = sim_comms_send,
+};
+
+const painter_comms_vtable_t async_comms_vtable = {
+    .comms_init       = sim_comms_init,
+    .comms_start      = sim_comms_start,
+    .comms_stop       = sim_comms_stop,
+    .comms_send       = sim_comms_send,
+    .comms_send_async = sim_comms_send_async,
+    .comms_busy       = sim_comms_busy,
+};
+
+bool display_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+bool display_noop(painter_device_t device) {
+    return true;
+}
+
+bool display_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+bool display_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t commands[] = {0x2A, uint8_t(left >> 8), uint8_t(left), uint8_t(right >> 8), uint8_t(right), 0x2B, uint8_t(top >> 8), uint8_t(top), uint8_t(bottom >> 8), uint8_t(bottom), 0x2C};
+    qp_comms_send(device, commands, sizeof(commands));
+    return true;
+}
+
+bool display_pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+bool display_pixdata_async(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    return qp_comms_send_async(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+}
+
+bool display_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette) {
+    return true;
+}
+
+bool display_append_pixels(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    return true;
+}
+
+bool display_append_pixdata(painter_device_t device, uint8_t* target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+const painter_driver_vtable_t display_vtable = {
+    .init            = display_init,
+    .power           = display_power,
+    .clear           = display_noop,
+    .flush           = display_noop,
+    .viewport        = display_viewport,
+    .pixdata         = display_pixdata,
+    .palette_convert = display_palette_convert,
+    .append_pixels   = display_append_pixels,
+    .append_pixdata  = display_append_pixdata,
+    .pixdata_async   = display_pixdata_async,
+};
+} // namespace
+
+class AsyncPixdata : public ::testing::Test {
+   protected:
+    painter_driver_t      display = {};
+    std::vector<uint16_t> buffers[2];
+
+    void SetUp() override {
+        display.driver_vtable         = &display_vtable;
+        display.comms_vtable          = &async_comms_vtable;
+        display.panel_width           = width;
+        display.panel_height          = height;
+        display.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&display, QP_ROTATION_0));
+
+        buffers[0].resize(band_pixels);
+        buffers[1].resize(band_pixels);
+        now           = 0;
+        transfer_data = nullptr;
+        transfer_end  = 0;
+        received.clear();
+    }
+
+    // Renders and sends a frame a band at a time, the way the LVGL integration does, returning how long it took
+    uint64_t draw_frame(bool double_buffered, uint64_t render_ns_per_band) {
+        uint64_t start  = now;
+        uint8_t  buffer = 0;
+        for (uint16_t top = 0; top < height; top += band_rows) {
+            // Rendering into a buffer has to wait for it to be released
+            if (!double_buffered) {
+                while (!qp_pixdata_complete(&display)) {
+                }
+            }
+            std::fill(buffers[buffer].begin(), buffers[buffer].end(), top);
+            now += render_ns_per_band;
+
+            // Sending the next band has to wait for the previous one, as with LVGL's wait_cb
+            while (!qp_pixdata_complete(&display)) {
+            }
+            EXPECT_TRUE(qp_viewport(&display, 0, top, width - 1, top + band_rows - 1));
+            EXPECT_TRUE(qp_pixdata_async(&display, buffers[buffer].data(), band_pixels));
+            if (double_buffered) {
+                buffer ^= 1;
+            }
+        }
+        while (!qp_pixdata_complete(&display)) {
+        }
+        return now - start;
+    }
+};
+
+TEST_F(AsyncPixdata, DoubleBufferingSendsTheSameFrame) {
+    draw_frame(false, 0);
+    std::vector<uint8_t> single = received;
+    received.clear();
+
+    draw_frame(true, 0);
+    EXPECT_EQ(received, single);
+
+    // Every band is preceded by its viewport
+    EXPECT_EQ(single.size(), (height / band_rows) * (11 + band_pixels * sizeof(uint16_t)));
+}
+
+TEST_F(AsyncPixdata, OtherDrawingWaitsForTheTransfer) {
+    std::fill(buffers[0].begin(), buffers[0].end(), 0xABCD);
+    ASSERT_TRUE(qp_pixdata_async(&display, buffers[0].data(), band_pixels));
+    EXPECT_FALSE(qp_pixdata_complete(&display));
+    EXPECT_TRUE(received.empty());
+
+    ASSERT_TRUE(qp_viewport(&display, 0, 0, 9, 9));
+    ASSERT_EQ(received.size(), band_pixels * sizeof(uint16_t) + 11);
+    EXPECT_EQ(received.back(), 0x2C);
+    EXPECT_GE(now, uint64_t(band_pixels) * sizeof(uint16_t) * ns_per_byte);
+    EXPECT_TRUE(qp_pixdata_complete(&display));
+}
+
+TEST_F(AsyncPixdata, SynchronousCommsFallBackToPixdata) {
+    display.comms_vtable = &sync_comms_vtable;
+
+    std::fill(buffers[0].begin(), buffers[0].end(), 0x1234);
+    ASSERT_TRUE(qp_pixdata_async(&display, buffers[0].data(), band_pixels));
+    EXPECT_TRUE(qp_pixdata_complete(&display));
+    EXPECT_EQ(received.size(), band_pixels * sizeof(uint16_t));
+
+    received.clear();
+    uint64_t single = draw_frame(false, 1000000);
+    std::vector<uint8_t> expected = received;
+    received.clear();
+    EXPECT_EQ(draw_frame(true, 1000000), single);
+    EXPECT_EQ(received, expected);
+}
+
+TEST_F(AsyncPixdata, InvalidDevicesHaveNothingPending) {
+    painter_driver_t invalid = {};
+    EXPECT_FALSE(qp_pixdata_async(&invalid, buffers[0].data(), band_pixels));
+    EXPECT_TRUE(qp_pixdata_complete(&invalid));
+    EXPECT_TRUE(qp_pixdata_complete(nullptr));
+}
+
+TEST_F(AsyncPixdata, FrameTime) {
+    const uint64_t transfer_ns_per_band = uint64_t(band_pixels) * sizeof(uint16_t) * ns_per_byte;
+    const uint32_t bands                = height / band_rows;
+
+    // Rendering each band taking half, the same as and twice as long as sending it
+    for (uint64_t render_ns_per_band : {transfer_ns_per_band / 2, transfer_ns_per_band, transfer_ns_per_band * 2}) {
+        uint64_t single = draw_frame(false, render_ns_per_band);
+        uint64_t dual   = draw_frame(true, render_ns_per_band);
+
+        // Sequentially, every band is rendered then sent, with both buffers only the slower of the two is left
+        EXPECT_GE(single, bands * (render_ns_per_band + transfer_ns_per_band));
+        EXPECT_GE(dual, bands * std::max(render_ns_per_band, transfer_ns_per_band));
+        EXPECT_LT(dual, bands * std::max(render_ns_per_band, transfer_ns_per_band) + std::min(render_ns_per_band, transfer_ns_per_band) + bands * 20000);
+
+        std::cout << "[ BENCH    ] render " << render_ns_per_band / 1000 << "us, send " << transfer_ns_per_band / 1000 << "us per band: single buffer " << single / 1000 << "us, double buffer " << dual / 1000 << "us per frame" << std::endl;
+    }
+}
@@ -0,0 +1,11 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS true
+
+// Fits the 160x80 logo and a few small icons at 16bpp, but not the 102x288 djinn
+#define QUANTUM_PAINTER_IMAGE_CACHE_SIZE 32768
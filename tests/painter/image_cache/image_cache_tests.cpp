@@ -0,0 +1,274 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_comms_dummy.h"
+
+extern const uint8_t gfx_reverb[];
+extern const uint8_t gfx_logo[];
+extern const uint8_t gfx_djinn[];
+extern const uint8_t gfx_ghoul_name[];
+extern const uint8_t gfx_lock_caps[];
+}
+
+namespace {
+const uint16_t width  = 240;
+const uint16_t height = 320;
+
+std::vector<uint8_t> bytes_sent;
+uint32_t             palette_converts;
+uint32_t             appends;
+
+// Records the bytes sent to the display on top of the dummy comms, which discard them
+uint32_t recording_comms_send(painter_device_t device, const void* data, uint32_t byte_count) {
+    const uint8_t* bytes = (const uint8_t*)data;
+    bytes_sent.insert(bytes_sent.end(), bytes, bytes + byte_count);
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+bool recording_comms_init(painter_device_t device) {
+    return dummy_comms_vtable.comms_init(device);
+}
+
+bool recording_comms_start(painter_device_t device) {
+    return dummy_comms_vtable.comms_start(device);
+}
+
+void recording_comms_stop(painter_device_t device) {
+    dummy_comms_vtable.comms_stop(device);
+}
+
+const painter_comms_vtable_t recording_comms_vtable = {
+    recording_comms_init,
+    recording_comms_start,
+    recording_comms_stop,
+    recording_comms_send,
+};
+
+bool display_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+bool display_noop(painter_device_t device) {
+    return true;
+}
+
+bool display_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+bool display_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t commands[] = {0x2A, uint8_t(left >> 8), uint8_t(left), uint8_t(right >> 8), uint8_t(right), 0x2B, uint8_t(top >> 8), uint8_t(top), uint8_t(bottom >> 8), uint8_t(bottom), 0x2C};
+    qp_comms_send(device, commands, sizeof(commands));
+    return true;
+}
+
+bool display_pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+// Packs the HSV channels into 16 bits, which is enough to tell apart any colors the tests use
+bool display_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette) {
+    palette_converts++;
+    for (int16_t i = 0; i < palette_size; i++) {
+        palette[i].rgb565 = uint16_t((palette[i].hsv888.h >> 3) << 11 | (palette[i].hsv888.s >> 2) << 5 | (palette[i].hsv888.v >> 3));
+    }
+    return true;
+}
+
+bool display_append_pixels(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    appends++;
+    uint16_t* buffer = (uint16_t*)target_buffer;
+    for (uint32_t i = 0; i < pixel_count; i++) {
+        buffer[pixel_offset + i] = palette[palette_indices[i]].rgb565;
+    }
+    return true;
+}
+
+bool display_append_pixdata(painter_device_t device, uint8_t* target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    appends++;
+    target_buffer[pixdata_offset] = pixdata_byte;
+    return true;
+}
+
+const painter_driver_vtable_t display_vtable = {
+    display_init, display_power, display_noop, display_noop, display_viewport, display_pixdata, display_palette_convert, display_append_pixels, display_append_pixdata,
+};
+} // namespace
+
+class ImageCache : public ::testing::Test {
+   protected:
+    painter_driver_t                    display = {};
+    std::vector<painter_image_handle_t> loaded;
+
+    void SetUp() override {
+        display.driver_vtable         = &display_vtable;
+        display.comms_vtable          = &recording_comms_vtable;
+        display.panel_width           = width;
+        display.panel_height          = height;
+        display.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&display, QP_ROTATION_0));
+    }
+
+    void TearDown() override {
+        for (painter_image_handle_t image : loaded) {
+            qp_close_image(image);
+        }
+    }
+
+    painter_image_handle_t load(const uint8_t* data, bool cached = true) {
+        painter_image_handle_t image = qp_load_image_mem(data);
+        EXPECT_NE(image, nullptr);
+        if (image) {
+            loaded.push_back(image);
+            if (cached) {
+                EXPECT_TRUE(qp_cache_image(image, true));
+            }
+        }
+        return image;
+    }
+
+    // Returns everything sent to the display, odd offsets so that the viewport doesn't line up with anything
+    std::vector<uint8_t> draw(painter_image_handle_t image, uint8_t hue_fg = 0) {
+        bytes_sent.clear();
+        palette_converts = 0;
+        appends          = 0;
+        EXPECT_TRUE(qp_drawimage_recolor(&display, 3, 5, image, hue_fg, 255, 255, 0, 0, 0));
+        return bytes_sent;
+    }
+
+    // Whether the last draw was sent from the cache, without decoding the image
+    bool was_cached() const {
+        return palette_converts == 0 && appends == 0;
+    }
+};
+
+TEST_F(ImageCache, CachedDrawsSendTheSameBytes) {
+    for (const uint8_t* data : {gfx_reverb, gfx_logo, gfx_ghoul_name, gfx_lock_caps}) {
+        painter_image_handle_t uncached = load(data, false);
+        painter_image_handle_t cached   = load(data);
+        ASSERT_NE(uncached, nullptr);
+        ASSERT_NE(cached, nullptr);
+
+        std::vector<uint8_t> expected = draw(uncached);
+        ASSERT_GT(expected.size(), uint32_t(cached->width) * cached->height * sizeof(uint16_t));
+
+        // The first draw fills the cache, the second is sent from it
+        EXPECT_EQ(draw(cached), expected);
+        EXPECT_FALSE(was_cached());
+        EXPECT_EQ(draw(cached), expected);
+        EXPECT_TRUE(was_cached());
+
+        TearDown();
+        loaded.clear();
+    }
+}
+
+TEST_F(ImageCache, EachColorIsCachedSeparately) {
+    painter_image_handle_t image = load(gfx_lock_caps);
+    ASSERT_NE(image, nullptr);
+
+    std::vector<uint8_t> red = draw(image, 0);
+    EXPECT_FALSE(was_cached());
+    std::vector<uint8_t> green = draw(image, 85);
+    EXPECT_FALSE(was_cached());
+    EXPECT_NE(red, green);
+
+    EXPECT_EQ(draw(image, 0), red);
+    EXPECT_TRUE(was_cached());
+    EXPECT_EQ(draw(image, 85), green);
+    EXPECT_TRUE(was_cached());
+}
+
+TEST_F(ImageCache, EvictsLeastRecentlyDrawnFrames) {
+    painter_image_handle_t icon = load(gfx_lock_caps);  //   480 bytes
+    painter_image_handle_t logo = load(gfx_logo);       // 25600 bytes
+    painter_image_handle_t text = load(gfx_reverb);     // 12000 bytes
+    ASSERT_NE(icon, nullptr);
+    ASSERT_NE(logo, nullptr);
+    ASSERT_NE(text, nullptr);
+
+    std::vector<uint8_t> expected_logo = draw(logo);
+    std::vector<uint8_t> expected_text = draw(text);
+    EXPECT_FALSE(was_cached());
+
+    // Icon and logo fit, the text doesn't fit alongside them, so the logo drawn before the icon makes room for it
+    draw(icon);
+    draw(logo);
+    draw(icon);
+    EXPECT_TRUE(was_cached());
+    EXPECT_EQ(draw(text), expected_text);
+    EXPECT_FALSE(was_cached());
+
+    draw(icon);
+    EXPECT_TRUE(was_cached());
+    draw(text);
+    EXPECT_TRUE(was_cached());
+
+    // Bringing the logo back needs more room than the icon alone, so both are evicted
+    EXPECT_EQ(draw(logo), expected_logo);
+    EXPECT_FALSE(was_cached());
+    draw(icon);
+    EXPECT_FALSE(was_cached());
+    draw(text);
+    EXPECT_FALSE(was_cached());
+    EXPECT_EQ(draw(logo), expected_logo);
+    EXPECT_FALSE(was_cached());
+}
+
+TEST_F(ImageCache, FramesLargerThanTheCacheAreNotCached) {
+    painter_image_handle_t icon  = load(gfx_lock_caps);
+    painter_image_handle_t large = load(gfx_djinn);
+    ASSERT_NE(icon, nullptr);
+    ASSERT_NE(large, nullptr);
+
+    draw(icon);
+    std::vector<uint8_t> expected = draw(large);
+    EXPECT_FALSE(was_cached());
+    EXPECT_EQ(draw(large), expected);
+    EXPECT_FALSE(was_cached());
+
+    // And nothing was evicted trying to make room
+    draw(icon);
+    EXPECT_TRUE(was_cached());
+}
+
+TEST_F(ImageCache, OptingOutOrClosingDropsCachedFrames) {
+    painter_image_handle_t image = load(gfx_lock_caps);
+    ASSERT_NE(image, nullptr);
+
+    draw(image);
+    draw(image);
+    EXPECT_TRUE(was_cached());
+
+    EXPECT_TRUE(qp_cache_image(image, false));
+    draw(image);
+    EXPECT_FALSE(was_cached());
+    draw(image);
+    EXPECT_FALSE(was_cached());
+
+    // A different image loaded into the same slot is not mistaken for the closed one
+    EXPECT_TRUE(qp_cache_image(image, true));
+    draw(image);
+    TearDown();
+    loaded.clear();
+
+    painter_image_handle_t uncached = load(gfx_ghoul_name, false);
+    ASSERT_NE(uncached, nullptr);
+    std::vector<uint8_t> expected = draw(uncached);
+    TearDown();
+    loaded.clear();
+
+    painter_image_handle_t other = load(gfx_ghoul_name);
+    ASSERT_EQ(other, image);
+    EXPECT_EQ(draw(other), expected);
+    EXPECT_FALSE(was_cached());
+}
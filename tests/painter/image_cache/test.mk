@@ -0,0 +1,12 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += \
+	tests/painter/assets/reverb.qgf.c \
+	tests/painter/assets/logo.qgf.c \
+	tests/painter/assets/djinn.qgf.c \
+	tests/painter/assets/ghoul-name.qgf.c \
+	tests/painter/assets/lock-caps.qgf.c
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define QUANTUM_PAINTER_SUPPORTS_256_PALETTE true
+#define QUANTUM_PAINTER_SUPPORTS_NATIVE_COLORS true
@@ -0,0 +1,16 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+# Sample assets copied from keyboards in the tree, covering mono2, mono4, pal256 and rgb565, with and without RLE
+SRC += \
+	tests/painter/image_decode/image_decode_tests.cpp \
+	tests/painter/assets/reverb.qgf.c \
+	tests/painter/assets/splash.qgf.c \
+	tests/painter/assets/robotomono20.qff.c \
+	tests/painter/assets/logo.qgf.c \
+	tests/painter/assets/djinn.qgf.c \
+	tests/painter/assets/thintel15.qff.c \
+	tests/painter/assets/lock-caps.qgf.c
@@ -0,0 +1,144 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_surface.h"
+
+extern const uint8_t gfx_reverb[];
+extern const uint8_t gfx_splash[];
+extern const uint8_t gfx_logo[];
+extern const uint8_t gfx_djinn[];
+extern const uint8_t gfx_lock_caps[];
+extern const uint8_t font_robotomono20[];
+extern const uint8_t font_thintel15[];
+}
+
+namespace {
+const uint16_t width  = 256;
+const uint16_t height = 320;
+
+struct Asset {
+    const char*    name;
+    const uint8_t* data;
+    uint32_t       hash; // of the surface after drawing, as rendered one pixel at a time
+};
+
+const Asset images[] = {
+    {"reverb (mono2, RLE)", gfx_reverb, 1513900439u},
+    {"splash (pal256, RLE)", gfx_splash, 4921694u},
+    {"logo (rgb565, RLE)", gfx_logo, 2664224337u},
+    {"djinn (mono4, RLE)", gfx_djinn, 2519756193u},
+    {"lock-caps (mono4)", gfx_lock_caps, 2231636481u},
+};
+
+const Asset fonts[] = {
+    {"robotomono20 (mono2, RLE)", font_robotomono20, 3630636651u},
+    {"thintel15 (mono2)", font_thintel15, 3148680817u},
+};
+
+const char text[] = "Quantum Painter draws 0123456789 {[(<>)]} ~!@#$%^&*";
+
+uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, 16)];
+
+// Surfaces can't be released, so all the tests share the one surface slot
+painter_device_t surface;
+
+uint32_t framebuffer_hash() {
+    // FNV-1a
+    uint32_t hash = 2166136261u;
+    for (uint8_t byte : framebuffer) {
+        hash = (hash ^ byte) * 16777619u;
+    }
+    return hash;
+}
+} // namespace
+
+class ImageDecode : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        if (!surface) {
+            surface = qp_make_rgb565_surface(width, height, framebuffer);
+        }
+        ASSERT_NE(surface, nullptr);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+        clear();
+    }
+
+    void clear() {
+        ASSERT_TRUE(qp_rect(surface, 0, 0, width - 1, height - 1, 0, 0, 0, true));
+    }
+
+    // Odd offsets, so that the viewport doesn't line up with anything in the image
+    bool draw_image(painter_image_handle_t image) {
+        return qp_drawimage_recolor(surface, 3, 5, image, 0, 0, 255, 0, 0, 0);
+    }
+
+    bool draw_text(painter_font_handle_t font) {
+        return qp_drawtext_recolor(surface, 1, 7, font, text, 0, 0, 255, 0, 0, 0) > 0;
+    }
+};
+
+TEST_F(ImageDecode, SampleImagesDrawTheSame) {
+    for (const Asset& asset : images) {
+        painter_image_handle_t image = qp_load_image_mem(asset.data);
+        ASSERT_NE(image, nullptr) << asset.name;
+
+        clear();
+        EXPECT_TRUE(draw_image(image)) << asset.name;
+        EXPECT_EQ(framebuffer_hash(), asset.hash) << asset.name;
+        EXPECT_TRUE(std::any_of(std::begin(framebuffer), std::end(framebuffer), [](uint8_t byte) { return byte != 0; })) << asset.name << " drew nothing";
+
+        qp_close_image(image);
+    }
+}
+
+TEST_F(ImageDecode, SampleFontsDrawTheSame) {
+    for (const Asset& asset : fonts) {
+        painter_font_handle_t font = qp_load_font_mem(asset.data);
+        ASSERT_NE(font, nullptr) << asset.name;
+
+        // Glyph pixel counts are not multiples of a byte, and RLE runs continue from one glyph into the next
+        clear();
+        EXPECT_TRUE(draw_text(font)) << asset.name;
+        EXPECT_EQ(framebuffer_hash(), asset.hash) << asset.name;
+
+        qp_close_font(font);
+    }
+}
+
+TEST_F(ImageDecode, PixelsPerSecond) {
+    using clock = std::chrono::steady_clock;
+
+    for (const Asset& asset : images) {
+        painter_image_handle_t image = qp_load_image_mem(asset.data);
+        ASSERT_NE(image, nullptr) << asset.name;
+
+        const int draws = 20;
+        auto      best  = clock::duration::max();
+        for (int attempt = 0; attempt < 3; attempt++) {
+            auto start = clock::now();
+            for (int i = 0; i < draws; i++) {
+                ASSERT_TRUE(draw_image(image));
+            }
+            best = std::min(best, clock::now() - start);
+        }
+
+        double pixels  = double(image->width) * image->height * draws;
+        double seconds = std::chrono::duration<double>(best).count();
+
+        std::ios_base::fmtflags flags(std::cout.flags());
+        std::cout << std::fixed << std::setprecision(1);
+        std::cout << "[ BENCH    ] block size " << QUANTUM_PAINTER_DECODE_BLOCK_SIZE << ": " << asset.name << " " << pixels / seconds / 1e6 << " Mpixels/s" << std::endl;
+        std::cout.flags(flags);
+
+        qp_close_image(image);
+    }
+}
@@ -0,0 +1,202 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+}
+
+namespace {
+typedef std::pair<uint32_t, uint8_t> Glyph; // code point, width
+
+void put8(std::vector<uint8_t>& out, uint32_t value) {
+    out.push_back(value & 0xFF);
+}
+
+void put16(std::vector<uint8_t>& out, uint32_t value) {
+    put8(out, value);
+    put8(out, value >> 8);
+}
+
+void put24(std::vector<uint8_t>& out, uint32_t value) {
+    put16(out, value);
+    put8(out, value >> 16);
+}
+
+void put32(std::vector<uint8_t>& out, uint32_t value) {
+    put16(out, value);
+    put16(out, value >> 16);
+}
+
+void put_block_header(std::vector<uint8_t>& out, uint8_t type_id, uint32_t length) {
+    put8(out, type_id);
+    put8(out, ~type_id);
+    put24(out, length);
+}
+
+const uint8_t line_height = 8;
+
+/* Builds an uncompressed 1bpp greyscale QFF with a unicode table only, in the order the glyphs are given. */
+std::vector<uint8_t> make_font(uint8_t version, const std::vector<Glyph>& glyphs) {
+    std::vector<uint8_t> table;
+    std::vector<uint8_t> data;
+    for (const Glyph& glyph : glyphs) {
+        put24(table, glyph.first);
+        put24(table, (data.size() << 6) | glyph.second);
+        data.insert(data.end(), glyph.second, 0xAA);
+    }
+
+    std::vector<uint8_t> font;
+    put_block_header(font, 0x00, 20);
+    put24(font, 0x464651);
+    put8(font, version);
+    size_t size_offset = font.size();
+    put32(font, 0);
+    put32(font, 0);
+    put8(font, line_height);
+    put8(font, 0); // no ascii table
+    put16(font, glyphs.size());
+    put8(font, 0x00); // GRAYSCALE_1BPP
+    put8(font, 0);    // flags
+    put8(font, 0x00); // uncompressed
+    put8(font, 0xFF); // transparency index
+
+    put_block_header(font, 0x02, table.size());
+    font.insert(font.end(), table.begin(), table.end());
+    put_block_header(font, 0x04, data.size());
+    font.insert(font.end(), data.begin(), data.end());
+
+    std::vector<uint8_t> size;
+    put32(size, font.size());
+    put32(size, ~font.size());
+    std::copy(size.begin(), size.end(), font.begin() + size_offset);
+    return font;
+}
+
+std::string utf8(uint32_t code_point) {
+    std::string out;
+    if (code_point < 0x80) {
+        out += (char)code_point;
+    } else if (code_point < 0x800) {
+        out += (char)(0xC0 | (code_point >> 6));
+        out += (char)(0x80 | (code_point & 0x3F));
+    } else if (code_point < 0x10000) {
+        out += (char)(0xE0 | (code_point >> 12));
+        out += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out += (char)(0x80 | (code_point & 0x3F));
+    } else {
+        out += (char)(0xF0 | (code_point >> 18));
+        out += (char)(0x80 | ((code_point >> 12) & 0x3F));
+        out += (char)(0x80 | ((code_point >> 6) & 0x3F));
+        out += (char)(0x80 | (code_point & 0x3F));
+    }
+    return out;
+}
+
+/* A mix of latin, greek, CJK and emoji code points, sorted and with gaps in between. */
+std::vector<Glyph> sorted_glyphs() {
+    std::vector<Glyph> glyphs;
+    uint32_t           code_point = 0xA1;
+    for (uint8_t i = 0; i < 61; i++) {
+        glyphs.push_back(Glyph(code_point, 1 + (i % 30)));
+        code_point += (i < 20) ? 7 : (i < 40) ? 0x301 : 0x1003;
+        if (code_point >= 0xD800 && code_point <= 0xDFFF) {
+            code_point += 0x800; // UTF-16 surrogates can't be encoded
+        }
+    }
+    return glyphs;
+}
+} // namespace
+
+class QffGlyphLookup : public testing::Test {
+   protected:
+    painter_font_handle_t font = nullptr;
+
+    painter_font_handle_t load(const std::vector<uint8_t>& data) {
+        buffer = data;
+        font   = qp_load_font_mem(buffer.data());
+        return font;
+    }
+
+    void TearDown() override {
+        if (font) {
+            qp_close_font(font);
+        }
+    }
+
+   private:
+    std::vector<uint8_t> buffer;
+};
+
+TEST_F(QffGlyphLookup, SortedTableFindsEveryGlyph) {
+    std::vector<Glyph> glyphs = sorted_glyphs();
+    ASSERT_NE(load(make_font(0x02, glyphs)), nullptr);
+
+    for (const Glyph& glyph : glyphs) {
+        EXPECT_EQ(qp_textwidth(font, utf8(glyph.first).c_str()), glyph.second) << "code point " << glyph.first;
+    }
+}
+
+TEST_F(QffGlyphLookup, SortedTableMissingGlyphs) {
+    std::vector<Glyph> glyphs = sorted_glyphs();
+    ASSERT_NE(load(make_font(0x02, glyphs)), nullptr);
+
+    EXPECT_EQ(qp_textwidth(font, "A"), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(glyphs.front().first + 1).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(glyphs[30].first - 1).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(glyphs.back().first + 1).c_str()), 0);
+}
+
+TEST_F(QffGlyphLookup, SortedTableWithSingleGlyph) {
+    ASSERT_NE(load(make_font(0x02, {Glyph(0x4E2D, 12)})), nullptr);
+
+    EXPECT_EQ(qp_textwidth(font, utf8(0x4E2D).c_str()), 12);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x4E2C).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x4E2E).c_str()), 0);
+}
+
+TEST_F(QffGlyphLookup, StringWidthIsSumOfGlyphs) {
+    std::vector<Glyph> glyphs = sorted_glyphs();
+    ASSERT_NE(load(make_font(0x02, glyphs)), nullptr);
+
+    std::string text;
+    int16_t     width = 0;
+    for (size_t i = 0; i < glyphs.size(); i += 3) {
+        text += utf8(glyphs[i].first) + utf8(glyphs[i].first);
+        width += 2 * glyphs[i].second;
+    }
+    EXPECT_EQ(qp_textwidth(font, text.c_str()), width);
+}
+
+TEST_F(QffGlyphLookup, VersionOneTableIsScanned) {
+    std::vector<Glyph> glyphs = sorted_glyphs();
+    std::reverse(glyphs.begin(), glyphs.end());
+    std::swap(glyphs[3], glyphs[40]);
+    ASSERT_NE(load(make_font(0x01, glyphs)), nullptr);
+
+    for (const Glyph& glyph : glyphs) {
+        EXPECT_EQ(qp_textwidth(font, utf8(glyph.first).c_str()), glyph.second) << "code point " << glyph.first;
+    }
+    EXPECT_EQ(qp_textwidth(font, utf8(glyphs.front().first + 1).c_str()), 0);
+}
+
+TEST_F(QffGlyphLookup, UnknownVersionIsRejected) {
+    EXPECT_EQ(load(make_font(0x03, sorted_glyphs())), nullptr);
+}
+
+TEST_F(QffGlyphLookup, ReloadedSlotDoesNotReuseGlyphs) {
+    ASSERT_NE(load(make_font(0x02, {Glyph(0x3042, 10), Glyph(0x3044, 11)})), nullptr);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x3042).c_str()), 10);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x3044).c_str()), 11);
+    qp_close_font(font);
+
+    ASSERT_NE(load(make_font(0x02, {Glyph(0x3044, 5)})), nullptr);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x3042).c_str()), 0);
+    EXPECT_EQ(qp_textwidth(font, utf8(0x3044).c_str()), 5);
+}
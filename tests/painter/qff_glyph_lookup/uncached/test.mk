@@ -0,0 +1,7 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+QUANTUM_PAINTER_ENABLE = yes
+QUANTUM_PAINTER_DRIVERS = surface
+
+SRC += tests/painter/qff_glyph_lookup/qff_glyph_lookup_tests.cpp
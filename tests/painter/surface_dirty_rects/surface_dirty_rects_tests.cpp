@@ -0,0 +1,271 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdint>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "qp.h"
+#include "qp_internal.h"
+#include "qp_comms.h"
+#include "qp_surface.h"
+#include "qp_comms_dummy.h"
+}
+
+namespace {
+const uint16_t width  = 240;
+const uint16_t height = 240;
+
+// Size of the column/row address commands a typical TFT panel needs for each viewport
+const uint32_t viewport_bytes = 10;
+
+struct Rect {
+    uint16_t l, t, r, b;
+
+    uint32_t area() const {
+        return uint32_t(r - l + 1) * uint32_t(b - t + 1);
+    }
+
+    bool contains(uint16_t x, uint16_t y) const {
+        return x >= l && x <= r && y >= t && y <= b;
+    }
+
+    bool overlaps(const Rect& other) const {
+        return l <= other.r && other.l <= r && t <= other.b && other.t <= b;
+    }
+};
+
+std::vector<Rect> viewports;
+uint32_t          bytes_sent;
+
+// Counts the bytes of each frame on top of the dummy comms, which discard them
+uint32_t counting_comms_send(painter_device_t device, const void* data, uint32_t byte_count) {
+    bytes_sent += byte_count;
+    return dummy_comms_vtable.comms_send(device, data, byte_count);
+}
+
+bool counting_comms_init(painter_device_t device) {
+    return dummy_comms_vtable.comms_init(device);
+}
+
+bool counting_comms_start(painter_device_t device) {
+    return dummy_comms_vtable.comms_start(device);
+}
+
+void counting_comms_stop(painter_device_t device) {
+    dummy_comms_vtable.comms_stop(device);
+}
+
+const painter_comms_vtable_t counting_comms_vtable = {
+    counting_comms_init,
+    counting_comms_start,
+    counting_comms_stop,
+    counting_comms_send,
+};
+
+bool display_init(painter_device_t device, painter_rotation_t rotation) {
+    return true;
+}
+
+bool display_noop(painter_device_t device) {
+    return true;
+}
+
+bool display_power(painter_device_t device, bool power_on) {
+    return true;
+}
+
+bool display_viewport(painter_device_t device, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom) {
+    uint8_t commands[viewport_bytes] = {0x2A, uint8_t(left >> 8), uint8_t(left), uint8_t(right >> 8), uint8_t(right), 0x2B, uint8_t(top >> 8), uint8_t(top), uint8_t(bottom >> 8), uint8_t(bottom)};
+    qp_comms_send(device, commands, sizeof(commands));
+    viewports.push_back(Rect{left, top, right, bottom});
+    return true;
+}
+
+bool display_pixdata(painter_device_t device, const void* pixel_data, uint32_t native_pixel_count) {
+    qp_comms_send(device, pixel_data, native_pixel_count * sizeof(uint16_t));
+    return true;
+}
+
+bool display_palette_convert(painter_device_t device, int16_t palette_size, qp_pixel_t* palette) {
+    return true;
+}
+
+bool display_append_pixels(painter_device_t device, uint8_t* target_buffer, qp_pixel_t* palette, uint32_t pixel_offset, uint32_t pixel_count, uint8_t* palette_indices) {
+    return true;
+}
+
+bool display_append_pixdata(painter_device_t device, uint8_t* target_buffer, uint32_t pixdata_offset, uint8_t pixdata_byte) {
+    return true;
+}
+
+const painter_driver_vtable_t display_vtable = {
+    display_init, display_power, display_noop, display_noop, display_viewport, display_pixdata, display_palette_convert, display_append_pixels, display_append_pixdata,
+};
+
+uint8_t framebuffer[SURFACE_REQUIRED_BUFFER_BYTE_SIZE(width, height, 16)];
+
+// Surfaces can't be released, so all the tests share the one surface slot
+painter_device_t surface;
+} // namespace
+
+class SurfaceDirtyRects : public ::testing::Test {
+   protected:
+    painter_driver_t display = {};
+
+    void SetUp() override {
+        display.driver_vtable         = &display_vtable;
+        display.comms_vtable          = &counting_comms_vtable;
+        display.panel_width           = width;
+        display.panel_height          = height;
+        display.native_bits_per_pixel = 16;
+        ASSERT_TRUE(qp_init(&display, QP_ROTATION_0));
+
+        if (!surface) {
+            surface = qp_make_rgb565_surface(width, height, framebuffer);
+        }
+        ASSERT_NE(surface, nullptr);
+        ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+
+        // Get rid of the initial full surface transfer
+        ASSERT_TRUE(qp_surface_draw(surface, &display, 0, 0, false));
+        next_frame();
+    }
+
+    void next_frame() {
+        viewports.clear();
+        bytes_sent = 0;
+    }
+
+    void fill(const Rect& rect, uint8_t val = 255) {
+        ASSERT_TRUE(qp_rect(surface, rect.l, rect.t, rect.r, rect.b, 0, 0, val, true));
+    }
+
+    void draw_frame() {
+        ASSERT_TRUE(qp_surface_draw(surface, &display, 0, 0, false));
+    }
+
+    uint32_t pixel_bytes() const {
+        uint32_t total = 0;
+        for (const Rect& viewport : viewports) {
+            total += viewport.area() * sizeof(uint16_t);
+        }
+        return total;
+    }
+
+    void expect_no_overlaps() const {
+        for (size_t i = 0; i < viewports.size(); i++) {
+            for (size_t j = i + 1; j < viewports.size(); j++) {
+                EXPECT_FALSE(viewports[i].overlaps(viewports[j])) << "viewports " << i << " and " << j << " overlap";
+            }
+        }
+    }
+
+    void expect_covered(const Rect& rect) const {
+        for (uint16_t y = rect.t; y <= rect.b; y++) {
+            for (uint16_t x = rect.l; x <= rect.r; x++) {
+                bool covered = false;
+                for (const Rect& viewport : viewports) {
+                    covered |= viewport.contains(x, y);
+                }
+                ASSERT_TRUE(covered) << "pixel " << x << "," << y << " was not sent";
+            }
+        }
+    }
+};
+
+TEST_F(SurfaceDirtyRects, FirstDrawSendsEntireSurface) {
+    ASSERT_TRUE(qp_init(surface, QP_ROTATION_0));
+    draw_frame();
+
+    ASSERT_EQ(viewports.size(), 1);
+    EXPECT_EQ(viewports[0].area(), uint32_t(width) * height);
+    EXPECT_EQ(bytes_sent, viewport_bytes + width * height * sizeof(uint16_t));
+}
+
+TEST_F(SurfaceDirtyRects, UnchangedSurfaceSendsNothing) {
+    draw_frame();
+    EXPECT_EQ(bytes_sent, 0);
+
+    // Drawing the same colour over the existing contents doesn't dirty anything either
+    fill({0, 0, width - 1, height - 1}, 0);
+    draw_frame();
+    EXPECT_EQ(bytes_sent, 0);
+}
+
+TEST_F(SurfaceDirtyRects, OppositeCornersAreSentSeparately) {
+    Rect clock{4, 4, 83, 19};
+    Rect icon{216, 216, 235, 235};
+    fill(clock);
+    fill(icon);
+    draw_frame();
+
+    ASSERT_EQ(viewports.size(), 2);
+    expect_covered(clock);
+    expect_covered(icon);
+    EXPECT_EQ(bytes_sent, 2 * viewport_bytes + (clock.area() + icon.area()) * sizeof(uint16_t));
+}
+
+TEST_F(SurfaceDirtyRects, OverlappingChangesAreMerged) {
+    Rect first{10, 10, 59, 59};
+    Rect second{40, 40, 89, 89};
+    fill(first);
+    fill(second);
+    draw_frame();
+
+    ASSERT_EQ(viewports.size(), 1);
+    expect_covered(first);
+    expect_covered(second);
+}
+
+TEST_F(SurfaceDirtyRects, ExcessRegionsAreMergedCheaply) {
+    std::vector<Rect> regions;
+    for (uint16_t i = 0; i < SURFACE_MAX_DIRTY_RECTS + 3; i++) {
+        uint16_t offset = i * (width / (SURFACE_MAX_DIRTY_RECTS + 3));
+        regions.push_back(Rect{offset, offset, uint16_t(offset + 4), uint16_t(offset + 4)});
+    }
+    for (const Rect& region : regions) {
+        fill(region);
+    }
+    draw_frame();
+
+    EXPECT_LE(viewports.size(), SURFACE_MAX_DIRTY_RECTS);
+    expect_no_overlaps();
+    for (const Rect& region : regions) {
+        expect_covered(region);
+    }
+    // Still far less than the bounding box of all regions, which spans nearly the whole panel
+    EXPECT_LT(pixel_bytes(), (width * height * sizeof(uint16_t)) / 4);
+}
+
+TEST_F(SurfaceDirtyRects, ScatteredPixelsAreAllSent) {
+    std::vector<Rect> pixels;
+    for (uint16_t i = 0; i < 50; i++) {
+        uint16_t x = (i * 97) % width;
+        uint16_t y = (i * 61) % height;
+        pixels.push_back(Rect{x, y, x, y});
+        ASSERT_TRUE(qp_setpixel(surface, x, y, 0, 0, 255));
+    }
+    draw_frame();
+
+    EXPECT_LE(viewports.size(), SURFACE_MAX_DIRTY_RECTS);
+    expect_no_overlaps();
+    for (const Rect& pixel : pixels) {
+        expect_covered(pixel);
+    }
+}
+
+TEST_F(SurfaceDirtyRects, EntireSurfaceSendsOneViewport) {
+    fill({4, 4, 19, 19});
+    fill({200, 200, 219, 219});
+    ASSERT_TRUE(qp_surface_draw(surface, &display, 0, 0, true));
+
+    ASSERT_EQ(viewports.size(), 1);
+    EXPECT_EQ(bytes_sent, viewport_bytes + width * height * sizeof(uint16_t));
+
+    // The dirty rects were reset by the transfer
+    next_frame();
+    draw_frame();
+    EXPECT_EQ(bytes_sent, 0);
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define PROFILING_RING_SIZE 4
+#define PROFILING_HISTOGRAM_BUCKETS 8
@@ -0,0 +1,4 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+PROFILING_ENABLE = yes
@@ -0,0 +1,126 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "profiling.h"
+
+void advance_cycles(uint32_t cycles);
+}
+
+using testing::_;
+
+namespace {
+// Cycles spent in process_record_user(), which runs inside matrix_task()
+uint32_t process_record_cycles = 0;
+
+void record_sample(uint32_t cycles) {
+    PROFILING_CALL_NAMED("sample", advance_cycles(cycles));
+}
+} // namespace
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t *record) {
+    advance_cycles(process_record_cycles);
+    return true;
+}
+
+class Profiling : public TestFixture {
+   protected:
+    void SetUp() override {
+        profiling_reset();
+        process_record_cycles = 0;
+    }
+};
+
+TEST_F(Profiling, SampleCounters) {
+    for (uint32_t cycles : {10, 2, 30, 7}) {
+        record_sample(cycles);
+    }
+
+    const profiling_probe_t *probe = profiling_find_probe("sample");
+    ASSERT_NE(probe, nullptr);
+    EXPECT_EQ(probe->count, 4);
+    EXPECT_EQ(probe->min, 2);
+    EXPECT_EQ(probe->max, 30);
+    EXPECT_EQ(probe->total, 49);
+    EXPECT_EQ(profiling_probe_recent_average(probe), 49 / 4);
+}
+
+TEST_F(Profiling, RecentAverageOnlyCoversRing) {
+    for (int i = 0; i < 10; i++) {
+        record_sample(1000);
+    }
+    for (int i = 0; i < PROFILING_RING_SIZE; i++) {
+        record_sample(8);
+    }
+
+    const profiling_probe_t *probe = profiling_find_probe("sample");
+    ASSERT_NE(probe, nullptr);
+    EXPECT_EQ(profiling_probe_recent_average(probe), 8);
+    EXPECT_EQ(probe->max, 1000);
+}
+
+TEST_F(Profiling, HistogramBuckets) {
+    // 0 -> bucket 0, 1 -> 1, 2..3 -> 2, 4..7 -> 3, anything from 64 up lands in the last bucket
+    for (uint32_t cycles : {0, 1, 2, 3, 4, 7, 64, 100000}) {
+        record_sample(cycles);
+    }
+
+    const profiling_probe_t *probe = profiling_find_probe("sample");
+    ASSERT_NE(probe, nullptr);
+    const uint16_t expected[PROFILING_HISTOGRAM_BUCKETS] = {1, 1, 2, 2, 0, 0, 0, 2};
+    for (int i = 0; i < PROFILING_HISTOGRAM_BUCKETS; i++) {
+        EXPECT_EQ(probe->histogram[i], expected[i]) << "bucket " << i;
+    }
+}
+
+TEST_F(Profiling, ResetKeepsProbesRegistered) {
+    record_sample(5);
+    profiling_reset();
+
+    const profiling_probe_t *probe = profiling_find_probe("sample");
+    ASSERT_NE(probe, nullptr);
+    EXPECT_EQ(probe->count, 0);
+    EXPECT_EQ(probe->max, 0);
+    EXPECT_EQ(profiling_probe_recent_average(probe), 0);
+    for (int i = 0; i < PROFILING_HISTOGRAM_BUCKETS; i++) {
+        EXPECT_EQ(probe->histogram[i], 0);
+    }
+}
+
+TEST_F(Profiling, KeyboardTaskProbes) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+
+    run_one_scan_loop();
+    process_record_cycles = 100;
+    key.press();
+    run_one_scan_loop();
+    key.release();
+    run_one_scan_loop();
+
+    const profiling_probe_t *keyboard_task = profiling_find_probe("keyboard_task");
+    const profiling_probe_t *matrix_task   = profiling_find_probe("matrix_task");
+    const profiling_probe_t *quantum_task  = profiling_find_probe("quantum_task");
+    ASSERT_NE(keyboard_task, nullptr);
+    ASSERT_NE(matrix_task, nullptr);
+    ASSERT_NE(quantum_task, nullptr);
+
+    EXPECT_EQ(keyboard_task->count, matrix_task->count);
+    EXPECT_EQ(keyboard_task->count, quantum_task->count);
+    EXPECT_GE(keyboard_task->count, 3);
+
+    // Only the press and the release spent any time, both inside matrix_task()
+    EXPECT_EQ(matrix_task->total, 200);
+    EXPECT_EQ(matrix_task->max, 100);
+    EXPECT_EQ(matrix_task->min, 0);
+    EXPECT_EQ(quantum_task->total, 0);
+    EXPECT_EQ(keyboard_task->total, 200);
+}
@@ -0,0 +1,139 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+
+namespace {
+uint32_t             mock_us;
+uint32_t             led_cost_us;
+std::vector<uint8_t> led_updates(RGB_MATRIX_LED_COUNT);
+uint32_t             complete_frames;
+uint32_t             incomplete_frames;
+
+void budget_init(void) {}
+
+// Simulates an effect that takes `led_cost_us` to compute every LED
+void budget_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    mock_us += led_cost_us;
+    led_updates[index]++;
+}
+
+void budget_set_color_all(uint8_t r, uint8_t g, uint8_t b) {}
+
+// Every frame has to render each LED exactly once, however it's been split into chunks
+void budget_flush(void) {
+    if (std::all_of(led_updates.begin(), led_updates.end(), [](uint8_t updates) { return updates == 1; })) {
+        complete_frames++;
+    } else {
+        incomplete_frames++;
+    }
+    std::fill(led_updates.begin(), led_updates.end(), 0);
+}
+} // namespace
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {budget_init, budget_set_color, budget_set_color_all, budget_flush};
+
+led_config_t g_led_config = {
+    {{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}, {10, 11, 12, 13, 14, 15, 16, 17, 18, 19}, {20, 21, 22, 23, 24, 25, 26, 27, 28, 29}, {30, 31, 32, 33, 34, 35, 36, 37, 38, 39}},
+    {{0, 0}, {24, 0}, {48, 0}, {72, 0}, {96, 0}, {120, 0}, {144, 0}, {168, 0}, {192, 0}, {216, 0}, {0, 21}, {24, 21}, {48, 21}, {72, 21}, {96, 21}, {120, 21}, {144, 21}, {168, 21}, {192, 21}, {216, 21}, {0, 42}, {24, 42}, {48, 42}, {72, 42}, {96, 42}, {120, 42}, {144, 42}, {168, 42}, {192, 42}, {216, 42}, {0, 63}, {24, 63}, {48, 63}, {72, 63}, {96, 63}, {120, 63}, {144, 63}, {168, 63}, {192, 63}, {216, 63}},
+    {4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4},
+};
+
+uint32_t rgb_matrix_render_timer_us(void) {
+    return mock_us;
+}
+}
+
+class RgbMatrixRenderBudget : public TestFixture {
+   protected:
+    TestDriver driver;
+
+    void SetUp() override {
+        EXPECT_CALL(driver, send_keyboard_mock(_)).Times(testing::AnyNumber());
+        rgb_matrix_enable_noeeprom();
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+        led_cost_us = 10;
+    }
+
+    /* Runs `scans` scans 1ms apart, returning the most time spent rendering in a single scan. */
+    uint32_t run_scans(uint32_t scans, uint32_t* over_budget = nullptr) {
+        uint32_t worst = 0;
+        for (uint32_t i = 0; i < scans; i++) {
+            uint32_t start = mock_us;
+            keyboard_task();
+            uint32_t elapsed = mock_us - start;
+            worst            = std::max(worst, elapsed);
+            if (over_budget && elapsed > RGB_MATRIX_RENDER_BUDGET_US) {
+                (*over_budget)++;
+            }
+            advance_time(1);
+        }
+        return worst;
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, ScansStayWithinBudget) {
+    EXPECT_LE(run_scans(500), RGB_MATRIX_RENDER_BUDGET_US);
+    EXPECT_EQ(rgb_matrix_get_render_chunk_size(), RGB_MATRIX_RENDER_BUDGET_US / 10);
+}
+
+TEST_F(RgbMatrixRenderBudget, EveryLedIsRenderedOncePerFrame) {
+    run_scans(100);
+    complete_frames   = 0;
+    incomplete_frames = 0;
+
+    // Vary the chunk size while rendering, the chunks must still tile the whole matrix
+    for (uint32_t cost = 3; cost < 60; cost += 7) {
+        led_cost_us = cost;
+        run_scans(50);
+    }
+
+    EXPECT_GT(complete_frames, 0);
+    EXPECT_EQ(incomplete_frames, 0);
+}
+
+TEST_F(RgbMatrixRenderBudget, AdaptsToSlowerEffects) {
+    run_scans(500);
+
+    // Only the first chunk after the change can go over budget
+    led_cost_us          = 40;
+    uint32_t over_budget = 0;
+    run_scans(500, &over_budget);
+    EXPECT_LE(over_budget, 1);
+    EXPECT_EQ(rgb_matrix_get_render_chunk_size(), RGB_MATRIX_RENDER_BUDGET_US / 40);
+
+    over_budget = 0;
+    EXPECT_LE(run_scans(500, &over_budget), RGB_MATRIX_RENDER_BUDGET_US);
+}
+
+TEST_F(RgbMatrixRenderBudget, AdaptsToFasterEffects) {
+    led_cost_us = 40;
+    run_scans(500);
+    EXPECT_EQ(rgb_matrix_get_render_chunk_size(), RGB_MATRIX_RENDER_BUDGET_US / 40);
+
+    led_cost_us = 2;
+    EXPECT_LE(run_scans(1000), RGB_MATRIX_RENDER_BUDGET_US);
+    EXPECT_EQ(rgb_matrix_get_render_chunk_size(), RGB_MATRIX_LED_COUNT);
+}
+
+TEST_F(RgbMatrixRenderBudget, ReportsFrameRateAndWorstChunk) {
+    // Let a full stats window pass with the chunk size settled
+    run_scans(2500);
+
+    // Frames are started every RGB_MATRIX_LED_FLUSH_LIMIT ms at most
+    EXPECT_LE(rgb_matrix_get_frame_rate(), 1000 / RGB_MATRIX_LED_FLUSH_LIMIT);
+    EXPECT_GE(rgb_matrix_get_frame_rate(), 1000 / (RGB_MATRIX_LED_FLUSH_LIMIT + 2));
+    EXPECT_EQ(rgb_matrix_get_worst_chunk_us(), RGB_MATRIX_RENDER_BUDGET_US);
+}
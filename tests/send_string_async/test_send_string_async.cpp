@@ -0,0 +1,183 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::Invoke;
+
+namespace {
+struct TimedReport {
+    uint32_t          time;
+    report_keyboard_t report;
+};
+
+bool operator==(const TimedReport& lhs, const TimedReport& rhs) {
+    return lhs.time == rhs.time && lhs.report == rhs.report;
+}
+
+std::ostream& operator<<(std::ostream& stream, const TimedReport& value) {
+    return stream << value.time << "ms " << value.report;
+}
+
+std::vector<report_keyboard_t> without_time(const std::vector<TimedReport>& reports) {
+    std::vector<report_keyboard_t> result;
+    for (auto& timed : reports) {
+        result.push_back(timed.report);
+    }
+    return result;
+}
+
+bool has_key(const report_keyboard_t& report, uint8_t key) {
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (report.keys[i] == key) {
+            return true;
+        }
+    }
+    return false;
+}
+} // namespace
+
+class SendStringAsync : public TestFixture {
+   protected:
+    // Reports sent by `send` and by typing out whatever it queued, timed from the call
+    std::vector<TimedReport> capture(TestDriver& driver, std::function<void()> send) {
+        std::vector<TimedReport> reports;
+        uint32_t                 start = timer_read32();
+        EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly(Invoke([&](report_keyboard_t& report) { reports.push_back({timer_read32() - start, report}); }));
+        send();
+        for (int i = 0; i < 10000 && send_string_async_is_busy(); i++) {
+            run_one_scan_loop();
+        }
+        EXPECT_FALSE(send_string_async_is_busy());
+        VERIFY_AND_CLEAR(driver);
+        return reports;
+    }
+};
+
+TEST_F(SendStringAsync, MatchesBlockingWithDelay) {
+    TestDriver driver;
+    const char string[] = "Hi, you!" SS_TAP(X_CAPS) SS_DELAY(20) SS_LCTL("a") "~\n";
+
+    auto blocking = capture(driver, [&] { send_string_with_delay(string, 5); });
+    auto async    = capture(driver, [&] { EXPECT_TRUE(send_string_async_with_delay(string, 5)); });
+
+    EXPECT_FALSE(blocking.empty());
+    EXPECT_EQ(async, blocking);
+}
+
+TEST_F(SendStringAsync, MatchesBlockingWithoutDelay) {
+    TestDriver driver;
+    const char string[] = "Hi, you!" SS_TAP(X_CAPS) SS_DELAY(20) SS_LCTL("a") "~\n";
+
+    // Typed over several scans instead of all at once, but with the same reports
+    auto blocking = capture(driver, [&] { send_string_with_delay(string, 0); });
+    auto async    = capture(driver, [&] { EXPECT_TRUE(send_string_async_with_delay(string, 0)); });
+
+    EXPECT_FALSE(blocking.empty());
+    EXPECT_EQ(without_time(async), without_time(blocking));
+}
+
+TEST_F(SendStringAsync, UnicodeMatchesBlocking) {
+    TestDriver driver;
+    const char string[] = "aΨ\U0001F9D9";
+
+    for (uint8_t mode : {UNICODE_MODE_LINUX, UNICODE_MODE_MACOS, UNICODE_MODE_WINDOWS, UNICODE_MODE_WINCOMPOSE}) {
+        set_unicode_input_mode(mode);
+
+        auto blocking = capture(driver, [&] { send_unicode_string(string); });
+        auto async    = capture(driver, [&] { EXPECT_TRUE(send_unicode_string_async(string)); });
+
+        EXPECT_FALSE(blocking.empty());
+        EXPECT_EQ(without_time(async), without_time(blocking)) << "input mode " << (int)mode;
+    }
+}
+
+TEST_F(SendStringAsync, FullQueueRejectsString) {
+    TestDriver driver;
+    // Each string takes up its length plus three bytes
+    std::string too_long(SEND_STRING_ASYNC_BUFFER_SIZE - 2, 'a');
+    std::string fits(SEND_STRING_ASYNC_BUFFER_SIZE - 3 - 4, 'a');
+
+    auto reports = capture(driver, [&] {
+        EXPECT_FALSE(send_string_async(too_long.c_str()));
+        EXPECT_EQ(send_string_async_free(), SEND_STRING_ASYNC_BUFFER_SIZE);
+
+        EXPECT_TRUE(send_string_async(fits.c_str()));
+        EXPECT_TRUE(send_string_async("b"));
+        EXPECT_EQ(send_string_async_free(), 0);
+
+        // Nothing of a string that does not fit is queued
+        EXPECT_FALSE(send_string_async("c"));
+    });
+
+    EXPECT_EQ(reports.size(), (fits.size() + 1) * 2);
+    for (auto& timed : reports) {
+        EXPECT_FALSE(has_key(timed.report, KC_C));
+    }
+    EXPECT_EQ(send_string_async_free(), SEND_STRING_ASYNC_BUFFER_SIZE);
+}
+
+TEST_F(SendStringAsync, KeysWorkWhileTyping) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 0, KC_B);
+    set_keymap({key});
+
+    auto reports = capture(driver, [&] {
+        EXPECT_TRUE(send_string_async_with_delay("aaaa", 10));
+        idle_for(15);
+        key.press();
+        run_one_scan_loop();
+        EXPECT_TRUE(send_string_async_is_busy());
+        key.release();
+        run_one_scan_loop();
+    });
+
+    // The key press is reported while the string is still being typed
+    ASSERT_EQ(reports.size(), 10);
+    EXPECT_TRUE(has_key(reports[2].report, KC_B));
+    EXPECT_EQ(reports[2].time, 15);
+    EXPECT_TRUE(has_key(reports[3].report, KC_A) || has_key(reports[4].report, KC_A));
+}
+
+TEST_F(SendStringAsync, ClearFinishesCurrentCharacter) {
+    TestDriver driver;
+
+    auto reports = capture(driver, [&] {
+        EXPECT_TRUE(send_string_async_with_delay("ABC", 10));
+        // Shift is held down for the A
+        idle_for(15);
+        send_string_async_clear();
+    });
+
+    // Shift, Shift+A, Shift, nothing
+    ASSERT_EQ(reports.size(), 4);
+    EXPECT_TRUE(has_key(reports[1].report, KC_A));
+    EXPECT_EQ(reports[3].report, report_keyboard_t{});
+}
+
+TEST_F(SendStringAsync, ClearCancelsUnicodeCharacter) {
+    TestDriver driver;
+    set_unicode_input_mode(UNICODE_MODE_WINCOMPOSE);
+
+    auto reports = capture(driver, [&] {
+        EXPECT_TRUE(send_unicode_string_async("ΨΨ"));
+        idle_for(3);
+        send_string_async_clear();
+    });
+
+    // The sequence is cancelled with Escape rather than finished with Enter
+    ASSERT_FALSE(reports.empty());
+    EXPECT_TRUE(has_key(reports[reports.size() - 2].report, KC_ESCAPE));
+    for (auto& timed : reports) {
+        EXPECT_FALSE(has_key(timed.report, KC_ENTER));
+    }
+}
@@ -0,0 +1,143 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+
+extern "C" {
+#include "keycode_config.h"
+
+// Normally set by the USB stack, the host has not asked for the boot protocol
+uint8_t keyboard_protocol = 1;
+}
+
+using testing::_;
+using testing::Invoke;
+
+namespace {
+std::vector<uint8_t> nkro_keys(const report_nkro_t& report) {
+    std::vector<uint8_t> keys;
+    for (uint16_t code = 0; code < NKRO_REPORT_BITS * 8; code++) {
+        if (report.bits[code >> 3] & (1 << (code & 7))) {
+            keys.push_back(code);
+        }
+    }
+    return keys;
+}
+
+char keycode_to_char(uint8_t keycode, bool shifted) {
+    for (uint8_t ascii_code = ' '; ascii_code < 128; ascii_code++) {
+        if (pgm_read_byte(&ascii_to_keycode_lut[ascii_code]) == keycode && (bool)((ascii_to_shift_lut[ascii_code / 8] >> (ascii_code % 8)) & 1) == shifted) {
+            return ascii_code;
+        }
+    }
+    return '?';
+}
+
+// Types out what a host would, taking the keys newly pressed in each report in keycode order
+class NkroHost {
+   public:
+    void receive(const report_nkro_t& report) {
+        reports++;
+        bool shifted = report.mods & MOD_BIT(KC_LEFT_SHIFT);
+        auto keys    = nkro_keys(report);
+        for (uint8_t key : keys) {
+            if (std::find(held.begin(), held.end(), key) == held.end()) {
+                text += keycode_to_char(key, shifted);
+            }
+        }
+        held = keys;
+    }
+
+    std::string          text;
+    std::vector<uint8_t> held;
+    int                  reports = 0;
+};
+} // namespace
+
+class SendStringNkro : public TestFixture {
+   protected:
+    void SetUp() override {
+        keymap_config.nkro = true;
+    }
+
+    void TearDown() override {
+        keymap_config.nkro = false;
+    }
+
+    NkroHost capture(TestDriver& driver, const char* string) {
+        NkroHost host;
+        EXPECT_CALL(driver, send_nkro_mock(_)).WillRepeatedly(Invoke([&](report_nkro_t& report) { host.receive(report); }));
+        send_string(string);
+        VERIFY_AND_CLEAR(driver);
+        EXPECT_TRUE(host.held.empty());
+        return host;
+    }
+};
+
+TEST_F(SendStringNkro, AscendingRunIsOneReport) {
+    TestDriver driver;
+
+    auto host = capture(driver, "abcdefghijklmnopqrstuvwxyz");
+
+    EXPECT_EQ(host.text, "abcdefghijklmnopqrstuvwxyz");
+    EXPECT_EQ(host.reports, 2);
+}
+
+TEST_F(SendStringNkro, RunEndsWhenKeycodesGoDown) {
+    TestDriver driver;
+
+    // c, then ab together, then a and a on their own
+    auto host = capture(driver, "cabaa");
+
+    EXPECT_EQ(host.text, "cabaa");
+    EXPECT_EQ(host.reports, 8);
+}
+
+TEST_F(SendStringNkro, RunEndsWhenModifiersChange) {
+    TestDriver driver;
+
+    // ab, then Shift, CD, Shift released
+    auto host = capture(driver, "abCD");
+
+    EXPECT_EQ(host.text, "abCD");
+    EXPECT_EQ(host.reports, 6);
+}
+
+TEST_F(SendStringNkro, KeepsTextIntact) {
+    TestDriver driver;
+    const char string[] = "Hello, World! The quick brown fox jumps over the lazy dog; \"QMK\" {1234567890} <~>";
+
+    auto host = capture(driver, string);
+
+    EXPECT_EQ(host.text, string);
+    EXPECT_LT(host.reports, (int)(sizeof(string) - 1) * 2);
+}
+
+TEST_F(SendStringNkro, KeycodeInjectionIsNotBatched) {
+    TestDriver driver;
+
+    auto host = capture(driver, "ab" SS_TAP(X_C) "de");
+
+    EXPECT_EQ(host.text, "abcde");
+    EXPECT_EQ(host.reports, 6);
+}
+
+TEST_F(SendStringNkro, SixKroIsUnchanged) {
+    TestDriver driver;
+    keymap_config.nkro = false;
+
+    EXPECT_CALL(driver, send_nkro_mock(_)).Times(0);
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_B));
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_EMPTY_REPORT(driver).Times(3);
+    send_string("abc");
+    VERIFY_AND_CLEAR(driver);
+}
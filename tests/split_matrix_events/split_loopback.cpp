@@ -0,0 +1,107 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "split_loopback.hpp"
+
+extern "C" {
+#include "serial.h"
+#include "timer.h"
+#include "transactions.h"
+#include "transport.h"
+#include "test_matrix.h"
+}
+
+#define SLAVE_ROWS ((MATRIX_ROWS) / 2)
+
+static bool                  running_slave = false;
+static split_shared_memory_t slave_memory;
+static matrix_row_t          slave_keys[SLAVE_ROWS];
+static matrix_row_t          slave_mirror[SLAVE_ROWS];
+static uint32_t              link_resumes = 0;
+
+extern "C" bool is_keyboard_master(void) {
+    return !running_slave;
+}
+
+extern "C" bool is_keyboard_left(void) {
+    return true;
+}
+
+// The slave runs with its own copy of the shared memory swapped in
+static void run_as_slave(void (*fn)(void *), void *arg) {
+    split_shared_memory_t temp;
+    memcpy(&temp, split_shmem, sizeof(temp));
+    memcpy(split_shmem, &slave_memory, sizeof(temp));
+    running_slave = true;
+    fn(arg);
+    running_slave = false;
+    memcpy(&slave_memory, split_shmem, sizeof(temp));
+    memcpy(split_shmem, &temp, sizeof(temp));
+}
+
+static void slave_scan(void *arg) {
+    transactions_slave(slave_mirror, slave_keys);
+}
+
+static void slave_callback(void *arg) {
+    split_transaction_desc_t *trans = (split_transaction_desc_t *)arg;
+    trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+}
+
+extern "C" void soft_serial_initiator_init(void) {}
+
+extern "C" void soft_serial_target_init(void) {}
+
+extern "C" bool soft_serial_transaction(int sstd_index) {
+    if (timer_read32() < link_resumes) {
+        return false;
+    }
+
+    split_transaction_desc_t *trans = &split_transaction_table[sstd_index];
+    memcpy((uint8_t *)&slave_memory + trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size);
+    if (trans->slave_callback) {
+        run_as_slave(slave_callback, trans);
+    }
+    memcpy(split_trans_target2initiator_buffer(trans), (uint8_t *)&slave_memory + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    return true;
+}
+
+extern "C" void matrix_scan_kb(void) {
+    run_as_slave(slave_scan, NULL);
+
+    matrix_row_t master_rows[SLAVE_ROWS];
+    matrix_row_t received[SLAVE_ROWS] = {0};
+    for (uint8_t row = 0; row < SLAVE_ROWS; row++) {
+        master_rows[row] = matrix_get_row(row);
+    }
+    if (!transactions_master(master_rows, received)) {
+        return;
+    }
+    for (uint8_t row = 0; row < SLAVE_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (received[row] & ((matrix_row_t)1 << col)) {
+                press_key(col, SLAVE_ROWS + row);
+            } else {
+                release_key(col, SLAVE_ROWS + row);
+            }
+        }
+    }
+}
+
+void split_loopback_reset(void) {
+    memset(slave_keys, 0, sizeof(slave_keys));
+    link_resumes = 0;
+}
+
+void slave_key_press(const KeymapKey& key) {
+    slave_keys[key.position.row - SLAVE_ROWS] |= (matrix_row_t)1 << key.position.col;
+}
+
+void slave_key_release(const KeymapKey& key) {
+    slave_keys[key.position.row - SLAVE_ROWS] &= ~((matrix_row_t)1 << key.position.col);
+}
+
+void split_link_delay(uint16_t ms) {
+    link_resumes = timer_read32() + ms;
+}
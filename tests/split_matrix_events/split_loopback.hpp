@@ -0,0 +1,15 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_keymap_key.hpp"
+
+// Both halves run in this process. The test matrix holds the master half and whatever the master has received for
+// the slave half, while keys on the slave half are pressed here, for the simulated slave to scan.
+void split_loopback_reset(void);
+void slave_key_press(const KeymapKey& key);
+void slave_key_release(const KeymapKey& key);
+
+// Every transaction fails for the given time, as if the link were busy
+void split_link_delay(uint16_t ms);
@@ -0,0 +1,146 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "split_loopback.hpp"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::InSequence;
+
+// Rows 0 and 1 are on the master half, rows 2 and 3 on the slave half
+class SplitMatrixEvents : public TestFixture {
+   protected:
+    void SetUp() override {
+        split_loopback_reset();
+    }
+};
+
+TEST_F(SplitMatrixEvents, SlaveKeyReachesHost) {
+    TestDriver driver;
+    KeymapKey  key = KeymapKey(0, 0, 2, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    slave_key_press(key);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slave_key_release(key);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitMatrixEvents, DelayedModTapPressKeepsSlaveTime) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap = KeymapKey(0, 0, 2, LSFT_T(KC_A));
+    set_keymap({mod_tap});
+
+    // Pressed for longer than the tapping term, but the press only reaches the master 50ms later
+    EXPECT_NO_REPORT(driver);
+    slave_key_press(mod_tap);
+    split_link_delay(50);
+    idle_for(100);
+    VERIFY_AND_CLEAR(driver);
+
+    // Timed from when the slave scanned the press, this is a hold
+    EXPECT_REPORT(driver, (KC_LSFT));
+    idle_for(TAPPING_TERM - 100 + 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    slave_key_release(mod_tap);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitMatrixEvents, TapWithinLatencyIsNotLost) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap = KeymapKey(0, 0, 2, LSFT_T(KC_A));
+    set_keymap({mod_tap});
+
+    // Press and release both arrive with the same transfer
+    EXPECT_NO_REPORT(driver);
+    split_link_delay(60);
+    slave_key_press(mod_tap);
+    idle_for(30);
+    slave_key_release(mod_tap);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitMatrixEvents, ModTapHeldAcrossHalves) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  mod_tap    = KeymapKey(0, 0, 2, LSFT_T(KC_A));
+    KeymapKey  master_key = KeymapKey(0, 0, 0, KC_B);
+    set_keymap({mod_tap, master_key});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    slave_key_press(mod_tap);
+    split_link_delay(50);
+    idle_for(TAPPING_TERM + 10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_LSFT, KC_B));
+    EXPECT_REPORT(driver, (KC_LSFT));
+    tap_key(master_key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slave_key_release(mod_tap);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(SplitMatrixEvents, MissedEventsResyncFromMatrix) {
+    TestDriver driver;
+    InSequence s;
+    KeymapKey  key_a = KeymapKey(0, 0, 3, KC_A);
+    KeymapKey  key_b = KeymapKey(0, 1, 3, KC_B);
+    KeymapKey  key_c = KeymapKey(0, 2, 3, KC_C);
+    KeymapKey  key_d = KeymapKey(0, 3, 3, KC_D);
+    KeymapKey  key_e = KeymapKey(0, 4, 3, KC_E);
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+
+    // More changes than the slave can hold on to while the link is down
+    EXPECT_NO_REPORT(driver);
+    split_link_delay(20);
+    for (auto& key : {key_a, key_b, key_c, key_d, key_e}) {
+        slave_key_press(key);
+        run_one_scan_loop();
+    }
+    idle_for(10);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_B));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_A, KC_B, KC_C, KC_D, KC_E));
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_C, KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_D, KC_E));
+    EXPECT_REPORT(driver, (KC_E));
+    EXPECT_EMPTY_REPORT(driver);
+    for (auto& key : {key_a, key_b, key_c, key_d, key_e}) {
+        slave_key_release(key);
+    }
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
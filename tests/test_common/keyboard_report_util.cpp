@@ -27,9 +27,7 @@ namespace {
 
 std::vector<uint8_t> get_keys(const report_keyboard_t& report) {
     std::vector<uint8_t> result;
-#if defined(NKRO_ENABLE)
-#    error NKRO support not implemented yet
-#elif defined(RING_BUFFERED_6KRO_REPORT_ENABLE)
+#if defined(RING_BUFFERED_6KRO_REPORT_ENABLE)
 #    error 6KRO support not implemented yet
 #else
     for (size_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
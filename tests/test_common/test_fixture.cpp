@@ -100,6 +100,7 @@ void TestFixture::add_key(KeymapKey key) {
     }
 
     this->keymap.push_back(key);
+    layer_switch_cache_invalidate();
 }
 
 void TestFixture::tap_key(KeymapKey key, unsigned delay_ms) {